@@ -70,6 +70,11 @@ NS_ASSUME_NONNULL_BEGIN
 
 + (void)removeCognitoIdentityUserPoolForKey:(NSString *)key;
 
+/**
+ Keeps `count` SRP ephemeral key pairs precomputed on a low priority background queue, so that starting a password or device sign in does not have to wait for the modular exponentiation. Pairs are used once and refilled as they are consumed. Pass 0 (the default) to disable the pool.
+ */
++ (void)setPrecomputedSrpKeyPairCount:(NSUInteger)count;
+
 /**
  Sign up a new user
  */
@@ -19,10 +19,11 @@
 #import "AWSCognitoIdentityUser_Internal.h"
 #import "AWSCognitoIdentityUserPool_Internal.h"
 #import "AWSUICKeyChainStore.h"
-#import <CommonCrypto/CommonHMAC.h>
+#import "aws_sha256.h"
 #import "NSData+AWSCognitoIdentityProvider.h"
 #import "AWSCognitoIdentityProviderModel.h"
 #import "AWSCognitoIdentityProviderASF.h"
+#import "AWSCognitoIdentityProviderSrpHelper.h"
 
 static const NSString * AWSCognitoIdentityUserPoolCurrentUser = @"currentUser";
 
@@ -138,6 +139,10 @@ static NSString *const AWSPinpointContextKeychainUniqueIdKey = @"com.amazonaws.A
     [_serviceClients removeObjectForKey:key];
 }
 
++ (void)setPrecomputedSrpKeyPairCount:(NSUInteger)count {
+    [AWSCognitoIdentityProviderSrpKeyPairPool sharedPool].capacity = count;
+}
+
 - (instancetype)init {
     @throw [NSException exceptionWithName:NSInternalInconsistencyException
                                    reason:@"`- init` is not a valid initializer. Use `+ defaultCognitoIdentityProvider` or `+ CognitoIdentityProviderForKey:` instead."
@@ -303,12 +308,12 @@ static NSString *const AWSPinpointContextKeychainUniqueIdKey = @"com.amazonaws.A
     const char *cKey  = [self.userPoolConfiguration.clientSecret cStringUsingEncoding:NSASCIIStringEncoding];
     const char *cData = [[userName stringByAppendingString:self.userPoolConfiguration.clientId] cStringUsingEncoding:NSUTF8StringEncoding];
 
-    unsigned char cHMAC[CC_SHA256_DIGEST_LENGTH];
+    unsigned char cHMAC[AWS_SHA256_DIGEST_LENGTH];
 
-    CCHmac(kCCHmacAlgSHA256, cKey, strlen(cKey), cData, strlen(cData), cHMAC);
+    aws_hmac_sha256(cKey, strlen(cKey), cData, strlen(cData), cHMAC);
 
     NSData *HMAC = [[NSData alloc] initWithBytes:cHMAC
-                                          length:CC_SHA256_DIGEST_LENGTH];
+                                          length:AWS_SHA256_DIGEST_LENGTH];
 
     return [HMAC base64EncodedStringWithOptions:kNilOptions];
 }
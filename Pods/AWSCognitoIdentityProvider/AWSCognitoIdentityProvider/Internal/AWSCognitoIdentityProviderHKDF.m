@@ -17,9 +17,7 @@
 
 #import "AWSCognitoIdentityProviderHKDF.h"
 
-#import <CommonCrypto/CommonCrypto.h>
-#import <CommonCrypto/CommonKeyDerivation.h>
-#import <CommonCrypto/CommonDigest.h>
+#import "aws_sha256.h"
 
 
 @interface AWSCognitoIdentityProviderHKDF ()
@@ -36,34 +34,33 @@
 }
 
 + (NSData*)extractWithInputKeyingMaterial:(NSData*)ikm salt:(NSData*)salt {
-    uint8_t output[CC_SHA256_DIGEST_LENGTH] = {0};
+    uint8_t output[AWS_SHA256_DIGEST_LENGTH] = {0};
     
-    CCHmac(kCCHmacAlgSHA256,
-           [salt bytes], [salt length],
-           [ikm bytes], [ikm length],
-           output);
+    aws_hmac_sha256([salt bytes], [salt length],
+                    [ikm bytes], [ikm length],
+                    output);
     
-    return [NSData dataWithBytes:output length:CC_SHA256_DIGEST_LENGTH];
+    return [NSData dataWithBytes:output length:AWS_SHA256_DIGEST_LENGTH];
 }
 
 NSData* calculateT(NSData *prk, NSData *previousT, NSData *info, uint8_t i) {
-    CCHmacContext ctx;
-    CCHmacInit(&ctx, kCCHmacAlgSHA256, [prk bytes], [prk length]);
-    CCHmacUpdate(&ctx, [previousT bytes], [previousT length]);
+    aws_hmac_sha256_ctx ctx;
+    aws_hmac_sha256_init(&ctx, [prk bytes], [prk length]);
+    aws_hmac_sha256_update(&ctx, [previousT bytes], [previousT length]);
     if (info != nil) {
-        CCHmacUpdate(&ctx, [info bytes], [info length]);
+        aws_hmac_sha256_update(&ctx, [info bytes], [info length]);
     }
-    CCHmacUpdate(&ctx, &i, sizeof(uint8_t));
+    aws_hmac_sha256_update(&ctx, &i, sizeof(uint8_t));
     
-    uint8_t output[CC_SHA256_DIGEST_LENGTH];
-    CCHmacFinal(&ctx, output);
+    uint8_t output[AWS_SHA256_DIGEST_LENGTH];
+    aws_hmac_sha256_final(&ctx, output);
     
     return [NSData dataWithBytes:output length:sizeof(output)];
 }
 
 + (NSData*)expand:(NSData*)prk info:(NSData*)info outputLength:(NSUInteger)outputLength {
     
-    NSUInteger n = (NSUInteger)ceil((double)outputLength / CC_SHA256_DIGEST_LENGTH);
+    NSUInteger n = (NSUInteger)ceil((double)outputLength / AWS_SHA256_DIGEST_LENGTH);
     NSMutableData *outputKeyMaterial = [NSMutableData data];
     
     NSData *previousT = [NSData data];
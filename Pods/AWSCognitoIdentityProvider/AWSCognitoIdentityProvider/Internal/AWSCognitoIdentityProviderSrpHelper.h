@@ -27,6 +27,12 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g;
 - (instancetype)initN:(AWSJKBigInteger *)N g:(AWSJKBigInteger *)g k:(AWSJKBigInteger *)k;
 - (AWSJKBigInteger*)calculateK:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g;
+/* base^exponent mod N, using the Montgomery context cached for N */
+- (AWSJKBigInteger*)modPow:(AWSJKBigInteger*)base exponent:(AWSJKBigInteger*)exponent;
+/* g^exponent mod N, using the shared fixed-base table for the default group */
+- (AWSJKBigInteger*)gPow:(AWSJKBigInteger*)exponent;
+/* S = (B - k*g^x)^(a + u*x) mod N, computed without intermediate objects */
+- (AWSJKBigInteger*)calculateSWithPublicB:(AWSJKBigInteger*)B privateA:(AWSJKBigInteger*)a x:(AWSJKBigInteger*)x u:(AWSJKBigInteger*)u;
 
 @property(nonatomic, retain) AWSJKBigInteger *N;
 @property(nonatomic, retain) AWSJKBigInteger *g;
@@ -69,6 +75,19 @@ NS_ASSUME_NONNULL_BEGIN
 @property(nonatomic, strong) NSData *serviceSecretBlock;
 @end
 
+/* Ephemeral (a, A) pairs for the default group, precomputed on a background queue */
+@interface AWSCognitoIdentityProviderSrpKeyPairPool : NSObject
+
++ (instancetype)sharedPool;
+
+/* Number of pairs kept ready; 0 (the default) disables the pool and drops any held pairs */
+@property(nonatomic) NSUInteger capacity;
+
+/* Removes one pair from the pool and schedules a refill; returns NO when the pool is empty */
+- (BOOL)takePrivateA:(AWSJKBigInteger * _Nullable * _Nonnull)privateA publicA:(AWSJKBigInteger * _Nullable * _Nonnull)publicA;
+
+@end
+
 @interface AWSCognitoIdentityProviderSrpHelper : NSObject
 
 @property(nonatomic, strong) AWSCognitoIdentityProviderSrpCommonState *commonState;
@@ -93,6 +112,13 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype)initWithClientState:(AWSCognitoIdentityProviderSrpClientState *)clientState;
 - (instancetype)initWithPoolName:(NSString *)poolName userName:(NSString *)userName password:(NSString *)password;
 
+/* Salts and verifiers for many users of one pool, spread over all cores with a single shared group.
+   Helpers come back in the order of userNames, each as from initWithPoolName:userName:password:;
+   returns nil when the two arrays differ in length */
++ (nullable NSArray<AWSCognitoIdentityProviderSrpHelper *> *)helpersWithPoolName:(NSString *)poolName
+                                                                      userNames:(NSArray<NSString *> *)userNames
+                                                                      passwords:(NSArray<NSString *> *)passwords;
+
 - (NSData*)completeAuthentication:(AWSCognitoIdentityProviderSrpServerState*)serverState;
 
 - (AWSJKBigInteger*)calculateS:(AWSCognitoIdentityProviderSrpServerState*)serverState;
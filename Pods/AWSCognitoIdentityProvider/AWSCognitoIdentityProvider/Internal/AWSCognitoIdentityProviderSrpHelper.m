@@ -19,29 +19,129 @@
 #import "AWSCognitoIdentityProviderHKDF.h"
 #import "AWSJKBigInteger.h"
 #import "AWSCocoaLumberjack.h"
-#import <CommonCrypto/CommonCrypto.h>
-#import <CommonCrypto/CommonKeyDerivation.h>
-#import <CommonCrypto/CommonDigest.h>
+#import "aws_sha256.h"
 #import <errno.h>
 
 #import "NSData+AWSCognitoIdentityProvider.h"
 
-void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize);
-void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize);
-AWSJKBigInteger* finalizeUnsignedBigIntHash(CC_SHA256_CTX *ctx);
-AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx);
+void updateHashWithUnsignedBigInt(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt);
+void updateHashWithSignedBigInt(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt);
+void updateHashWithBigIntData(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt);
+AWSJKBigInteger* finalizeUnsignedBigIntHash(aws_sha256_ctx *ctx);
+AWSJKBigInteger* finalizeSignedBigIntHash(aws_sha256_ctx *ctx);
 
 static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F24117C4B1FE649286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF06F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64ECFB850458DBEF0A8AEA71575D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D120A93AD2CAFFFFFFFFFFFFFFFF";
 
+// Montgomery context for N_IN_HEX, set up once per process and shared read-only by every common state
+static aws_mp_mont_ctx *defaultMontgomeryContext(void) {
+    static aws_mp_mont_ctx context;
+    static aws_mp_mont_ctx *sharedContext = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        aws_mp_int N;
+        aws_mp_init(&N);
+        if (aws_mp_read_radix(&N, N_IN_HEX.UTF8String, 16) == AWS_MP_OKAY
+            && aws_mp_mont_ctx_init(&context, &N) == AWS_MP_OKAY) {
+            sharedContext = &context;
+        }
+        aws_mp_clear(&N);
+    });
+    return sharedContext;
+}
+
+// Private A and x are at most 256 bits wide, so a 256-bit comb over g covers every fixed-base exponentiation
+static const int AWSCognitoIdentityProviderSrpCombBits = 256;
+static const int AWSCognitoIdentityProviderSrpCombTeeth = 8;
+
+// Fixed-base comb table for g = 2 over the default group, built on first use and shared read-only
+static aws_mp_comb *defaultGeneratorComb(void) {
+    static aws_mp_comb comb;
+    static aws_mp_comb *sharedComb = NULL;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        aws_mp_mont_ctx *context = defaultMontgomeryContext();
+        if (context == NULL) {
+            return;
+        }
+        aws_mp_int g;
+        aws_mp_init_set(&g, 2);
+        if (aws_mp_comb_init(&comb, &g, AWSCognitoIdentityProviderSrpCombBits, AWSCognitoIdentityProviderSrpCombTeeth, context) == AWS_MP_OKAY) {
+            sharedComb = &comb;
+        }
+        aws_mp_clear(&g);
+    });
+    return sharedComb;
+}
+
+// S = (B - k*g^x)^(a + u*x) mod N straight on the digits, given g^x. With a Montgomery
+// context every reduction goes through it; otherwise N is used with the generic routines.
+static int calculateSecret(aws_mp_int *S, aws_mp_int *B, aws_mp_int *k, aws_mp_int *gx,
+                           aws_mp_int *a, aws_mp_int *u, aws_mp_int *x,
+                           aws_mp_int *N, aws_mp_mont_ctx *context) {
+    aws_mp_int base, exponent;
+    int result = aws_mp_init_multi(&base, &exponent, NULL);
+    if (result != AWS_MP_OKAY) {
+        return result;
+    }
+
+    // base = B - (k*g^x mod N); a B already in [0, N) needs at most one correction
+    result = context != NULL ? aws_mp_mulmod_ctx(k, gx, context, &base) : aws_mp_mulmod(k, gx, N, &base);
+    if (result == AWS_MP_OKAY) {
+        result = aws_mp_sub(B, &base, &base);
+    }
+    if (result == AWS_MP_OKAY && base.sign == AWS_MP_NEG) {
+        result = aws_mp_add(&base, N, &base);
+    }
+    if (result == AWS_MP_OKAY && (base.sign == AWS_MP_NEG || aws_mp_cmp(&base, N) != AWS_MP_LT)) {
+        result = aws_mp_mod(&base, N, &base);
+    }
+
+    // exponent = a + u*x
+    if (result == AWS_MP_OKAY) {
+        result = aws_mp_mul(u, x, &exponent);
+    }
+    if (result == AWS_MP_OKAY) {
+        result = aws_mp_add(&exponent, a, &exponent);
+    }
+
+    if (result == AWS_MP_OKAY) {
+        result = context != NULL ? aws_mp_exptmod_ctx(&base, &exponent, context, S) : aws_mp_exptmod(&base, &exponent, N, S);
+    }
+
+    aws_mp_clear_multi(&base, &exponent, NULL);
+    return result;
+}
+
+@interface AWSCognitoIdentityProviderSrpCommonState ()
+- (BOOL)usesDefaultGroup;
+- (aws_mp_mont_ctx *)currentMontgomeryContext;
+- (int)gPow:(aws_mp_int *)exponent result:(aws_mp_int *)result;
+@end
+
 #pragma mark - Srp State
-@implementation AWSCognitoIdentityProviderSrpCommonState
+@implementation AWSCognitoIdentityProviderSrpCommonState {
+    aws_mp_mont_ctx *_montgomeryContext;
+    BOOL _ownsMontgomeryContext;
+}
+
 - (instancetype)init {
     if (self = [super init]) {
-            self.N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
-                                               andRadix:16];
-
-            self.g = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
-            self.k = [self calculateK:self.N g:self.g];
+            // the default group is parsed and hashed once, then shared read-only by every common state
+            static AWSJKBigInteger *defaultN = nil;
+            static AWSJKBigInteger *defaultG = nil;
+            static AWSJKBigInteger *defaultK = nil;
+            static dispatch_once_t onceToken;
+            dispatch_once(&onceToken, ^{
+                defaultN = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
+                                                          andRadix:16];
+                defaultG = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
+                defaultK = [self calculateK:defaultN g:defaultG];
+            });
+
+            self.N = defaultN;
+            self.g = defaultG;
+            self.k = defaultK;
+            _montgomeryContext = defaultMontgomeryContext();
     }
     return self;
 }
@@ -51,6 +151,7 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
         self.N = N;
         self.g = g;
         self.k = k;
+        [self setUpMontgomeryContext];
     }
     return self;
 }
@@ -60,28 +161,109 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
         self.N = N;
         self.g = g;
         self.k = [self calculateK:self.N g:self.g];
+        [self setUpMontgomeryContext];
     }
     return self;
 }
 
-- (AWSJKBigInteger*)calculateK:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g {
+- (void)setUpMontgomeryContext {
+    aws_mp_mont_ctx *sharedContext = defaultMontgomeryContext();
+    if (sharedContext != NULL && aws_mp_cmp([self.N value], &sharedContext->N) == AWS_MP_EQ) {
+        _montgomeryContext = sharedContext;
+        return;
+    }
 
-    // + 1 to allow for a sign byte
-    unsigned int maxNumBytes = [N countBytes] + 1;
+    // a custom group gets its own context; even moduli are left to the generic exptmod
+    aws_mp_mont_ctx *context = malloc(sizeof(aws_mp_mont_ctx));
+    if (context != NULL && aws_mp_mont_ctx_init(context, [self.N value]) == AWS_MP_OKAY) {
+        _montgomeryContext = context;
+        _ownsMontgomeryContext = YES;
+    } else {
+        free(context);
+    }
+}
 
-    uint8_t *bytes = malloc(sizeof(uint8_t) * maxNumBytes);
-    if (bytes == NULL) {
-        // this situation is irrecoverable and we don't want to return something corrupted, so we raise an exception (avoiding NSAssert that may be disabled)
-        [NSException raise:@"NSInternalInconsistencyException" format:@"failed malloc" arguments:nil];
+- (void)dealloc {
+    if (_ownsMontgomeryContext) {
+        aws_mp_mont_ctx_clear(_montgomeryContext);
+        free(_montgomeryContext);
+    }
+}
+
+// N is a writable property, only trust the context while it still matches
+- (aws_mp_mont_ctx *)currentMontgomeryContext {
+    if (_montgomeryContext != NULL && aws_mp_cmp([self.N value], &_montgomeryContext->N) == AWS_MP_EQ) {
+        return _montgomeryContext;
+    }
+    return NULL;
+}
+
+- (AWSJKBigInteger*)modPow:(AWSJKBigInteger*)base exponent:(AWSJKBigInteger*)exponent {
+    aws_mp_mont_ctx *context = [self currentMontgomeryContext];
+    if (context != NULL) {
+        return [base pow:exponent andMontgomeryContext:context];
+    }
+    return [base pow:exponent andMod:self.N];
+}
+
+- (BOOL)usesDefaultGroup {
+    aws_mp_comb *comb = defaultGeneratorComb();
+    return comb != NULL
+        && aws_mp_cmp([self.N value], &comb->ctx->N) == AWS_MP_EQ
+        && aws_mp_cmp([self.g value], &comb->G) == AWS_MP_EQ;
+}
+
+- (int)gPow:(aws_mp_int *)exponent result:(aws_mp_int *)result {
+    aws_mp_comb *comb = _montgomeryContext == defaultMontgomeryContext() ? defaultGeneratorComb() : NULL;
+    if (comb == NULL
+        || aws_mp_cmp([self.N value], &comb->ctx->N) != AWS_MP_EQ
+        || aws_mp_cmp([self.g value], &comb->G) != AWS_MP_EQ) {
+        aws_mp_mont_ctx *context = [self currentMontgomeryContext];
+        if (context != NULL) {
+            return aws_mp_exptmod_ctx([self.g value], exponent, context, result);
+        }
+        return aws_mp_exptmod([self.g value], exponent, [self.N value], result);
+    }
+    return aws_mp_exptmod_comb(exponent, comb, result);
+}
+
+- (AWSJKBigInteger*)gPow:(AWSJKBigInteger*)exponent {
+    aws_mp_int power;
+    aws_mp_init(&power);
+    if ([self gPow:[exponent value] result:&power] != AWS_MP_OKAY) {
+        aws_mp_clear(&power);
         return nil;
     }
 
-    CC_SHA256_CTX ctx;
-    CC_SHA256_Init(&ctx);
-    updateHashWithSignedBigInt(&ctx, N, bytes, maxNumBytes);
-    updateHashWithUnsignedBigInt(&ctx, g, bytes, maxNumBytes);
+    AWSJKBigInteger *result = [[AWSJKBigInteger alloc] initWithValue:&power];
+    aws_mp_clear(&power);
+
+    return result;
+}
+
+- (AWSJKBigInteger*)calculateSWithPublicB:(AWSJKBigInteger*)B privateA:(AWSJKBigInteger*)a x:(AWSJKBigInteger*)x u:(AWSJKBigInteger*)u {
+    aws_mp_int gx, S;
+    if (aws_mp_init_multi(&gx, &S, NULL) != AWS_MP_OKAY) {
+        return nil;
+    }
+
+    AWSJKBigInteger *result = nil;
+    if ([self gPow:[x value] result:&gx] == AWS_MP_OKAY
+        && calculateSecret(&S, [B value], [self.k value], &gx, [a value], [u value], [x value],
+                           [self.N value], [self currentMontgomeryContext]) == AWS_MP_OKAY) {
+        result = [[AWSJKBigInteger alloc] initWithValue:&S];
+    }
+
+    aws_mp_clear_multi(&gx, &S, NULL);
+    return result;
+}
+
+- (AWSJKBigInteger*)calculateK:(AWSJKBigInteger*)N g:(AWSJKBigInteger*)g {
 
-    free(bytes);
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
+    updateHashWithSignedBigInt(&ctx, N);
+    updateHashWithUnsignedBigInt(&ctx, g);
 
     return finalizeUnsignedBigIntHash(&ctx);
 }
@@ -97,13 +279,15 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     me.userName = userName;
     me.password = password;
 
-    me.privateA = [AWSCognitoIdentityProviderSrpHelper
-            generatePrivateABigInt:commonState.N];
-
-    me.publicA = [AWSCognitoIdentityProviderSrpHelper
-            generatePublicABigInt:me.privateA
-                                N:commonState.N
-                                g:commonState.g];
+    AWSJKBigInteger *privateA = nil;
+    AWSJKBigInteger *publicA = nil;
+    if (![commonState usesDefaultGroup]
+        || ![[AWSCognitoIdentityProviderSrpKeyPairPool sharedPool] takePrivateA:&privateA publicA:&publicA]) {
+        privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:commonState.N];
+        publicA = [commonState gPow:privateA];
+    }
+    me.privateA = privateA;
+    me.publicA = publicA;
 
     me.timestamp = [NSDate date];
     return me;
@@ -145,8 +329,98 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 @end
 
+#pragma mark - Srp Key Pair Pool
+
+@implementation AWSCognitoIdentityProviderSrpKeyPairPool {
+    NSMutableArray<NSArray<AWSJKBigInteger *> *> *_keyPairs;
+    NSUInteger _capacity;
+    NSUInteger _pendingCount;
+    dispatch_queue_t _queue;
+    AWSCognitoIdentityProviderSrpCommonState *_commonState;
+}
+
++ (instancetype)sharedPool {
+    static AWSCognitoIdentityProviderSrpKeyPairPool *_sharedPool = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        _sharedPool = [AWSCognitoIdentityProviderSrpKeyPairPool new];
+    });
+    return _sharedPool;
+}
+
+- (instancetype)init {
+    if (self = [super init]) {
+        _keyPairs = [NSMutableArray new];
+        _queue = dispatch_queue_create("com.amazonaws.AWSCognitoIdentityProviderSrpKeyPairPool",
+                                       dispatch_queue_attr_make_with_qos_class(DISPATCH_QUEUE_SERIAL, QOS_CLASS_BACKGROUND, 0));
+    }
+    return self;
+}
+
+- (NSUInteger)capacity {
+    @synchronized(self) {
+        return _capacity;
+    }
+}
+
+- (void)setCapacity:(NSUInteger)capacity {
+    @synchronized(self) {
+        _capacity = capacity;
+        if (_keyPairs.count > capacity) {
+            [_keyPairs removeObjectsInRange:NSMakeRange(capacity, _keyPairs.count - capacity)];
+        }
+        [self refill];
+    }
+}
+
+- (BOOL)takePrivateA:(AWSJKBigInteger **)privateA publicA:(AWSJKBigInteger **)publicA {
+    @synchronized(self) {
+        NSArray<AWSJKBigInteger *> *keyPair = [_keyPairs lastObject];
+        if (keyPair == nil) {
+            [self refill];
+            return NO;
+        }
+        // a pair is handed out exactly once
+        [_keyPairs removeLastObject];
+        *privateA = keyPair[0];
+        *publicA = keyPair[1];
+        [self refill];
+        return YES;
+    }
+}
+
+// must be called while synchronized on self
+- (void)refill {
+    while (_keyPairs.count + _pendingCount < _capacity) {
+        _pendingCount++;
+        dispatch_async(_queue, ^{
+            if (self->_commonState == nil) {
+                self->_commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
+            }
+            AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:self->_commonState.N];
+            AWSJKBigInteger *publicA = [self->_commonState gPow:privateA];
+
+            @synchronized(self) {
+                self->_pendingCount--;
+                if (privateA != nil && publicA != nil && self->_keyPairs.count < self->_capacity) {
+                    [self->_keyPairs addObject:@[privateA, publicA]];
+                }
+            }
+        });
+    }
+}
+
+@end
+
 #pragma mark - Srp Helper
 
+@interface AWSCognitoIdentityProviderSrpHelper ()
+- (instancetype)initWithPoolName:(NSString *)poolName
+                        userName:(NSString *)userName
+                        password:(NSString *)password
+                     commonState:(AWSCognitoIdentityProviderSrpCommonState *)commonState;
+@end
+
 @implementation AWSCognitoIdentityProviderSrpHelper {
 }
 
@@ -166,8 +440,12 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     if (self = [super init]) {
         self.commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
 
-        AWSJKBigInteger *privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:self.commonState.N];
-        AWSJKBigInteger *publicA = [AWSCognitoIdentityProviderSrpHelper generatePublicABigInt:privateA N:self.commonState.N g:self.commonState.g];
+        AWSJKBigInteger *privateA = nil;
+        AWSJKBigInteger *publicA = nil;
+        if (![[AWSCognitoIdentityProviderSrpKeyPairPool sharedPool] takePrivateA:&privateA publicA:&publicA]) {
+            privateA = [AWSCognitoIdentityProviderSrpHelper generatePrivateABigInt:self.commonState.N];
+            publicA = [self.commonState gPow:privateA];
+        }
 
         self.clientState = [AWSCognitoIdentityProviderSrpClientState
                 clientStateForUserName:userName password:password privateA:privateA publicA:publicA];
@@ -184,6 +462,16 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 
 - (instancetype)initWithPoolName:(NSString *)poolName userName:(NSString *)userName password:(NSString *)password {
+    return [self initWithPoolName:poolName
+                         userName:userName
+                         password:password
+                      commonState:[[AWSCognitoIdentityProviderSrpCommonState alloc] init]];
+}
+
+- (instancetype)initWithPoolName:(NSString *)poolName
+                        userName:(NSString *)userName
+                        password:(NSString *)password
+                     commonState:(AWSCognitoIdentityProviderSrpCommonState *)commonState {
     if (self = [super init]) {
         self.salt = [AWSCognitoIdentityProviderSrpHelper generateRandomUnsignedBigInt:128];
  
@@ -193,16 +481,43 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
                               password:password
                               salt:self.salt];
 
-        AWSJKBigInteger *N = [[AWSJKBigInteger alloc] initWithString:N_IN_HEX
-                                       andRadix:16];
-        AWSJKBigInteger *g = [[AWSJKBigInteger alloc] initWithUnsignedLong:2l];
+        self.commonState = commonState;
         
         //calculate v
-        self.v = [g pow:x andMod:N];
+        self.v = [self.commonState gPow:x];
     }
     return self;
 }
 
++ (NSArray<AWSCognitoIdentityProviderSrpHelper *> *)helpersWithPoolName:(NSString *)poolName
+                                                             userNames:(NSArray<NSString *> *)userNames
+                                                             passwords:(NSArray<NSString *> *)passwords {
+    if (userNames.count != passwords.count) {
+        return nil;
+    }
+
+    // one common state for the whole batch; it is only read while the verifiers are computed
+    AWSCognitoIdentityProviderSrpCommonState *commonState = [[AWSCognitoIdentityProviderSrpCommonState alloc] init];
+
+    NSUInteger count = userNames.count;
+    NSMutableArray<AWSCognitoIdentityProviderSrpHelper *> *helpers = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [helpers addObject:(AWSCognitoIdentityProviderSrpHelper *)[NSNull null]];
+    }
+
+    dispatch_apply(count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+        AWSCognitoIdentityProviderSrpHelper *helper = [[AWSCognitoIdentityProviderSrpHelper alloc] initWithPoolName:poolName
+                                                                                                          userName:userNames[i]
+                                                                                                          password:passwords[i]
+                                                                                                       commonState:commonState];
+        @synchronized(helpers) {
+            helpers[i] = helper;
+        }
+    });
+
+    return helpers;
+}
+
 // Step 2
 #pragma mark - Compute
 - (NSData*)completeAuthentication:(AWSCognitoIdentityProviderSrpServerState*)serverState {
@@ -242,15 +557,15 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 - (NSData*) generateUserAuthenticationSignature {
 
     NSString *dateStr = [AWSCognitoIdentityProviderSrpHelper generateDateString:self.clientState.timestamp];
-    NSMutableData *hashOutput = [NSMutableData dataWithLength:CC_SHA256_DIGEST_LENGTH];
+    NSMutableData *hashOutput = [NSMutableData dataWithLength:AWS_SHA256_DIGEST_LENGTH];
 
-    CCHmacContext ctx;
-    CCHmacInit(&ctx, kCCHmacAlgSHA256, self.authenticationKey.bytes, self.authenticationKey.length);
-    CCHmacUpdate(&ctx, self.serverState.poolName.UTF8String, (CC_LONG)[self.serverState.poolName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CCHmacUpdate(&ctx, self.clientState.userName.UTF8String, (CC_LONG)[self.clientState.userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CCHmacUpdate(&ctx, self.serverState.serviceSecretBlock.bytes, self.serverState.serviceSecretBlock.length);
-    CCHmacUpdate(&ctx, dateStr.UTF8String, (CC_LONG)[dateStr lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CCHmacFinal(&ctx, hashOutput.mutableBytes);
+    aws_hmac_sha256_ctx ctx;
+    aws_hmac_sha256_init(&ctx, self.authenticationKey.bytes, self.authenticationKey.length);
+    aws_hmac_sha256_update(&ctx, self.serverState.poolName.UTF8String, [self.serverState.poolName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_hmac_sha256_update(&ctx, self.clientState.userName.UTF8String, [self.clientState.userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_hmac_sha256_update(&ctx, self.serverState.serviceSecretBlock.bytes, self.serverState.serviceSecretBlock.length);
+    aws_hmac_sha256_update(&ctx, dateStr.UTF8String, [dateStr lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_hmac_sha256_final(&ctx, hashOutput.mutableBytes);
 
     return [NSData dataWithData:hashOutput];
 }
@@ -279,21 +594,7 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
     
     self.u = [AWSCognitoIdentityProviderSrpHelper hashBigInts:@[self.clientState.publicA, B]];
 
-    AWSJKBigInteger *k = self.commonState.k;
-    AWSJKBigInteger *g = self.commonState.g;
-    AWSJKBigInteger *N = self.commonState.N;
-
-    AWSJKBigInteger *a = self.clientState.privateA;
-    AWSJKBigInteger *exp = [a add:[self.u multiply:self.x]];
-    AWSJKBigInteger *base = [B subtract:[k multiply:[g pow:self.x andMod:N]]];
-
-    //Need this for negative base #s
-    base = [AWSCognitoIdentityProviderSrpHelper mod:base divisor:N];
-
-    AWSJKBigInteger *S = [base pow:exp andMod:N];
-    S = [AWSCognitoIdentityProviderSrpHelper mod:S divisor:N];
-    
-    return S;
+    return [self.commonState calculateSWithPublicB:B privateA:self.clientState.privateA x:self.x u:self.u];
 }
 
 + (NSString *)generateDateString:(NSDate *)date {
@@ -316,63 +617,64 @@ static NSString* N_IN_HEX = @"FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129
 }
 
 + (AWSJKBigInteger*) mod:(AWSJKBigInteger*)dividend divisor:(AWSJKBigInteger*) divisor {
-    return [[divisor add:[dividend remainder:divisor]] remainder:divisor];
+    AWSJKMutableBigInteger *result = [[AWSJKMutableBigInteger alloc] initWithValue:[dividend value]];
+    return [result reduceModulo:divisor] ? result : nil;
 }
 
 #pragma mark - Hashing
 
 + (AWSJKBigInteger*) hashSignedBigInts:(NSArray*)bigInts {
-    CC_SHA256_CTX ctx;
-    CC_SHA256_Init(&ctx);
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
     
     for (AWSJKBigInteger *i in bigInts) {
-        NSData *data = [NSData aws_dataWithSignedBigInteger:i];
-        CC_SHA256_Update(&ctx, data.bytes, (CC_LONG)data.length);        
+        updateHashWithBigIntData(&ctx, i);
     }
     
     return finalizeSignedBigIntHash(&ctx);
 }
 
-void updateHashWithUnsignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize) {
-    unsigned int byteCount = [bigInt countBytes];
-    uint8_t *targetBuffer = buffer;
-    
-    if (byteCount <= bufferSize) {
-        targetBuffer = malloc(sizeof(uint8_t) * byteCount);
-    }
-    
-    [bigInt toByteArrayUnsigned:targetBuffer];
-    CC_SHA256_Update(ctx, targetBuffer, byteCount);
-    
-    if (targetBuffer != buffer) {
-        free(targetBuffer);
-    }
+static int updateHashWithBytes(const unsigned char *bytes, int length, void *ctx) {
+    aws_sha256_update((aws_sha256_ctx *)ctx, bytes, length);
+    return length;
 }
 
-void updateHashWithSignedBigInt(CC_SHA256_CTX *ctx, AWSJKBigInteger *bigInt, uint8_t *buffer, size_t bufferSize) {
-    // + 1 to allow for a sign byte TODO: add a function to JKBigInteger to provide a countBytesForSigned
-    unsigned int byteCount = [bigInt countBytes] + 1;
-    uint8_t *targetBuffer = buffer;
+// the magnitude in big endian, streamed straight from the digits
+void updateHashWithUnsignedBigInt(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt) {
+    aws_mp_to_unsigned_bin_stream([bigInt value], updateHashWithBytes, ctx);
+}
 
-    if (byteCount <= bufferSize) {
-        targetBuffer = malloc(sizeof(uint8_t) * byteCount);
-    }
+// the layout of toByteArraySigned: a sign byte, then the magnitude
+void updateHashWithSignedBigInt(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt) {
+    const uint8_t sign = [bigInt value]->sign == AWS_MP_NEG ? 1 : 0;
+    aws_sha256_update(ctx, &sign, sizeof(sign));
+    aws_mp_to_unsigned_bin_stream([bigInt value], updateHashWithBytes, ctx);
+}
 
-    [bigInt toByteArraySigned:targetBuffer];
-    CC_SHA256_Update(ctx, targetBuffer, byteCount);
+// the bytes of [NSData aws_dataWithSignedBigInteger:], without building them for non-negative values
+void updateHashWithBigIntData(aws_sha256_ctx *ctx, AWSJKBigInteger *bigInt) {
+    aws_mp_int *value = [bigInt value];
+    if (value->sign == AWS_MP_NEG) {
+        NSData *data = [NSData aws_dataWithSignedBigInteger:bigInt];
+        aws_sha256_update(ctx, data.bytes, data.length);
+        return;
+    }
 
-    if (targetBuffer != buffer) {
-        free(targetBuffer);
+    // a zero byte keeps a multi-byte magnitude with its top bit set from reading as negative
+    if (aws_mp_unsigned_bin_size(value) > 1 && aws_mp_count_bits(value) % 8 == 0) {
+        const uint8_t zero = 0;
+        aws_sha256_update(ctx, &zero, sizeof(zero));
     }
+    aws_mp_to_unsigned_bin_stream(value, updateHashWithBytes, ctx);
 }
 
-AWSJKBigInteger* finalizeUnsignedBigIntHash(CC_SHA256_CTX *ctx) {
-    uint8_t hash[CC_SHA256_DIGEST_LENGTH];
-    CC_SHA256_Final(hash, ctx);
+AWSJKBigInteger* finalizeUnsignedBigIntHash(aws_sha256_ctx *ctx) {
+    uint8_t hash[AWS_SHA256_DIGEST_LENGTH];
+    aws_sha256_final(ctx, hash);
 
     aws_mp_int hashBigInt;
     aws_mp_init(&hashBigInt);
-    aws_mp_read_unsigned_bin(&hashBigInt, hash, CC_SHA256_DIGEST_LENGTH);
+    aws_mp_read_unsigned_bin(&hashBigInt, hash, AWS_SHA256_DIGEST_LENGTH);
 
     AWSJKBigInteger *result = [[AWSJKBigInteger alloc] initWithValue:&hashBigInt];
     aws_mp_clear(&hashBigInt);
@@ -380,11 +682,11 @@ AWSJKBigInteger* finalizeUnsignedBigIntHash(CC_SHA256_CTX *ctx) {
     return result;
 }
 
-AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
-    int bufferLength = CC_SHA256_DIGEST_LENGTH+1;
+AWSJKBigInteger* finalizeSignedBigIntHash(aws_sha256_ctx *ctx) {
+    int bufferLength = AWS_SHA256_DIGEST_LENGTH+1;
     uint8_t hash[bufferLength];
-    // hash goes in [1..CC_SHA256_DIGEST_LENGTH; keep hash[0] for the sign byte required by AWSJKBigInteger
-    CC_SHA256_Final(hash+1, ctx);
+    // hash goes in [1..AWS_SHA256_DIGEST_LENGTH; keep hash[0] for the sign byte required by AWSJKBigInteger
+    aws_sha256_final(ctx, hash+1);
     
     AWSJKBigInteger *twosComplementMinusOneMaybe = nil;
     hash[0] = (hash[1] & 0x80) == 0x80;
@@ -413,58 +715,54 @@ AWSJKBigInteger* finalizeSignedBigIntHash(CC_SHA256_CTX *ctx) {
 }
 
 + (NSData*)calculateXHash:(NSString*)userPool userName:(NSString*)userName password:(NSString*)password salt:(AWSJKBigInteger*)salt {
-    uint8_t identityHash[CC_SHA256_DIGEST_LENGTH];
+    uint8_t identityHash[AWS_SHA256_DIGEST_LENGTH];
     
-    CC_SHA256_CTX identityHashCtx;
-    CC_SHA256_Init(&identityHashCtx);
-    CC_SHA256_Update(&identityHashCtx, [userPool UTF8String], (CC_LONG)[userPool lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CC_SHA256_Update(&identityHashCtx, [userName UTF8String], (CC_LONG)[userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_ctx identityHashCtx;
+    aws_sha256_init(&identityHashCtx);
+    aws_sha256_update(&identityHashCtx, [userPool UTF8String], [userPool lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_update(&identityHashCtx, [userName UTF8String], [userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
     const uint8_t delim = ':';
-    CC_SHA256_Update(&identityHashCtx, &delim, sizeof(delim));
-    CC_SHA256_Update(&identityHashCtx, [password UTF8String], (CC_LONG)[password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CC_SHA256_Final(identityHash, &identityHashCtx);
-    
-    NSData *saltData = [NSData aws_dataWithSignedBigInteger:salt];
+    aws_sha256_update(&identityHashCtx, &delim, sizeof(delim));
+    aws_sha256_update(&identityHashCtx, [password UTF8String], [password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_final(&identityHashCtx, identityHash);
     
-    uint8_t finalHash[CC_SHA256_DIGEST_LENGTH];
-    CC_SHA256_CTX ctx;
-    CC_SHA256_Init(&ctx);
-    CC_SHA256_Update(&ctx, saltData.bytes, (CC_LONG)saltData.length);
-    CC_SHA256_Update(&ctx, identityHash, sizeof(identityHash));
-    CC_SHA256_Final(finalHash, &ctx);
-    return [NSData dataWithBytes:finalHash length:CC_SHA256_DIGEST_LENGTH];
+    uint8_t finalHash[AWS_SHA256_DIGEST_LENGTH];
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
+    updateHashWithBigIntData(&ctx, salt);
+    aws_sha256_update(&ctx, identityHash, sizeof(identityHash));
+    aws_sha256_final(&ctx, finalHash);
+    return [NSData dataWithBytes:finalHash length:AWS_SHA256_DIGEST_LENGTH];
 }
 
 + (AWSJKBigInteger*) calculateX:(NSString*)userPool userName:(NSString*)userName password:(NSString*)password salt:(AWSJKBigInteger*)salt {
     
-    uint8_t identityHash[CC_SHA256_DIGEST_LENGTH];
+    uint8_t identityHash[AWS_SHA256_DIGEST_LENGTH];
     
-    CC_SHA256_CTX identityHashCtx;
-    CC_SHA256_Init(&identityHashCtx);
-    CC_SHA256_Update(&identityHashCtx, userPool.UTF8String, (CC_LONG)[userPool lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CC_SHA256_Update(&identityHashCtx, userName.UTF8String, (CC_LONG)[userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_ctx identityHashCtx;
+    aws_sha256_init(&identityHashCtx);
+    aws_sha256_update(&identityHashCtx, userPool.UTF8String, [userPool lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_update(&identityHashCtx, userName.UTF8String, [userName lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
     const uint8_t delim = ':';
-    CC_SHA256_Update(&identityHashCtx, &delim, sizeof(delim));
-    CC_SHA256_Update(&identityHashCtx, password.UTF8String, (CC_LONG)[password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
-    CC_SHA256_Final(identityHash, &identityHashCtx);
+    aws_sha256_update(&identityHashCtx, &delim, sizeof(delim));
+    aws_sha256_update(&identityHashCtx, password.UTF8String, [password lengthOfBytesUsingEncoding:NSUTF8StringEncoding]);
+    aws_sha256_final(&identityHashCtx, identityHash);
     
-    NSData *saltData = [NSData aws_dataWithSignedBigInteger:salt];
-    CC_SHA256_CTX ctx;
-    CC_SHA256_Init(&ctx);
-    CC_SHA256_Update(&ctx, saltData.bytes, (CC_LONG)saltData.length);
-    CC_SHA256_Update(&ctx, identityHash, sizeof(identityHash));
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
+    updateHashWithBigIntData(&ctx, salt);
+    aws_sha256_update(&ctx, identityHash, sizeof(identityHash));
     
 
     return finalizeUnsignedBigIntHash(&ctx);
 }
 
 + (AWSJKBigInteger*) hashBigInts:(NSArray*)bigInts {
-    CC_SHA256_CTX ctx;
-    CC_SHA256_Init(&ctx);
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
     
     for (AWSJKBigInteger *i in bigInts) {
-        NSData *data = [NSData aws_dataWithSignedBigInteger:i];
-        CC_SHA256_Update(&ctx, data.bytes, (CC_LONG)data.length);
+        updateHashWithBigIntData(&ctx, i);
     }
     
     return finalizeUnsignedBigIntHash(&ctx);
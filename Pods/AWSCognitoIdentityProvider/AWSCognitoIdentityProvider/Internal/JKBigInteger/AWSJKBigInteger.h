@@ -30,6 +30,7 @@
 
 - (id)pow:(unsigned int)exponent;
 - (id)pow:(AWSJKBigInteger*)exponent andMod:(AWSJKBigInteger*)modulus;
+- (id)pow:(AWSJKBigInteger*)exponent andMontgomeryContext:(aws_mp_mont_ctx *)context;
 - (id)negate;
 - (id)abs;
 
@@ -54,3 +55,20 @@
 - (void)toByteArrayUnsigned: (unsigned char*) byteArray;
 
 @end
+
+/* An AWSJKBigInteger whose value is updated in place, for chains of operations that
+   would otherwise allocate a new object and copy the digits at every step */
+@interface AWSJKMutableBigInteger : AWSJKBigInteger
+
+- (BOOL)setBigInteger:(AWSJKBigInteger *)bigInteger;
+
+- (BOOL)addBigInteger:(AWSJKBigInteger *)bigInteger;
+- (BOOL)subtractBigInteger:(AWSJKBigInteger *)bigInteger;
+- (BOOL)multiplyByBigInteger:(AWSJKBigInteger *)bigInteger;
+
+/* Leaves the value in [0, modulus) for a positive modulus */
+- (BOOL)reduceModulo:(AWSJKBigInteger *)modulus;
+- (BOOL)powBigInteger:(AWSJKBigInteger *)exponent modulo:(AWSJKBigInteger *)modulus;
+- (BOOL)powBigInteger:(AWSJKBigInteger *)exponent montgomeryContext:(aws_mp_mont_ctx *)context;
+
+@end
@@ -244,6 +244,24 @@
     return newBigInteger;
 }
 
+- (id)pow:(AWSJKBigInteger*)exponent andMontgomeryContext:(aws_mp_mont_ctx *)context {
+
+    int result;
+    aws_mp_int output;
+    aws_mp_init(&output);
+    
+    result = aws_mp_exptmod_ctx(&m_value, &exponent->m_value, context, &output);
+    if (result != AWS_MP_OKAY) {
+        aws_mp_clear(&output);
+        return nil;
+    }
+    
+    AWSJKBigInteger *newBigInteger = [[AWSJKBigInteger alloc] initWithValue:&output];
+    aws_mp_clear(&output);
+    
+    return newBigInteger;
+}
+
 - (id)negate {
 
     aws_mp_int negate;
@@ -410,3 +428,35 @@
 }
 
 @end
+
+@implementation AWSJKMutableBigInteger
+
+- (BOOL)setBigInteger:(AWSJKBigInteger *)bigInteger {
+    return aws_mp_copy([bigInteger value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)addBigInteger:(AWSJKBigInteger *)bigInteger {
+    return aws_mp_add([self value], [bigInteger value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)subtractBigInteger:(AWSJKBigInteger *)bigInteger {
+    return aws_mp_sub([self value], [bigInteger value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)multiplyByBigInteger:(AWSJKBigInteger *)bigInteger {
+    return aws_mp_mul([self value], [bigInteger value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)reduceModulo:(AWSJKBigInteger *)modulus {
+    return aws_mp_mod([self value], [modulus value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)powBigInteger:(AWSJKBigInteger *)exponent modulo:(AWSJKBigInteger *)modulus {
+    return aws_mp_exptmod([self value], [exponent value], [modulus value], [self value]) == AWS_MP_OKAY;
+}
+
+- (BOOL)powBigInteger:(AWSJKBigInteger *)exponent montgomeryContext:(aws_mp_mont_ctx *)context {
+    return aws_mp_exptmod_ctx([self value], [exponent value], context, [self value]) == AWS_MP_OKAY;
+}
+
+@end
@@ -160,6 +160,12 @@ extern int AWS_KARATSUBA_MUL_CUTOFF,
         AWS_TOOM_MUL_CUTOFF,
         AWS_TOOM_SQR_CUTOFF;
 
+/* a set of the above */
+typedef struct {
+    int karatsuba_mul, karatsuba_sqr,
+        toom_mul,      toom_sqr;
+} aws_mp_cutoffs;
+
 /* define this to use lower memory usage routines (exptmods mostly) */
 /* #define AWS_MP_LOW_MEM */
 
@@ -184,6 +190,9 @@ typedef struct  {
 /* callback for mp_prime_random, should fill dst with random bytes and return how many read [upto len] */
 typedef int aws_ltm_prime_callback(unsigned char *dst, int len, void *dat);
 
+/* callback for mp_to_unsigned_bin_stream, should take the len bytes in src and return how many it took */
+typedef int aws_ltm_stream_callback(const unsigned char *src, int len, void *dat);
+
 
 #define AWS_JKTM_USED(m)    ((m)->used)
 #define AWS_JKTM_DIGIT(m,k) ((m)->dp[(k)])
@@ -217,6 +226,32 @@ int aws_mp_grow(aws_mp_int *a, int size);
 /* init to a given number of digits */
 int aws_mp_init_size(aws_mp_int *a, int size);
 
+/* ---> multiplication cutoffs <--- */
+
+/* read the cutoffs currently in use */
+void aws_mp_cutoffs_get(aws_mp_cutoffs *c);
+
+/* replace the cutoffs in use */
+void aws_mp_cutoffs_set(const aws_mp_cutoffs *c);
+
+/* ---> digit array recycling <--- */
+
+/* heap traffic for digit arrays on one thread */
+typedef struct {
+    unsigned long heap_allocs;   /* arrays taken from the heap */
+    unsigned long heap_frees;    /* arrays returned to the heap */
+    unsigned long scratch_hits;  /* arrays served from the thread's free lists */
+} aws_mp_heap_stats;
+
+/* counters of the calling thread */
+void aws_mp_heap_stats_get(aws_mp_heap_stats *stats);
+
+/* zero the counters of the calling thread */
+void aws_mp_heap_stats_reset(void);
+
+/* free the digit arrays cached by the calling thread */
+void aws_mp_scratch_release(void);
+
 /* ---> Basic Manipulations <--- */
 #define aws_mp_iszero(a) (((a)->used == 0) ? AWS_MP_YES : AWS_MP_NO)
 #define aws_mp_iseven(a) (((a)->used > 0 && (((a)->dp[0] & 1) == 0)) ? AWS_MP_YES : AWS_MP_NO)
@@ -443,6 +478,52 @@ int aws_mp_reduce_2k_l(aws_mp_int *a, aws_mp_int *n, aws_mp_int *d);
 /* d = a**b (mod c) */
 int aws_mp_exptmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, aws_mp_int *d);
 
+/* ---> Montgomery contexts <--- */
+
+/* precomputed reduction state for a fixed odd modulus, read-only once setup */
+typedef struct {
+    aws_mp_int N;        /* the modulus */
+    aws_mp_int RR;       /* R**2 mod N */
+    aws_mp_int one;      /* R mod N, i.e. 1 in Montgomery form */
+    aws_mp_digit rho;    /* -1/N mod B */
+    int (*redux)(aws_mp_int *, aws_mp_int *, aws_mp_digit);
+} aws_mp_mont_ctx;
+
+/* setup a Montgomery context for the odd modulus N */
+int aws_mp_mont_ctx_init(aws_mp_mont_ctx *ctx, aws_mp_int *N);
+
+/* free a Montgomery context */
+void aws_mp_mont_ctx_clear(aws_mp_mont_ctx *ctx);
+
+/* d = a**b (mod ctx->N) */
+int aws_mp_exptmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx, aws_mp_int *d);
+
+/* c = a*b (mod ctx->N) */
+int aws_mp_mulmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx, aws_mp_int *c);
+
+/* Y[i] = G[i]**X[i] (mod ctx->N) for i < count, several at a time where the CPU allows */
+int aws_mp_exptmod_batch(aws_mp_int *G, aws_mp_int *X, int count, aws_mp_mont_ctx *ctx, aws_mp_int *Y);
+
+/* number of exponentiations aws_mp_exptmod_batch runs side by side on this CPU */
+int aws_mp_exptmod_batch_lanes(void);
+
+/* fixed-base comb table for G over a Montgomery context, read-only once setup */
+typedef struct {
+    aws_mp_mont_ctx *ctx;  /* context of the modulus, not owned */
+    aws_mp_int G;          /* the base */
+    aws_mp_int *T;         /* 2**teeth table entries in Montgomery form */
+    int teeth, span;       /* rows of the comb and bits per row */
+} aws_mp_comb;
+
+/* build a comb table for G covering exponents of up to "bits" bits */
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *G, int bits, int teeth, aws_mp_mont_ctx *ctx);
+
+/* free a comb table */
+void aws_mp_comb_clear(aws_mp_comb *comb);
+
+/* c = G**a (mod ctx->N) with G, ctx taken from the comb table */
+int aws_mp_exptmod_comb(aws_mp_int *a, aws_mp_comb *comb, aws_mp_int *c);
+
 /* ---> Primes <--- */
 
 /* number of primes */
@@ -524,6 +605,13 @@ int aws_mp_read_unsigned_bin(aws_mp_int *a, const unsigned char *b, int c);
 int aws_mp_to_unsigned_bin(aws_mp_int *a, unsigned char *b);
 int aws_mp_to_unsigned_bin_n(aws_mp_int *a, unsigned char *b, unsigned long *outlen);
 
+/* bytes handed to a stream callback at a time */
+#ifndef AWS_MP_STREAM_CHUNK
+   #define AWS_MP_STREAM_CHUNK 64
+#endif
+
+int aws_mp_to_unsigned_bin_stream(aws_mp_int *a, aws_ltm_stream_callback cb, void *dat);
+
 int aws_mp_signed_bin_size(aws_mp_int *a);
 int aws_mp_read_signed_bin(aws_mp_int *a, const unsigned char *b, int c);
 int aws_mp_to_signed_bin(aws_mp_int *a, unsigned char *b);
@@ -558,6 +646,10 @@ int aws_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs);
 int aws_fast_s_mp_mul_high_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs);
 int aws_s_mp_mul_high_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs);
 int aws_fast_s_mp_sqr(aws_mp_int *a, aws_mp_int *b);
+typedef void (*aws_mp_comba_mul_kernel)(aws_mp_digit *W, const aws_mp_digit *a, int na, const aws_mp_digit *b, int nb, int pa);
+typedef void (*aws_mp_comba_sqr_kernel)(aws_mp_digit *W, const aws_mp_digit *a, int na);
+aws_mp_comba_mul_kernel aws_mp_comba_mul_kernel_get(int generic);
+aws_mp_comba_sqr_kernel aws_mp_comba_sqr_kernel_get(int generic);
 int aws_s_mp_sqr(aws_mp_int *a, aws_mp_int *b);
 int aws_mp_karatsuba_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
 int aws_mp_toom_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c);
@@ -569,6 +661,15 @@ int aws_fast_mp_montgomery_reduce(aws_mp_int *a, aws_mp_int *m, aws_mp_digit mp)
 int aws_mp_exptmod_fast(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int mode);
 int aws_s_mp_exptmod(aws_mp_int *G, aws_mp_int *X, aws_mp_int *P, aws_mp_int *Y, int mode);
 void aws_bn_reverse(unsigned char *s, int len);
+int aws_s_mp_radix_value(int ch, int radix);
+int aws_s_mp_radix_log2(int radix);
+int aws_s_mp_read_radix_pow2(aws_mp_int *a, const char *str, int len, int radix, int bits);
+int aws_s_mp_read_radix_dec(aws_mp_int *a, const char *str, int len);
+int aws_s_mp_toradix_pow2(aws_mp_int *a, char *str, int bits);
+int aws_s_mp_toradix_dec(aws_mp_int *a, char *str, int *len);
+int aws_s_mp_radix_size_dec(aws_mp_int *a, int *size);
+aws_mp_digit *aws_s_mp_digits_get(int *size);
+void aws_s_mp_digits_put(aws_mp_digit *dp, int alloc);
 
 extern const char *aws_mp_s_rmap;
 
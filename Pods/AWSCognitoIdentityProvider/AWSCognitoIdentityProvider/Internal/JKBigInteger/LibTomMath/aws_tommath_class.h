@@ -11,6 +11,7 @@
 #define AWS_BN_ERROR_C
 #define AWS_BN_FAST_MP_INVMOD_C
 #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+#define AWS_BN_FAST_S_MP_COMBA_C
 #define AWS_BN_FAST_S_MP_MUL_DIGS_C
 #define AWS_BN_FAST_S_MP_MUL_HIGH_DIGS_C
 #define AWS_BN_FAST_S_MP_SQR_C
@@ -27,8 +28,10 @@
 #define AWS_BN_MP_CMP_D_C
 #define AWS_BN_MP_CMP_MAG_C
 #define AWS_BN_MP_CNT_LSB_C
+#define AWS_BN_MP_COMB_INIT_C
 #define AWS_BN_MP_COPY_C
 #define AWS_BN_MP_COUNT_BITS_C
+#define AWS_BN_MP_CUTOFFS_C
 #define AWS_BN_MP_DIV_C
 #define AWS_BN_MP_DIV_2_C
 #define AWS_BN_MP_DIV_2D_C
@@ -40,7 +43,10 @@
 #define AWS_BN_MP_EXCH_C
 #define AWS_BN_MP_EXPT_D_C
 #define AWS_BN_MP_EXPTMOD_C
+#define AWS_BN_MP_EXPTMOD_BATCH_C
+#define AWS_BN_MP_EXPTMOD_COMB_C
 #define AWS_BN_MP_EXPTMOD_FAST_C
+#define AWS_BN_MP_EXPTMOD_CTX_C
 #define AWS_BN_MP_EXTEUCLID_C
 #define AWS_BN_MP_FREAD_C
 #define AWS_BN_MP_FWRITE_C
@@ -67,11 +73,13 @@
 #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
 #define AWS_BN_MP_MONTGOMERY_REDUCE_C
 #define AWS_BN_MP_MONTGOMERY_SETUP_C
+#define AWS_BN_MP_MONT_CTX_INIT_C
 #define AWS_BN_MP_MUL_C
 #define AWS_BN_MP_MUL_2_C
 #define AWS_BN_MP_MUL_2D_C
 #define AWS_BN_MP_MUL_D_C
 #define AWS_BN_MP_MULMOD_C
+#define AWS_BN_MP_MULMOD_CTX_C
 #define AWS_BN_MP_N_ROOT_C
 #define AWS_BN_MP_NEG_C
 #define AWS_BN_MP_OR_C
@@ -98,6 +106,7 @@
 #define AWS_BN_MP_REDUCE_SETUP_C
 #define AWS_BN_MP_RSHD_C
 #define AWS_BN_MP_SET_C
+#define AWS_BN_MP_SCRATCH_C
 #define AWS_BN_MP_SET_INT_C
 #define AWS_BN_MP_SHRINK_C
 #define AWS_BN_MP_SIGNED_BIN_SIZE_C
@@ -111,6 +120,7 @@
 #define AWS_BN_MP_TO_SIGNED_BIN_N_C
 #define AWS_BN_MP_TO_UNSIGNED_BIN_C
 #define AWS_BN_MP_TO_UNSIGNED_BIN_N_C
+#define AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C
 #define AWS_BN_MP_TOOM_MUL_C
 #define AWS_BN_MP_TOOM_SQR_C
 #define AWS_BN_MP_TORADIX_C
@@ -124,6 +134,7 @@
 #define AWS_BN_S_MP_EXPTMOD_C
 #define AWS_BN_S_MP_MUL_DIGS_C
 #define AWS_BN_S_MP_MUL_HIGH_DIGS_C
+#define AWS_BN_S_MP_RADIX_C
 #define AWS_BN_S_MP_SQR_C
 #define AWS_BN_S_MP_SUB_C
 #define AWS_BNCORE_C
@@ -158,7 +169,11 @@
    #define AWS_BN_S_MP_SUB_C
 #endif
 
+#if defined(AWS_BN_FAST_S_MP_COMBA_C)
+#endif
+
 #if defined(AWS_BN_FAST_S_MP_MUL_DIGS_C)
+   #define AWS_BN_FAST_S_MP_COMBA_C
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_CLAMP_C
 #endif
@@ -169,6 +184,7 @@
 #endif
 
 #if defined(AWS_BN_FAST_S_MP_SQR_C)
+   #define AWS_BN_FAST_S_MP_COMBA_C
    #define AWS_BN_MP_GROW_C
    #define AWS_BN_MP_CLAMP_C
 #endif
@@ -212,6 +228,7 @@
 #endif
 
 #if defined(AWS_BN_MP_CLEAR_C)
+   #define AWS_BN_MP_SCRATCH_C
 #endif
 
 #if defined(AWS_BN_MP_CLEAR_MULTI_C)
@@ -228,6 +245,17 @@
 #if defined(AWS_BN_MP_CMP_MAG_C)
 #endif
 
+#if defined(AWS_BN_MP_COMB_INIT_C)
+   #define AWS_BN_MP_MONT_CTX_INIT_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_MUL_C
+#endif
+
 #if defined(AWS_BN_MP_CNT_LSB_C)
    #define AWS_BN_MP_ISZERO_C
 #endif
@@ -358,6 +386,46 @@
    #define AWS_BN_MP_EXCH_C
 #endif
 
+#if defined(AWS_BN_MP_EXPTMOD_COMB_C)
+   #define AWS_BN_MP_COMB_INIT_C
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_EXCH_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_BATCH_C)
+   #define AWS_BN_MP_EXPTMOD_CTX_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_2EXPT_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_ZERO_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_S_MP_SUB_C
+#endif
+
+#if defined(AWS_BN_MP_EXPTMOD_CTX_C)
+   #define AWS_BN_MP_MONT_CTX_INIT_C
+   #define AWS_BN_MP_EXPTMOD_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_MOD_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_EXCH_C
+#endif
+
 #if defined(AWS_BN_MP_EXTEUCLID_C)
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_SET_C
@@ -402,9 +470,11 @@
 #endif
 
 #if defined(AWS_BN_MP_GROW_C)
+   #define AWS_BN_MP_SCRATCH_C
 #endif
 
 #if defined(AWS_BN_MP_INIT_C)
+   #define AWS_BN_MP_SCRATCH_C
 #endif
 
 #if defined(AWS_BN_MP_INIT_COPY_C)
@@ -428,6 +498,7 @@
 #endif
 
 #if defined(AWS_BN_MP_INIT_SIZE_C)
+   #define AWS_BN_MP_SCRATCH_C
    #define AWS_BN_MP_INIT_C
 #endif
 
@@ -551,6 +622,18 @@
 #if defined(AWS_BN_MP_MONTGOMERY_SETUP_C)
 #endif
 
+#if defined(AWS_BN_MP_MONT_CTX_INIT_C)
+   #define AWS_BN_MP_INIT_MULTI_C
+   #define AWS_BN_MP_CLEAR_MULTI_C
+   #define AWS_BN_MP_CMP_D_C
+   #define AWS_BN_MP_COPY_C
+   #define AWS_BN_MP_MONTGOMERY_SETUP_C
+   #define AWS_BN_FAST_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_MONTGOMERY_REDUCE_C
+   #define AWS_BN_MP_MONTGOMERY_CALC_NORMALIZATION_C
+   #define AWS_BN_MP_SQRMOD_C
+#endif
+
 #if defined(AWS_BN_MP_MUL_C)
    #define AWS_BN_MP_TOOM_MUL_C
    #define AWS_BN_MP_KARATSUBA_MUL_C
@@ -582,6 +665,16 @@
    #define AWS_BN_MP_MOD_C
 #endif
 
+#if defined(AWS_BN_MP_MULMOD_CTX_C)
+   #define AWS_BN_MP_MONT_CTX_INIT_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_MULMOD_C
+   #define AWS_BN_MP_INIT_SIZE_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_EXCH_C
+   #define AWS_BN_MP_CLEAR_C
+#endif
+
 #if defined(AWS_BN_MP_N_ROOT_C)
    #define AWS_BN_MP_INIT_C
    #define AWS_BN_MP_SET_C
@@ -667,6 +760,7 @@
 #endif
 
 #if defined(AWS_BN_MP_RADIX_SIZE_C)
+   #define AWS_BN_S_MP_RADIX_C
    #define AWS_BN_MP_COUNT_BITS_C
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_ISZERO_C
@@ -685,6 +779,7 @@
 #endif
 
 #if defined(AWS_BN_MP_READ_RADIX_C)
+   #define AWS_BN_S_MP_RADIX_C
    #define AWS_BN_MP_ZERO_C
    #define AWS_BN_MP_S_RMAP_C
    #define AWS_BN_MP_RADIX_SMAP_C
@@ -778,6 +873,9 @@
    #define AWS_BN_MP_ZERO_C
 #endif
 
+#if defined(AWS_BN_MP_SCRATCH_C)
+#endif
+
 #if defined(AWS_BN_MP_SET_C)
    #define AWS_BN_MP_ZERO_C
 #endif
@@ -863,6 +961,10 @@
    #define AWS_BN_MP_TO_UNSIGNED_BIN_C
 #endif
 
+#if defined(AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C)
+   #define AWS_BN_MP_UNSIGNED_BIN_SIZE_C
+#endif
+
 #if defined(AWS_BN_MP_TOOM_MUL_C)
    #define AWS_BN_MP_INIT_MULTI_C
    #define AWS_BN_MP_MOD_2D_C
@@ -898,6 +1000,7 @@
 #endif
 
 #if defined(AWS_BN_MP_TORADIX_C)
+   #define AWS_BN_S_MP_RADIX_C
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_DIV_D_C
@@ -906,6 +1009,9 @@
 #endif
 
 #if defined(AWS_BN_MP_TORADIX_N_C)
+   #define AWS_BN_S_MP_RADIX_C
+   #define AWS_BN_MP_RADIX_SIZE_C
+   #define AWS_BN_MP_TORADIX_C
    #define AWS_BN_MP_ISZERO_C
    #define AWS_BN_MP_INIT_COPY_C
    #define AWS_BN_MP_DIV_D_C
@@ -970,6 +1076,30 @@
    #define AWS_BN_MP_CLEAR_C
 #endif
 
+#if defined(AWS_BN_S_MP_RADIX_C)
+   #define AWS_BN_MP_INIT_C
+   #define AWS_BN_MP_SET_C
+   #define AWS_BN_MP_SQR_C
+   #define AWS_BN_MP_CLEAR_C
+   #define AWS_BN_MP_ZERO_C
+   #define AWS_BN_MP_GROW_C
+   #define AWS_BN_MP_CLAMP_C
+   #define AWS_BN_MP_MUL_D_C
+   #define AWS_BN_MP_ADD_D_C
+   #define AWS_BN_MP_MUL_C
+   #define AWS_BN_MP_ADD_C
+   #define AWS_BN_MP_COUNT_BITS_C
+   #define AWS_BN_MP_RADIX_SMAP_C
+   #define AWS_BN_MP_DIV_D_C
+   #define AWS_BN_REVERSE_C
+   #define AWS_BN_MP_ISZERO_C
+   #define AWS_BN_MP_CMP_MAG_C
+   #define AWS_BN_MP_DIV_C
+   #define AWS_BN_MP_INIT_COPY_C
+   #define AWS_BN_MP_INIT_SET_C
+   #define AWS_BN_MP_EXPT_D_C
+#endif
+
 #if defined(AWS_BN_S_MP_SQR_C)
    #define AWS_BN_MP_INIT_SIZE_C
    #define AWS_BN_MP_CLAMP_C
@@ -203,28 +203,207 @@ int aws_mp_add(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
 
 #endif
 
+#ifdef AWS_BN_MP_SCRATCH_C
+
+/* per-thread recycling of digit arrays
+ *
+ * Freed digit arrays are kept on per-thread free lists, one list per
+ * multiple of AWS_MP_PREC digits, and handed back out by aws_mp_init,
+ * aws_mp_init_size and aws_mp_grow.  Once a thread has run an operation
+ * once, repeating it [e.g. another SRP login] is served entirely from
+ * these lists.  Each thread keeps at most AWS_MP_SCRATCH_BYTES cached
+ * and the lists are freed when the thread exits.
+ *
+ * Define AWS_MP_NO_SCRATCH to go straight to the heap every time.
+ */
+#ifndef AWS_MP_SCRATCH_CLASSES
+   #define AWS_MP_SCRATCH_CLASSES  16
+#endif
+#ifndef AWS_MP_SCRATCH_BYTES
+   #define AWS_MP_SCRATCH_BYTES    (512 * 1024)
+#endif
+
+#ifndef AWS_MP_NO_SCRATCH
+#include <pthread.h>
+
+typedef struct {
+   aws_mp_digit     *free[AWS_MP_SCRATCH_CLASSES + 1];
+   size_t            bytes;
+   aws_mp_heap_stats stats;
+} aws_s_mp_scratch;
+
+static pthread_key_t  aws_s_mp_scratch_key;
+static pthread_once_t aws_s_mp_scratch_once = PTHREAD_ONCE_INIT;
+static int            aws_s_mp_scratch_key_ok;
+
+static aws_mp_digit *aws_s_mp_scratch_next(aws_mp_digit *dp)
+{
+   aws_mp_digit *next;
+   memcpy(&next, dp, sizeof(next));
+   return next;
+}
+
+static void aws_s_mp_scratch_drain(aws_s_mp_scratch *s)
+{
+   aws_mp_digit *dp, *next;
+   int k;
+
+   for (k = 1; k <= AWS_MP_SCRATCH_CLASSES; k++) {
+      for (dp = s->free[k]; dp != NULL; dp = next) {
+         next = aws_s_mp_scratch_next(dp);
+         AWS_XFREE(dp);
+      }
+      s->free[k] = NULL;
+   }
+   s->bytes = 0;
+}
+
+static void aws_s_mp_scratch_destroy(void *p)
+{
+   aws_s_mp_scratch_drain((aws_s_mp_scratch *)p);
+   AWS_XFREE(p);
+}
+
+static void aws_s_mp_scratch_make_key(void)
+{
+   aws_s_mp_scratch_key_ok = (pthread_key_create(&aws_s_mp_scratch_key, aws_s_mp_scratch_destroy) == 0);
+}
+
+/* returns the calling thread's lists, NULL if they cannot be made */
+static aws_s_mp_scratch *aws_s_mp_scratch_get(void)
+{
+   aws_s_mp_scratch *s;
+
+   pthread_once(&aws_s_mp_scratch_once, aws_s_mp_scratch_make_key);
+   if (aws_s_mp_scratch_key_ok == 0) {
+      return NULL;
+   }
+
+   s = (aws_s_mp_scratch *)pthread_getspecific(aws_s_mp_scratch_key);
+   if (s == NULL) {
+      s = (aws_s_mp_scratch *)AWS_XCALLOC(1, sizeof(aws_s_mp_scratch));
+      if (s != NULL && pthread_setspecific(aws_s_mp_scratch_key, s) != 0) {
+         AWS_XFREE(s);
+         s = NULL;
+      }
+   }
+   return s;
+}
+#endif
+
+/* get an array of at least *size digits, *size is updated to its real length */
+aws_mp_digit *aws_s_mp_digits_get(int *size)
+{
+   aws_mp_digit *dp;
+   int k;
+
+   k = (*size + AWS_MP_PREC - 1) / AWS_MP_PREC;
+#ifndef AWS_MP_NO_SCRATCH
+   {
+      aws_s_mp_scratch *s = aws_s_mp_scratch_get();
+
+      if (s != NULL && k >= 1 && k <= AWS_MP_SCRATCH_CLASSES) {
+         *size = k * AWS_MP_PREC;
+         if (s->free[k] != NULL) {
+            dp         = s->free[k];
+            s->free[k] = aws_s_mp_scratch_next(dp);
+            s->bytes  -= sizeof(aws_mp_digit) * (size_t)*size;
+            s->stats.scratch_hits++;
+            return dp;
+         }
+      }
+      if (s != NULL) {
+         s->stats.heap_allocs++;
+      }
+   }
+#endif
+   return AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * *size);
+}
+
+/* give back an array of alloc digits from aws_s_mp_digits_get */
+void aws_s_mp_digits_put(aws_mp_digit *dp, int alloc)
+{
+#ifndef AWS_MP_NO_SCRATCH
+   aws_s_mp_scratch *s = aws_s_mp_scratch_get();
+   int k = alloc / AWS_MP_PREC;
+
+   if (s != NULL) {
+      if (k >= 1 && k <= AWS_MP_SCRATCH_CLASSES &&
+          s->bytes + sizeof(aws_mp_digit) * (size_t)(k * AWS_MP_PREC) <= AWS_MP_SCRATCH_BYTES) {
+         memcpy(dp, &s->free[k], sizeof(dp));
+         s->free[k] = dp;
+         s->bytes  += sizeof(aws_mp_digit) * (size_t)(k * AWS_MP_PREC);
+         return;
+      }
+      s->stats.heap_frees++;
+   }
+#else
+   (void)alloc;
+#endif
+   AWS_XFREE(dp);
+}
+
+/* heap traffic of the calling thread since it started or was last reset */
+void aws_mp_heap_stats_get(aws_mp_heap_stats *stats)
+{
+#ifndef AWS_MP_NO_SCRATCH
+   aws_s_mp_scratch *s = aws_s_mp_scratch_get();
+
+   if (s != NULL) {
+      *stats = s->stats;
+      return;
+   }
+#endif
+   memset(stats, 0, sizeof(*stats));
+}
+
+void aws_mp_heap_stats_reset(void)
+{
+#ifndef AWS_MP_NO_SCRATCH
+   aws_s_mp_scratch *s = aws_s_mp_scratch_get();
+
+   if (s != NULL) {
+      memset(&s->stats, 0, sizeof(s->stats));
+   }
+#endif
+}
+
+/* frees the arrays cached by the calling thread */
+void aws_mp_scratch_release(void)
+{
+#ifndef AWS_MP_NO_SCRATCH
+   aws_s_mp_scratch *s = aws_s_mp_scratch_get();
+
+   if (s != NULL) {
+      aws_s_mp_scratch_drain(s);
+   }
+#endif
+}
+#endif
+
 #ifdef AWS_BN_MP_INIT_C
 
 /* init a new mp_int */
 int aws_mp_init(aws_mp_int *a)
 {
-  int i;
+  int i, size;
 
   /* allocate memory required and clear it */
-  a->dp = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * AWS_MP_PREC);
+  size  = AWS_MP_PREC;
+  a->dp = aws_s_mp_digits_get(&size);
   if (a->dp == NULL) {
     return AWS_MP_MEM;
   }
 
   /* set the digits to zero */
-  for (i = 0; i < AWS_MP_PREC; i++) {
+  for (i = 0; i < size; i++) {
       a->dp[i] = 0;
   }
 
   /* set the used to zero, allocated digits to the default precision
    * and sign to positive */
   a->used  = 0;
-  a->alloc = AWS_MP_PREC;
+  a->alloc = size;
   a->sign  = AWS_MP_ZPOS;
 
   return AWS_MP_OKAY;
@@ -671,11 +850,53 @@ int aws_mp_reduce_is_2k(aws_mp_int *a)
  
 */
 
-int     AWS_KARATSUBA_MUL_CUTOFF = 80,      /* Min. number of digits before Karatsuba multiplication is used. */
-        AWS_KARATSUBA_SQR_CUTOFF = 120,     /* Min. number of digits before Karatsuba squaring is used. */
+/* The defaults below can be replaced at build time, either by defining the
+ * AWS_MP_*_CUTOFF macros directly or by pointing AWS_MP_CUTOFFS_HEADER at a
+ * header written by "mpbench tune" (sdk/bignum) on the target machine, e.g.
+ *
+ *    -DAWS_MP_CUTOFFS_HEADER='"aws_tommath_cutoffs.h"'
+ */
+#ifdef AWS_MP_CUTOFFS_HEADER
+   #include AWS_MP_CUTOFFS_HEADER
+#endif
+#ifndef AWS_MP_KARATSUBA_MUL_CUTOFF
+   #define AWS_MP_KARATSUBA_MUL_CUTOFF 80
+#endif
+#ifndef AWS_MP_KARATSUBA_SQR_CUTOFF
+   #define AWS_MP_KARATSUBA_SQR_CUTOFF 120
+#endif
+#ifndef AWS_MP_TOOM_MUL_CUTOFF
+   #define AWS_MP_TOOM_MUL_CUTOFF      350
+#endif
+#ifndef AWS_MP_TOOM_SQR_CUTOFF
+   #define AWS_MP_TOOM_SQR_CUTOFF      400
+#endif
+
+int     AWS_KARATSUBA_MUL_CUTOFF = AWS_MP_KARATSUBA_MUL_CUTOFF,  /* Min. number of digits before Karatsuba multiplication is used. */
+        AWS_KARATSUBA_SQR_CUTOFF = AWS_MP_KARATSUBA_SQR_CUTOFF,  /* Min. number of digits before Karatsuba squaring is used. */
         
-        AWS_TOOM_MUL_CUTOFF = 350,      /* no optimal values of these are known yet so set em high */
-        AWS_TOOM_SQR_CUTOFF = 400;
+        AWS_TOOM_MUL_CUTOFF = AWS_MP_TOOM_MUL_CUTOFF,      /* no optimal values of these are known yet so set em high */
+        AWS_TOOM_SQR_CUTOFF = AWS_MP_TOOM_SQR_CUTOFF;
+#endif
+
+#ifdef AWS_BN_MP_CUTOFFS_C
+/* read the multiplication cutoffs currently in use */
+void aws_mp_cutoffs_get(aws_mp_cutoffs *c)
+{
+   c->karatsuba_mul = AWS_KARATSUBA_MUL_CUTOFF;
+   c->karatsuba_sqr = AWS_KARATSUBA_SQR_CUTOFF;
+   c->toom_mul      = AWS_TOOM_MUL_CUTOFF;
+   c->toom_sqr      = AWS_TOOM_SQR_CUTOFF;
+}
+
+/* replace the multiplication cutoffs, not safe while other threads multiply */
+void aws_mp_cutoffs_set(const aws_mp_cutoffs *c)
+{
+   AWS_KARATSUBA_MUL_CUTOFF = c->karatsuba_mul;
+   AWS_KARATSUBA_SQR_CUTOFF = c->karatsuba_sqr;
+   AWS_TOOM_MUL_CUTOFF      = c->toom_mul;
+   AWS_TOOM_SQR_CUTOFF      = c->toom_sqr;
+}
 #endif
 
 #ifdef AWS_BN_MP_MOD_2D_C
@@ -1129,7 +1350,7 @@ void aws_mp_zero(aws_mp_int *a)
 /* stores a bignum as a ASCII string in a given radix (2..64) */
 int aws_mp_toradix(aws_mp_int *a, char *str, int radix)
 {
-  int     res, digs;
+  int     res, digs, bits;
   aws_mp_int t;
   aws_mp_digit d;
   char   *_s = str;
@@ -1157,6 +1378,17 @@ int aws_mp_toradix(aws_mp_int *a, char *str, int radix)
     t.sign = AWS_MP_ZPOS;
   }
 
+  /* power of two and decimal radices have faster paths */
+  if ((bits = aws_s_mp_radix_log2(radix)) != 0) {
+    aws_s_mp_toradix_pow2(&t, str, bits);
+    aws_mp_clear(&t);
+    return AWS_MP_OKAY;
+  } else if (radix == 10) {
+    res = aws_s_mp_toradix_dec(&t, str, &digs);
+    aws_mp_clear(&t);
+    return res;
+  }
+
   digs = 0;
   while (aws_mp_iszero (&t) == 0) {
     if ((res = aws_mp_div_d(&t, (aws_mp_digit) radix, &t, &d)) != AWS_MP_OKAY) {
@@ -1330,7 +1562,7 @@ int aws_mp_init_size(aws_mp_int *a, int size)
   size += (AWS_MP_PREC * 2) - (size % AWS_MP_PREC);
   
   /* alloc mem */
-  a->dp = AWS_OPT_CAST(aws_mp_digit) AWS_XMALLOC (sizeof (aws_mp_digit) * size);
+  a->dp = aws_s_mp_digits_get(&size);
   if (a->dp == NULL) {
     return AWS_MP_MEM;
   }
@@ -2535,7 +2767,7 @@ aws_mp_clear(&a1);
 /* returns size of ASCII reprensentation */
 int aws_mp_radix_size(aws_mp_int *a, int radix, int *size)
 {
-  int     res, digs;
+  int     res, digs, bits;
   aws_mp_int t;
   aws_mp_digit d;
 
@@ -2565,6 +2797,18 @@ int aws_mp_radix_size(aws_mp_int *a, int radix, int *size)
     ++digs;
   }
 
+  /* power of two and decimal radices are counted without dividing */
+  if ((bits = aws_s_mp_radix_log2(radix)) != 0) {
+    *size = digs + (aws_mp_count_bits(a) + bits - 1) / bits + 1;
+    return AWS_MP_OKAY;
+  } else if (radix == 10) {
+    if ((res = aws_s_mp_radix_size_dec(a, &bits)) != AWS_MP_OKAY) {
+      return res;
+    }
+    *size = digs + bits + 1;
+    return AWS_MP_OKAY;
+  }
+
   /* init a copy of the input */
   if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
     return res;
@@ -3343,19 +3587,23 @@ int aws_mp_grow(aws_mp_int *a, int size)
     /* ensure there are always at least AWS_MP_PREC digits extra on top */
     size += (AWS_MP_PREC * 2) - (size % AWS_MP_PREC);
 
-    /* reallocate the array a->dp
+    /* move to a larger array
      *
      * We store the return in a temporary variable
      * in case the operation failed we don't want
      * to overwrite the dp member of a.
      */
-    tmp = AWS_OPT_CAST(aws_mp_digit) AWS_XREALLOC (a->dp, sizeof (aws_mp_digit) * size);
+    tmp = aws_s_mp_digits_get(&size);
     if (tmp == NULL) {
-      /* reallocation failed but "a" is still valid [can be freed] */
+      /* allocation failed but "a" is still valid [can be freed] */
       return AWS_MP_MEM;
     }
 
-    /* reallocation succeeded so set a->dp */
+    /* copy the old digits over and give the old array back */
+    if (a->dp != NULL) {
+      memcpy(tmp, a->dp, sizeof (aws_mp_digit) * a->alloc);
+      aws_s_mp_digits_put(a->dp, a->alloc);
+    }
     a->dp = tmp;
 
     /* zero excess digits */
@@ -3515,7 +3763,7 @@ aws_mp_clear(aws_mp_int *a)
     }
 
     /* free ram */
-    AWS_XFREE(a->dp);
+    aws_s_mp_digits_put(a->dp, a->alloc);
 
     /* reset members to make debugging easier */
     a->dp    = NULL;
@@ -4592,642 +4840,2168 @@ aws_mp_clear(&M[1]);
 }
 #endif
 
-#ifdef AWS_BN_S_MP_ADD_C
+#ifdef AWS_BN_MP_MONT_CTX_INIT_C
 
-/* low level addition, based on HAC pp.594, Algorithm 14.7 */
-int
-aws_s_mp_add(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+/* setups a reusable Montgomery context for the odd modulus N
+ *
+ * Everything that aws_mp_exptmod_fast recomputes per call for a fixed
+ * modulus [rho, R mod N, R**2 mod N and the choice of reduction routine]
+ * is computed once here.  The context is read-only afterwards so it may be
+ * shared between threads.
+ */
+int aws_mp_mont_ctx_init(aws_mp_mont_ctx *ctx, aws_mp_int *N)
 {
-  aws_mp_int *x;
-  int     olduse, res, min, max;
+  int err;
 
-  /* find sizes, we let |a| <= |b| which means we have to sort
-   * them.  "x" will point to the input with the most digits
-   */
-  if (a->used > b->used) {
-    min = b->used;
-    max = a->used;
-    x = a;
-  } else {
-    min = a->used;
-    max = b->used;
-    x = b;
+  /* modulus must be positive and odd */
+  if (N->sign == AWS_MP_NEG || aws_mp_isodd(N) == AWS_MP_NO || aws_mp_cmp_d(N, 1) != AWS_MP_GT) {
+     return AWS_MP_VAL;
   }
 
-  /* init result */
-  if (c->alloc < max + 1) {
-    if ((res = aws_mp_grow(c, max + 1)) != AWS_MP_OKAY) {
-      return res;
-    }
+  if ((err = aws_mp_init_multi(&ctx->N, &ctx->RR, &ctx->one, NULL)) != AWS_MP_OKAY) {
+     return err;
   }
 
-  /* get old used digit count and set new one */
-  olduse = c->used;
-  c->used = max + 1;
-
-  {
-    register aws_mp_digit u, *tmpa, *tmpb, *tmpc;
-    register int i;
-
-    /* alias for digit pointers */
-
-    /* first input */
-    tmpa = a->dp;
-
-    /* second input */
-    tmpb = b->dp;
-
-    /* destination */
-    tmpc = c->dp;
-
-    /* zero the carry */
-    u = 0;
-    for (i = 0; i < min; i++) {
-      /* Compute the sum at one digit, T[i] = A[i] + B[i] + U */
-      *tmpc = *tmpa++ + *tmpb++ + u;
-
-      /* U = carry bit of T[i] */
-      u = *tmpc >> ((aws_mp_digit)AWS_DIGIT_BIT);
-
-      /* take away carry bit from T[i] */
-      *tmpc++ &= AWS_MP_MASK;
-    }
-
-    /* now copy higher words if any, that is in A+B 
-     * if A or B has more digits add those in 
-     */
-    if (min != max) {
-      for (; i < max; i++) {
-        /* T[i] = X[i] + U */
-        *tmpc = x->dp[i] + u;
+  if ((err = aws_mp_copy(N, &ctx->N)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
 
-        /* U = carry bit of T[i] */
-        u = *tmpc >> ((aws_mp_digit)AWS_DIGIT_BIT);
+  if ((err = aws_mp_montgomery_setup(&ctx->N, &ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
 
-        /* take away carry bit from T[i] */
-        *tmpc++ &= AWS_MP_MASK;
-      }
-    }
+  /* automatically pick the comba one if available */
+  if (((N->used * 2 + 1) < AWS_MP_WARRAY) &&
+       N->used < (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
+     ctx->redux = aws_fast_mp_montgomery_reduce;
+  } else {
+     ctx->redux = aws_mp_montgomery_reduce;
+  }
 
-    /* add carry */
-    *tmpc++ = u;
+  /* one = R mod N */
+  if ((err = aws_mp_montgomery_calc_normalization(&ctx->one, &ctx->N)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
 
-    /* clear digits above oldused */
-    for (i = c->used; i < olduse; i++) {
-      *tmpc++ = 0;
-    }
+  /* RR = R**2 mod N, lets us enter the Montgomery domain without a division */
+  if ((err = aws_mp_sqrmod(&ctx->one, &ctx->N, &ctx->RR)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
   }
 
-    aws_mp_clamp(c);
   return AWS_MP_OKAY;
+LBL_ERR:
+  aws_mp_clear_multi(&ctx->N, &ctx->RR, &ctx->one, NULL);
+  return err;
+}
+
+/* frees a context made with aws_mp_mont_ctx_init */
+void aws_mp_mont_ctx_clear(aws_mp_mont_ctx *ctx)
+{
+  aws_mp_clear_multi(&ctx->N, &ctx->RR, &ctx->one, NULL);
+  ctx->rho   = 0;
+  ctx->redux = NULL;
 }
 #endif
 
-#ifdef AWS_BN_MP_PRIME_FERMAT_C
+#ifdef AWS_BN_MP_EXPTMOD_CTX_C
 
-/* performs one Fermat test.
- * 
- * If "a" were prime then b**a == b (mod a) since the order of
- * the multiplicative sub-group would be phi(a) = a-1.  That means
- * it would be the same as b**(a mod (a-1)) == b**1 == b (mod a).
+/* computes Y == G**X mod N using a precomputed Montgomery context
  *
- * Sets result to 1 if the congruence holds, or zero otherwise.
+ * Same k-ary sliding window as aws_mp_exptmod_fast but the Montgomery
+ * setup comes from ctx and G is mapped to G*R mod N by a single
+ * Montgomery multiplication with R**2 instead of a mulmod.  The window
+ * table itself depends on G so it is still built per call, but each
+ * entry is sized up front so the squarings never have to grow it.
  */
-int aws_mp_prime_fermat(aws_mp_int *a, aws_mp_int *b, int *result)
-{
-  aws_mp_int t;
-  int     err;
 
-  /* default to composite  */
-  *result = AWS_MP_NO;
+#ifdef AWS_MP_LOW_MEM
+   #define TAB_SIZE 32
+#else
+   #define TAB_SIZE 256
+#endif
 
-  /* ensure b > 1 */
-  if (aws_mp_cmp_d(b, 1) != AWS_MP_GT) {
-     return AWS_MP_VAL;
-  }
+int aws_mp_exptmod_ctx(aws_mp_int *G, aws_mp_int *X, aws_mp_mont_ctx *ctx, aws_mp_int *Y)
+{
+  aws_mp_int M[TAB_SIZE], res;
+  aws_mp_int *P;
+  aws_mp_digit buf, mp;
+  int     err, bitbuf, bitcpy, bitcnt, mode, digidx, x, y, winsize, digs;
+  int     (*redux)(aws_mp_int *, aws_mp_int *,aws_mp_digit);
 
-  /* init t */
-  if ((err = aws_mp_init(&t)) != AWS_MP_OKAY) {
-    return err;
-  }
+  P     = &ctx->N;
+  mp    = ctx->rho;
+  redux = ctx->redux;
 
-  /* compute t = b**a mod a */
-  if ((err = aws_mp_exptmod(b, a, a, &t)) != AWS_MP_OKAY) {
-    goto LBL_T;
+  /* negative exponents need an inverse, leave those to the generic code */
+  if (X->sign == AWS_MP_NEG) {
+     return aws_mp_exptmod(G, X, P, Y);
   }
 
-  /* is it equal to b? */
-  if (aws_mp_cmp(&t, b) == AWS_MP_EQ) {
-    *result = AWS_MP_YES;
+  /* find window size */
+  x = aws_mp_count_bits(X);
+  if (x <= 7) {
+    winsize = 2;
+  } else if (x <= 36) {
+    winsize = 3;
+  } else if (x <= 140) {
+    winsize = 4;
+  } else if (x <= 450) {
+    winsize = 5;
+  } else if (x <= 1303) {
+    winsize = 6;
+  } else if (x <= 3529) {
+    winsize = 7;
+  } else {
+    winsize = 8;
   }
 
-  err = AWS_MP_OKAY;
-LBL_T:
-aws_mp_clear(&t);
-  return err;
-}
+#ifdef AWS_MP_LOW_MEM
+  if (winsize > 5) {
+     winsize = 5;
+  }
 #endif
 
-#ifdef AWS_BN_MP_ABS_C
+  /* every table entry holds a product before reduction */
+  digs = P->used * 2 + 1;
 
-/* b = |a| 
- *
- * Simple function copies the input and fixes the sign to positive
- */
+  /* init M array */
+  /* init first cell */
+  if ((err = aws_mp_init_size(&M[1], digs)) != AWS_MP_OKAY) {
+     return err;
+  }
+
+  /* now init the second half of the array */
+  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
+    if ((err = aws_mp_init_size(&M[x], digs)) != AWS_MP_OKAY) {
+      for (y = 1<<(winsize-1); y < x; y++) {
+          aws_mp_clear(&M[y]);
+      }
+        aws_mp_clear(&M[1]);
+      return err;
+    }
+  }
+
+  /* setup result, res = 1 in Montgomery form */
+  if ((err = aws_mp_init_size(&res, digs)) != AWS_MP_OKAY) {
+    goto LBL_M;
+  }
+  if ((err = aws_mp_copy(&ctx->one, &res)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  /* now set M[1] to G * R mod m, i.e. redux(G * R**2) */
+  if (G->sign == AWS_MP_NEG || aws_mp_cmp_mag(G, P) != AWS_MP_LT) {
+     if ((err = aws_mp_mod(G, P, &M[1])) != AWS_MP_OKAY) {
+       goto LBL_RES;
+     }
+     if ((err = aws_mp_mul(&M[1], &ctx->RR, &M[1])) != AWS_MP_OKAY) {
+       goto LBL_RES;
+     }
+  } else {
+     if ((err = aws_mp_mul(G, &ctx->RR, &M[1])) != AWS_MP_OKAY) {
+       goto LBL_RES;
+     }
+  }
+  if ((err = redux (&M[1], P, mp)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  /* compute the value at M[1<<(winsize-1)] by squaring M[1] (winsize-1) times */
+  if ((err = aws_mp_copy(&M[1], &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  for (x = 0; x < (winsize - 1); x++) {
+    if ((err = aws_mp_sqr(&M[1 << (winsize - 1)], &M[1 << (winsize - 1)])) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+    if ((err = redux (&M[1 << (winsize - 1)], P, mp)) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+  }
+
+  /* create upper table */
+  for (x = (1 << (winsize - 1)) + 1; x < (1 << winsize); x++) {
+    if ((err = aws_mp_mul(&M[x - 1], &M[1], &M[x])) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+    if ((err = redux (&M[x], P, mp)) != AWS_MP_OKAY) {
+      goto LBL_RES;
+    }
+  }
+
+  /* set initial mode and bit cnt */
+  mode   = 0;
+  bitcnt = 1;
+  buf    = 0;
+  digidx = X->used - 1;
+  bitcpy = 0;
+  bitbuf = 0;
+
+  for (;;) {
+    /* grab next digit as required */
+    if (--bitcnt == 0) {
+      /* if digidx == -1 we are out of digits so break */
+      if (digidx == -1) {
+        break;
+      }
+      /* read next digit and reset bitcnt */
+      buf    = X->dp[digidx--];
+      bitcnt = (int)AWS_DIGIT_BIT;
+    }
+
+    /* grab the next msb from the exponent */
+    y     = (aws_mp_digit)(buf >> (AWS_DIGIT_BIT - 1)) & 1;
+    buf <<= (aws_mp_digit)1;
+
+    /* skip the leading zero bits */
+    if (mode == 0 && y == 0) {
+      continue;
+    }
+
+    /* if the bit is zero and mode == 1 then we square */
+    if (mode == 1 && y == 0) {
+      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+      continue;
+    }
+
+    /* else we add it to the window */
+    bitbuf |= (y << (winsize - ++bitcpy));
+    mode    = 2;
+
+    if (bitcpy == winsize) {
+      /* ok window is filled so square as required and multiply  */
+      /* square first */
+      for (x = 0; x < winsize; x++) {
+        if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+        if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+      }
+
+      /* then multiply */
+      if ((err = aws_mp_mul(&res, &M[bitbuf], &res)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+
+      /* empty window and reset */
+      bitcpy = 0;
+      bitbuf = 0;
+      mode   = 1;
+    }
+  }
+
+  /* if bits remain then square/multiply */
+  if (mode == 2 && bitcpy > 0) {
+    /* square then multiply if the bit is set */
+    for (x = 0; x < bitcpy; x++) {
+      if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+      if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+        goto LBL_RES;
+      }
+
+      /* get next bit of the window */
+      bitbuf <<= 1;
+      if ((bitbuf & (1 << winsize)) != 0) {
+        /* then multiply */
+        if ((err = aws_mp_mul(&res, &M[1], &res)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+        if ((err = redux (&res, P, mp)) != AWS_MP_OKAY) {
+          goto LBL_RES;
+        }
+      }
+    }
+  }
+
+  /* leave the Montgomery domain */
+  if ((err = redux(&res, P, mp)) != AWS_MP_OKAY) {
+    goto LBL_RES;
+  }
+
+  /* swap res with Y */
+    aws_mp_exch(&res, Y);
+  err = AWS_MP_OKAY;
+LBL_RES:
+aws_mp_clear(&res);
+LBL_M:
+aws_mp_clear(&M[1]);
+  for (x = 1<<(winsize-1); x < (1 << winsize); x++) {
+      aws_mp_clear(&M[x]);
+  }
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_MULMOD_CTX_C
+
+/* c = a * b (mod ctx->N)
+ *
+ * Both operands in [0, N) are multiplied and brought back with two
+ * Montgomery reductions [ab/R, then (ab/R)(R**2)/R] instead of a division.
+ * Anything else goes through aws_mp_mulmod.
+ */
+int aws_mp_mulmod_ctx(aws_mp_int *a, aws_mp_int *b, aws_mp_mont_ctx *ctx, aws_mp_int *c)
+{
+  aws_mp_int t;
+  int        err;
+
+  if (a->sign == AWS_MP_NEG || b->sign == AWS_MP_NEG ||
+      aws_mp_cmp_mag(a, &ctx->N) != AWS_MP_LT || aws_mp_cmp_mag(b, &ctx->N) != AWS_MP_LT) {
+     return aws_mp_mulmod(a, b, &ctx->N, c);
+  }
+
+  if ((err = aws_mp_init_size(&t, ctx->N.used * 2 + 1)) != AWS_MP_OKAY) {
+     return err;
+  }
+
+  if ((err = aws_mp_mul(a, b, &t)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = ctx->redux(&t, &ctx->N, ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_mul(&t, &ctx->RR, &t)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = ctx->redux(&t, &ctx->N, ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  aws_mp_exch(&t, c);
+
+LBL_ERR:
+  aws_mp_clear(&t);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_BATCH_C
+
+/* computes Y[i] == G[i]**X[i] mod N for count pairs sharing one context
+ *
+ * On x86-64 CPUs with AVX-512 IFMA eight exponentiations run side by
+ * side, one per 64-bit lane of a ZMM register.  Values are held as k
+ * limbs of 52 bits with 52k >= bits(N) + 2, so R = 2**(52k) > 4N and the
+ * "almost" Montgomery product of two values below 2N is again below 2N
+ * without the final conditional subtraction, which is the one step the
+ * lanes could not take independently.  VPMADD52LUQ/HUQ add the low and
+ * high halves of each 52x52 limb product into 64-bit column sums that
+ * are carried only once per product; k is capped so the sums cannot
+ * overflow.  The lanes share one fixed window walk over the longest
+ * exponent and each gathers its own table entry.
+ *
+ * Pairs the vector code does not take [negative exponent, base outside
+ * [0, N)], moduli wider than the limb cap and CPUs without IFMA go
+ * through aws_mp_exptmod_ctx one at a time, which gives the same results.
+ * Y[i] may be G[i] or X[i].
+ */
+#if defined(AWS_MP_64BIT) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(AWS_MP_NO_ASM)
+#define AWS_MP_BATCH_IFMA
+#include <immintrin.h>
+#include <cpuid.h>
+
+#define AWS_MP_BATCH_LANES    8
+#define AWS_MP_BATCH_LIMBS    80     /* moduli of up to 52*80 - 2 bits */
+#define AWS_MP_BATCH_MASK     ((((ulong64)1) << 52) - 1)
+
+static int aws_s_mp_cpu_has_ifma(void)
+{
+  unsigned int eax, ebx, ecx, edx, xlo, xhi;
+
+  if (__get_cpuid_max(0, NULL) < 7) {
+     return 0;
+  }
+  /* ECX bit 27 = OSXSAVE, needed to read XCR0 */
+  __cpuid(1, eax, ebx, ecx, edx);
+  if (((ecx >> 27) & 1) == 0) {
+     return 0;
+  }
+  /* EBX bit 16 = AVX512F, bit 21 = AVX512IFMA */
+  __cpuid_count(7, 0, eax, ebx, ecx, edx);
+  if (((ebx >> 16) & 1) == 0 || ((ebx >> 21) & 1) == 0) {
+     return 0;
+  }
+  /* the OS must save the SSE, AVX and all three AVX-512 register states */
+  __asm__ __volatile__ ("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+  return (xlo & 0xE6) == 0xE6;
+}
+
+/* stores the low 52k bits of a as k limbs in lane l of v */
+static void aws_s_mp_batch_split(aws_mp_int *a, ulong64 *v, int l, int k)
+{
+  ulong64 w;
+  int     j, ix, off, got;
+
+  for (j = 0; j < k; j++) {
+     ix  = (j * 52) / AWS_DIGIT_BIT;
+     off = (j * 52) % AWS_DIGIT_BIT;
+     w   = 0;
+     for (got = 0; got < 52 && ix < a->used; ix++) {
+        w   |= ((ulong64)(a->dp[ix] >> off)) << got;
+        got += AWS_DIGIT_BIT - off;
+        off  = 0;
+     }
+     v[j * AWS_MP_BATCH_LANES + l] = w & AWS_MP_BATCH_MASK;
+  }
+}
+
+/* a = the k limbs in lane l of v */
+static int aws_s_mp_batch_join(aws_mp_int *a, const ulong64 *v, int l, int k)
+{
+  ulong64 w;
+  int     err, j, ix, off, digs;
+
+  digs = (52 * k + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT;
+  if ((err = aws_mp_grow(a, digs)) != AWS_MP_OKAY) {
+     return err;
+  }
+  aws_mp_zero(a);
+
+  for (j = 0; j < k; j++) {
+     w   = v[j * AWS_MP_BATCH_LANES + l];
+     ix  = (j * 52) / AWS_DIGIT_BIT;
+     off = (j * 52) % AWS_DIGIT_BIT;
+     while (w != 0) {
+        a->dp[ix++] |= ((aws_mp_digit)(w << off)) & AWS_MP_MASK;
+        w  >>= AWS_DIGIT_BIT - off;
+        off  = 0;
+     }
+  }
+  a->used = digs;
+  aws_mp_clamp(a);
+  return AWS_MP_OKAY;
+}
+
+/* the w bits of X starting at bit "bit" */
+static int aws_s_mp_batch_window(aws_mp_int *X, int bit, int w)
+{
+  int r, pos;
+
+  r = 0;
+  for (pos = bit + w - 1; pos >= bit; pos--) {
+     r <<= 1;
+     if (pos / AWS_DIGIT_BIT < X->used) {
+        r |= (int)((X->dp[pos / AWS_DIGIT_BIT] >> (pos % AWS_DIGIT_BIT)) & 1);
+     }
+  }
+  return r;
+}
+
+/* r = a*b/R (mod N) in every lane, for a, b below 2N; r may be a or b */
+__attribute__((target("avx512f,avx512ifma")))
+static void aws_s_mp_batch_amm(__m512i *r, const __m512i *a, const __m512i *b, const __m512i *n, __m512i rho, int k)
+{
+  __m512i acc[AWS_MP_BATCH_LIMBS], zero, bi, m, c;
+  int     i, j;
+
+  zero = _mm512_setzero_si512();
+  for (j = 0; j < k; j++) {
+     acc[j] = zero;
+  }
+
+  for (i = 0; i < k; i++) {
+     bi = b[i];
+     for (j = 0; j < k; j++) {
+        acc[j] = _mm512_madd52lo_epu64(acc[j], a[j], bi);
+     }
+     m = _mm512_madd52lo_epu64(zero, acc[0], rho);
+     for (j = 0; j < k; j++) {
+        acc[j] = _mm512_madd52lo_epu64(acc[j], n[j], m);
+     }
+
+     /* the low limb is now a multiple of 2**52, shift everything down one
+        limb and add the high halves in at their shifted place */
+     c = _mm512_srli_epi64(acc[0], 52);
+     for (j = 0; j < k - 1; j++) {
+        acc[j] = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(acc[j + 1], a[j], bi), n[j], m);
+     }
+     acc[k - 1] = _mm512_madd52hi_epu64(_mm512_madd52hi_epu64(zero, a[k - 1], bi), n[k - 1], m);
+     acc[0] = _mm512_add_epi64(acc[0], c);
+  }
+
+  /* propagate the column carries, the result is below 2N < R */
+  c = zero;
+  for (j = 0; j < k; j++) {
+     acc[j] = _mm512_add_epi64(acc[j], c);
+     c      = _mm512_srli_epi64(acc[j], 52);
+     r[j]   = _mm512_and_si512(acc[j], _mm512_set1_epi64((long long)AWS_MP_BATCH_MASK));
+  }
+}
+
+/* exponentiates up to eight lanes, the rest of the ZMM lanes compute 0**0 */
+__attribute__((target("avx512f,avx512ifma")))
+static int aws_s_mp_batch_lanes(aws_mp_int **G, aws_mp_int **X, int lanes, aws_mp_int *P, __m512i *n, __m512i *rr,
+                                __m512i rho, __m512i *T, __m512i *acc, __m512i *b, int k, aws_mp_int **Y)
+{
+  long long base[AWS_MP_BATCH_LANES];
+  __m512i   idx, step;
+  int       err, l, j, i, x, bits, winsize, wins;
+
+  /* find window size */
+  bits = 0;
+  for (l = 0; l < lanes; l++) {
+     x = aws_mp_count_bits(X[l]);
+     bits = AWS_MAX(bits, x);
+  }
+  if (bits <= 64) {
+     winsize = 3;
+  } else if (bits <= 320) {
+     winsize = 4;
+  } else if (bits <= 1024) {
+     winsize = 5;
+  } else {
+     winsize = 6;
+  }
+  wins = (bits + winsize - 1) / winsize;
+
+  /* T[0] = R, T[1] = G*R, T[x] = G**x * R, all mod N */
+  for (j = 0; j < k; j++) {
+     b[j] = _mm512_setzero_si512();
+  }
+  b[0] = _mm512_set1_epi64(1);
+  aws_s_mp_batch_amm(T, b, rr, n, rho, k);
+  for (j = 0; j < k; j++) {
+     b[j] = _mm512_setzero_si512();
+  }
+  for (l = 0; l < lanes; l++) {
+     aws_s_mp_batch_split(G[l], (ulong64 *)b, l, k);
+  }
+  aws_s_mp_batch_amm(T + k, b, rr, n, rho, k);
+  for (x = 2; x < (1 << winsize); x++) {
+     aws_s_mp_batch_amm(T + x * k, T + (x - 1) * k, T + k, n, rho, k);
+  }
+
+  for (j = 0; j < k; j++) {
+     acc[j] = T[j];
+  }
+  step = _mm512_set1_epi64(AWS_MP_BATCH_LANES);
+  for (i = wins - 1; i >= 0; i--) {
+     if (i != wins - 1) {
+        for (x = 0; x < winsize; x++) {
+           aws_s_mp_batch_amm(acc, acc, acc, n, rho, k);
+        }
+     }
+
+     /* every lane fetches its own entry: limb j of T[d] in lane l is
+        64-bit word (d*k + j)*LANES + l of the table */
+     for (l = 0; l < AWS_MP_BATCH_LANES; l++) {
+        x = (l < lanes) ? aws_s_mp_batch_window(X[l], i * winsize, winsize) : 0;
+        base[l] = (long long)x * k * AWS_MP_BATCH_LANES + l;
+     }
+     idx = _mm512_loadu_si512((const void *)base);
+     for (j = 0; j < k; j++) {
+        b[j] = _mm512_i64gather_epi64(idx, (const void *)T, 8);
+        idx  = _mm512_add_epi64(idx, step);
+     }
+     aws_s_mp_batch_amm(acc, acc, b, n, rho, k);
+  }
+
+  /* leave the Montgomery domain, acc*1/R is at most N */
+  for (j = 0; j < k; j++) {
+     b[j] = _mm512_setzero_si512();
+  }
+  b[0] = _mm512_set1_epi64(1);
+  aws_s_mp_batch_amm(acc, acc, b, n, rho, k);
+
+  for (l = 0; l < lanes; l++) {
+     if ((err = aws_s_mp_batch_join(Y[l], (const ulong64 *)acc, l, k)) != AWS_MP_OKAY) {
+        return err;
+     }
+     if (aws_mp_cmp_mag(Y[l], P) != AWS_MP_LT) {
+        if ((err = aws_s_mp_sub(Y[l], P, Y[l])) != AWS_MP_OKAY) {
+           return err;
+        }
+     }
+  }
+  return AWS_MP_OKAY;
+}
+
+__attribute__((target("avx512f,avx512ifma")))
+static int aws_s_mp_exptmod_batch_ifma(aws_mp_int *G, aws_mp_int *X, int count, aws_mp_mont_ctx *ctx, aws_mp_int *Y)
+{
+  aws_mp_int *g[AWS_MP_BATCH_LANES], *x[AWS_MP_BATCH_LANES], *y[AWS_MP_BATCH_LANES];
+  aws_mp_int t;
+  __m512i    *n, *rr, *T, *acc, *b, rho;
+  ulong64    inv, n0;
+  void       *mem;
+  int        err, i, j, k, lanes;
+
+  k = (aws_mp_count_bits(&ctx->N) + 2 + 51) / 52;
+
+  /* N, R**2 mod N, the largest table and three work values, 64-byte aligned */
+  mem = AWS_XMALLOC(sizeof(__m512i) * (size_t)k * (4 + (1 << 6)) + 63);
+  if (mem == NULL) {
+     return AWS_MP_MEM;
+  }
+  n   = (__m512i *)(((size_t)mem + 63) & ~(size_t)63);
+  rr  = n + k;
+  acc = rr + k;
+  b   = acc + k;
+  T   = b + k;
+
+  if ((err = aws_mp_init(&t)) != AWS_MP_OKAY) {
+     goto LBL_MEM;
+  }
+  if ((err = aws_mp_2expt(&t, 2 * 52 * k)) != AWS_MP_OKAY) {
+     goto LBL_T;
+  }
+  if ((err = aws_mp_mod(&t, &ctx->N, &t)) != AWS_MP_OKAY) {
+     goto LBL_T;
+  }
+  for (j = 0; j < AWS_MP_BATCH_LANES; j++) {
+     aws_s_mp_batch_split(&ctx->N, (ulong64 *)n, j, k);
+     aws_s_mp_batch_split(&t, (ulong64 *)rr, j, k);
+  }
+
+  /* rho = -1/N mod 2**52, each Newton step doubles the correct low bits */
+  n0  = ((ulong64 *)n)[0];
+  inv = n0;
+  for (j = 0; j < 5; j++) {
+     inv *= 2 - n0 * inv;
+  }
+  rho = _mm512_set1_epi64((long long)((0 - inv) & AWS_MP_BATCH_MASK));
+
+  lanes = 0;
+  for (i = 0; i < count; i++) {
+     if (X[i].sign == AWS_MP_NEG || G[i].sign == AWS_MP_NEG ||
+         aws_mp_cmp_mag(&G[i], &ctx->N) != AWS_MP_LT) {
+        if ((err = aws_mp_exptmod_ctx(&G[i], &X[i], ctx, &Y[i])) != AWS_MP_OKAY) {
+           goto LBL_T;
+        }
+        continue;
+     }
+     g[lanes] = &G[i];
+     x[lanes] = &X[i];
+     y[lanes] = &Y[i];
+     if (++lanes == AWS_MP_BATCH_LANES) {
+        if ((err = aws_s_mp_batch_lanes(g, x, lanes, &ctx->N, n, rr, rho, T, acc, b, k, y)) != AWS_MP_OKAY) {
+           goto LBL_T;
+        }
+        lanes = 0;
+     }
+  }
+  if (lanes > 0) {
+     err = aws_s_mp_batch_lanes(g, x, lanes, &ctx->N, n, rr, rho, T, acc, b, k, y);
+  }
+
+LBL_T:
+  aws_mp_clear(&t);
+LBL_MEM:
+  AWS_XFREE(mem);
+  return err;
+}
+#endif
+
+#ifdef AWS_MP_BATCH_IFMA
+#include <pthread.h>
+
+/* probed once per process, read without locking afterwards */
+static int            aws_s_mp_batch_lanes_cpu;
+static pthread_once_t aws_s_mp_batch_lanes_once = PTHREAD_ONCE_INIT;
+
+static void aws_s_mp_batch_lanes_probe(void)
+{
+  aws_s_mp_batch_lanes_cpu = aws_s_mp_cpu_has_ifma() ? AWS_MP_BATCH_LANES : 1;
+}
+#endif
+
+/* number of exponentiations aws_mp_exptmod_batch runs at once on this CPU */
+int aws_mp_exptmod_batch_lanes(void)
+{
+#ifdef AWS_MP_BATCH_IFMA
+  pthread_once(&aws_s_mp_batch_lanes_once, aws_s_mp_batch_lanes_probe);
+  return aws_s_mp_batch_lanes_cpu;
+#else
+  return 1;
+#endif
+}
+
+int aws_mp_exptmod_batch(aws_mp_int *G, aws_mp_int *X, int count, aws_mp_mont_ctx *ctx, aws_mp_int *Y)
+{
+  int err, i;
+
+#ifdef AWS_MP_BATCH_IFMA
+  if (aws_mp_exptmod_batch_lanes() == AWS_MP_BATCH_LANES &&
+      aws_mp_count_bits(&ctx->N) + 2 <= 52 * AWS_MP_BATCH_LIMBS) {
+     return aws_s_mp_exptmod_batch_ifma(G, X, count, ctx, Y);
+  }
+#endif
+
+  for (i = 0; i < count; i++) {
+     if ((err = aws_mp_exptmod_ctx(&G[i], &X[i], ctx, &Y[i])) != AWS_MP_OKAY) {
+        return err;
+     }
+  }
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_MP_COMB_INIT_C
+
+/* builds a fixed-base comb table for G [Lim-Lee, single comb]
+ *
+ * An exponent of up to "bits" bits is cut into "teeth" rows of
+ * span = ceil(bits/teeth) bits.  Entry T[j] holds the product of
+ * G**(2**(i*span)) for every bit i set in j, kept in Montgomery form.
+ * An exponentiation then costs span squarings and at most span
+ * multiplications instead of one squaring per exponent bit.
+ *
+ * The table references ctx, which must outlive it.  Once built the
+ * table is only read so it may be shared between threads.
+ */
+int aws_mp_comb_init(aws_mp_comb *comb, aws_mp_int *G, int bits, int teeth, aws_mp_mont_ctx *ctx)
+{
+  aws_mp_int *P;
+  int err, i, j, k, size, digs;
+
+  if (bits < 1 || teeth < 1 || teeth > 10) {
+     return AWS_MP_VAL;
+  }
+
+  P           = &ctx->N;
+  size        = 1 << teeth;
+  digs        = P->used * 2 + 1;
+  comb->ctx   = ctx;
+  comb->teeth = teeth;
+  comb->span  = (bits + teeth - 1) / teeth;
+
+  comb->T = AWS_OPT_CAST(aws_mp_int)AWS_XCALLOC((size_t)size, sizeof(aws_mp_int));
+  if (comb->T == NULL) {
+     return AWS_MP_MEM;
+  }
+
+  if ((err = aws_mp_init_copy(&comb->G, G)) != AWS_MP_OKAY) {
+     AWS_XFREE(comb->T);
+     comb->T = NULL;
+     return err;
+  }
+
+  for (j = 0; j < size; j++) {
+     if ((err = aws_mp_init_size(&comb->T[j], digs)) != AWS_MP_OKAY) {
+        while (j-- > 0) {
+           aws_mp_clear(&comb->T[j]);
+        }
+        aws_mp_clear(&comb->G);
+        AWS_XFREE(comb->T);
+        comb->T = NULL;
+        return err;
+     }
+  }
+
+  /* T[0] = 1, T[1] = G, both in Montgomery form */
+  if ((err = aws_mp_copy(&ctx->one, &comb->T[0])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_mod(G, P, &comb->T[1])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = aws_mp_mul(&comb->T[1], &ctx->RR, &comb->T[1])) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+  if ((err = ctx->redux(&comb->T[1], P, ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_ERR;
+  }
+
+  /* T[2**i] = T[2**(i-1)]**(2**span) */
+  for (i = 1; i < teeth; i++) {
+     if ((err = aws_mp_copy(&comb->T[1 << (i - 1)], &comb->T[1 << i])) != AWS_MP_OKAY) {
+        goto LBL_ERR;
+     }
+     for (k = 0; k < comb->span; k++) {
+        if ((err = aws_mp_sqr(&comb->T[1 << i], &comb->T[1 << i])) != AWS_MP_OKAY) {
+           goto LBL_ERR;
+        }
+        if ((err = ctx->redux(&comb->T[1 << i], P, ctx->rho)) != AWS_MP_OKAY) {
+           goto LBL_ERR;
+        }
+     }
+  }
+
+  /* fill in the rest, T[j] = T[j - msb(j)] * T[msb(j)] */
+  for (i = 1; i < teeth; i++) {
+     for (j = (1 << i) + 1; j < (1 << (i + 1)); j++) {
+        if ((err = aws_mp_mul(&comb->T[j - (1 << i)], &comb->T[1 << i], &comb->T[j])) != AWS_MP_OKAY) {
+           goto LBL_ERR;
+        }
+        if ((err = ctx->redux(&comb->T[j], P, ctx->rho)) != AWS_MP_OKAY) {
+           goto LBL_ERR;
+        }
+     }
+  }
+
+  return AWS_MP_OKAY;
+LBL_ERR:
+  aws_mp_comb_clear(comb);
+  return err;
+}
+
+/* frees a table made with aws_mp_comb_init */
+void aws_mp_comb_clear(aws_mp_comb *comb)
+{
+  int j;
+
+  if (comb->T != NULL) {
+     for (j = 0; j < (1 << comb->teeth); j++) {
+        aws_mp_clear(&comb->T[j]);
+     }
+     AWS_XFREE(comb->T);
+     comb->T = NULL;
+     aws_mp_clear(&comb->G);
+  }
+  comb->ctx = NULL;
+}
+#endif
+
+#ifdef AWS_BN_MP_EXPTMOD_COMB_C
+
+/* computes Y == G**X mod N from a fixed-base comb table of G
+ *
+ * Exponents that are negative or wider than the table fall back to
+ * the sliding window in aws_mp_exptmod_ctx.
+ */
+int aws_mp_exptmod_comb(aws_mp_int *X, aws_mp_comb *comb, aws_mp_int *Y)
+{
+  aws_mp_mont_ctx *ctx;
+  aws_mp_int res, *P;
+  int err, i, k, bit, idx, started;
+
+  ctx = comb->ctx;
+  P   = &ctx->N;
+
+  if (X->sign == AWS_MP_NEG || aws_mp_count_bits(X) > comb->teeth * comb->span) {
+     return aws_mp_exptmod_ctx(&comb->G, X, ctx, Y);
+  }
+
+  if ((err = aws_mp_init_size(&res, P->used * 2 + 1)) != AWS_MP_OKAY) {
+     return err;
+  }
+  if ((err = aws_mp_copy(&ctx->one, &res)) != AWS_MP_OKAY) {
+     goto LBL_RES;
+  }
+
+  started = 0;
+  for (k = comb->span - 1; k >= 0; k--) {
+     /* skip the squarings of 1 */
+     if (started) {
+        if ((err = aws_mp_sqr(&res, &res)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+        if ((err = ctx->redux(&res, P, ctx->rho)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+     }
+
+     /* gather bit k of every row */
+     idx = 0;
+     for (i = 0; i < comb->teeth; i++) {
+        bit = i * comb->span + k;
+        if (bit / AWS_DIGIT_BIT < X->used &&
+            ((X->dp[bit / AWS_DIGIT_BIT] >> (bit % AWS_DIGIT_BIT)) & 1) != 0) {
+           idx |= 1 << i;
+        }
+     }
+
+     if (idx != 0) {
+        if ((err = aws_mp_mul(&res, &comb->T[idx], &res)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+        if ((err = ctx->redux(&res, P, ctx->rho)) != AWS_MP_OKAY) {
+           goto LBL_RES;
+        }
+        started = 1;
+     }
+  }
+
+  /* leave the Montgomery domain */
+  if ((err = ctx->redux(&res, P, ctx->rho)) != AWS_MP_OKAY) {
+     goto LBL_RES;
+  }
+
+  aws_mp_exch(&res, Y);
+  err = AWS_MP_OKAY;
+LBL_RES:
+  aws_mp_clear(&res);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_S_MP_ADD_C
+
+/* low level addition, based on HAC pp.594, Algorithm 14.7 */
+int
+aws_s_mp_add(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  aws_mp_int *x;
+  int     olduse, res, min, max;
+
+  /* find sizes, we let |a| <= |b| which means we have to sort
+   * them.  "x" will point to the input with the most digits
+   */
+  if (a->used > b->used) {
+    min = b->used;
+    max = a->used;
+    x = a;
+  } else {
+    min = a->used;
+    max = b->used;
+    x = b;
+  }
+
+  /* init result */
+  if (c->alloc < max + 1) {
+    if ((res = aws_mp_grow(c, max + 1)) != AWS_MP_OKAY) {
+      return res;
+    }
+  }
+
+  /* get old used digit count and set new one */
+  olduse = c->used;
+  c->used = max + 1;
+
+  {
+    register aws_mp_digit u, *tmpa, *tmpb, *tmpc;
+    register int i;
+
+    /* alias for digit pointers */
+
+    /* first input */
+    tmpa = a->dp;
+
+    /* second input */
+    tmpb = b->dp;
+
+    /* destination */
+    tmpc = c->dp;
+
+    /* zero the carry */
+    u = 0;
+    for (i = 0; i < min; i++) {
+      /* Compute the sum at one digit, T[i] = A[i] + B[i] + U */
+      *tmpc = *tmpa++ + *tmpb++ + u;
+
+      /* U = carry bit of T[i] */
+      u = *tmpc >> ((aws_mp_digit)AWS_DIGIT_BIT);
+
+      /* take away carry bit from T[i] */
+      *tmpc++ &= AWS_MP_MASK;
+    }
+
+    /* now copy higher words if any, that is in A+B 
+     * if A or B has more digits add those in 
+     */
+    if (min != max) {
+      for (; i < max; i++) {
+        /* T[i] = X[i] + U */
+        *tmpc = x->dp[i] + u;
+
+        /* U = carry bit of T[i] */
+        u = *tmpc >> ((aws_mp_digit)AWS_DIGIT_BIT);
+
+        /* take away carry bit from T[i] */
+        *tmpc++ &= AWS_MP_MASK;
+      }
+    }
+
+    /* add carry */
+    *tmpc++ = u;
+
+    /* clear digits above oldused */
+    for (i = c->used; i < olduse; i++) {
+      *tmpc++ = 0;
+    }
+  }
+
+    aws_mp_clamp(c);
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_MP_PRIME_FERMAT_C
+
+/* performs one Fermat test.
+ * 
+ * If "a" were prime then b**a == b (mod a) since the order of
+ * the multiplicative sub-group would be phi(a) = a-1.  That means
+ * it would be the same as b**(a mod (a-1)) == b**1 == b (mod a).
+ *
+ * Sets result to 1 if the congruence holds, or zero otherwise.
+ */
+int aws_mp_prime_fermat(aws_mp_int *a, aws_mp_int *b, int *result)
+{
+  aws_mp_int t;
+  int     err;
+
+  /* default to composite  */
+  *result = AWS_MP_NO;
+
+  /* ensure b > 1 */
+  if (aws_mp_cmp_d(b, 1) != AWS_MP_GT) {
+     return AWS_MP_VAL;
+  }
+
+  /* init t */
+  if ((err = aws_mp_init(&t)) != AWS_MP_OKAY) {
+    return err;
+  }
+
+  /* compute t = b**a mod a */
+  if ((err = aws_mp_exptmod(b, a, a, &t)) != AWS_MP_OKAY) {
+    goto LBL_T;
+  }
+
+  /* is it equal to b? */
+  if (aws_mp_cmp(&t, b) == AWS_MP_EQ) {
+    *result = AWS_MP_YES;
+  }
+
+  err = AWS_MP_OKAY;
+LBL_T:
+aws_mp_clear(&t);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_ABS_C
+
+/* b = |a| 
+ *
+ * Simple function copies the input and fixes the sign to positive
+ */
+int
+aws_mp_abs(aws_mp_int *a, aws_mp_int *b)
+{
+  int     res;
+
+  /* copy a to b */
+  if (a != b) {
+     if ((res = aws_mp_copy(a, b)) != AWS_MP_OKAY) {
+       return res;
+     }
+  }
+
+  /* force the sign of b to positive */
+  b->sign = AWS_MP_ZPOS;
+
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_MP_CLAMP_C
+
+/* trim unused digits 
+ *
+ * This is used to ensure that leading zero digits are
+ * trimed and the leading "used" digit will be non-zero
+ * Typically very fast.  Also fixes the sign if there
+ * are no more leading digits
+ */
+void
+aws_mp_clamp(aws_mp_int *a)
+{
+  /* decrease used while the most significant digit is
+   * zero.
+   */
+  while (a->used > 0 && a->dp[a->used - 1] == 0) {
+    --(a->used);
+  }
+
+  /* reset the sign flag if used == 0 */
+  if (a->used == 0) {
+    a->sign = AWS_MP_ZPOS;
+  }
+}
+#endif
+
+/* $Source$ */
+/* $Revision: 0.41 $ */
+/* $Date: 2007-04-18 09:58:18 +0000 $ */
+
+#ifdef AWS_BN_MP_SIGNED_BIN_SIZE_C
+
+/* get the size for an signed equivalent */
+int aws_mp_signed_bin_size(aws_mp_int *a)
+{
+  return 1 + aws_mp_unsigned_bin_size(a);
+}
+#endif
+
+#ifdef AWS_BN_MP_SQRT_C
+
+/* this function is less generic than mp_n_root, simpler and faster */
+int aws_mp_sqrt(aws_mp_int *arg, aws_mp_int *ret)
+{
+  int res;
+  aws_mp_int t1,t2;
+
+  /* must be positive */
+  if (arg->sign == AWS_MP_NEG) {
+    return AWS_MP_VAL;
+  }
+
+  /* easy out */
+  if (aws_mp_iszero(arg) == AWS_MP_YES) {
+      aws_mp_zero(ret);
+    return AWS_MP_OKAY;
+  }
+
+  if ((res = aws_mp_init_copy(&t1, arg)) != AWS_MP_OKAY) {
+    return res;
+  }
+
+  if ((res = aws_mp_init(&t2)) != AWS_MP_OKAY) {
+    goto E2;
+  }
+
+  /* First approx. (not very bad for large arg) */
+    aws_mp_rshd(&t1, t1.used / 2);
+
+  /* t1 > 0  */ 
+  if ((res = aws_mp_div(arg, &t1, &t2, NULL)) != AWS_MP_OKAY) {
+    goto E1;
+  }
+  if ((res = aws_mp_add(&t1, &t2, &t1)) != AWS_MP_OKAY) {
+    goto E1;
+  }
+  if ((res = aws_mp_div_2(&t1, &t1)) != AWS_MP_OKAY) {
+    goto E1;
+  }
+  /* And now t1 > sqrt(arg) */
+  do { 
+    if ((res = aws_mp_div(arg, &t1, &t2, NULL)) != AWS_MP_OKAY) {
+      goto E1;
+    }
+    if ((res = aws_mp_add(&t1, &t2, &t1)) != AWS_MP_OKAY) {
+      goto E1;
+    }
+    if ((res = aws_mp_div_2(&t1, &t1)) != AWS_MP_OKAY) {
+      goto E1;
+    }
+    /* t1 >= sqrt(arg) >= t2 at this point */
+  } while (aws_mp_cmp_mag(&t1, &t2) == AWS_MP_GT);
+
+    aws_mp_exch(&t1, ret);
+
+E1:
+aws_mp_clear(&t2);
+E2:
+aws_mp_clear(&t1);
+  return res;
+}
+
+#endif
+
+#ifdef AWS_BN_MP_MONTGOMERY_SETUP_C
+
+/* setups the montgomery reduction stuff */
 int
-aws_mp_abs(aws_mp_int *a, aws_mp_int *b)
+aws_mp_montgomery_setup(aws_mp_int *n, aws_mp_digit *rho)
+{
+  aws_mp_digit x, b;
+
+/* fast inversion mod 2**k
+ *
+ * Based on the fact that
+ *
+ * XA = 1 (mod 2**n)  =>  (X(2-XA)) A = 1 (mod 2**2n)
+ *                    =>  2*X*A - X*X*A*A = 1
+ *                    =>  2*(1) - (1)     = 1
+ */
+  b = n->dp[0];
+
+  if ((b & 1) == 0) {
+    return AWS_MP_VAL;
+  }
+
+  x = (((b + 2) & 4) << 1) + b; /* here x*a==1 mod 2**4 */
+  x *= 2 - b * x;               /* here x*a==1 mod 2**8 */
+#if !defined(AWS_MP_8BIT)
+  x *= 2 - b * x;               /* here x*a==1 mod 2**16 */
+#endif
+#if defined(AWS_MP_64BIT) || !(defined(AWS_MP_8BIT) || defined(AWS_MP_16BIT))
+  x *= 2 - b * x;               /* here x*a==1 mod 2**32 */
+#endif
+#ifdef AWS_MP_64BIT
+  x *= 2 - b * x;               /* here x*a==1 mod 2**64 */
+#endif
+
+  /* rho = -1/m mod b */
+  *rho = (unsigned long)(((aws_mp_word)1 << ((aws_mp_word) AWS_DIGIT_BIT)) - x) & AWS_MP_MASK;
+
+  return AWS_MP_OKAY;
+}
+#endif
+
+#ifdef AWS_BN_MP_FWRITE_C
+
+int aws_mp_fwrite(aws_mp_int *a, int radix, FILE *stream)
+{
+   char *buf = NULL;
+   int err = 0, len = 0, x = 0;
+   
+   if ((err = aws_mp_radix_size(a, radix, &len)) != AWS_MP_OKAY) {
+      return err;
+   }
+
+   buf = AWS_OPT_CAST(char) AWS_XMALLOC (len);
+   if (buf == NULL) {
+      return AWS_MP_MEM;
+   }
+   
+   if ((err = aws_mp_toradix(a, buf, radix)) != AWS_MP_OKAY) {
+      AWS_XFREE (buf);
+      return err;
+   }
+   
+   for (x = 0; x < len; x++) {
+       if (fputc(buf[x], stream) == EOF) {
+          AWS_XFREE (buf);
+          return AWS_MP_VAL;
+       }
+   }
+   
+   AWS_XFREE (buf);
+   return AWS_MP_OKAY;
+}
+
+#endif
+
+#ifdef AWS_BN_MP_EXCH_C
+
+/* swap the elements of two integers, for cases where you can't simply swap the 
+ * mp_int pointers around
+ */
+void
+aws_mp_exch(aws_mp_int *a, aws_mp_int *b)
+{
+  aws_mp_int t;
+
+  t  = *a;
+  *a = *b;
+  *b = t;
+}
+#endif
+
+#ifdef AWS_BN_PRIME_TAB_C
+
+const aws_mp_digit aws_ltm_prime_tab[] = {
+  0x0002, 0x0003, 0x0005, 0x0007, 0x000B, 0x000D, 0x0011, 0x0013,
+  0x0017, 0x001D, 0x001F, 0x0025, 0x0029, 0x002B, 0x002F, 0x0035,
+  0x003B, 0x003D, 0x0043, 0x0047, 0x0049, 0x004F, 0x0053, 0x0059,
+  0x0061, 0x0065, 0x0067, 0x006B, 0x006D, 0x0071, 0x007F,
+#ifndef AWS_MP_8BIT
+  0x0083,
+  0x0089, 0x008B, 0x0095, 0x0097, 0x009D, 0x00A3, 0x00A7, 0x00AD,
+  0x00B3, 0x00B5, 0x00BF, 0x00C1, 0x00C5, 0x00C7, 0x00D3, 0x00DF,
+  0x00E3, 0x00E5, 0x00E9, 0x00EF, 0x00F1, 0x00FB, 0x0101, 0x0107,
+  0x010D, 0x010F, 0x0115, 0x0119, 0x011B, 0x0125, 0x0133, 0x0137,
+
+  0x0139, 0x013D, 0x014B, 0x0151, 0x015B, 0x015D, 0x0161, 0x0167,
+  0x016F, 0x0175, 0x017B, 0x017F, 0x0185, 0x018D, 0x0191, 0x0199,
+  0x01A3, 0x01A5, 0x01AF, 0x01B1, 0x01B7, 0x01BB, 0x01C1, 0x01C9,
+  0x01CD, 0x01CF, 0x01D3, 0x01DF, 0x01E7, 0x01EB, 0x01F3, 0x01F7,
+  0x01FD, 0x0209, 0x020B, 0x021D, 0x0223, 0x022D, 0x0233, 0x0239,
+  0x023B, 0x0241, 0x024B, 0x0251, 0x0257, 0x0259, 0x025F, 0x0265,
+  0x0269, 0x026B, 0x0277, 0x0281, 0x0283, 0x0287, 0x028D, 0x0293,
+  0x0295, 0x02A1, 0x02A5, 0x02AB, 0x02B3, 0x02BD, 0x02C5, 0x02CF,
+
+  0x02D7, 0x02DD, 0x02E3, 0x02E7, 0x02EF, 0x02F5, 0x02F9, 0x0301,
+  0x0305, 0x0313, 0x031D, 0x0329, 0x032B, 0x0335, 0x0337, 0x033B,
+  0x033D, 0x0347, 0x0355, 0x0359, 0x035B, 0x035F, 0x036D, 0x0371,
+  0x0373, 0x0377, 0x038B, 0x038F, 0x0397, 0x03A1, 0x03A9, 0x03AD,
+  0x03B3, 0x03B9, 0x03C7, 0x03CB, 0x03D1, 0x03D7, 0x03DF, 0x03E5,
+  0x03F1, 0x03F5, 0x03FB, 0x03FD, 0x0407, 0x0409, 0x040F, 0x0419,
+  0x041B, 0x0425, 0x0427, 0x042D, 0x043F, 0x0443, 0x0445, 0x0449,
+  0x044F, 0x0455, 0x045D, 0x0463, 0x0469, 0x047F, 0x0481, 0x048B,
+
+  0x0493, 0x049D, 0x04A3, 0x04A9, 0x04B1, 0x04BD, 0x04C1, 0x04C7,
+  0x04CD, 0x04CF, 0x04D5, 0x04E1, 0x04EB, 0x04FD, 0x04FF, 0x0503,
+  0x0509, 0x050B, 0x0511, 0x0515, 0x0517, 0x051B, 0x0527, 0x0529,
+  0x052F, 0x0551, 0x0557, 0x055D, 0x0565, 0x0577, 0x0581, 0x058F,
+  0x0593, 0x0595, 0x0599, 0x059F, 0x05A7, 0x05AB, 0x05AD, 0x05B3,
+  0x05BF, 0x05C9, 0x05CB, 0x05CF, 0x05D1, 0x05D5, 0x05DB, 0x05E7,
+  0x05F3, 0x05FB, 0x0607, 0x060D, 0x0611, 0x0617, 0x061F, 0x0623,
+  0x062B, 0x062F, 0x063D, 0x0641, 0x0647, 0x0649, 0x064D, 0x0653
+#endif
+};
+#endif
+
+#ifdef AWS_BN_MP_INIT_SET_C
+
+/* initialize and set a digit */
+int aws_mp_init_set(aws_mp_int *a, aws_mp_digit b)
+{
+  int err;
+  if ((err = aws_mp_init(a)) != AWS_MP_OKAY) {
+     return err;
+  }
+    aws_mp_set(a, b);
+  return err;
+}
+#endif
+
+#ifdef AWS_BN_MP_GET_INT_C
+
+/* get the lower 32-bits of an mp_int */
+unsigned long aws_mp_get_int(aws_mp_int *a)
+{
+  int i;
+  unsigned long res;
+
+  if (a->used == 0) {
+     return 0;
+  }
+
+  /* get number of digits of the lsb we have to read */
+  i = AWS_MIN(a->used,(int)((sizeof(unsigned long)*CHAR_BIT+AWS_DIGIT_BIT-1)/AWS_DIGIT_BIT))-1;
+
+  /* get most significant digit of result */
+  res = AWS_JKTM_DIGIT(a,i);
+   
+  while (--i >= 0) {
+    res = (res << AWS_DIGIT_BIT) | AWS_JKTM_DIGIT(a,i);
+  }
+
+  /* force result to 32-bits always so it is consistent on non 32-bit platforms */
+  return res & 0xFFFFFFFFUL;
+}
+#endif
+
+#ifdef AWS_BN_MP_MUL_C
+
+/* high level multiplication (handles sign) */
+int aws_mp_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  int     res, neg;
+  neg = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
+
+  /* use Toom-Cook? */
+#ifdef AWS_BN_MP_TOOM_MUL_C
+  if (AWS_MIN (a->used, b->used) >= AWS_TOOM_MUL_CUTOFF) {
+    res = aws_mp_toom_mul(a, b, c);
+  } else 
+#endif
+#ifdef AWS_BN_MP_KARATSUBA_MUL_C
+  /* use Karatsuba? */
+  if (AWS_MIN (a->used, b->used) >= AWS_KARATSUBA_MUL_CUTOFF) {
+    res = aws_mp_karatsuba_mul(a, b, c);
+  } else 
+#endif
+  {
+    /* can we use the fast multiplier?
+     *
+     * The fast multiplier can be used if the output will 
+     * have less than AWS_MP_WARRAY digits and the number of
+     * digits won't affect carry propagation
+     */
+    int     digs = a->used + b->used + 1;
+
+#ifdef AWS_BN_FAST_S_MP_MUL_DIGS_C
+    if ((digs < AWS_MP_WARRAY) &&
+        AWS_MIN(a->used, b->used) <=
+        (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
+      res = aws_fast_s_mp_mul_digs(a, b, c, digs);
+    } else 
+#endif
+#ifdef AWS_BN_S_MP_MUL_DIGS_C
+      res = aws_s_mp_mul (a, b, c); /* uses s_mp_mul_digs */
+#else
+      res = AWS_MP_VAL;
+#endif
+
+  }
+  c->sign = (c->used > 0) ? neg : AWS_MP_ZPOS;
+  return res;
+}
+#endif
+
+#ifdef AWS_BN_MP_SQRMOD_C
+
+/* c = a * a (mod b) */
+int
+aws_mp_sqrmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+{
+  int     res;
+  aws_mp_int t;
+
+  if ((res = aws_mp_init(&t)) != AWS_MP_OKAY) {
+    return res;
+  }
+
+  if ((res = aws_mp_sqr(a, &t)) != AWS_MP_OKAY) {
+      aws_mp_clear(&t);
+    return res;
+  }
+  res = aws_mp_mod(&t, b, c);
+    aws_mp_clear(&t);
+  return res;
+}
+#endif
+
+#ifdef AWS_BN_MP_TO_UNSIGNED_BIN_C
+
+/* store in unsigned [big endian] format */
+int aws_mp_to_unsigned_bin(aws_mp_int *a, unsigned char *b)
 {
-  int     res;
+  int     x, res;
+  aws_mp_int t;
 
-  /* copy a to b */
-  if (a != b) {
-     if ((res = aws_mp_copy(a, b)) != AWS_MP_OKAY) {
-       return res;
-     }
+  if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+    return res;
   }
 
-  /* force the sign of b to positive */
-  b->sign = AWS_MP_ZPOS;
-
+  x = 0;
+  while (aws_mp_iszero (&t) == 0) {
+#ifndef AWS_MP_8BIT
+      b[x++] = (unsigned char) (t.dp[0] & 255);
+#else
+      b[x++] = (unsigned char) (t.dp[0] | ((t.dp[1] & 0x01) << 7));
+#endif
+    if ((res = aws_mp_div_2d(&t, 8, &t, NULL)) != AWS_MP_OKAY) {
+        aws_mp_clear(&t);
+      return res;
+    }
+  }
+    aws_bn_reverse(b, x);
+    aws_mp_clear(&t);
   return AWS_MP_OKAY;
 }
 #endif
 
-#ifdef AWS_BN_MP_CLAMP_C
+#ifdef AWS_BN_MP_TO_UNSIGNED_BIN_STREAM_C
 
-/* trim unused digits 
+/* feed the unsigned [big endian] format of a to cb, AWS_MP_STREAM_CHUNK bytes at a time
  *
- * This is used to ensure that leading zero digits are
- * trimed and the leading "used" digit will be non-zero
- * Typically very fast.  Also fixes the sign if there
- * are no more leading digits
+ * The bytes are read straight out of the digits, nothing is copied or
+ * shifted and no memory is allocated.  cb returns how many bytes it took,
+ * anything short of len stops the stream with AWS_MP_VAL.
  */
-void
-aws_mp_clamp(aws_mp_int *a)
+int aws_mp_to_unsigned_bin_stream(aws_mp_int *a, aws_ltm_stream_callback cb, void *dat)
 {
-  /* decrease used while the most significant digit is
-   * zero.
-   */
-  while (a->used > 0 && a->dp[a->used - 1] == 0) {
-    --(a->used);
-  }
-
-  /* reset the sign flag if used == 0 */
-  if (a->used == 0) {
-    a->sign = AWS_MP_ZPOS;
+  unsigned char buf[AWS_MP_STREAM_CHUNK];
+  aws_mp_digit  v;
+  int           x, n, ix, bit;
+
+  n = 0;
+  for (x = aws_mp_unsigned_bin_size(a) - 1; x >= 0; x--) {
+    /* byte x counting from the least significant end */
+    bit = x * 8;
+    ix  = bit / AWS_DIGIT_BIT;
+    bit = bit % AWS_DIGIT_BIT;
+    v   = a->dp[ix] >> bit;
+    if (bit + 8 > AWS_DIGIT_BIT && ix + 1 < a->used) {
+      v |= a->dp[ix + 1] << (AWS_DIGIT_BIT - bit);
+    }
+    buf[n++] = (unsigned char) (v & 255);
+
+    if (n == AWS_MP_STREAM_CHUNK || x == 0) {
+      if (cb(buf, n, dat) != n) {
+        return AWS_MP_VAL;
+      }
+      n = 0;
+    }
   }
+  return AWS_MP_OKAY;
 }
 #endif
 
-/* $Source$ */
-/* $Revision: 0.41 $ */
-/* $Date: 2007-04-18 09:58:18 +0000 $ */
-
-#ifdef AWS_BN_MP_SIGNED_BIN_SIZE_C
+#ifdef AWS_BN_S_MP_SQR_C
 
-/* get the size for an signed equivalent */
-int aws_mp_signed_bin_size(aws_mp_int *a)
+/* low level squaring, b = a*a, HAC pp.596-597, Algorithm 14.16 */
+int aws_s_mp_sqr(aws_mp_int *a, aws_mp_int *b)
 {
-  return 1 + aws_mp_unsigned_bin_size(a);
-}
-#endif
+  aws_mp_int t;
+  int     res, ix, iy, pa;
+  aws_mp_word r;
+  aws_mp_digit u, tmpx, *tmpt;
 
-#ifdef AWS_BN_MP_SQRT_C
+  pa = a->used;
+  if ((res = aws_mp_init_size(&t, 2 * pa + 1)) != AWS_MP_OKAY) {
+    return res;
+  }
 
-/* this function is less generic than mp_n_root, simpler and faster */
-int aws_mp_sqrt(aws_mp_int *arg, aws_mp_int *ret)
-{
-  int res;
-  aws_mp_int t1,t2;
+  /* default used is maximum possible size */
+  t.used = 2*pa + 1;
 
-  /* must be positive */
-  if (arg->sign == AWS_MP_NEG) {
-    return AWS_MP_VAL;
-  }
+  for (ix = 0; ix < pa; ix++) {
+    /* first calculate the digit at 2*ix */
+    /* calculate double precision result */
+    r = ((aws_mp_word) t.dp[2*ix]) +
+        ((aws_mp_word)a->dp[ix])*((aws_mp_word)a->dp[ix]);
 
-  /* easy out */
-  if (aws_mp_iszero(arg) == AWS_MP_YES) {
-      aws_mp_zero(ret);
-    return AWS_MP_OKAY;
-  }
+    /* store lower part in result */
+    t.dp[ix+ix] = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
 
-  if ((res = aws_mp_init_copy(&t1, arg)) != AWS_MP_OKAY) {
-    return res;
-  }
+    /* get the carry */
+    u           = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
 
-  if ((res = aws_mp_init(&t2)) != AWS_MP_OKAY) {
-    goto E2;
-  }
+    /* left hand side of A[ix] * A[iy] */
+    tmpx        = a->dp[ix];
 
-  /* First approx. (not very bad for large arg) */
-    aws_mp_rshd(&t1, t1.used / 2);
+    /* alias for where to store the results */
+    tmpt        = t.dp + (2*ix + 1);
+    
+    for (iy = ix + 1; iy < pa; iy++) {
+      /* first calculate the product */
+      r       = ((aws_mp_word)tmpx) * ((aws_mp_word)a->dp[iy]);
 
-  /* t1 > 0  */ 
-  if ((res = aws_mp_div(arg, &t1, &t2, NULL)) != AWS_MP_OKAY) {
-    goto E1;
-  }
-  if ((res = aws_mp_add(&t1, &t2, &t1)) != AWS_MP_OKAY) {
-    goto E1;
-  }
-  if ((res = aws_mp_div_2(&t1, &t1)) != AWS_MP_OKAY) {
-    goto E1;
-  }
-  /* And now t1 > sqrt(arg) */
-  do { 
-    if ((res = aws_mp_div(arg, &t1, &t2, NULL)) != AWS_MP_OKAY) {
-      goto E1;
-    }
-    if ((res = aws_mp_add(&t1, &t2, &t1)) != AWS_MP_OKAY) {
-      goto E1;
+      /* now calculate the double precision result, note we use
+       * addition instead of *2 since it's easier to optimize
+       */
+      r       = ((aws_mp_word) *tmpt) + r + r + ((aws_mp_word) u);
+
+      /* store lower part */
+      *tmpt++ = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
+
+      /* get carry */
+      u       = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
     }
-    if ((res = aws_mp_div_2(&t1, &t1)) != AWS_MP_OKAY) {
-      goto E1;
+    /* propagate upwards */
+    while (u != ((aws_mp_digit) 0)) {
+      r       = ((aws_mp_word) *tmpt) + ((aws_mp_word) u);
+      *tmpt++ = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
+      u       = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
     }
-    /* t1 >= sqrt(arg) >= t2 at this point */
-  } while (aws_mp_cmp_mag(&t1, &t2) == AWS_MP_GT);
-
-    aws_mp_exch(&t1, ret);
+  }
 
-E1:
-aws_mp_clear(&t2);
-E2:
-aws_mp_clear(&t1);
-  return res;
+    aws_mp_clamp(&t);
+    aws_mp_exch(&t, b);
+    aws_mp_clear(&t);
+  return AWS_MP_OKAY;
 }
-
 #endif
 
-#ifdef AWS_BN_MP_MONTGOMERY_SETUP_C
+#ifdef AWS_BN_MP_NEG_C
 
-/* setups the montgomery reduction stuff */
-int
-aws_mp_montgomery_setup(aws_mp_int *n, aws_mp_digit *rho)
+/* b = -a */
+int aws_mp_neg(aws_mp_int *a, aws_mp_int *b)
 {
-  aws_mp_digit x, b;
-
-/* fast inversion mod 2**k
- *
- * Based on the fact that
- *
- * XA = 1 (mod 2**n)  =>  (X(2-XA)) A = 1 (mod 2**2n)
- *                    =>  2*X*A - X*X*A*A = 1
- *                    =>  2*(1) - (1)     = 1
- */
-  b = n->dp[0];
+  int     res;
+  if (a != b) {
+     if ((res = aws_mp_copy(a, b)) != AWS_MP_OKAY) {
+        return res;
+     }
+  }
 
-  if ((b & 1) == 0) {
-    return AWS_MP_VAL;
+  if (aws_mp_iszero(b) != AWS_MP_YES) {
+     b->sign = (a->sign == AWS_MP_ZPOS) ? AWS_MP_NEG : AWS_MP_ZPOS;
+  } else {
+     b->sign = AWS_MP_ZPOS;
   }
 
-  x = (((b + 2) & 4) << 1) + b; /* here x*a==1 mod 2**4 */
-  x *= 2 - b * x;               /* here x*a==1 mod 2**8 */
-#if !defined(AWS_MP_8BIT)
-  x *= 2 - b * x;               /* here x*a==1 mod 2**16 */
+  return AWS_MP_OKAY;
+}
 #endif
-#if defined(AWS_MP_64BIT) || !(defined(AWS_MP_8BIT) || defined(AWS_MP_16BIT))
-  x *= 2 - b * x;               /* here x*a==1 mod 2**32 */
+
+#ifdef AWS_BN_MP_RADIX_SMAP_C
+
+/* chars used in radix conversions */
+const char *aws_mp_s_rmap = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz+/";
 #endif
-#ifdef AWS_MP_64BIT
-  x *= 2 - b * x;               /* here x*a==1 mod 2**64 */
+
+#ifdef AWS_BN_S_MP_RADIX_C
+
+/* fast paths for radix conversions
+ *
+ * Power of two radices are packed and unpacked bitwise straight from the
+ * digits.  Radix 10 moves whole decimal chunks [10**k, the largest power
+ * of ten that fits in a digit] at a time, and splits long numbers in
+ * half around powers 10**(k*2**i) so the bulk of the work is done by
+ * aws_mp_mul/aws_mp_div on large operands instead of one digit at a time.
+ */
+#ifndef AWS_MP_RADIX_DC_CUTOFF
+   #define AWS_MP_RADIX_DC_CUTOFF  400     /* decimal chars below which radix 10 is converted chunk by chunk */
 #endif
 
-  /* rho = -1/m mod b */
-  *rho = (unsigned long)(((aws_mp_word)1 << ((aws_mp_word) AWS_DIGIT_BIT)) - x) & AWS_MP_MASK;
+#define AWS_MP_RADIX_DC_LEVELS  32
+
+/* value of ch in the given radix, radix or more if ch is not a digit of it */
+int aws_s_mp_radix_value(int ch, int radix)
+{
+   /* if the radix < 36 the conversion is case insensitive */
+   if (radix < 36 && ch >= 'a' && ch <= 'z') {
+      ch -= 'a' - 'A';
+   }
+
+   if (ch >= '0' && ch <= '9') {
+      return ch - '0';
+   } else if (ch >= 'A' && ch <= 'Z') {
+      return ch - 'A' + 10;
+   } else if (ch >= 'a' && ch <= 'z') {
+      return ch - 'a' + 36;
+   } else if (ch == '+') {
+      return 62;
+   } else if (ch == '/') {
+      return 63;
+   }
+   return 64;
+}
+
+/* log2 of radix if it is a power of two, zero otherwise */
+int aws_s_mp_radix_log2(int radix)
+{
+   int bits;
+
+   if (radix < 2 || (radix & (radix - 1)) != 0) {
+      return 0;
+   }
+   for (bits = 0; (1 << bits) != radix; bits++);
+   return bits;
+}
+
+/* largest power of ten that fits in a digit, returns its exponent */
+static int aws_s_mp_dec_chunk(aws_mp_digit *big)
+{
+   aws_mp_digit b;
+   int          k;
+
+   for (b = 10, k = 1; b <= AWS_MP_MASK / 10; b *= 10, k++);
+   *big = b;
+   return k;
+}
+
+/* P[0..levels] = big**(2**i) */
+static int aws_s_mp_dec_powers(aws_mp_int *P, int levels, aws_mp_digit big)
+{
+   int err, x;
+
+   for (x = 0; x <= levels; x++) {
+      if ((err = aws_mp_init(&P[x])) != AWS_MP_OKAY) {
+         goto LBL_ERR;
+      }
+      if (x == 0) {
+         aws_mp_set(&P[0], big);
+      } else if ((err = aws_mp_sqr(&P[x - 1], &P[x])) != AWS_MP_OKAY) {
+         aws_mp_clear(&P[x]);
+         goto LBL_ERR;
+      }
+   }
+   return AWS_MP_OKAY;
+
+LBL_ERR:
+   while (x-- > 0) {
+      aws_mp_clear(&P[x]);
+   }
+   return err;
+}
+
+/* len chars of radix 2**bits from str into a */
+int aws_s_mp_read_radix_pow2(aws_mp_int *a, const char *str, int len, int radix, int bits)
+{
+   aws_mp_word acc;
+   int         err, accbits, ix, x;
+
+   aws_mp_zero(a);
+   if ((err = aws_mp_grow(a, (len * bits) / AWS_DIGIT_BIT + 1)) != AWS_MP_OKAY) {
+      return err;
+   }
+
+   /* feed the string in from its least significant end */
+   acc     = 0;
+   accbits = 0;
+   ix      = 0;
+   for (x = len - 1; x >= 0; x--) {
+      acc     |= ((aws_mp_word) aws_s_mp_radix_value((unsigned char) str[x], radix)) << accbits;
+      accbits += bits;
+      if (accbits >= AWS_DIGIT_BIT) {
+         a->dp[ix++] = (aws_mp_digit) (acc & ((aws_mp_word) AWS_MP_MASK));
+         acc        >>= ((aws_mp_word) AWS_DIGIT_BIT);
+         accbits     -= AWS_DIGIT_BIT;
+      }
+   }
+   if (accbits > 0) {
+      a->dp[ix++] = (aws_mp_digit) acc;
+   }
+
+   a->used = ix;
+   aws_mp_clamp(a);
+   return AWS_MP_OKAY;
+}
+
+/* chunk by chunk reading of len decimal chars */
+static int aws_s_mp_read_dec_chunks(aws_mp_int *a, const char *str, int len, int k, aws_mp_digit big)
+{
+   aws_mp_digit d;
+   int          err, n, x;
+
+   aws_mp_zero(a);
 
-  return AWS_MP_OKAY;
+   /* the first chunk takes the odd chars so the rest are whole */
+   n = len % k;
+   if (n == 0) {
+      n = k;
+   }
+   while (len > 0) {
+      for (d = 0, x = 0; x < n; x++) {
+         d = d * 10 + (aws_mp_digit) (str[x] - '0');
+      }
+      if (n == k) {
+         err = aws_mp_mul_d(a, big, a);
+      } else {
+         err = AWS_MP_OKAY;
+      }
+      if (err != AWS_MP_OKAY || (err = aws_mp_add_d(a, d, a)) != AWS_MP_OKAY) {
+         return err;
+      }
+      str += n;
+      len -= n;
+      n    = k;
+   }
+   return AWS_MP_OKAY;
 }
-#endif
 
-#ifdef AWS_BN_MP_FWRITE_C
-
-int aws_mp_fwrite(aws_mp_int *a, int radix, FILE *stream)
+/* a = str[0..len), the low half being P[level] chars long */
+static int aws_s_mp_read_dec_rec(aws_mp_int *a, const char *str, int len, aws_mp_int *P, int level, int k, aws_mp_digit big)
 {
-   char *buf = NULL;
-   int err = 0, len = 0, x = 0;
-   
-   if ((err = aws_mp_radix_size(a, radix, &len)) != AWS_MP_OKAY) {
+   aws_mp_int t;
+   int        err, m;
+
+   while (level >= 0 && len <= (k << level)) {
+      --level;
+   }
+   if (level < 0 || len <= AWS_MP_RADIX_DC_CUTOFF) {
+      return aws_s_mp_read_dec_chunks(a, str, len, k, big);
+   }
+
+   /* a = high * 10**m + low */
+   m = k << level;
+   if ((err = aws_mp_init(&t)) != AWS_MP_OKAY) {
       return err;
    }
+   if ((err = aws_s_mp_read_dec_rec(&t, str, len - m, P, level - 1, k, big)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   if ((err = aws_s_mp_read_dec_rec(a, str + len - m, m, P, level - 1, k, big)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   if ((err = aws_mp_mul(&t, &P[level], &t)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   err = aws_mp_add(&t, a, a);
 
-   buf = AWS_OPT_CAST(char) AWS_XMALLOC (len);
-   if (buf == NULL) {
-      return AWS_MP_MEM;
+LBL_ERR:
+   aws_mp_clear(&t);
+   return err;
+}
+
+/* len decimal chars from str into a */
+int aws_s_mp_read_radix_dec(aws_mp_int *a, const char *str, int len)
+{
+   aws_mp_int   P[AWS_MP_RADIX_DC_LEVELS];
+   aws_mp_digit big;
+   int          err, k, levels, x;
+
+   k = aws_s_mp_dec_chunk(&big);
+   if (len <= AWS_MP_RADIX_DC_CUTOFF) {
+      return aws_s_mp_read_dec_chunks(a, str, len, k, big);
    }
-   
-   if ((err = aws_mp_toradix(a, buf, radix)) != AWS_MP_OKAY) {
-      AWS_XFREE (buf);
+
+   /* the top split halves the string */
+   for (levels = 0; (k << (levels + 1)) < len && levels < AWS_MP_RADIX_DC_LEVELS - 1; levels++);
+   if ((err = aws_s_mp_dec_powers(P, levels, big)) != AWS_MP_OKAY) {
       return err;
    }
-   
-   for (x = 0; x < len; x++) {
-       if (fputc(buf[x], stream) == EOF) {
-          AWS_XFREE (buf);
-          return AWS_MP_VAL;
-       }
+   err = aws_s_mp_read_dec_rec(a, str, len, P, levels, k, big);
+   for (x = 0; x <= levels; x++) {
+      aws_mp_clear(&P[x]);
    }
-   
-   AWS_XFREE (buf);
-   return AWS_MP_OKAY;
+   return err;
 }
 
-#endif
-
-#ifdef AWS_BN_MP_EXCH_C
+/* writes |a| != 0 in radix 2**bits with a NULL, returns the char count */
+int aws_s_mp_toradix_pow2(aws_mp_int *a, char *str, int bits)
+{
+   aws_mp_digit v;
+   int          n, x, ix, off;
+
+   n = (aws_mp_count_bits(a) + bits - 1) / bits;
+   for (x = n - 1; x >= 0; x--) {
+      ix  = (x * bits) / AWS_DIGIT_BIT;
+      off = (x * bits) % AWS_DIGIT_BIT;
+      v   = a->dp[ix] >> off;
+      if (off + bits > AWS_DIGIT_BIT && ix + 1 < a->used) {
+         v |= a->dp[ix + 1] << (AWS_DIGIT_BIT - off);
+      }
+      *str++ = aws_mp_s_rmap[v & (((aws_mp_digit) 1 << bits) - 1)];
+   }
+   *str = '\0';
+   return n;
+}
 
-/* swap the elements of two integers, for cases where you can't simply swap the 
- * mp_int pointers around
- */
-void
-aws_mp_exch(aws_mp_int *a, aws_mp_int *b)
+/* chunk by chunk writing of a, destroys a, pads with zeros to pad chars */
+static int aws_s_mp_todec_chunks(aws_mp_int *a, char **str, int pad, int k, aws_mp_digit big)
 {
-  aws_mp_int t;
+   aws_mp_digit d;
+   char        *s = *str;
+   int          err, x;
 
-  t  = *a;
-  *a = *b;
-  *b = t;
+   /* the chars come out least significant first */
+   while (aws_mp_iszero(a) == AWS_MP_NO) {
+      if ((err = aws_mp_div_d(a, big, a, &d)) != AWS_MP_OKAY) {
+         return err;
+      }
+      if (aws_mp_iszero(a) == AWS_MP_YES) {
+         for (; d != 0; d /= 10) {
+            *s++ = (char) ('0' + (int) (d % 10));
+         }
+      } else {
+         for (x = 0; x < k; x++, d /= 10) {
+            *s++ = (char) ('0' + (int) (d % 10));
+         }
+      }
+   }
+   while ((int) (s - *str) < pad) {
+      *s++ = '0';
+   }
+
+   aws_bn_reverse((unsigned char *) *str, (int) (s - *str));
+   *str = s;
+   return AWS_MP_OKAY;
 }
-#endif
 
-#ifdef AWS_BN_PRIME_TAB_C
+/* writes a < P[level+1], destroys a, pads with zeros to pad chars */
+static int aws_s_mp_todec_rec(aws_mp_int *a, char **str, int pad, aws_mp_int *P, int level, int k, aws_mp_digit big)
+{
+   aws_mp_int q;
+   int        err, m;
 
-const aws_mp_digit aws_ltm_prime_tab[] = {
-  0x0002, 0x0003, 0x0005, 0x0007, 0x000B, 0x000D, 0x0011, 0x0013,
-  0x0017, 0x001D, 0x001F, 0x0025, 0x0029, 0x002B, 0x002F, 0x0035,
-  0x003B, 0x003D, 0x0043, 0x0047, 0x0049, 0x004F, 0x0053, 0x0059,
-  0x0061, 0x0065, 0x0067, 0x006B, 0x006D, 0x0071, 0x007F,
-#ifndef AWS_MP_8BIT
-  0x0083,
-  0x0089, 0x008B, 0x0095, 0x0097, 0x009D, 0x00A3, 0x00A7, 0x00AD,
-  0x00B3, 0x00B5, 0x00BF, 0x00C1, 0x00C5, 0x00C7, 0x00D3, 0x00DF,
-  0x00E3, 0x00E5, 0x00E9, 0x00EF, 0x00F1, 0x00FB, 0x0101, 0x0107,
-  0x010D, 0x010F, 0x0115, 0x0119, 0x011B, 0x0125, 0x0133, 0x0137,
+   /* without padding leading zero halves are skipped */
+   while (level >= 0 && pad == 0 && aws_mp_cmp_mag(a, &P[level]) == AWS_MP_LT) {
+      --level;
+   }
+   if (level < 0 || (k << (level + 1)) <= AWS_MP_RADIX_DC_CUTOFF) {
+      return aws_s_mp_todec_chunks(a, str, pad, k, big);
+   }
 
-  0x0139, 0x013D, 0x014B, 0x0151, 0x015B, 0x015D, 0x0161, 0x0167,
-  0x016F, 0x0175, 0x017B, 0x017F, 0x0185, 0x018D, 0x0191, 0x0199,
-  0x01A3, 0x01A5, 0x01AF, 0x01B1, 0x01B7, 0x01BB, 0x01C1, 0x01C9,
-  0x01CD, 0x01CF, 0x01D3, 0x01DF, 0x01E7, 0x01EB, 0x01F3, 0x01F7,
-  0x01FD, 0x0209, 0x020B, 0x021D, 0x0223, 0x022D, 0x0233, 0x0239,
-  0x023B, 0x0241, 0x024B, 0x0251, 0x0257, 0x0259, 0x025F, 0x0265,
-  0x0269, 0x026B, 0x0277, 0x0281, 0x0283, 0x0287, 0x028D, 0x0293,
-  0x0295, 0x02A1, 0x02A5, 0x02AB, 0x02B3, 0x02BD, 0x02C5, 0x02CF,
+   /* a = q * 10**m + a */
+   m = k << level;
+   if ((err = aws_mp_init(&q)) != AWS_MP_OKAY) {
+      return err;
+   }
+   if ((err = aws_mp_div(a, &P[level], &q, a)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   if ((err = aws_s_mp_todec_rec(&q, str, (pad > m) ? pad - m : 0, P, level - 1, k, big)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   err = aws_s_mp_todec_rec(a, str, m, P, level - 1, k, big);
 
-  0x02D7, 0x02DD, 0x02E3, 0x02E7, 0x02EF, 0x02F5, 0x02F9, 0x0301,
-  0x0305, 0x0313, 0x031D, 0x0329, 0x032B, 0x0335, 0x0337, 0x033B,
-  0x033D, 0x0347, 0x0355, 0x0359, 0x035B, 0x035F, 0x036D, 0x0371,
-  0x0373, 0x0377, 0x038B, 0x038F, 0x0397, 0x03A1, 0x03A9, 0x03AD,
-  0x03B3, 0x03B9, 0x03C7, 0x03CB, 0x03D1, 0x03D7, 0x03DF, 0x03E5,
-  0x03F1, 0x03F5, 0x03FB, 0x03FD, 0x0407, 0x0409, 0x040F, 0x0419,
-  0x041B, 0x0425, 0x0427, 0x042D, 0x043F, 0x0443, 0x0445, 0x0449,
-  0x044F, 0x0455, 0x045D, 0x0463, 0x0469, 0x047F, 0x0481, 0x048B,
+LBL_ERR:
+   aws_mp_clear(&q);
+   return err;
+}
 
-  0x0493, 0x049D, 0x04A3, 0x04A9, 0x04B1, 0x04BD, 0x04C1, 0x04C7,
-  0x04CD, 0x04CF, 0x04D5, 0x04E1, 0x04EB, 0x04FD, 0x04FF, 0x0503,
-  0x0509, 0x050B, 0x0511, 0x0515, 0x0517, 0x051B, 0x0527, 0x0529,
-  0x052F, 0x0551, 0x0557, 0x055D, 0x0565, 0x0577, 0x0581, 0x058F,
-  0x0593, 0x0595, 0x0599, 0x059F, 0x05A7, 0x05AB, 0x05AD, 0x05B3,
-  0x05BF, 0x05C9, 0x05CB, 0x05CF, 0x05D1, 0x05D5, 0x05DB, 0x05E7,
-  0x05F3, 0x05FB, 0x0607, 0x060D, 0x0611, 0x0617, 0x061F, 0x0623,
-  0x062B, 0x062F, 0x063D, 0x0641, 0x0647, 0x0649, 0x064D, 0x0653
-#endif
-};
-#endif
+/* writes |a| != 0 in decimal with a NULL, *len gets the char count */
+int aws_s_mp_toradix_dec(aws_mp_int *a, char *str, int *len)
+{
+   aws_mp_int   t, P[AWS_MP_RADIX_DC_LEVELS];
+   aws_mp_digit big;
+   char        *s = str;
+   int          err, k, levels, n, x;
 
-#ifdef AWS_BN_MP_INIT_SET_C
+   k = aws_s_mp_dec_chunk(&big);
+   if ((err = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+      return err;
+   }
+   t.sign = AWS_MP_ZPOS;
+
+   /* no more than n chars, pick the split that halves them */
+   n = (int) (((long) aws_mp_count_bits(a) * 30103L) / 100000L) + 1;
+   levels = -1;
+   if (n > AWS_MP_RADIX_DC_CUTOFF) {
+      for (levels = 0; (k << (levels + 1)) < n && levels < AWS_MP_RADIX_DC_LEVELS - 1; levels++);
+      if ((err = aws_s_mp_dec_powers(P, levels, big)) != AWS_MP_OKAY) {
+         goto LBL_T;
+      }
+   }
 
-/* initialize and set a digit */
-int aws_mp_init_set(aws_mp_int *a, aws_mp_digit b)
+   err = aws_s_mp_todec_rec(&t, &s, 0, P, levels, k, big);
+   *s = '\0';
+   *len = (int) (s - str);
+
+   for (x = 0; x <= levels; x++) {
+      aws_mp_clear(&P[x]);
+   }
+LBL_T:
+   aws_mp_clear(&t);
+   return err;
+}
+
+/* number of decimal chars in |a| != 0 */
+int aws_s_mp_radix_size_dec(aws_mp_int *a, int *size)
 {
-  int err;
-  if ((err = aws_mp_init(a)) != AWS_MP_OKAY) {
-     return err;
-  }
-    aws_mp_set(a, b);
-  return err;
+   aws_mp_int p;
+   int        err, n;
+
+   /* n is at most one or two above the real count, check it against 10**(n-1) */
+   n = (int) (((long) aws_mp_count_bits(a) * 30103L) / 100000L) + 1;
+   if ((err = aws_mp_init_set(&p, 10)) != AWS_MP_OKAY) {
+      return err;
+   }
+   if ((err = aws_mp_expt_d(&p, (aws_mp_digit) (n - 1), &p)) != AWS_MP_OKAY) {
+      goto LBL_ERR;
+   }
+   while (n > 1 && aws_mp_cmp_mag(a, &p) == AWS_MP_LT) {
+      if ((err = aws_mp_div_d(&p, 10, &p, NULL)) != AWS_MP_OKAY) {
+         goto LBL_ERR;
+      }
+      --n;
+   }
+   *size = n;
+
+LBL_ERR:
+   aws_mp_clear(&p);
+   return err;
 }
 #endif
 
-#ifdef AWS_BN_MP_GET_INT_C
+#ifdef AWS_BN_FAST_S_MP_COMBA_C
 
-/* get the lower 32-bits of an mp_int */
-unsigned long aws_mp_get_int(aws_mp_int *a)
+/* column kernels behind aws_fast_s_mp_mul_digs and aws_fast_s_mp_sqr
+ *
+ * Each kernel produces the normalised digits of the product in W, the
+ * portable ones are the original comba loops.  The kernel for the running
+ * CPU is picked once, on first use.  x86-64 has none: MULX/ADCX/ADOX and
+ * split-accumulator versions of the multiply never beat the C loop, which
+ * the compiler already turns into MUL/ADD/ADC, by more than run-to-run
+ * noise at any size from 512 to 6144 bits.
+ */
+
+/* W[0..pa-1] = low pa digits of a * b */
+static void aws_s_mp_comba_mul_c(aws_mp_digit *W, const aws_mp_digit *a, int na, const aws_mp_digit *b, int nb, int pa)
 {
-  int i;
-  unsigned long res;
+  int     ix, iz;
+  aws_mp_word  _W;
 
-  if (a->used == 0) {
-     return 0;
-  }
+  /* clear the carry */
+  _W = 0;
+  for (ix = 0; ix < pa; ix++) { 
+      int      tx, ty;
+      int      iy;
+      const aws_mp_digit *tmpx, *tmpy;
 
-  /* get number of digits of the lsb we have to read */
-  i = AWS_MIN(a->used,(int)((sizeof(unsigned long)*CHAR_BIT+AWS_DIGIT_BIT-1)/AWS_DIGIT_BIT))-1;
+      /* get offsets into the two bignums */
+      ty = AWS_MIN(nb-1, ix);
+      tx = ix - ty;
 
-  /* get most significant digit of result */
-  res = AWS_JKTM_DIGIT(a,i);
-   
-  while (--i >= 0) {
-    res = (res << AWS_DIGIT_BIT) | AWS_JKTM_DIGIT(a,i);
-  }
+      /* setup temp aliases */
+      tmpx = a + tx;
+      tmpy = b + ty;
 
-  /* force result to 32-bits always so it is consistent on non 32-bit platforms */
-  return res & 0xFFFFFFFFUL;
-}
-#endif
+      /* this is the number of times the loop will iterrate, essentially 
+         while (tx++ < a->used && ty-- >= 0) { ... }
+       */
+      iy = AWS_MIN(na-tx, ty+1);
 
-#ifdef AWS_BN_MP_MUL_C
+      /* execute loop */
+      for (iz = 0; iz < iy; ++iz) {
+         _W += ((aws_mp_word)*tmpx++)*((aws_mp_word)*tmpy--);
+      }
 
-/* high level multiplication (handles sign) */
-int aws_mp_mul(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
+      /* store term */
+      W[ix] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+
+      /* make next carry */
+      _W = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+}
+
+/* W[0..2*na-1] = a * a */
+static void aws_s_mp_comba_sqr_c(aws_mp_digit *W, const aws_mp_digit *a, int na)
 {
-  int     res, neg;
-  neg = (a->sign == b->sign) ? AWS_MP_ZPOS : AWS_MP_NEG;
+  int       pa, ix, iz;
+  aws_mp_word   W1;
 
-  /* use Toom-Cook? */
-#ifdef AWS_BN_MP_TOOM_MUL_C
-  if (AWS_MIN (a->used, b->used) >= AWS_TOOM_MUL_CUTOFF) {
-    res = aws_mp_toom_mul(a, b, c);
-  } else 
-#endif
-#ifdef AWS_BN_MP_KARATSUBA_MUL_C
-  /* use Karatsuba? */
-  if (AWS_MIN (a->used, b->used) >= AWS_KARATSUBA_MUL_CUTOFF) {
-    res = aws_mp_karatsuba_mul(a, b, c);
-  } else 
-#endif
-  {
-    /* can we use the fast multiplier?
-     *
-     * The fast multiplier can be used if the output will 
-     * have less than AWS_MP_WARRAY digits and the number of
-     * digits won't affect carry propagation
-     */
-    int     digs = a->used + b->used + 1;
+  pa = na + na;
+  W1 = 0;
+  for (ix = 0; ix < pa; ix++) { 
+      int      tx, ty, iy;
+      aws_mp_word  _W;
+      const aws_mp_digit *tmpx, *tmpy;
 
-#ifdef AWS_BN_FAST_S_MP_MUL_DIGS_C
-    if ((digs < AWS_MP_WARRAY) &&
-        AWS_MIN(a->used, b->used) <=
-        (1 << ((CHAR_BIT * sizeof (aws_mp_word)) - (2 * AWS_DIGIT_BIT)))) {
-      res = aws_fast_s_mp_mul_digs(a, b, c, digs);
-    } else 
-#endif
-#ifdef AWS_BN_S_MP_MUL_DIGS_C
-      res = aws_s_mp_mul (a, b, c); /* uses s_mp_mul_digs */
-#else
-      res = AWS_MP_VAL;
-#endif
+      /* clear counter */
+      _W = 0;
+
+      /* get offsets into the two bignums */
+      ty = AWS_MIN(na-1, ix);
+      tx = ix - ty;
 
-  }
-  c->sign = (c->used > 0) ? neg : AWS_MP_ZPOS;
-  return res;
-}
-#endif
+      /* setup temp aliases */
+      tmpx = a + tx;
+      tmpy = a + ty;
 
-#ifdef AWS_BN_MP_SQRMOD_C
+      /* this is the number of times the loop will iterrate, essentially
+         while (tx++ < a->used && ty-- >= 0) { ... }
+       */
+      iy = AWS_MIN(na-tx, ty+1);
 
-/* c = a * a (mod b) */
-int
-aws_mp_sqrmod(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c)
-{
-  int     res;
-  aws_mp_int t;
+      /* now for squaring tx can never equal ty 
+       * we halve the distance since they approach at a rate of 2x
+       * and we have to round because odd cases need to be executed
+       */
+      iy = AWS_MIN(iy, (ty-tx+1)>>1);
 
-  if ((res = aws_mp_init(&t)) != AWS_MP_OKAY) {
-    return res;
-  }
+      /* execute loop */
+      for (iz = 0; iz < iy; iz++) {
+         _W += ((aws_mp_word)*tmpx++)*((aws_mp_word)*tmpy--);
+      }
 
-  if ((res = aws_mp_sqr(a, &t)) != AWS_MP_OKAY) {
-      aws_mp_clear(&t);
-    return res;
+      /* double the inner product and add carry */
+      _W = _W + _W + W1;
+
+      /* even columns have the square term in them */
+      if ((ix&1) == 0) {
+         _W += ((aws_mp_word)a[ix>>1])*((aws_mp_word)a[ix>>1]);
+      }
+
+      /* store it */
+      W[ix] = (aws_mp_digit)(_W & AWS_MP_MASK);
+
+      /* make next carry */
+      W1 = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
   }
-  res = aws_mp_mod(&t, b, c);
-    aws_mp_clear(&t);
-  return res;
 }
-#endif
 
-#ifdef AWS_BN_MP_TO_UNSIGNED_BIN_C
+#if defined(AWS_MP_USE_NEON) && defined(__aarch64__) && defined(__ARM_NEON) && !defined(AWS_MP_64BIT) && !defined(AWS_MP_NO_ASM) && (AWS_DIGIT_BIT <= 28)
+#define AWS_MP_COMBA_NEON
+#include <arm_neon.h>
 
-/* store in unsigned [big endian] format */
-int aws_mp_to_unsigned_bin(aws_mp_int *a, unsigned char *b)
+/* AArch64 NEON kernel for 28-bit digits
+ *
+ * Digits fit in 32 bits so a column is summed two products per UMLAL in
+ * 64-bit lanes, four per iteration over two accumulators.  The b side is
+ * walked backwards so its lanes are swapped with REV64 after narrowing.
+ * A column holds fewer than AWS_MP_WARRAY products of at most 56 bits so
+ * the 64-bit lanes cannot overflow.  ASIMD is part of the AArch64 base
+ * ISA so this kernel needs no runtime check.  It is only built with
+ * -DAWS_MP_USE_NEON until "make check-aarch64" in sdk/bignum has passed
+ * on real hardware or under qemu.
+ */
+static aws_mp_word aws_s_mp_comba_column_neon(const aws_mp_digit *tmpx, const aws_mp_digit *tmpy, int iy)
 {
-  int     x, res;
-  aws_mp_int t;
+  uint64x2_t acc0 = vdupq_n_u64(0), acc1 = vdupq_n_u64(0);
+  aws_mp_word _W;
+  int iz;
 
-  if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
-    return res;
+  for (iz = 0; iz + 3 < iy; iz += 4) {
+     uint32x2_t x0 = vmovn_u64(vld1q_u64((const uint64_t *)tmpx + iz));
+     uint32x2_t x1 = vmovn_u64(vld1q_u64((const uint64_t *)tmpx + iz + 2));
+     uint32x2_t y0 = vrev64_u32(vmovn_u64(vld1q_u64((const uint64_t *)tmpy - iz - 1)));
+     uint32x2_t y1 = vrev64_u32(vmovn_u64(vld1q_u64((const uint64_t *)tmpy - iz - 3)));
+     acc0 = vmlal_u32(acc0, x0, y0);
+     acc1 = vmlal_u32(acc1, x1, y1);
   }
 
-  x = 0;
-  while (aws_mp_iszero (&t) == 0) {
-#ifndef AWS_MP_8BIT
-      b[x++] = (unsigned char) (t.dp[0] & 255);
-#else
-      b[x++] = (unsigned char) (t.dp[0] | ((t.dp[1] & 0x01) << 7));
-#endif
-    if ((res = aws_mp_div_2d(&t, 8, &t, NULL)) != AWS_MP_OKAY) {
-        aws_mp_clear(&t);
-      return res;
-    }
+  _W = vaddvq_u64(vaddq_u64(acc0, acc1));
+  for (; iz < iy; iz++) {
+     _W += ((aws_mp_word)tmpx[iz])*((aws_mp_word)tmpy[-iz]);
   }
-    aws_bn_reverse(b, x);
-    aws_mp_clear(&t);
-  return AWS_MP_OKAY;
+  return _W;
 }
-#endif
-
-#ifdef AWS_BN_S_MP_SQR_C
 
-/* low level squaring, b = a*a, HAC pp.596-597, Algorithm 14.16 */
-int aws_s_mp_sqr(aws_mp_int *a, aws_mp_int *b)
+static void aws_s_mp_comba_mul_neon(aws_mp_digit *W, const aws_mp_digit *a, int na, const aws_mp_digit *b, int nb, int pa)
 {
-  aws_mp_int t;
-  int     res, ix, iy, pa;
-  aws_mp_word r;
-  aws_mp_digit u, tmpx, *tmpt;
+  int     ix, tx, ty, iy;
+  aws_mp_word  _W;
 
-  pa = a->used;
-  if ((res = aws_mp_init_size(&t, 2 * pa + 1)) != AWS_MP_OKAY) {
-    return res;
+  /* clear the carry */
+  _W = 0;
+  for (ix = 0; ix < pa; ix++) {
+     ty = AWS_MIN(nb-1, ix);
+     tx = ix - ty;
+     iy = AWS_MIN(na-tx, ty+1);
+
+     _W += aws_s_mp_comba_column_neon(a + tx, b + ty, iy);
+
+     /* store term and make next carry */
+     W[ix] = ((aws_mp_digit)_W) & AWS_MP_MASK;
+     _W = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
   }
+}
 
-  /* default used is maximum possible size */
-  t.used = 2*pa + 1;
+static void aws_s_mp_comba_sqr_neon(aws_mp_digit *W, const aws_mp_digit *a, int na)
+{
+  int     pa, ix, tx, ty, iy;
+  aws_mp_word  _W, W1;
 
+  pa = na + na;
+  W1 = 0;
   for (ix = 0; ix < pa; ix++) {
-    /* first calculate the digit at 2*ix */
-    /* calculate double precision result */
-    r = ((aws_mp_word) t.dp[2*ix]) +
-        ((aws_mp_word)a->dp[ix])*((aws_mp_word)a->dp[ix]);
+     ty = AWS_MIN(na-1, ix);
+     tx = ix - ty;
+     iy = AWS_MIN(na-tx, ty+1);
+     iy = AWS_MIN(iy, (ty-tx+1)>>1);
 
-    /* store lower part in result */
-    t.dp[ix+ix] = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
+     _W = aws_s_mp_comba_column_neon(a + tx, a + ty, iy);
 
-    /* get the carry */
-    u           = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
+     /* double the inner product and add carry */
+     _W = _W + _W + W1;
 
-    /* left hand side of A[ix] * A[iy] */
-    tmpx        = a->dp[ix];
+     /* even columns have the square term in them */
+     if ((ix&1) == 0) {
+        _W += ((aws_mp_word)a[ix>>1])*((aws_mp_word)a[ix>>1]);
+     }
 
-    /* alias for where to store the results */
-    tmpt        = t.dp + (2*ix + 1);
-    
-    for (iy = ix + 1; iy < pa; iy++) {
-      /* first calculate the product */
-      r       = ((aws_mp_word)tmpx) * ((aws_mp_word)a->dp[iy]);
+     /* store it and make next carry */
+     W[ix] = (aws_mp_digit)(_W & AWS_MP_MASK);
+     W1 = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
+  }
+}
+#endif
 
-      /* now calculate the double precision result, note we use
-       * addition instead of *2 since it's easier to optimize
-       */
-      r       = ((aws_mp_word) *tmpt) + r + r + ((aws_mp_word) u);
+#include <pthread.h>
 
-      /* store lower part */
-      *tmpt++ = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
+/* chosen once per process, read without locking afterwards */
+static aws_mp_comba_mul_kernel aws_s_mp_comba_mul_selected;
+static aws_mp_comba_sqr_kernel aws_s_mp_comba_sqr_selected;
+static pthread_once_t          aws_s_mp_comba_once = PTHREAD_ONCE_INIT;
 
-      /* get carry */
-      u       = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
-    }
-    /* propagate upwards */
-    while (u != ((aws_mp_digit) 0)) {
-      r       = ((aws_mp_word) *tmpt) + ((aws_mp_word) u);
-      *tmpt++ = (aws_mp_digit) (r & ((aws_mp_word) AWS_MP_MASK));
-      u       = (aws_mp_digit)(r >> ((aws_mp_word) AWS_DIGIT_BIT));
-    }
-  }
+static void aws_s_mp_comba_select(void)
+{
+  aws_mp_comba_sqr_kernel sqr = aws_s_mp_comba_sqr_c;
+  aws_mp_comba_mul_kernel mul = aws_s_mp_comba_mul_c;
 
-    aws_mp_clamp(&t);
-    aws_mp_exch(&t, b);
-    aws_mp_clear(&t);
-  return AWS_MP_OKAY;
-}
+#if defined(AWS_MP_COMBA_NEON)
+  mul = aws_s_mp_comba_mul_neon;
+  sqr = aws_s_mp_comba_sqr_neon;
 #endif
 
-#ifdef AWS_BN_MP_NEG_C
+  aws_s_mp_comba_sqr_selected = sqr;
+  aws_s_mp_comba_mul_selected = mul;
+}
 
-/* b = -a */
-int aws_mp_neg(aws_mp_int *a, aws_mp_int *b)
+/* returns the multiply kernel for this CPU, or the portable one if generic != 0 */
+aws_mp_comba_mul_kernel aws_mp_comba_mul_kernel_get(int generic)
 {
-  int     res;
-  if (a != b) {
-     if ((res = aws_mp_copy(a, b)) != AWS_MP_OKAY) {
-        return res;
-     }
+  if (generic != 0) {
+     return aws_s_mp_comba_mul_c;
   }
+  pthread_once(&aws_s_mp_comba_once, aws_s_mp_comba_select);
+  return aws_s_mp_comba_mul_selected;
+}
 
-  if (aws_mp_iszero(b) != AWS_MP_YES) {
-     b->sign = (a->sign == AWS_MP_ZPOS) ? AWS_MP_NEG : AWS_MP_ZPOS;
-  } else {
-     b->sign = AWS_MP_ZPOS;
+/* returns the squaring kernel for this CPU, or the portable one if generic != 0 */
+aws_mp_comba_sqr_kernel aws_mp_comba_sqr_kernel_get(int generic)
+{
+  if (generic != 0) {
+     return aws_s_mp_comba_sqr_c;
   }
-
-  return AWS_MP_OKAY;
+  pthread_once(&aws_s_mp_comba_once, aws_s_mp_comba_select);
+  return aws_s_mp_comba_sqr_selected;
 }
 #endif
 
-#ifdef AWS_BN_MP_RADIX_SMAP_C
-
-/* chars used in radix conversions */
-const char *aws_mp_s_rmap = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz+/";
-#endif
-
 #ifdef AWS_BN_FAST_S_MP_MUL_DIGS_C
 
 /* Fast (comba) multiplier
@@ -5248,9 +7022,8 @@ const char *aws_mp_s_rmap = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmno
  */
 int aws_fast_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs)
 {
-  int     olduse, res, pa, ix, iz;
-	aws_mp_digit W[AWS_MP_WARRAY] = {};
-  register aws_mp_word  _W;
+  int     olduse, res, pa, ix;
+  aws_mp_digit W[AWS_MP_WARRAY];
 
   /* grow the destination as required */
   if (c->alloc < digs) {
@@ -5262,38 +7035,9 @@ int aws_fast_s_mp_mul_digs(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int digs
   /* number of output digits to produce */
   pa = AWS_MIN(digs, a->used + b->used);
 
-  /* clear the carry */
-  _W = 0;
-  for (ix = 0; ix < pa; ix++) { 
-      int      tx, ty;
-      int      iy;
-      aws_mp_digit *tmpx, *tmpy;
-
-      /* get offsets into the two bignums */
-      ty = AWS_MIN(b->used-1, ix);
-      tx = ix - ty;
-
-      /* setup temp aliases */
-      tmpx = a->dp + tx;
-      tmpy = b->dp + ty;
-
-      /* this is the number of times the loop will iterrate, essentially 
-         while (tx++ < a->used && ty-- >= 0) { ... }
-       */
-      iy = AWS_MIN(a->used-tx, ty+1);
-
-      /* execute loop */
-      for (iz = 0; iz < iy; ++iz) {
-         _W += ((aws_mp_word)*tmpx++)*((aws_mp_word)*tmpy--);
-
-      }
-
-      /* store term */
-      W[ix] = ((aws_mp_digit)_W) & AWS_MP_MASK;
-
-      /* make next carry */
-      _W = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
- }
+  /* compute the columns, the digit above them is always zero */
+  aws_mp_comba_mul_kernel_get(0)(W, a->dp, a->used, b->dp, b->used, pa);
+  W[pa] = 0;
 
   /* setup dest */
   olduse  = c->used;
@@ -5537,9 +7281,8 @@ After that loop you do the squares and add them in.
 
 int aws_fast_s_mp_sqr(aws_mp_int *a, aws_mp_int *b)
 {
-  int       olduse, res, pa, ix, iz;
-  aws_mp_digit   W[AWS_MP_WARRAY], *tmpx;
-  aws_mp_word   W1;
+  int       olduse, res, pa, ix;
+  aws_mp_digit   W[AWS_MP_WARRAY];
 
   /* grow the destination as required */
   pa = a->used + a->used;
@@ -5549,54 +7292,8 @@ int aws_fast_s_mp_sqr(aws_mp_int *a, aws_mp_int *b)
     }
   }
 
-  /* number of output digits to produce */
-  W1 = 0;
-  for (ix = 0; ix < pa; ix++) { 
-      int      tx, ty, iy;
-      aws_mp_word  _W;
-      aws_mp_digit *tmpy;
-
-      /* clear counter */
-      _W = 0;
-
-      /* get offsets into the two bignums */
-      ty = AWS_MIN(a->used-1, ix);
-      tx = ix - ty;
-
-      /* setup temp aliases */
-      tmpx = a->dp + tx;
-      tmpy = a->dp + ty;
-
-      /* this is the number of times the loop will iterrate, essentially
-         while (tx++ < a->used && ty-- >= 0) { ... }
-       */
-      iy = AWS_MIN(a->used-tx, ty+1);
-
-      /* now for squaring tx can never equal ty 
-       * we halve the distance since they approach at a rate of 2x
-       * and we have to round because odd cases need to be executed
-       */
-      iy = AWS_MIN(iy, (ty-tx+1)>>1);
-
-      /* execute loop */
-      for (iz = 0; iz < iy; iz++) {
-         _W += ((aws_mp_word)*tmpx++)*((aws_mp_word)*tmpy--);
-      }
-
-      /* double the inner product and add carry */
-      _W = _W + _W + W1;
-
-      /* even columns have the square term in them */
-      if ((ix&1) == 0) {
-         _W += ((aws_mp_word)a->dp[ix>>1])*((aws_mp_word)a->dp[ix>>1]);
-      }
-
-      /* store it */
-      W[ix] = (aws_mp_digit)(_W & AWS_MP_MASK);
-
-      /* make next carry */
-      W1 = _W >> ((aws_mp_word)AWS_DIGIT_BIT);
-  }
+  /* compute the columns */
+  aws_mp_comba_sqr_kernel_get(0)(W, a->dp, a->used);
 
   /* setup dest */
   olduse  = b->used;
@@ -5772,6 +7469,16 @@ int aws_mp_toradix_n(aws_mp_int *a, char *str, int radix, int maxlen)
      return AWS_MP_OKAY;
   }
 
+  /* the faster paths of aws_mp_toradix when it all fits */
+  if (aws_s_mp_radix_log2(radix) != 0 || radix == 10) {
+    if ((res = aws_mp_radix_size(a, radix, &digs)) != AWS_MP_OKAY) {
+      return res;
+    }
+    if (digs <= maxlen) {
+      return aws_mp_toradix(a, str, radix);
+    }
+  }
+
   if ((res = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
     return res;
   }
@@ -6788,8 +8495,7 @@ aws_mp_rand(aws_mp_int *a, int digits)
 /* read a string [ASCII] in a given radix */
 int aws_mp_read_radix(aws_mp_int *a, const char *str, int radix)
 {
-  int     y, res, neg;
-  char    ch;
+  int     y, res, neg, len, bits;
 
   /* zero the digit bignum */
     aws_mp_zero(a);
@@ -6809,37 +8515,32 @@ int aws_mp_read_radix(aws_mp_int *a, const char *str, int radix)
     neg = AWS_MP_ZPOS;
   }
 
-  /* set the integer to the default of zero */
-    aws_mp_zero(a);
-  
-  /* process each digit of the string */
-  while (*str) {
-    /* if the radix < 36 the conversion is case insensitive
-     * this allows numbers like 1AB and 1ab to represent the same  value
-     * [e.g. in hex]
-     */
-    ch = (char) ((radix < 36) ? toupper (*str) : *str);
-    for (y = 0; y < 64; y++) {
-      if (ch == aws_mp_s_rmap[y]) {
-         break;
-      }
+  /* find the run of valid digits, the number ends at the first other char */
+  for (len = 0; aws_s_mp_radix_value((unsigned char) str[len], radix) < radix; len++);
+
+  /* power of two and decimal radices have faster paths */
+  if ((bits = aws_s_mp_radix_log2(radix)) != 0) {
+    if ((res = aws_s_mp_read_radix_pow2(a, str, len, radix, bits)) != AWS_MP_OKAY) {
+      return res;
     }
+  } else if (radix == 10) {
+    if ((res = aws_s_mp_read_radix_dec(a, str, len)) != AWS_MP_OKAY) {
+      return res;
+    }
+  } else {
+    /* set the integer to the default of zero */
+    aws_mp_zero(a);
 
-    /* if the char was found in the map 
-     * and is less than the given radix add it
-     * to the number, otherwise exit the loop. 
-     */
-    if (y < radix) {
+    /* process each digit of the string */
+    for (; len > 0; --len, ++str) {
+      y = aws_s_mp_radix_value((unsigned char) *str, radix);
       if ((res = aws_mp_mul_d(a, (aws_mp_digit) radix, a)) != AWS_MP_OKAY) {
          return res;
       }
       if ((res = aws_mp_add_d(a, (aws_mp_digit) y, a)) != AWS_MP_OKAY) {
          return res;
       }
-    } else {
-      break;
     }
-    ++str;
   }
   
   /* set the sign only if a != 0 */
@@ -16,6 +16,7 @@
 #import "AWSCredentialsProvider.h"
 #import "AWSCognitoIdentity.h"
 #import "AWSSTS.h"
+#import "AWSSignature.h"
 #import "AWSUICKeyChainStore.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSBolts.h"
@@ -216,6 +217,7 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (void)invalidateCachedTemporaryCredentials {
     self.internalCredentials = nil;
+    [AWSSignatureV4Signer clearSigningKeyCache];
 }
 
 #pragma mark -
@@ -603,6 +605,7 @@ static NSString *const AWSCredentialsProviderKeychainIdentityId = @"identityId";
 
 - (void)invalidateCachedTemporaryCredentials {
     self.internalCredentials = nil;
+    [AWSSignatureV4Signer clearSigningKeyCache];
 }
 
 #pragma mark -
@@ -19,7 +19,20 @@
 FOUNDATION_EXPORT NSString *const AWSSignatureV4Algorithm;
 FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
 
+/**
+ * `NSURLProtocol` property key under which request serializers record the file URL
+ * a body stream reads from, so the signer can hash the file without consuming the stream.
+ **/
+FOUNDATION_EXPORT NSString *const AWSSignatureV4PayloadFileURLKey;
+
+/**
+ * `NSURLProtocol` property key under which query request serializers record the request
+ * parameters, unencoded, so the SigV2 signer can canonicalize them without parsing the body.
+ **/
+FOUNDATION_EXPORT NSString *const AWSSignatureV2QueryParametersKey;
+
 @class AWSEndpoint;
+@class AWSCredentials;
 
 @protocol AWSCredentialsProvider;
 
@@ -28,15 +41,62 @@ FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
 + (NSData *)sha256HMacWithData:(NSData *)data withKey:(NSData *)key;
 + (NSString *)hashString:(NSString *)stringToHash;
 + (NSData *)hash:(NSData *)dataToHash;
+/**
+ * SHA-256 of everything an unopened stream produces, read in fixed-size pieces.
+ * The stream is opened, read to the end and closed. Returns nil if reading fails.
+ **/
++ (NSData *)hashStream:(NSInputStream *)stream;
++ (NSData *)hashFileAtURL:(NSURL *)fileURL;
 + (NSString *)hexEncode:(NSString *)string;
 + (NSString *)HMACSign:(NSData *)data withKey:(NSString *)key usingAlgorithm:(uint32_t)algorithm;
 
 @end
 
+/**
+ * One URL for +generateQueryStringsForSignatureV4WithCredentials:date:requests:. The
+ * properties mean what the arguments of the single-URL method of the same name mean.
+ **/
+@interface AWSSignatureV4QueryStringRequest : NSObject
+
+@property (nonatomic, assign) AWSHTTPMethod httpMethod;
+@property (nonatomic, assign) int32_t expireDuration;
+@property (nonatomic, strong) AWSEndpoint *endpoint;
+@property (nonatomic, strong) NSString *keyPath;
+@property (nonatomic, strong) NSDictionary<NSString *, NSString *> *requestHeaders;
+@property (nonatomic, strong) NSDictionary<NSString *, id> *requestParameters;
+@property (nonatomic, assign) BOOL signBody;
+
+@end
+
 @interface AWSSignatureV4Signer : NSObject <AWSNetworkingRequestInterceptor>
 
 @property (nonatomic, strong, readonly) id<AWSCredentialsProvider> credentialsProvider;
 
+/**
+ * Sign HTTPS requests with `UNSIGNED-PAYLOAD` instead of hashing the body. Streamed
+ * bodies then go out as they are, without chunk signatures. Only for endpoints that
+ * accept it, such as Amazon S3. Plain HTTP requests are always signed in full. The default is NO.
+ **/
+@property (nonatomic, assign) BOOL allowsUnsignedPayload;
+
+/**
+ * Payload bytes per signed chunk when a streamed body is sent with aws-chunked
+ * encoding. Clamped to AWSS3ChunkedEncodingMinimumChunkSize...AWSS3ChunkedEncodingMaximumChunkSize;
+ * 0 selects AWSS3ChunkedEncodingDefaultChunkSize.
+ **/
+@property (nonatomic, assign) NSUInteger signedChunkSize;
+
+/**
+ * Send streamed HTTPS bodies as STREAMING-UNSIGNED-PAYLOAD-TRAILER: only the headers
+ * are signed and a CRC32C of the body, computed as it streams, follows it as an
+ * x-amz-checksum-crc32c trailer. Takes precedence over allowsUnsignedPayload for
+ * streamed bodies. Only for Amazon S3. Plain HTTP requests keep signed chunks.
+ * Applies only to requests this signer signs with a body stream; bodies sent
+ * through presigned URLs, such as AWSS3TransferUtility uploads and their multipart
+ * parts, carry no checksum. The default is NO.
+ **/
+@property (nonatomic, assign) BOOL usesChecksumTrailer;
+
 - (instancetype)initWithCredentialsProvider:(id<AWSCredentialsProvider>)credentialsProvider
                                    endpoint:(AWSEndpoint *)endpoint;
 
@@ -49,6 +109,31 @@ FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
                                                             requestParameters:(NSDictionary<NSString *, id> *)requestParameters
                                                                      signBody:(BOOL)signBody;
 
+/**
+ * Builds the same pre-signed URL synchronously from credentials that are already
+ * resolved, stamped with the given date. URLs signed with the same credentials and
+ * date share one derived signing key.
+ **/
++ (NSURL *)generateQueryStringForSignatureV4WithCredentials:(AWSCredentials *)credentials
+                                                       date:(NSDate *)date
+                                                 httpMethod:(AWSHTTPMethod)httpMethod
+                                             expireDuration:(int32_t)expireDuration
+                                                   endpoint:(AWSEndpoint *)endpoint
+                                                    keyPath:(NSString *)keyPath
+                                             requestHeaders:(NSDictionary<NSString *, NSString *> *)requestHeaders
+                                          requestParameters:(NSDictionary<NSString *, id> *)requestParameters
+                                                   signBody:(BOOL)signBody;
+
+/**
+ * The pre-signed URLs of several requests signed with the same credentials and date,
+ * in order. Requests for the same region and service are signed together: their
+ * canonical requests and strings to sign are hashed side by side where the CPU
+ * allows (aws_sha256_multi). An element is NSNull where a URL could not be built.
+ **/
++ (NSArray *)generateQueryStringsForSignatureV4WithCredentials:(AWSCredentials *)credentials
+                                                          date:(NSDate *)date
+                                                      requests:(NSArray<AWSSignatureV4QueryStringRequest *> *)requests;
+
 + (NSString *)getCanonicalizedRequest:(NSString *)method
                                  path:(NSString *)path
                                 query:(NSString *)query
@@ -62,6 +147,12 @@ FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
 
 + (NSString *)getSignedHeadersString:(NSDictionary *)headers;
 
+/**
+ * Drops the cached signing keys. Keys derived for a (credentials, date, region,
+ * service) tuple are reused until the date changes or the credentials expire or rotate.
+ **/
++ (void)clearSigningKeyCache;
+
 @end
 
 @interface AWSSignatureV2Signer : NSObject <AWSNetworkingRequestInterceptor>
@@ -80,12 +171,22 @@ FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
  * A subclass of NSInputStream that wraps an input stream and adds
  * signature of chunk data.
  **/
+FOUNDATION_EXPORT const NSUInteger AWSS3ChunkedEncodingMinimumChunkSize;
+FOUNDATION_EXPORT const NSUInteger AWSS3ChunkedEncodingMaximumChunkSize;
+FOUNDATION_EXPORT const NSUInteger AWSS3ChunkedEncodingDefaultChunkSize;
+
 @interface AWSS3ChunkedEncodingInputStream : NSInputStream <NSStreamDelegate>
 
 @property (atomic, assign) int64_t totalLengthOfChunkSignatureSent;
+
+/**
+ * Payload bytes carried by every chunk but the last two.
+ **/
+@property (nonatomic, assign, readonly) NSUInteger chunkSize;
+
 /**
  * Initialize the input stream with date, scope, signing key and signature
- * of request headers.
+ * of request headers. Uses AWSS3ChunkedEncodingDefaultChunkSize.
  **/
 - (instancetype)initWithInputStream:(NSInputStream *)stream
                                date:(NSDate *)date
@@ -93,9 +194,31 @@ FOUNDATION_EXPORT NSString *const AWSSignatureV4Terminator;
                            kSigning:(NSData *)kSigning
                     headerSignature:(NSString *)headerSignature;
 
+/**
+ * Initialize the input stream with an explicit chunk size, clamped to
+ * AWSS3ChunkedEncodingMinimumChunkSize...AWSS3ChunkedEncodingMaximumChunkSize.
+ * Once the stream is read, the next chunk is read from the source and signed
+ * in the background while the current one is consumed.
+ **/
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                               date:(NSDate *)date
+                              scope:(NSString *)scope
+                           kSigning:(NSData *)kSigning
+                    headerSignature:(NSString *)headerSignature
+                          chunkSize:(NSUInteger)chunkSize;
+
+/**
+ * Initialize the input stream for STREAMING-UNSIGNED-PAYLOAD-TRAILER: chunks
+ * go out unsigned and the stream ends with an x-amz-checksum-crc32c trailer
+ * computed over the payload as it is read.
+ **/
+- (instancetype)initUnsignedWithInputStream:(NSInputStream *)stream
+                                  chunkSize:(NSUInteger)chunkSize;
+
 /**
  * Computes new content length after data being chunked encoded.
  **/
 + (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength;
++ (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength chunkSize:(NSUInteger)chunkSize;
 
 @end
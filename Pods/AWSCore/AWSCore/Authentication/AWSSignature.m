@@ -15,30 +15,104 @@
 #import "AWSSignature.h"
 
 #import <CommonCrypto/CommonCrypto.h>
+#import "aws_crc32c.h"
+#import "aws_sha256.h"
+#import "aws_sigv4.h"
 #import "AWSCategory.h"
 #import "AWSService.h"
 #import "AWSCredentialsProvider.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSBolts.h"
 
-static NSString *const AWSSigV4Marker = @"AWS4";
 NSString *const AWSSignatureV4Algorithm = @"AWS4-HMAC-SHA256";
 NSString *const AWSSignatureV4Terminator = @"aws4_request";
+NSString *const AWSSignatureV4PayloadFileURLKey = @"com.amazonaws.AWSSignatureV4PayloadFileURL";
+NSString *const AWSSignatureV2QueryParametersKey = @"com.amazonaws.AWSSignatureV2QueryParameters";
 
-@implementation AWSSignatureSignerUtility
+static NSString *const AWSSignatureV4UnsignedPayload = @"UNSIGNED-PAYLOAD";
+static NSString *const AWSSignatureV4StreamingUnsignedPayloadTrailer = @"STREAMING-UNSIGNED-PAYLOAD-TRAILER";
 
-+ (NSData *)sha256HMacWithData:(NSData *)data withKey:(NSData *)key {
-    CCHmacContext context;
+// Bodies are hashed in pieces of this size, so only one piece is in memory at a time.
+static const NSUInteger AWSSignatureStreamReadLength = 64 * 1024;
 
-    CCHmacInit(&context, kCCHmacAlgSHA256, [key bytes], [key length]);
-    CCHmacUpdate(&context, [data bytes], [data length]);
+// Canonical requests up to this size are built on the stack.
+static const size_t AWSSignatureV4CanonicalRequestStorage = 2048;
 
-    unsigned char digestRaw[CC_SHA256_DIGEST_LENGTH];
-    NSInteger digestLength = CC_SHA256_DIGEST_LENGTH;
+static NSString *AWSSignatureHexString(const uint8_t *bytes, size_t length) {
+    char hex[2 * AWS_SHA256_DIGEST_LENGTH];
+    if (length > AWS_SHA256_DIGEST_LENGTH) {
+        return nil;
+    }
+    aws_sigv4_hex_encode(bytes, length, hex);
+    return [[NSString alloc] initWithBytes:hex length:2 * length encoding:NSASCIIStringEncoding];
+}
 
-    CCHmacFinal(&context, digestRaw);
+// Hashes an unopened stream to the end. If copy is not nil the bytes read are appended to it.
+static BOOL AWSSignatureHashStream(NSInputStream *stream, NSMutableData *copy, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    uint8_t *buffer = malloc(AWSSignatureStreamReadLength);
+    if (buffer == NULL) {
+        return NO;
+    }
+
+    aws_sha256_ctx ctx;
+    aws_sha256_init(&ctx);
+
+    NSInteger bytesRead;
+    [stream open];
+    while ((bytesRead = [stream read:buffer maxLength:AWSSignatureStreamReadLength]) > 0) {
+        aws_sha256_update(&ctx, buffer, (size_t)bytesRead);
+        [copy appendBytes:buffer length:(NSUInteger)bytesRead];
+    }
+    [stream close];
+    free(buffer);
 
-    return [NSData dataWithBytes:digestRaw length:digestLength];
+    if (bytesRead < 0) {
+        AWSDDLogError(@"Unable to hash the request body: %@", [stream streamError]);
+        return NO;
+    }
+
+    aws_sha256_final(&ctx, digest);
+    return YES;
+}
+
+// The UTF-8 bytes of string, valid until the current autorelease pool drains, as with -UTF8String.
+// The length comes from the string, not strlen, so an embedded U+0000 is signed instead of ending it.
+static const char *AWSSignatureUTF8String(NSString *string, size_t *length) {
+    *length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+    if (bytes) {
+        return bytes;
+    }
+    if (*length == 0) {
+        return "";
+    }
+
+    NSMutableData *utf8 = [NSMutableData dataWithLength:*length + 1];
+    NSUInteger usedLength = 0;
+    if (!utf8
+        || ![string getBytes:[utf8 mutableBytes]
+                   maxLength:*length
+                  usedLength:&usedLength
+                    encoding:NSUTF8StringEncoding
+                     options:0
+                       range:NSMakeRange(0, [string length])
+              remainingRange:NULL]
+        || usedLength != *length) {
+        *length = 0;
+        return NULL;
+    }
+    // Handed to the pool explicitly: under ARC the local reference alone may be the last one.
+    return [(__bridge NSMutableData *)CFAutorelease((__bridge_retained CFTypeRef)utf8) bytes];
+}
+
+@implementation AWSSignatureSignerUtility
+
++ (NSData *)sha256HMacWithData:(NSData *)data withKey:(NSData *)key {
+    unsigned char digestRaw[AWS_SHA256_DIGEST_LENGTH];
+
+    aws_hmac_sha256([key bytes], [key length], [data bytes], [data length], digestRaw);
+
+    return [NSData dataWithBytes:digestRaw length:AWS_SHA256_DIGEST_LENGTH];
 }
 
 + (NSString *)hashString:(NSString *)stringToHash {
@@ -47,16 +121,28 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 + (NSData *)hash:(NSData *)dataToHash {
-    if ([dataToHash length] > UINT32_MAX) {
+    unsigned char result[AWS_SHA256_DIGEST_LENGTH];
+
+    aws_sha256([dataToHash bytes], [dataToHash length], result);
+
+    return [[NSData alloc] initWithBytes:result length:AWS_SHA256_DIGEST_LENGTH];
+}
+
++ (NSData *)hashStream:(NSInputStream *)stream {
+    if (stream == nil) {
         return nil;
     }
 
-    const void *cStr = [dataToHash bytes];
-    unsigned char result[CC_SHA256_DIGEST_LENGTH];
+    unsigned char result[AWS_SHA256_DIGEST_LENGTH];
+    if (!AWSSignatureHashStream(stream, nil, result)) {
+        return nil;
+    }
 
-    CC_SHA256(cStr, (uint32_t)[dataToHash length], result);
+    return [[NSData alloc] initWithBytes:result length:AWS_SHA256_DIGEST_LENGTH];
+}
 
-    return [[NSData alloc] initWithBytes:result length:CC_SHA256_DIGEST_LENGTH];
++ (NSData *)hashFileAtURL:(NSURL *)fileURL {
+    return [self hashStream:[NSInputStream inputStreamWithURL:fileURL]];
 }
 
 + (NSString *)hexEncode:(NSString *)string {
@@ -73,6 +159,22 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
     [string getCharacters:chars];
 
+    BOOL bytesOnly = YES;
+    for (NSUInteger i = 0; i < len && bytesOnly; i++) {
+        bytesOnly = chars[i] <= 0xFF;
+    }
+
+    if (bytesOnly) {
+        // The usual case, digest bytes decoded as ASCII. Character i and its two hex
+        // digits occupy the same two bytes, so the digits are written in place.
+        char *hex = (char *)chars;
+        for (NSUInteger i = 0; i < len; i++) {
+            uint8_t byte = (uint8_t)chars[i];
+            aws_sigv4_hex_encode(&byte, 1, hex + 2 * i);
+        }
+        return [[NSString alloc] initWithBytesNoCopy:hex length:2 * len encoding:NSASCIIStringEncoding freeWhenDone:YES];
+    }
+
     NSMutableString *hexString = [NSMutableString new];
     for (NSUInteger i = 0; i < len; i++) {
         if ((int)chars[i] < 16) {
@@ -86,24 +188,27 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 + (NSString *)HMACSign:(NSData *)data withKey:(NSString *)key usingAlgorithm:(CCHmacAlgorithm)algorithm {
-    CCHmacContext context;
     const char    *keyCString = [key cStringUsingEncoding:NSASCIIStringEncoding];
 
-    CCHmacInit(&context, algorithm, keyCString, strlen(keyCString));
-    CCHmacUpdate(&context, [data bytes], [data length]);
-
     // Both SHA1 and SHA256 will fit in here
     unsigned char digestRaw[CC_SHA256_DIGEST_LENGTH];
 
     NSInteger digestLength = -1;
 
     switch (algorithm) {
-        case kCCHmacAlgSHA1:
+        case kCCHmacAlgSHA1: {
+            CCHmacContext context;
+
+            CCHmacInit(&context, algorithm, keyCString, strlen(keyCString));
+            CCHmacUpdate(&context, [data bytes], [data length]);
+            CCHmacFinal(&context, digestRaw);
             digestLength = CC_SHA1_DIGEST_LENGTH;
             break;
+        }
 
         case kCCHmacAlgSHA256:
-            digestLength = CC_SHA256_DIGEST_LENGTH;
+            aws_hmac_sha256(keyCString, strlen(keyCString), [data bytes], [data length], digestRaw);
+            digestLength = AWS_SHA256_DIGEST_LENGTH;
             break;
 
         default:
@@ -112,8 +217,6 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
             break;
     }
 
-    CCHmacFinal(&context, digestRaw);
-
     NSData *digestData = [NSData dataWithBytes:digestRaw length:digestLength];
 
     return [digestData base64EncodedStringWithOptions:kNilOptions];
@@ -121,11 +224,342 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 
 @end
 
+#pragma mark - SigV4 canonical request
+
+// Hands the request to the C core: canonical request only when key is NULL, otherwise signed into signature.
+static int AWSSignatureV4SignRequest(aws_sigv4_buf *buf,
+                                     const aws_hmac_sha256_ctx *key,
+                                     const aws_sigv4_header_template *headerTemplate,
+                                     const char *amzDate, size_t amzDateLength,
+                                     const char *scope, size_t scopeLength,
+                                     NSString *method,
+                                     NSString *path,
+                                     NSString *query,
+                                     NSDictionary *headers,
+                                     NSString *contentSha256,
+                                     char signature[AWS_SIGV4_SIGNATURE_LENGTH],
+                                     size_t *signedHeadersOffset,
+                                     size_t *signedHeadersLength) {
+    aws_sigv4_header inlineHeaders[32];
+    NSUInteger headerCount = [headers count];
+    aws_sigv4_header *canonicalHeaders = inlineHeaders;
+    if (headerCount > sizeof(inlineHeaders) / sizeof(inlineHeaders[0])) {
+        canonicalHeaders = malloc(headerCount * sizeof(aws_sigv4_header));
+        if (canonicalHeaders == NULL) {
+            return -1;
+        }
+    }
+
+    __block NSUInteger index = 0;
+    // The byte pointers stay valid as long as headers holds the strings
+    [headers enumerateKeysAndObjectsUsingBlock:^(NSString *name, NSString *value, BOOL *stop) {
+        aws_sigv4_header *header = &canonicalHeaders[index++];
+        header->name = AWSSignatureUTF8String(name, &header->nameLength);
+        header->value = AWSSignatureUTF8String(value, &header->valueLength);
+    }];
+
+    size_t methodLength, pathLength, queryLength, contentSha256Length;
+    const char *methodBytes = AWSSignatureUTF8String(method, &methodLength);
+    const char *pathBytes = AWSSignatureUTF8String(path, &pathLength);
+    const char *queryBytes = AWSSignatureUTF8String(query, &queryLength);
+    const char *contentSha256Bytes = AWSSignatureUTF8String(contentSha256, &contentSha256Length);
+
+    int result;
+    if (key) {
+        result = aws_sigv4_sign_request(buf, key, headerTemplate,
+                                        amzDate, amzDateLength,
+                                        scope, scopeLength,
+                                        methodBytes, methodLength,
+                                        pathBytes, pathLength,
+                                        queryBytes, queryLength,
+                                        canonicalHeaders, index,
+                                        contentSha256Bytes, contentSha256Length,
+                                        signature, signedHeadersOffset, signedHeadersLength);
+    } else {
+        result = aws_sigv4_canonical_request(buf,
+                                             methodBytes, methodLength,
+                                             pathBytes, pathLength,
+                                             queryBytes, queryLength,
+                                             canonicalHeaders, index,
+                                             contentSha256Bytes, contentSha256Length,
+                                             signedHeadersOffset, signedHeadersLength);
+    }
+
+    if (canonicalHeaders != inlineHeaders) {
+        free(canonicalHeaders);
+    }
+    return result;
+}
+
+#pragma mark - AWSSignatureV4HeaderTemplate
+
+/**
+ * The headers one signer sends with every request (host, user agent, content type, ...),
+ * lowercased, trimmed and sorted once. Immutable, so requests signed on any thread share it.
+ **/
+@interface AWSSignatureV4HeaderTemplate : NSObject {
+@public
+    aws_sigv4_header_template _template;
+}
+
++ (instancetype)templateWithHeaders:(NSDictionary *)headers;
+
+@end
+
+@implementation AWSSignatureV4HeaderTemplate
+
++ (instancetype)templateWithHeaders:(NSDictionary *)headers {
+    return [[self alloc] initWithHeaders:headers];
+}
+
+- (instancetype)initWithHeaders:(NSDictionary *)headers {
+    if (self = [super init]) {
+        // Headers that change with every request would never match again.
+        static NSSet<NSString *> *perRequestHeaders = nil;
+        static dispatch_once_t onceToken;
+        dispatch_once(&onceToken, ^{
+            perRequestHeaders = [NSSet setWithObjects:@"authorization", @"content-length", @"content-md5",
+                                 @"x-amz-content-sha256", @"x-amz-date", @"x-amz-decoded-content-length", nil];
+        });
+
+        aws_sigv4_header templateHeaders[AWS_SIGV4_HEADER_TEMPLATE_MAX];
+        size_t count = 0;
+        for (NSString *name in headers) {
+            if (count == AWS_SIGV4_HEADER_TEMPLATE_MAX) {
+                break;
+            }
+            if ([perRequestHeaders containsObject:[name lowercaseString]]) {
+                continue;
+            }
+            aws_sigv4_header *header = &templateHeaders[count++];
+            header->name = AWSSignatureUTF8String(name, &header->nameLength);
+            header->value = AWSSignatureUTF8String(headers[name], &header->valueLength);
+        }
+        if (aws_sigv4_header_template_init(&_template, templateHeaders, count)) {
+            return nil;
+        }
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    aws_sigv4_header_template_free(&_template);
+}
+
+@end
+
+#pragma mark - AWSSignatureV4SigningContext
+
+// Enough for a handful of services across a day boundary; entries are looked up linearly.
+static const NSUInteger AWSSignatureV4SigningContextCacheSize = 8;
+
+/**
+ * Everything SigV4 derives from (credentials, date, region, service): the scope
+ * strings and the signing key, kept both as bytes and as a keyed HMAC context.
+ **/
+@interface AWSSignatureV4SigningContext : NSObject {
+    aws_hmac_sha256_ctx _signingHMAC;
+}
+
+@property (nonatomic, strong, readonly) NSString *accessKey;
+@property (nonatomic, strong, readonly) NSString *secretKey;
+@property (nonatomic, strong, readonly) NSDate *expiration;
+@property (nonatomic, strong, readonly) NSString *dateStamp;
+@property (nonatomic, strong, readonly) NSString *regionName;
+@property (nonatomic, strong, readonly) NSString *serviceName;
+@property (nonatomic, strong, readonly) NSString *scope;
+@property (nonatomic, strong, readonly) NSString *signingCredentials;
+@property (nonatomic, strong, readonly) NSData *kSigning;
+
++ (instancetype)contextWithCredentials:(AWSCredentials *)credentials
+                                  date:(NSString *)dateStamp
+                                region:(NSString *)regionName
+                               service:(NSString *)serviceName;
+
++ (void)clearCache;
+
+/**
+ * Builds the canonical request and string-to-sign in one byte buffer and signs it.
+ * Headers found in headerTemplate (may be nil) skip normalising and sorting.
+ * Returns the hex signature, or nil if the buffer could not grow.
+ **/
+- (NSString *)signatureWithMethod:(NSString *)method
+                             path:(NSString *)path
+                            query:(NSString *)query
+                          headers:(NSDictionary *)headers
+                   headerTemplate:(AWSSignatureV4HeaderTemplate *)headerTemplate
+                    contentSha256:(NSString *)contentSha256
+                          amzDate:(NSString *)amzDate
+                    signedHeaders:(NSString **)signedHeaders;
+
+@end
+
+@implementation AWSSignatureV4SigningContext
+
+static NSMutableArray<AWSSignatureV4SigningContext *> *AWSSignatureV4SigningContexts = nil;
+
+- (instancetype)initWithCredentials:(AWSCredentials *)credentials
+                               date:(NSString *)dateStamp
+                             region:(NSString *)regionName
+                            service:(NSString *)serviceName {
+    if (self = [super init]) {
+        _accessKey = credentials.accessKey;
+        _secretKey = credentials.secretKey;
+        _expiration = credentials.expiration;
+        _dateStamp = dateStamp;
+        _regionName = regionName;
+        _serviceName = serviceName;
+        _scope = [NSString stringWithFormat:@"%@/%@/%@/%@", dateStamp, regionName, serviceName, AWSSignatureV4Terminator];
+        _signingCredentials = [NSString stringWithFormat:@"%@/%@", _accessKey, _scope];
+        _kSigning = [AWSSignatureV4Signer getV4DerivedKey:_secretKey
+                                                     date:dateStamp
+                                                   region:regionName
+                                                  service:serviceName];
+        aws_hmac_sha256_init(&_signingHMAC, [_kSigning bytes], [_kSigning length]);
+    }
+
+    return self;
+}
+
+- (void)dealloc {
+    memset(&_signingHMAC, 0, sizeof(_signingHMAC));
+}
+
+- (BOOL)matchesCredentials:(AWSCredentials *)credentials
+                      date:(NSString *)dateStamp
+                    region:(NSString *)regionName
+                   service:(NSString *)serviceName {
+    return [self.accessKey isEqualToString:credentials.accessKey]
+    && [self.dateStamp isEqualToString:dateStamp]
+    && [self.regionName isEqualToString:regionName]
+    && [self.serviceName isEqualToString:serviceName]
+    && [self.secretKey isEqualToString:credentials.secretKey];
+}
+
+- (BOOL)isStaleForCredentials:(AWSCredentials *)credentials date:(NSString *)dateStamp now:(NSDate *)now {
+    // A new day, expired temporary credentials, or the same access key with a rotated secret
+    return ![self.dateStamp isEqualToString:dateStamp]
+    || (self.expiration && [self.expiration compare:now] != NSOrderedDescending)
+    || ([self.accessKey isEqualToString:credentials.accessKey] && ![self.secretKey isEqualToString:credentials.secretKey]);
+}
+
++ (instancetype)contextWithCredentials:(AWSCredentials *)credentials
+                                  date:(NSString *)dateStamp
+                                region:(NSString *)regionName
+                               service:(NSString *)serviceName {
+    if (credentials.accessKey == nil || credentials.secretKey == nil
+        || dateStamp == nil || regionName == nil || serviceName == nil) {
+        return [[self alloc] initWithCredentials:credentials date:dateStamp region:regionName service:serviceName];
+    }
+
+    @synchronized(self) {
+        for (AWSSignatureV4SigningContext *context in AWSSignatureV4SigningContexts) {
+            if ([context matchesCredentials:credentials date:dateStamp region:regionName service:serviceName]) {
+                return context;
+            }
+        }
+    }
+
+    // Derive outside the lock; two threads racing on the same miss both produce the same key.
+    AWSSignatureV4SigningContext *context = [[self alloc] initWithCredentials:credentials
+                                                                         date:dateStamp
+                                                                       region:regionName
+                                                                      service:serviceName];
+    NSDate *now = [NSDate date];
+    @synchronized(self) {
+        if (!AWSSignatureV4SigningContexts) {
+            AWSSignatureV4SigningContexts = [NSMutableArray arrayWithCapacity:AWSSignatureV4SigningContextCacheSize];
+        }
+        NSIndexSet *staleIndexes = [AWSSignatureV4SigningContexts indexesOfObjectsPassingTest:^BOOL(AWSSignatureV4SigningContext *cached, NSUInteger idx, BOOL *stop) {
+            return [cached isStaleForCredentials:credentials date:dateStamp now:now]
+            || [cached matchesCredentials:credentials date:dateStamp region:regionName service:serviceName];
+        }];
+        [AWSSignatureV4SigningContexts removeObjectsAtIndexes:staleIndexes];
+        if ([AWSSignatureV4SigningContexts count] >= AWSSignatureV4SigningContextCacheSize) {
+            [AWSSignatureV4SigningContexts removeLastObject];
+        }
+        [AWSSignatureV4SigningContexts insertObject:context atIndex:0];
+    }
+
+    return context;
+}
+
++ (void)clearCache {
+    @synchronized(self) {
+        [AWSSignatureV4SigningContexts removeAllObjects];
+    }
+}
+
+- (NSString *)signatureWithMethod:(NSString *)method
+                             path:(NSString *)path
+                            query:(NSString *)query
+                          headers:(NSDictionary *)headers
+                   headerTemplate:(AWSSignatureV4HeaderTemplate *)headerTemplate
+                    contentSha256:(NSString *)contentSha256
+                          amzDate:(NSString *)amzDate
+                    signedHeaders:(NSString **)signedHeaders {
+    uint8_t storage[AWSSignatureV4CanonicalRequestStorage];
+    aws_sigv4_buf buf;
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+
+    NSString *signature = nil;
+    size_t signedHeadersOffset = 0;
+    size_t signedHeadersLength = 0;
+    size_t amzDateLength, scopeLength;
+    const char *amzDateBytes = AWSSignatureUTF8String(amzDate, &amzDateLength);
+    const char *scopeBytes = AWSSignatureUTF8String(self.scope, &scopeLength);
+    char signatureHex[AWS_SIGV4_SIGNATURE_LENGTH];
+    if (AWSSignatureV4SignRequest(&buf, &_signingHMAC, headerTemplate ? &headerTemplate->_template : NULL, amzDateBytes, amzDateLength, scopeBytes, scopeLength,
+                                  method, path, query, headers, contentSha256,
+                                  signatureHex, &signedHeadersOffset, &signedHeadersLength)) {
+        AWSDDLogError(@"Unable to sign: out of memory building the canonical request.");
+        goto done;
+    }
+    AWSDDLogVerbose(@"AWS4 Canonical Request and String to Sign: [%@]", [[NSString alloc] initWithBytes:buf.data length:buf.length encoding:NSUTF8StringEncoding]);
+
+    if (signedHeaders) {
+        *signedHeaders = [[NSString alloc] initWithBytes:buf.data + signedHeadersOffset
+                                                  length:signedHeadersLength
+                                                encoding:NSUTF8StringEncoding];
+    }
+    signature = [[NSString alloc] initWithBytes:signatureHex length:sizeof(signatureHex) encoding:NSASCIIStringEncoding];
+
+done:
+    aws_sigv4_buf_free(&buf);
+    return signature;
+}
+
+@end
+
+#pragma mark - AWSSignatureV4QueryStringRequest
+
+@implementation AWSSignatureV4QueryStringRequest
+
+@end
+
 #pragma mark - AWSSignatureV4Signer
 
+//CanonicalURI is the URI-encoded version of the absolute path component of the URI—everything starting with the "/" that follows the domain name and up to the end of the string or to the question mark character ('?') if you have query string parameters. e.g. https://s3.amazonaws.com/examplebucket/myphoto.jpg /examplebucket/myphoto.jpg is the absolute path. In the absolute path, you don't encode the "/".
+static NSString *AWSSignatureV4PresignCanonicalURI(NSString *keyPath) {
+    return [NSString stringWithFormat:@"/%@", [keyPath aws_stringWithURLEncodingPath]]; //keyPath is not url-encoded.
+}
+
+static NSString *AWSSignatureV4PresignContentSha256(AWSHTTPMethod httpMethod, BOOL signBody) {
+    if (signBody && httpMethod == AWSHTTPMethodGET) {
+        //in case of http get we sign the body as an empty string only if the sign body flag is set to true
+        uint8_t emptyHash[AWS_SHA256_DIGEST_LENGTH];
+        aws_sha256(NULL, 0, emptyHash);
+        return AWSSignatureHexString(emptyHash, AWS_SHA256_DIGEST_LENGTH);
+    }
+    return AWSSignatureV4UnsignedPayload;
+}
+
 @interface AWSSignatureV4Signer()
 
 @property (nonatomic, strong) AWSEndpoint *endpoint;
+// Built from the first request signed; atomic because requests are signed on any thread.
+@property (atomic, strong) AWSSignatureV4HeaderTemplate *headerTemplate;
 
 @end
 
@@ -198,8 +632,12 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     NSString *dateStamp = [date aws_stringValue:AWSDateShortDateFormat1];
     //NSString *dateTime  = [date aws_stringValue:AWSDateAmzDateFormat];
 
-    NSString *scope = [NSString stringWithFormat:@"%@/%@/%@/%@", dateStamp, self.endpoint.regionName, self.endpoint.serviceName, AWSSignatureV4Terminator];
-    NSString *signingCredentials = [NSString stringWithFormat:@"%@/%@", credentials.accessKey, scope];
+    AWSSignatureV4SigningContext *signingContext = [AWSSignatureV4SigningContext contextWithCredentials:credentials
+                                                                                                   date:dateStamp
+                                                                                                 region:self.endpoint.regionName
+                                                                                                service:self.endpoint.serviceName];
+    NSString *scope = signingContext.scope;
+    NSString *signingCredentials = signingContext.signingCredentials;
 
     // compute canonical request
     NSString *httpMethod = urlRequest.HTTPMethod;
@@ -221,15 +659,35 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     NSString *contentSha256;
     NSInputStream *stream = [urlRequest HTTPBodyStream];
     NSUInteger contentLength = [[urlRequest allHTTPHeaderFields][@"Content-Length"] integerValue];
-    if (nil != stream) {
+    BOOL unsignedPayload = [self usesUnsignedPayloadForRequest:urlRequest];
+    BOOL checksumTrailer = nil != stream && [self usesChecksumTrailerForRequest:urlRequest];
+    if (checksumTrailer) {
+        // Only the headers are signed; the body is checked against the trailing CRC32C.
+        contentSha256 = AWSSignatureV4StreamingUnsignedPayloadTrailer;
+        [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
+        [urlRequest addValue:@"aws-chunked" forHTTPHeaderField:@"Content-Encoding"];
+        [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)contentLength] forHTTPHeaderField:@"x-amz-decoded-content-length"];
+        [urlRequest setValue:@"x-amz-checksum-crc32c" forHTTPHeaderField:@"x-amz-trailer"];
+    } else if (unsignedPayload) {
+        // The body goes out as is; a stream keeps the Content-Length the serializer gave it.
+        contentSha256 = AWSSignatureV4UnsignedPayload;
+        if (nil == stream) {
+            if (contentLength == 0) {
+                [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
+            } else {
+                [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)[[urlRequest HTTPBody] length]] forHTTPHeaderField:@"Content-Length"];
+            }
+        }
+    } else if (nil != stream) {
         contentSha256 = @"STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
-        [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)[AWSS3ChunkedEncodingInputStream computeContentLengthForChunkedData:contentLength]]
-          forHTTPHeaderField:@"Content-Length"];
         [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"]; //remove Content-Length header if it is a HTTPBodyStream
         [urlRequest addValue:@"aws-chunked" forHTTPHeaderField:@"Content-Encoding"]; //add aws-chunked keyword for s3 chunk upload
         [urlRequest setValue:[NSString stringWithFormat:@"%lu", (unsigned long)contentLength] forHTTPHeaderField:@"x-amz-decoded-content-length"];
     } else {
-        contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hash:[urlRequest HTTPBody]] encoding:NSASCIIStringEncoding]];
+        NSData *body = [urlRequest HTTPBody];
+        uint8_t bodyHash[AWS_SHA256_DIGEST_LENGTH];
+        aws_sha256([body bytes], [body length], bodyHash);
+        contentSha256 = AWSSignatureHexString(bodyHash, AWS_SHA256_DIGEST_LENGTH);
         //using Content-Length with value of '0' cause auth issue, remove it.
         if (contentLength == 0) {
             [urlRequest setValue:nil forHTTPHeaderField:@"Content-Length"];
@@ -253,44 +711,39 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         
     }
     
-    NSMutableDictionary *headers = [[urlRequest allHTTPHeaderFields] mutableCopy];
-
-    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:httpMethod
-                                                                          path:path
-                                                                         query:query
-                                                                       headers:headers
-                                                                 contentSha256:contentSha256];
-    AWSDDLogVerbose(@"Canonical request: [%@]", canonicalRequest);
+    NSString *signedHeaders = nil;
+    NSDictionary *headers = [urlRequest allHTTPHeaderFields];
+    NSString *signatureString = [signingContext signatureWithMethod:httpMethod
+                                                               path:path
+                                                              query:query
+                                                            headers:headers
+                                                     headerTemplate:[self headerTemplateForHeaders:headers]
+                                                      contentSha256:contentSha256
+                                                            amzDate:[urlRequest valueForHTTPHeaderField:@"X-Amz-Date"]
+                                                      signedHeaders:&signedHeaders];
+    if (!signatureString) {
+        return nil;
+    }
 
-    NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                              AWSSignatureV4Algorithm,
-                              [urlRequest valueForHTTPHeaderField:@"X-Amz-Date"],
-                              scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
-
-    NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
-                                                         date:dateStamp
-                                                       region:self.endpoint.regionName
-                                                      service:self.endpoint.serviceName];
-
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:kSigning];
-    NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                           encoding:NSASCIIStringEncoding]];
+    NSData *kSigning = signingContext.kSigning;
 
     NSString *authorization = [NSString stringWithFormat:@"%@ Credential=%@, SignedHeaders=%@, Signature=%@",
                                AWSSignatureV4Algorithm,
                                signingCredentials,
-                               [AWSSignatureV4Signer getSignedHeadersString:headers],
+                               signedHeaders,
                                signatureString];
 
-    if (nil != stream) {
+    if (checksumTrailer) {
+        AWSS3ChunkedEncodingInputStream *chunkedStream = [[AWSS3ChunkedEncodingInputStream alloc] initUnsignedWithInputStream:stream
+                                                                                                                   chunkSize:self.signedChunkSize];
+        [urlRequest setHTTPBodyStream:chunkedStream];
+    } else if (nil != stream && !unsignedPayload) {
         AWSS3ChunkedEncodingInputStream *chunkedStream = [[AWSS3ChunkedEncodingInputStream alloc] initWithInputStream:stream
                                                                                                            date:date
                                                                                                           scope:scope
                                                                                                        kSigning:kSigning
-                                                                                                headerSignature:signatureString];
+                                                                                                headerSignature:signatureString
+                                                                                                      chunkSize:self.signedChunkSize];
         [urlRequest setHTTPBodyStream:chunkedStream];
     }
 
@@ -298,6 +751,56 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
 }
 
 
+- (AWSSignatureV4HeaderTemplate *)headerTemplateForHeaders:(NSDictionary *)headers {
+    AWSSignatureV4HeaderTemplate *headerTemplate = self.headerTemplate;
+    if (!headerTemplate) {
+        // Threads that race here build equivalent templates; whichever is stored last is kept.
+        headerTemplate = [AWSSignatureV4HeaderTemplate templateWithHeaders:headers];
+        self.headerTemplate = headerTemplate;
+    }
+    return headerTemplate;
+}
+
+- (BOOL)usesUnsignedPayloadForRequest:(NSURLRequest *)request {
+    return self.allowsUnsignedPayload
+    && [[[request URL] scheme] caseInsensitiveCompare:@"https"] == NSOrderedSame;
+}
+
+- (BOOL)usesChecksumTrailerForRequest:(NSURLRequest *)request {
+    return self.usesChecksumTrailer
+    && [[[request URL] scheme] caseInsensitiveCompare:@"https"] == NSOrderedSame;
+}
+
+- (NSString *)contentSha256ForRequest:(NSMutableURLRequest *)request {
+    if ([self usesUnsignedPayloadForRequest:request]) {
+        [request setValue:AWSSignatureV4UnsignedPayload forHTTPHeaderField:@"x-amz-content-sha256"];
+        return AWSSignatureV4UnsignedPayload;
+    }
+
+    uint8_t bodyHash[AWS_SHA256_DIGEST_LENGTH];
+    NSInputStream *stream = [request HTTPBodyStream];
+    if ([request HTTPBody] || stream == nil) {
+        aws_sha256([request.HTTPBody bytes], [request.HTTPBody length], bodyHash);
+    } else {
+        NSURL *fileURL = [NSURLProtocol propertyForKey:AWSSignatureV4PayloadFileURLKey inRequest:request];
+        if (fileURL) {
+            // Hash the file itself and leave the unopened body stream to the session.
+            if (!AWSSignatureHashStream([NSInputStream inputStreamWithURL:fileURL], nil, bodyHash)) {
+                return nil;
+            }
+        } else {
+            // Any other stream cannot be rewound once read, so the bytes read become the body.
+            NSMutableData *body = [NSMutableData new];
+            if (!AWSSignatureHashStream(stream, body, bodyHash)) {
+                return nil;
+            }
+            request.HTTPBody = body;
+        }
+    }
+
+    return AWSSignatureHexString(bodyHash, AWS_SHA256_DIGEST_LENGTH);
+}
+
 - (NSString *)signRequestV4:(NSMutableURLRequest *)request
                 credentials:(AWSCredentials *)credentials {
     
@@ -322,49 +825,36 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
         query = [NSString stringWithFormat:@""];
     }
 
-    NSString *contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hash:request.HTTPBody] encoding:NSASCIIStringEncoding]];
-
-    NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:request.HTTPMethod
-                                                                          path:path
-                                                                         query:query
-                                                                       headers:request.allHTTPHeaderFields
-                                                                 contentSha256:contentSha256];
+    NSString *contentSha256 = [self contentSha256ForRequest:request];
+    if (!contentSha256) {
+        return nil;
+    }
 
-    AWSDDLogVerbose(@"AWS4 Canonical Request: [%@]", canonicalRequest);
     AWSDDLogVerbose(@"payload %@",[[NSString alloc] initWithData:request.HTTPBody encoding:NSUTF8StringEncoding]);
 
-    NSString *scope = [NSString stringWithFormat:@"%@/%@/%@/%@",
-                       dateStamp,
-                       self.endpoint.regionName,
-                       self.endpoint.serviceName,
-                       AWSSignatureV4Terminator];
-    NSString *signingCredentials = [NSString stringWithFormat:@"%@/%@",
-                                    credentials.accessKey,
-                                    scope];
-    NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                              AWSSignatureV4Algorithm,
-                              [request valueForHTTPHeaderField:@"X-Amz-Date"],
-                              scope,
-                              [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
-
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
-
-    NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
-                                                         date:dateStamp
-                                                       region:self.endpoint.regionName
-                                                      service:self.endpoint.serviceName];
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:kSigning];
-
-    NSString *credentialsAuthorizationHeader = [NSString stringWithFormat:@"Credential=%@", signingCredentials];
-    NSString *signedHeadersAuthorizationHeader = [NSString stringWithFormat:@"SignedHeaders=%@", [AWSSignatureV4Signer getSignedHeadersString:request.allHTTPHeaderFields]];
-    NSString *signatureAuthorizationHeader = [NSString stringWithFormat:@"Signature=%@", [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature encoding:NSASCIIStringEncoding]]];
+    AWSSignatureV4SigningContext *signingContext = [AWSSignatureV4SigningContext contextWithCredentials:credentials
+                                                                                                   date:dateStamp
+                                                                                                 region:self.endpoint.regionName
+                                                                                                service:self.endpoint.serviceName];
+    NSString *signedHeaders = nil;
+    NSDictionary *headers = request.allHTTPHeaderFields;
+    NSString *signature = [signingContext signatureWithMethod:request.HTTPMethod
+                                                         path:path
+                                                        query:query
+                                                      headers:headers
+                                               headerTemplate:[self headerTemplateForHeaders:headers]
+                                                contentSha256:contentSha256
+                                                      amzDate:[request valueForHTTPHeaderField:@"X-Amz-Date"]
+                                                signedHeaders:&signedHeaders];
+    if (!signature) {
+        return nil;
+    }
 
-    NSString *authorization = [NSString stringWithFormat:@"%@ %@, %@, %@",
+    NSString *authorization = [NSString stringWithFormat:@"%@ Credential=%@, SignedHeaders=%@, Signature=%@",
                                AWSSignatureV4Algorithm,
-                               credentialsAuthorizationHeader,
-                               signedHeadersAuthorizationHeader,
-                               signatureAuthorizationHeader];
+                               signingContext.signingCredentials,
+                               signedHeaders,
+                               signature];
 
     return authorization;
 }
@@ -380,245 +870,298 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
                                                                      signBody:(BOOL)signBody{
     
     return [[credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
-        AWSCredentials *credentials = task.result;
-        
-        //Implementation of V4 signaure http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-query-string-auth.html
-        NSMutableString *queryString = [NSMutableString new];
-        
-        //Append Identifies the version of AWS Signature and the algorithm that you used to calculate the signature.
-        [queryString appendFormat:@"%@=%@&",@"X-Amz-Algorithm",AWSSignatureV4Algorithm];
-        
         //Get ClockSkew Fixed Date
-        NSDate *currentDate = [NSDate aws_clockSkewFixedDate];
-        
-        //Format of X-Amz-Credential : <your-access-key-id>/<date>/<AWS-region>/<AWS-service>/aws4_request.
-        NSString *scope = [NSString stringWithFormat:@"%@/%@/%@/%@",
-                           [currentDate aws_stringValue:AWSDateShortDateFormat1],
-                           endpoint.regionName,
-                           endpoint.serviceName,
-                           AWSSignatureV4Terminator];
-        
-        NSString *signingCredentials = [NSString stringWithFormat:@"%@/%@",credentials.accessKey, scope];
-        //need to replace "/" with "%2F"
-        NSString *xAmzCredentialString = [signingCredentials stringByReplacingOccurrencesOfString:@"/" withString:@"\%2F"];
-        
-        [queryString appendFormat:@"%@=%@&",@"X-Amz-Credential",xAmzCredentialString];
-        
-        //X-Amz-Date in ISO 8601 format, for example, 20130721T201207Z. This value must match the date value used to calculate the signature.
-        [queryString appendFormat:@"%@=%@&",@"X-Amz-Date",[currentDate aws_stringValue:AWSDateISO8601DateFormat2]];
-        
-        //X-Amz-Expires, Provides the time period, in seconds, for which the generated presigned URL is valid.
-        //For example, 86400 (24 hours). This value is an integer. The minimum value you can set is 1, and the maximum is 604800 (seven days).
-        [queryString appendFormat:@"%@=%d&", @"X-Amz-Expires", expireDuration];
-        
-        /*
-         X-Amz-SignedHeaders Lists the headers that you used to calculate the signature. The HTTP host header is required.
-         Any x-amz-* headers that you plan to add to the request are also required for signature calculation.
-         In general, for added security, you should sign all the request headers that you plan to include in your request.
-         */
-        
-        [queryString appendFormat:@"%@=%@&", @"X-Amz-SignedHeaders", [[AWSSignatureV4Signer getSignedHeadersString:requestHeaders] aws_stringWithURLEncoding]];
-        
-        //add additionalParameters to queryString
-        for (NSString *key in requestParameters) {
-            if ([requestParameters[key] isKindOfClass:[NSArray class]]) {
-                NSArray<NSString *> *parameterValues = requestParameters[key];
-                for (NSString *paramValue in parameterValues) {
-                    [queryString appendFormat:@"%@=%@&", [key aws_stringWithURLEncoding], [paramValue aws_stringWithURLEncoding]];
-                }
-            } else if ([requestParameters[key] isKindOfClass:[NSString class]]) {
-                NSString *value = requestParameters[key];
-                [queryString appendFormat:@"%@=%@&",[key aws_stringWithURLEncoding], [value aws_stringWithURLEncoding]];
-            } else {
-                // Only @[NSString: NSString] and @[NSString: NSArray<NSString>] supported currently
-                @throw [NSException exceptionWithName:NSInternalInconsistencyException
-                                               reason:@"Invalid requestParameters dictionary. Supported Dictionaries include [NSString: NSString] and [NSString: NSArray<NSString>]"
-                                             userInfo:nil];
-            }
-        }
-        
-        //add security-token if necessary
-        if ([credentials.sessionKey length] > 0) {
-            [queryString appendFormat:@"%@=%@&", @"X-Amz-Security-Token", [credentials.sessionKey aws_stringWithURLEncoding]];
-        }
-        
-        // =============  generate v4 signature string ===================
-        
-        /* Canonical Request Format:
-         *
-         * HTTP-VERB + "\n" +  (e.g. GET, PUT, POST)
-         * Canonical URI + "\n" + (e.g. /test.txt)
-         * Canonical Query String + "\n" (multiple queryString need to sorted by QueryParameter)
-         * Canonical Headrs + "\n" + (multiple headers need to be sorted by HeaderName)
-         * Signed Headers + "\n" + (multiple headers need to be sorted by HeaderName)
-         * "UNSIGNED-PAYLOAD"
-         */
-        
-        
-        NSString *httpMethodString = [NSString aws_stringWithHTTPMethod:httpMethod];
-        
-        //CanonicalURI is the URI-encoded version of the absolute path component of the URI—everything starting with the "/" that follows the domain name and up to the end of the string or to the question mark character ('?') if you have query string parameters. e.g. https://s3.amazonaws.com/examplebucket/myphoto.jpg /examplebucket/myphoto.jpg is the absolute path. In the absolute path, you don't encode the "/".
-        
-        NSString *canonicalURI = [NSString stringWithFormat:@"/%@", [keyPath aws_stringWithURLEncodingPath]]; //keyPath is not url-encoded.
-        
-        NSString *contentSha256;
-        if(signBody && httpMethod == AWSHTTPMethodGET){
-            //in case of http get we sign the body as an empty string only if the sign body flag is set to true
-            contentSha256 = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:[AWSSignatureSignerUtility hash:[@"" dataUsingEncoding:NSUTF8StringEncoding]] encoding:NSASCIIStringEncoding]];
-        }else{
-            contentSha256 = @"UNSIGNED-PAYLOAD";
-        }
-        //Generate Canonical Request
-        NSString *canonicalRequest = [AWSSignatureV4Signer getCanonicalizedRequest:httpMethodString
-                                                                              path:canonicalURI
-                                                                             query:queryString
-                                                                           headers:requestHeaders
-                                                                     contentSha256:contentSha256];
-        AWSDDLogVerbose(@"AWSS4 PresignedURL Canonical request: [%@]", canonicalRequest);
-        
-        //Generate String to Sign
-        NSString *stringToSign = [NSString stringWithFormat:@"%@\n%@\n%@\n%@",
-                                  AWSSignatureV4Algorithm,
-                                  [currentDate aws_stringValue:AWSDateISO8601DateFormat2],
-                                  scope,
-                                  [AWSSignatureSignerUtility hexEncode:[AWSSignatureSignerUtility hashString:canonicalRequest]]];
-        
-        AWSDDLogVerbose(@"AWS4 PresignedURL String to Sign: [%@]", stringToSign);
-        
-        //Generate Signature
-        NSData *kSigning  = [AWSSignatureV4Signer getV4DerivedKey:credentials.secretKey
-                                                             date:[currentDate aws_stringValue:AWSDateShortDateFormat1]
-                                                           region:endpoint.regionName
-                                                          service:endpoint.serviceName];
-        NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                                  withKey:kSigning];
-        NSString *signatureString = [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:signature
-                                                                                               encoding:NSASCIIStringEncoding]];
-        
-        // ============  generate v4 signature string (END) ===================
-        
-        [queryString appendFormat:@"%@=%@", @"X-Amz-Signature", signatureString];
-        
-        NSString *urlString = [NSString stringWithFormat:@"%@://%@/%@?%@", endpoint.URL.scheme, endpoint.hostName, keyPath, queryString];
-        
-        return [NSURL URLWithString:urlString];
+        return [self generateQueryStringForSignatureV4WithCredentials:task.result
+                                                                 date:[NSDate aws_clockSkewFixedDate]
+                                                           httpMethod:httpMethod
+                                                       expireDuration:expireDuration
+                                                             endpoint:endpoint
+                                                              keyPath:keyPath
+                                                       requestHeaders:requestHeaders
+                                                    requestParameters:requestParameters
+                                                             signBody:signBody];
     }];
 }
 
++ (NSURL *)generateQueryStringForSignatureV4WithCredentials:(AWSCredentials *)credentials
+                                                       date:(NSDate *)currentDate
+                                                 httpMethod:(AWSHTTPMethod)httpMethod
+                                             expireDuration:(int32_t)expireDuration
+                                                   endpoint:(AWSEndpoint *)endpoint
+                                                    keyPath:(NSString *)keyPath
+                                             requestHeaders:(NSDictionary<NSString *, NSString *> *)requestHeaders
+                                          requestParameters:(NSDictionary<NSString *, id> *)requestParameters
+                                                   signBody:(BOOL)signBody {
+    //Implementation of V4 signaure http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-query-string-auth.html
+    AWSSignatureV4SigningContext *signingContext = [AWSSignatureV4SigningContext contextWithCredentials:credentials
+                                                                                                   date:[currentDate aws_stringValue:AWSDateShortDateFormat1]
+                                                                                                 region:endpoint.regionName
+                                                                                                service:endpoint.serviceName];
+    NSString *amzDate = [currentDate aws_stringValue:AWSDateISO8601DateFormat2];
+
+    NSMutableString *queryString = [self queryStringWithSigningContext:signingContext
+                                                                amzDate:amzDate
+                                                            credentials:credentials
+                                                         expireDuration:expireDuration
+                                                         requestHeaders:requestHeaders
+                                                      requestParameters:requestParameters];
+    if (!queryString) {
+        return nil;
+    }
 
-+ (NSString *)getCanonicalizedRequest:(NSString *)method path:(NSString *)path query:(NSString *)query headers:(NSDictionary *)headers contentSha256:(NSString *)contentSha256 {
-    NSMutableString *canonicalRequest = [NSMutableString new];
-    [canonicalRequest appendString:method];
-    [canonicalRequest appendString:@"\n"];
-    [canonicalRequest appendString:path]; // Canonicalized resource path
-    [canonicalRequest appendString:@"\n"];
-
-    [canonicalRequest appendString:[AWSSignatureV4Signer getCanonicalizedQueryString:query]]; // Canonicalized Query String
-    [canonicalRequest appendString:@"\n"];
-
-    [canonicalRequest appendString:[AWSSignatureV4Signer getCanonicalizedHeaderString:headers]];
-    [canonicalRequest appendString:@"\n"];
-
-    [canonicalRequest appendString:[AWSSignatureV4Signer getSignedHeadersString:headers]];
-    [canonicalRequest appendString:@"\n"];
+    // =============  generate v4 signature string ===================
+    
+    /* Canonical Request Format:
+     *
+     * HTTP-VERB + "\n" +  (e.g. GET, PUT, POST)
+     * Canonical URI + "\n" + (e.g. /test.txt)
+     * Canonical Query String + "\n" (multiple queryString need to sorted by QueryParameter)
+     * Canonical Headrs + "\n" + (multiple headers need to be sorted by HeaderName)
+     * Signed Headers + "\n" + (multiple headers need to be sorted by HeaderName)
+     * "UNSIGNED-PAYLOAD"
+     */
+
+    //Generate Canonical Request, String to Sign and Signature
+    NSString *signatureString = [signingContext signatureWithMethod:[NSString aws_stringWithHTTPMethod:httpMethod]
+                                                               path:AWSSignatureV4PresignCanonicalURI(keyPath)
+                                                              query:queryString
+                                                            headers:requestHeaders
+                                                     headerTemplate:nil
+                                                      contentSha256:AWSSignatureV4PresignContentSha256(httpMethod, signBody)
+                                                            amzDate:amzDate
+                                                      signedHeaders:nil];
+    if (!signatureString) {
+        return nil;
+    }
 
-    [canonicalRequest appendString:[NSString stringWithFormat:@"%@", contentSha256]];
+    // ============  generate v4 signature string (END) ===================
 
-    return canonicalRequest;
+    return [self URLWithEndpoint:endpoint keyPath:keyPath queryString:queryString signature:signatureString];
 }
 
-+ (NSString *)getCanonicalizedQueryString:(NSString *)query {
-    NSMutableDictionary<NSString *, NSMutableArray<NSString *> *> *queryDictionary = [NSMutableDictionary new];
-    [[query componentsSeparatedByString:@"&"] enumerateObjectsUsingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
-        NSArray *components = [obj componentsSeparatedByString:@"="];
-        if ([components count] == 2) {
-            // ?a=b
-            NSString *key = components[0]; // a
-            NSString *value = components[1]; // b
-            if (queryDictionary[key]) {
-                // If the query parameter has multiple values, add it in the mutable array
-                [[queryDictionary objectForKey:key] addObject:value];
-            } else {
-                // Insert the value for query parameter as an element in mutable array
-                [queryDictionary setObject:[@[value] mutableCopy] forKey:key];
-            }
++ (NSArray *)generateQueryStringsForSignatureV4WithCredentials:(AWSCredentials *)credentials
+                                                          date:(NSDate *)currentDate
+                                                      requests:(NSArray<AWSSignatureV4QueryStringRequest *> *)requests {
+    NSString *dateStamp = [currentDate aws_stringValue:AWSDateShortDateFormat1];
+    NSString *amzDate = [currentDate aws_stringValue:AWSDateISO8601DateFormat2];
+    NSMutableArray *URLs = [NSMutableArray arrayWithCapacity:[requests count]];
+
+    // Requests for one region and service share a signing context and are signed together
+    NSMapTable<AWSSignatureV4SigningContext *, NSMutableIndexSet *> *groups = [NSMapTable strongToStrongObjectsMapTable];
+    NSMutableArray<AWSSignatureV4SigningContext *> *contexts = [NSMutableArray array];
+    [requests enumerateObjectsUsingBlock:^(AWSSignatureV4QueryStringRequest *request, NSUInteger idx, BOOL *stop) {
+        AWSSignatureV4SigningContext *signingContext = [AWSSignatureV4SigningContext contextWithCredentials:credentials
+                                                                                                       date:dateStamp
+                                                                                                     region:request.endpoint.regionName
+                                                                                                    service:request.endpoint.serviceName];
+        NSMutableIndexSet *indexes = [groups objectForKey:signingContext];
+        if (!indexes) {
+            indexes = [NSMutableIndexSet indexSet];
+            [groups setObject:indexes forKey:signingContext];
+            [contexts addObject:signingContext];
         }
+        [indexes addIndex:idx];
+        [URLs addObject:[NSNull null]];
     }];
 
-    NSMutableArray *sortedQuery = [[NSMutableArray alloc] initWithArray:[queryDictionary allKeys]];
+    for (AWSSignatureV4SigningContext *signingContext in contexts) {
+        NSIndexSet *indexes = [groups objectForKey:signingContext];
+        NSUInteger count = [indexes count];
+        NSMutableArray<NSMutableString *> *queryStrings = [NSMutableArray arrayWithCapacity:count];
+        NSMutableArray<NSData *> *canonicalRequests = [NSMutableArray arrayWithCapacity:count];
+        NSMutableIndexSet *built = [NSMutableIndexSet indexSet];
+
+        uint8_t storage[AWSSignatureV4CanonicalRequestStorage];
+        aws_sigv4_buf buf;
+        aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+        for (NSUInteger idx = [indexes firstIndex]; idx != NSNotFound; idx = [indexes indexGreaterThanIndex:idx]) {
+            AWSSignatureV4QueryStringRequest *request = requests[idx];
+            NSMutableString *queryString = [self queryStringWithSigningContext:signingContext
+                                                                        amzDate:amzDate
+                                                                    credentials:credentials
+                                                                 expireDuration:request.expireDuration
+                                                                 requestHeaders:request.requestHeaders
+                                                              requestParameters:request.requestParameters];
+            aws_sigv4_buf_reset(&buf);
+            if (!queryString
+                || AWSSignatureV4SignRequest(&buf, NULL, NULL, NULL, 0, NULL, 0,
+                                             [NSString aws_stringWithHTTPMethod:request.httpMethod],
+                                             AWSSignatureV4PresignCanonicalURI(request.keyPath),
+                                             queryString,
+                                             request.requestHeaders,
+                                             AWSSignatureV4PresignContentSha256(request.httpMethod, request.signBody),
+                                             NULL, NULL, NULL)) {
+                continue;
+            }
+            [queryStrings addObject:queryString];
+            [canonicalRequests addObject:[NSData dataWithBytes:buf.data length:buf.length]];
+            [built addIndex:idx];
+        }
+        aws_sigv4_buf_free(&buf);
+
+        count = [canonicalRequests count];
+        if (count == 0) {
+            continue;
+        }
+        const void **canonicalRequestBytes = malloc(count * sizeof(const void *));
+        size_t *canonicalRequestLengths = malloc(count * sizeof(size_t));
+        char (*signatures)[AWS_SIGV4_SIGNATURE_LENGTH] = malloc(count * AWS_SIGV4_SIGNATURE_LENGTH);
+        size_t amzDateLength, scopeLength;
+        const char *amzDateBytes = AWSSignatureUTF8String(amzDate, &amzDateLength);
+        const char *scopeBytes = AWSSignatureUTF8String(signingContext.scope, &scopeLength);
+        if (canonicalRequestBytes && canonicalRequestLengths && signatures) {
+            for (NSUInteger i = 0; i < count; i++) {
+                canonicalRequestBytes[i] = [canonicalRequests[i] bytes];
+                canonicalRequestLengths[i] = [canonicalRequests[i] length];
+            }
+            if (aws_sigv4_sign_canonical_requests([signingContext.kSigning bytes], amzDateBytes, amzDateLength,
+                                                  scopeBytes, scopeLength,
+                                                  canonicalRequestBytes, canonicalRequestLengths, count,
+                                                  signatures) == 0) {
+                NSUInteger i = 0;
+                for (NSUInteger idx = [built firstIndex]; idx != NSNotFound; idx = [built indexGreaterThanIndex:idx], i++) {
+                    AWSSignatureV4QueryStringRequest *request = requests[idx];
+                    NSString *signature = [[NSString alloc] initWithBytes:signatures[i]
+                                                                   length:AWS_SIGV4_SIGNATURE_LENGTH
+                                                                 encoding:NSASCIIStringEncoding];
+                    NSURL *URL = [self URLWithEndpoint:request.endpoint keyPath:request.keyPath queryString:queryStrings[i] signature:signature];
+                    if (URL) {
+                        URLs[idx] = URL;
+                    }
+                }
+            }
+        }
+        free(canonicalRequestBytes);
+        free(canonicalRequestLengths);
+        free(signatures);
+    }
 
-    [sortedQuery sortUsingSelector:@selector(compare:)];
+    return URLs;
+}
 
-    NSMutableString *sortedQueryString = [NSMutableString new];
-    for (NSString *key in sortedQuery) {
-        [queryDictionary[key] sortUsingSelector:@selector(compare:)];
-        for (NSString *parameterValue in queryDictionary[key]) {
-            [sortedQueryString appendString:key];
-            [sortedQueryString appendString:@"="];
-            [sortedQueryString appendString:parameterValue];
-            [sortedQueryString appendString:@"&"];
+/*
+ X-Amz-Algorithm, X-Amz-Credential (<your-access-key-id>/<date>/<AWS-region>/<AWS-service>/aws4_request),
+ X-Amz-Date (must match the date used to calculate the signature), X-Amz-Expires (1 to 604800 seconds)
+ and X-Amz-SignedHeaders (the host header and any x-amz-* headers the request will carry), then the
+ request parameters and the security token. Returns nil when the buffer could not grow.
+ */
++ (NSMutableString *)queryStringWithSigningContext:(AWSSignatureV4SigningContext *)signingContext
+                                           amzDate:(NSString *)amzDate
+                                       credentials:(AWSCredentials *)credentials
+                                    expireDuration:(int32_t)expireDuration
+                                    requestHeaders:(NSDictionary<NSString *, NSString *> *)requestHeaders
+                                 requestParameters:(NSDictionary<NSString *, id> *)requestParameters {
+    size_t accessKeyLength, scopeLength, amzDateLength, signedHeadersLength;
+    const char *accessKeyBytes = AWSSignatureUTF8String(signingContext.accessKey, &accessKeyLength);
+    const char *scopeBytes = AWSSignatureUTF8String(signingContext.scope, &scopeLength);
+    const char *amzDateBytes = AWSSignatureUTF8String(amzDate, &amzDateLength);
+    const char *signedHeadersBytes = AWSSignatureUTF8String([AWSSignatureV4Signer getSignedHeadersString:requestHeaders], &signedHeadersLength);
+
+    uint8_t storage[AWSSignatureV4CanonicalRequestStorage];
+    aws_sigv4_buf buf;
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    int failed = aws_sigv4_append_presign_query(&buf,
+                                                accessKeyBytes, accessKeyLength,
+                                                scopeBytes, scopeLength,
+                                                amzDateBytes, amzDateLength,
+                                                (uint32_t)MAX(expireDuration, 0),
+                                                signedHeadersBytes, signedHeadersLength);
+    NSMutableString *queryString = failed ? nil : [[NSMutableString alloc] initWithBytes:buf.data
+                                                                                   length:buf.length
+                                                                                 encoding:NSUTF8StringEncoding];
+    aws_sigv4_buf_free(&buf);
+    if (!queryString) {
+        return nil;
+    }
+    
+    //add additionalParameters to queryString
+    for (NSString *key in requestParameters) {
+        if ([requestParameters[key] isKindOfClass:[NSArray class]]) {
+            NSArray<NSString *> *parameterValues = requestParameters[key];
+            for (NSString *paramValue in parameterValues) {
+                [queryString appendFormat:@"%@=%@&", [key aws_stringWithURLEncoding], [paramValue aws_stringWithURLEncoding]];
+            }
+        } else if ([requestParameters[key] isKindOfClass:[NSString class]]) {
+            NSString *value = requestParameters[key];
+            [queryString appendFormat:@"%@=%@&",[key aws_stringWithURLEncoding], [value aws_stringWithURLEncoding]];
+        } else {
+            // Only @[NSString: NSString] and @[NSString: NSArray<NSString>] supported currently
+            @throw [NSException exceptionWithName:NSInternalInconsistencyException
+                                           reason:@"Invalid requestParameters dictionary. Supported Dictionaries include [NSString: NSString] and [NSString: NSArray<NSString>]"
+                                         userInfo:nil];
         }
     }
-    // Remove the trailing & for a valid canonical query string.
-    if ([sortedQueryString hasSuffix:@"&"]) {
-        return [sortedQueryString substringToIndex:[sortedQueryString length] - 1];
+    
+    //add security-token if necessary
+    if ([credentials.sessionKey length] > 0) {
+        [queryString appendFormat:@"%@=%@&", @"X-Amz-Security-Token", [credentials.sessionKey aws_stringWithURLEncoding]];
     }
 
-    return sortedQueryString;
+    return queryString;
 }
 
-+ (NSString *)getCanonicalizedHeaderString:(NSDictionary *)headers {
-    NSMutableArray *sortedHeaders = [[NSMutableArray alloc] initWithArray:[headers allKeys]];
++ (NSURL *)URLWithEndpoint:(AWSEndpoint *)endpoint
+                   keyPath:(NSString *)keyPath
+               queryString:(NSMutableString *)queryString
+                 signature:(NSString *)signature {
+    [queryString appendFormat:@"%@=%@", @"X-Amz-Signature", signature];
+    
+    NSString *urlString = [NSString stringWithFormat:@"%@://%@/%@?%@", endpoint.URL.scheme, endpoint.hostName, keyPath, queryString];
+    
+    return [NSURL URLWithString:urlString];
+}
 
-    [sortedHeaders sortUsingSelector:@selector(caseInsensitiveCompare:)];
 
-    NSMutableString *headerString = [NSMutableString new];
-    for (NSString *header in sortedHeaders) {
-        [headerString appendString:[header lowercaseString]];
-        [headerString appendString:@":"];
-        [headerString appendString:[headers valueForKey:header]];
-        [headerString appendString:@"\n"];
++ (NSString *)getCanonicalizedRequest:(NSString *)method path:(NSString *)path query:(NSString *)query headers:(NSDictionary *)headers contentSha256:(NSString *)contentSha256 {
+    uint8_t storage[AWSSignatureV4CanonicalRequestStorage];
+    aws_sigv4_buf buf;
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+
+    NSString *canonicalRequest = nil;
+    if (AWSSignatureV4SignRequest(&buf, NULL, NULL, NULL, 0, NULL, 0,
+                                  method, path, query, headers, contentSha256, NULL, NULL, NULL) == 0) {
+        canonicalRequest = [[NSString alloc] initWithBytes:buf.data length:buf.length encoding:NSUTF8StringEncoding];
     }
+    aws_sigv4_buf_free(&buf);
 
-    // SigV4 expects all whitespace in headers and values to be collapsed to a single space
-    NSCharacterSet *whitespaceChars = [NSCharacterSet whitespaceCharacterSet];
-    NSPredicate *noEmptyStrings = [NSPredicate predicateWithFormat:@"SELF != ''"];
-
-    NSArray *parts = [headerString componentsSeparatedByCharactersInSet:whitespaceChars];
-    NSArray *nonWhitespace = [parts filteredArrayUsingPredicate:noEmptyStrings];
-    return [nonWhitespace componentsJoinedByString:@" "];
+    return canonicalRequest;
 }
 
 + (NSString *)getSignedHeadersString:(NSDictionary *)headers {
-    NSMutableArray *sortedHeaders = [[NSMutableArray alloc] initWithArray:[headers allKeys]];
-
-    [sortedHeaders sortUsingSelector:@selector(caseInsensitiveCompare:)];
-
-    NSMutableString *headerString = [NSMutableString new];
-    for (NSString *header in sortedHeaders) {
-        if ([headerString length] > 0) {
-            [headerString appendString:@";"];
-        }
-        [headerString appendString:[header lowercaseString]];
+    // Same order as the canonical request: lowercased names compared byte by byte
+    NSMutableArray<NSString *> *sortedHeaders = [NSMutableArray arrayWithCapacity:[headers count]];
+    for (NSString *header in headers) {
+        [sortedHeaders addObject:[header lowercaseString]];
     }
+    [sortedHeaders sortUsingComparator:^NSComparisonResult(NSString *a, NSString *b) {
+        return [a compare:b options:NSLiteralSearch];
+    }];
 
-    return headerString;
+    return [sortedHeaders componentsJoinedByString:@";"];
 }
 
 + (NSData *)getV4DerivedKey:(NSString *)secret date:(NSString *)dateStamp region:(NSString *)regionName service:(NSString *)serviceName {
     // AWS4 uses a series of derived keys, formed by hashing different pieces of data
-    NSString *kSecret = [NSString stringWithFormat:@"%@%@", AWSSigV4Marker, secret];
-    NSData *kDate = [AWSSignatureSignerUtility sha256HMacWithData:[dateStamp dataUsingEncoding:NSUTF8StringEncoding]
-                                                          withKey:[kSecret dataUsingEncoding:NSUTF8StringEncoding]];
-    NSData *kRegion = [AWSSignatureSignerUtility sha256HMacWithData:[regionName dataUsingEncoding:NSASCIIStringEncoding]
-                                                            withKey:kDate];
-    NSData *kService = [AWSSignatureSignerUtility sha256HMacWithData:[serviceName dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kRegion];
-    NSData *kSigning = [AWSSignatureSignerUtility sha256HMacWithData:[AWSSignatureV4Terminator dataUsingEncoding:NSUTF8StringEncoding]
-                                                             withKey:kService];
+    size_t secretLength, dateLength, regionLength, serviceLength;
+    const char *secretBytes = AWSSignatureUTF8String(secret, &secretLength);
+    const char *dateBytes = AWSSignatureUTF8String(dateStamp, &dateLength);
+    const char *regionBytes = AWSSignatureUTF8String(regionName, &regionLength);
+    const char *serviceBytes = AWSSignatureUTF8String(serviceName, &serviceLength);
+
+    uint8_t kSigning[AWS_SHA256_DIGEST_LENGTH];
+    aws_sigv4_derive_key(secretBytes, secretLength,
+                         dateBytes, dateLength,
+                         regionBytes, regionLength,
+                         serviceBytes, serviceLength,
+                         kSigning);
+    NSData *derivedKey = [NSData dataWithBytes:kSigning length:sizeof(kSigning)];
+    memset(kSigning, 0, sizeof(kSigning));
+
+    return derivedKey;
+}
 
-    //TODO: cache this derived key?
-    return kSigning;
++ (void)clearSigningKeyCache {
+    [AWSSignatureV4SigningContext clearCache];
 }
 
 // For SigV2
@@ -693,13 +1236,10 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
     return [[self.credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
         AWSCredentials *credentials = task.result;
 
-        NSString *HTTPBodyString = [[NSString alloc] initWithData:request.HTTPBody
-                                                         encoding:NSUTF8StringEncoding];
-        NSMutableDictionary *parameters = [NSMutableDictionary new];
-        [[HTTPBodyString componentsSeparatedByCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"&"]] enumerateObjectsUsingBlock:^(id obj, NSUInteger idx, BOOL *stop) {
-            NSArray *parameter = [obj componentsSeparatedByCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"="]];
-            [parameters setValue:parameter[1] forKey:parameter[0]];
-        }];
+        // Query serializers hand over their parameters; any other body is taken apart.
+        NSDictionary<NSString *, NSString *> *queryParameters = [NSURLProtocol propertyForKey:AWSSignatureV2QueryParametersKey
+                                                                                  inRequest:request];
+        NSMutableDictionary<NSString *, NSString *> *parameters = queryParameters ? [queryParameters mutableCopy] : [AWSSignatureV2Signer parametersWithHTTPBody:request.HTTPBody];
 
         [parameters setObject:@"HmacSHA256" forKey:@"SignatureMethod"];
         [parameters setObject:@"2" forKey:@"SignatureVersion"];
@@ -711,52 +1251,187 @@ NSString *const AWSSignatureV4Terminator = @"aws4_request";
             [parameters setObject:credentials.sessionKey forKey:@"SecurityToken"];
         }
 
-        NSMutableString *canonicalizedQueryString = [[AWSSignatureV4Signer canonicalizedQueryString:parameters] mutableCopy];
-        NSData *dataToSign = [[AWSSignatureV4Signer getV2StringToSign:request
-                                             canonicalizedQueryString:canonicalizedQueryString] dataUsingEncoding:NSUTF8StringEncoding];
-        NSString *signature = [AWSSignatureSignerUtility HMACSign:dataToSign
-                                                          withKey:credentials.secretKey
-                                                   usingAlgorithm:kCCHmacAlgSHA256];
-        [canonicalizedQueryString appendFormat:@"&Signature=%@", [signature aws_stringWithURLEncoding]];
-        request.HTTPBody = [canonicalizedQueryString dataUsingEncoding:NSUTF8StringEncoding];
+        NSData *HTTPBody = [AWSSignatureV2Signer signedHTTPBodyWithRequest:request
+                                                                parameters:parameters
+                                                                 secretKey:credentials.secretKey];
+        if (HTTPBody) {
+            request.HTTPBody = HTTPBody;
+        }
 
         return nil;
     }];
 }
 
++ (NSMutableDictionary<NSString *, NSString *> *)parametersWithHTTPBody:(NSData *)HTTPBody {
+    NSString *HTTPBodyString = [[NSString alloc] initWithData:HTTPBody
+                                                     encoding:NSUTF8StringEncoding];
+    NSMutableDictionary *parameters = [NSMutableDictionary new];
+    for (NSString *pair in [HTTPBodyString componentsSeparatedByString:@"&"]) {
+        NSRange separator = [pair rangeOfString:@"=" options:NSLiteralSearch];
+        if (separator.location == NSNotFound) {
+            continue;
+        }
+        NSString *key = [[pair substringToIndex:separator.location] aws_decodeURLEncoding];
+        NSString *value = [[pair substringFromIndex:NSMaxRange(separator)] aws_decodeURLEncoding];
+        [parameters setObject:value forKey:key];
+    }
+    return parameters;
+}
+
+/*
+ The string to sign is "method \n host \n path \n canonical query" and the body is the
+ canonical query followed by the signature, so both are built in one buffer: the body
+ is its tail.
+ */
++ (NSData *)signedHTTPBodyWithRequest:(NSURLRequest *)request
+                           parameters:(NSDictionary<NSString *, NSString *> *)parameters
+                            secretKey:(NSString *)secretKey {
+    NSString *host = [request.URL host];
+    NSString *path = [request.URL path];
+    if (nil == path || [path length] < 1) {
+        path = @"/";
+    }
+
+    size_t methodLength, hostLength, pathLength, secretKeyLength;
+    const char *methodBytes = AWSSignatureUTF8String(request.HTTPMethod, &methodLength);
+    const char *hostBytes = AWSSignatureUTF8String(host, &hostLength);
+    const char *pathBytes = AWSSignatureUTF8String(path, &pathLength);
+    const char *secretKeyBytes = AWSSignatureUTF8String(secretKey, &secretKeyLength);
+
+    uint8_t storage[AWSSignatureV4CanonicalRequestStorage];
+    aws_sigv4_buf buf;
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    int failed = aws_sigv4_buf_append(&buf, methodBytes, methodLength)
+        || aws_sigv4_buf_append(&buf, "\n", 1)
+        || aws_sigv4_buf_append(&buf, hostBytes, hostLength)
+        || aws_sigv4_buf_append(&buf, "\n", 1)
+        || aws_sigv4_buf_append(&buf, pathBytes, pathLength)
+        || aws_sigv4_buf_append(&buf, "\n", 1);
+    size_t queryOffset = buf.length;
+
+    // SigV2 sorts parameters by the bytes of their names.
+    NSArray<NSString *> *sortedKeys = [[parameters allKeys] sortedArrayUsingComparator:^NSComparisonResult(NSString *a, NSString *b) {
+        return [a compare:b options:NSLiteralSearch];
+    }];
+    for (NSString *key in sortedKeys) {
+        size_t keyLength, valueLength;
+        const char *keyBytes = AWSSignatureUTF8String(key, &keyLength);
+        const char *valueBytes = AWSSignatureUTF8String(parameters[key], &valueLength);
+        failed = failed || aws_sigv4_append_query_param(&buf, keyBytes, keyLength, valueBytes, valueLength);
+    }
+
+    NSData *HTTPBody = nil;
+    if (!failed) {
+        if (buf.length > queryOffset) {
+            buf.length--; // the '&' after the last parameter
+        }
+
+        uint8_t digest[AWS_SHA256_DIGEST_LENGTH];
+        aws_hmac_sha256(secretKeyBytes, secretKeyLength, buf.data, buf.length, digest);
+        NSString *signature = [[NSData dataWithBytes:digest length:sizeof(digest)] base64EncodedStringWithOptions:kNilOptions];
+        size_t signatureLength;
+        const char *signatureBytes = AWSSignatureUTF8String(signature, &signatureLength);
+        failed = aws_sigv4_buf_append(&buf, "&Signature=", 11)
+            || aws_sigv4_append_uri_encoded(&buf, signatureBytes, signatureLength, 1);
+    }
+    if (failed) {
+        AWSDDLogError(@"Unable to sign: out of memory building the canonical query string.");
+    } else {
+        HTTPBody = [NSData dataWithBytes:buf.data + queryOffset length:buf.length - queryOffset];
+    }
+
+    aws_sigv4_buf_free(&buf);
+    return HTTPBody;
+}
+
 @end
 
 #pragma mark - S3ChunkedEncodingInputStream
 
-static NSUInteger defaultChunkSize = 32 * 1024 - 91;
-static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+const NSUInteger AWSS3ChunkedEncodingMinimumChunkSize = 64 * 1024;
+const NSUInteger AWSS3ChunkedEncodingMaximumChunkSize = 8 * 1024 * 1024;
+const NSUInteger AWSS3ChunkedEncodingDefaultChunkSize = 64 * 1024;
+
+static const char AWSS3ChunkSignaturePrefix[] = ";chunk-signature=";
+static const size_t AWSS3ChunkSignatureLength = AWS_SIGV4_SIGNATURE_LENGTH;
+
+// <6 hex digits>;chunk-signature=<signature>\r\n. Six digits cover the largest chunk size.
+static const size_t AWSS3ChunkHeaderLength = 6 + sizeof(AWSS3ChunkSignaturePrefix) - 1 + AWSS3ChunkSignatureLength + 2;
+static const size_t AWSS3ChunkTrailerLength = 2;
+
+// x-amz-checksum-crc32c:<base64 of four bytes>\r\n\r\n, closing an unsigned stream
+static const char AWSS3ChecksumTrailerName[] = "x-amz-checksum-crc32c:";
+static const size_t AWSS3ChecksumTrailerLength = sizeof(AWSS3ChecksumTrailerName) - 1 + 8 + 4;
+
+static NSUInteger AWSS3ChunkedEncodingClampChunkSize(NSUInteger chunkSize) {
+    if (chunkSize == 0) {
+        return AWSS3ChunkedEncodingDefaultChunkSize;
+    }
+    return MIN(MAX(chunkSize, AWSS3ChunkedEncodingMinimumChunkSize), AWSS3ChunkedEncodingMaximumChunkSize);
+}
 
-@interface AWSS3ChunkedEncodingInputStream()
+@interface AWSS3ChunkedEncodingInputStream() {
+    // Two chunk buffers: the consumer reads one while the producer fills and signs
+    // the other. Each holds header, payload and trailer back to back, so the payload
+    // is read from the source straight into place.
+    uint8_t *_chunks[2];
+    NSUInteger _chunkOffsets[2];
+    NSUInteger _chunkLengths[2];
+    NSUInteger _chunkOverheads[2];
+    BOOL _chunkIsLast[2];
+    BOOL _chunkFailed[2];
+
+    // Buffer the consumer is reading, and whether it holds one at all.
+    NSUInteger _consumerIndex;
+    BOOL _consumerHoldsChunk;
+
+    dispatch_semaphore_t _emptyChunks;
+    dispatch_semaphore_t _filledChunks;
+    dispatch_group_t _producer;
+    BOOL _producerStarted;
+
+    // Keyed with the signing key and fed "AWS4-HMAC-SHA256-PAYLOAD\n<date>\n<scope>\n",
+    // which is the same for every chunk. Copied by value to sign each one.
+    aws_hmac_sha256_ctx _chunkHMAC;
+
+    // Signature of previous chunk. It's initialized as that of headers.
+    char _priorSignature[AWS_SIGV4_SIGNATURE_LENGTH];
+
+    // Unsigned chunks closed by a CRC32C trailer instead of signed chunks
+    BOOL _checksumTrailer;
+    uint32_t _crc32c;
+
+    // Sign two chunks at a time when both buffers are free and the CPU hashes
+    // messages side by side (aws_sha256_multi_lanes() > 1)
+    BOOL _signsChunkPairs;
+
+    // Run loops this stream is scheduled on, as (CFRunLoopRef, mode) pairs. The
+    // source is read synchronously by the producer and is never scheduled itself;
+    // events for this stream are posted from here.
+    NSMutableArray<NSArray *> *_runLoopModes;
+
+    // Client set by CFReadStreamSetClient when the stream is used as a CFReadStream
+    CFOptionFlags _clientFlags;
+    CFReadStreamClientCallBack _clientCallback;
+    CFStreamClientContext _clientContext;
+}
 
 // original input stream
 @property (nonatomic, strong) NSInputStream *stream;
 
-// buffer for chunked data plus header
-@property (nonatomic, strong) NSMutableData *chunkData;
-
-// Mark the location of chunkData to be read
+// Mark the location of the current chunk to be read
 @property (nonatomic, assign) NSUInteger location;
 
 // A flag indicates end of stream
 @property (nonatomic, assign) BOOL endOfStream;
 
-// SigV4 related properties
-// Date, used in signing
-@property (nonatomic, strong) NSDate *date;
+// A flag indicates the source stream failed
+@property (nonatomic, assign) BOOL failed;
 
-// Keypath/Scope
-@property (nonatomic, strong) NSString *scope;
+// Set on close to stop the producer
+@property (atomic, assign) BOOL cancelled;
 
-// Signature of previous chunk. It's initialized as that of headers.
-@property (nonatomic, strong) NSString *priorSha256;
-
-// SigV4 signing key
-@property (nonatomic, strong) NSData *kSigning;
+@property (nonatomic, assign, readwrite) NSUInteger chunkSize;
 
 @end
 
@@ -769,22 +1444,87 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
                               scope:(NSString *)scope
                            kSigning:(NSData *)kSigning
                     headerSignature:(NSString *)headerSignature {
+    return [self initWithInputStream:stream
+                                date:date
+                               scope:scope
+                            kSigning:kSigning
+                     headerSignature:headerSignature
+                           chunkSize:AWSS3ChunkedEncodingDefaultChunkSize];
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                               date:(NSDate *)date
+                              scope:(NSString *)scope
+                           kSigning:(NSData *)kSigning
+                    headerSignature:(NSString *)headerSignature
+                          chunkSize:(NSUInteger)chunkSize {
+    if (self = [self initWithInputStream:stream chunkSize:chunkSize checksumTrailer:NO]) {
+        size_t amzDateLength, scopeLength, length;
+        const char *amzDateBytes = AWSSignatureUTF8String([date aws_stringValue:AWSDateISO8601DateFormat2], &amzDateLength);
+        const char *scopeBytes = AWSSignatureUTF8String(scope, &scopeLength);
+        aws_hmac_sha256_ctx key;
+        aws_hmac_sha256_init(&key, [kSigning bytes], [kSigning length]);
+        aws_sigv4_chunk_key(&_chunkHMAC, &key, amzDateBytes, amzDateLength, scopeBytes, scopeLength);
+        memset(&key, 0, sizeof(key));
+
+        const char *bytes = AWSSignatureUTF8String(headerSignature, &length);
+        memset(_priorSignature, '0', sizeof(_priorSignature));
+        memcpy(_priorSignature, bytes, MIN(length, sizeof(_priorSignature)));
+        _signsChunkPairs = aws_sha256_multi_lanes() > 1;
+    }
+
+    return self;
+}
+
+- (instancetype)initUnsignedWithInputStream:(NSInputStream *)stream
+                                  chunkSize:(NSUInteger)chunkSize {
+    return [self initWithInputStream:stream chunkSize:chunkSize checksumTrailer:YES];
+}
+
+- (instancetype)initWithInputStream:(NSInputStream *)stream
+                          chunkSize:(NSUInteger)chunkSize
+                    checksumTrailer:(BOOL)checksumTrailer {
     if (self = [super init]) {
         _stream = stream;
         _stream.delegate = self;
-        _date = [date copy];
-        _scope = [scope copy];
-        _kSigning = [kSigning copy];
-        _priorSha256 = [headerSignature copy];
+        _chunkSize = AWSS3ChunkedEncodingClampChunkSize(chunkSize);
+        _checksumTrailer = checksumTrailer;
+
+        // Chunk size plus signature header and trailer. The last chunk of an
+        // unsigned stream carries the checksum trailer in place of payload.
+        NSUInteger capacity = AWSS3ChunkHeaderLength + _chunkSize + AWSS3ChunkTrailerLength;
+        _chunks[0] = malloc(capacity);
+        _chunks[1] = malloc(capacity);
+        if (_chunks[0] == NULL || _chunks[1] == NULL) {
+            return nil;
+        }
 
-        // Chunk size plus signature header
-        NSUInteger chunkSize = defaultChunkSize + [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:defaultChunkSize];
-        _chunkData = [[NSMutableData alloc] initWithCapacity:chunkSize];
+        // Created empty and signalled, so the semaphore may be released at any count.
+        _emptyChunks = dispatch_semaphore_create(0);
+        dispatch_semaphore_signal(_emptyChunks);
+        dispatch_semaphore_signal(_emptyChunks);
+        _filledChunks = dispatch_semaphore_create(0);
+        _producer = dispatch_group_create();
+        _runLoopModes = [NSMutableArray new];
     }
 
     return self;
 }
 
+- (void)dealloc {
+    // A producer waiting for a buffer finds no stream when it wakes and exits.
+    _cancelled = YES;
+    if (_emptyChunks) {
+        dispatch_semaphore_signal(_emptyChunks);
+    }
+    free(_chunks[0]);
+    free(_chunks[1]);
+    memset(&_chunkHMAC, 0, sizeof(_chunkHMAC));
+    if (_clientContext.release && _clientContext.info) {
+        _clientContext.release(_clientContext.info);
+    }
+}
+
 - (void)stream:(NSStream *)aStream handleEvent:(NSStreamEvent)eventCode {
     if ((eventCode & (1 << 4))) {
         // toggle the NSStreamEventEndEncountered bit.
@@ -795,94 +1535,263 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
     }
 }
 
-// Read next chunk of data from stream, and sign the chunk.
-// Returns YES on a successful read, NO otherwise.
-- (BOOL)nextChunk {
-    if (self.endOfStream) {
-        return NO;
+#pragma mark Producer
+
+// Starts reading and signing ahead of the consumer. The producer holds the stream
+// only while it fills a buffer, so a stream dropped without close still deallocates.
+- (void)startProducer {
+    if (_producerStarted) {
+        return;
     }
+    _producerStarted = YES;
+
+    dispatch_semaphore_t emptyChunks = _emptyChunks;
+    dispatch_semaphore_t filledChunks = _filledChunks;
+    __weak AWSS3ChunkedEncodingInputStream *weakSelf = self;
+    dispatch_group_async(_producer, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        NSUInteger index = 0;
+        BOOL done = NO;
+        while (!done) {
+            dispatch_semaphore_wait(emptyChunks, DISPATCH_TIME_FOREVER);
+            AWSS3ChunkedEncodingInputStream *strongSelf = weakSelf;
+            if (strongSelf == nil || strongSelf.cancelled) {
+                break;
+            }
+            NSUInteger filled = 1;
+            // With both buffers free, at the start or whenever the consumer has
+            // caught up, the two chunks are signed together.
+            if (strongSelf->_signsChunkPairs && dispatch_semaphore_wait(emptyChunks, DISPATCH_TIME_NOW) == 0) {
+                done = [strongSelf fillChunkPair:index filled:&filled];
+                if (filled == 1) {
+                    dispatch_semaphore_signal(emptyChunks);
+                }
+            } else {
+                done = [strongSelf fillChunk:index];
+            }
+            for (NSUInteger i = 0; i < filled; i++) {
+                dispatch_semaphore_signal(filledChunks);
+            }
+            index ^= filled & 1;
+        }
+    });
+}
 
-    // clear current chunkData for next chunk
-    [self.chunkData setLength:0];
+- (void)stopProducer {
+    if (!_producerStarted) {
+        return;
+    }
+    self.cancelled = YES;
+    dispatch_semaphore_signal(_emptyChunks);
+    dispatch_group_wait(_producer, DISPATCH_TIME_FOREVER);
+}
 
-    uint8_t *chunkBuffer = calloc(defaultChunkSize, sizeof(uint8_t));
-    NSInteger read = [self.stream read:chunkBuffer maxLength:defaultChunkSize];
+// Reads up to chunkSize bytes from the source into a buffer's payload.
+// Returns NO, with the buffer marked failed, when the source failed.
+- (BOOL)readChunk:(NSUInteger)index length:(NSUInteger *)length {
+    uint8_t *payload = _chunks[index] + AWSS3ChunkHeaderLength;
+    NSUInteger total = 0;
+
+    _chunkFailed[index] = NO;
+    while (total < self.chunkSize) {
+        NSInteger read = [self.stream read:payload + total maxLength:self.chunkSize - total];
+        if (read < 0) {
+            _chunkFailed[index] = YES;
+            return NO;
+        }
+        if (read == 0) {
+            break;
+        }
+        total += read;
+    }
+
+    *length = total;
+    _chunkIsLast[index] = (total == 0);
+    return YES;
+}
 
-    // mark end of stream if no data is read
-    self.endOfStream = (read <= 0);
+// Reads a chunk into a buffer and frames it.
+// Returns YES when this was the last chunk or the source failed.
+- (BOOL)fillChunk:(NSUInteger)index {
+    NSUInteger length;
+    if (![self readChunk:index length:&length]) {
+        return YES;
+    }
 
-    // return NO if stream read failed
-    if (read < 0) {
-        free(chunkBuffer);
-        AWSDDLogError(@"stream read failed streamStatus: %lu streamError: %@", (unsigned long)[self.stream streamStatus], [self.stream streamError].description);
-        return NO;
+    if (_checksumTrailer) {
+        [self finishUnsignedChunk:index payloadLength:length];
+    } else {
+        aws_sigv4_chunk_signature(&_chunkHMAC, _priorSignature, _chunks[index] + AWSS3ChunkHeaderLength, length, _priorSignature);
+        [self finishSignedChunk:index payloadLength:length signature:_priorSignature];
     }
+    _chunkOverheads[index] = _chunkLengths[index] - length;
 
-    NSData *data = [NSData dataWithBytesNoCopy:chunkBuffer length:read];
-    [self.chunkData appendData:[self getSignedChunk:data]];
+    return _chunkIsLast[index];
+}
 
-    AWSDDLogVerbose(@"stream read: %ld, chunk size: %lu", (long)read, (unsigned long)[self.chunkData length]);
+// Reads the next two chunks into buffer index and the other one, and signs them
+// with one aws_sigv4_chunk_signatures call so their payloads are hashed side by
+// side. Stops after the first when it is the last chunk or the source failed.
+// filled is set to the number of buffers handed to the consumer.
+- (BOOL)fillChunkPair:(NSUInteger)index filled:(NSUInteger *)filled {
+    NSUInteger indexes[2] = { index, index ^ 1 };
+    const void *payloads[2];
+    size_t lengths[2];
+    char signatures[2][AWS_SIGV4_SIGNATURE_LENGTH];
+    NSUInteger count = 0;
+    BOOL done = NO;
+
+    *filled = 0;
+    while (*filled < 2 && !done) {
+        NSUInteger chunk = indexes[(*filled)++];
+        NSUInteger length;
+        if (![self readChunk:chunk length:&length]) {
+            done = YES;
+            break;
+        }
+        payloads[count] = _chunks[chunk] + AWSS3ChunkHeaderLength;
+        lengths[count++] = length;
+        done = _chunkIsLast[chunk];
+    }
 
-    return YES;
+    if (count > 0) {
+        aws_sigv4_chunk_signatures(&_chunkHMAC, _priorSignature, payloads, lengths, count, signatures);
+        memcpy(_priorSignature, signatures[count - 1], sizeof(_priorSignature));
+    }
+    for (NSUInteger i = 0; i < count; i++) {
+        [self finishSignedChunk:indexes[i] payloadLength:lengths[i] signature:signatures[i]];
+        _chunkOverheads[indexes[i]] = _chunkLengths[indexes[i]] - lengths[i];
+    }
+
+    return done;
 }
 
-// Signs data
-- (NSData *)getSignedChunk:(NSData *)data {
-    NSString *chunkSha256 = [self dataToHexString:[AWSSignatureSignerUtility hash:data]];
-    NSString *stringToSign = [NSString stringWithFormat:
-                              @"%@\n%@\n%@\n%@\n%@\n%@",
-                              @"AWS4-HMAC-SHA256-PAYLOAD",
-                              [self.date aws_stringValue:AWSDateISO8601DateFormat2],
-                              self.scope,
-                              self.priorSha256,
-                              emptyStringSha256,
-                              chunkSha256];
-    AWSDDLogVerbose(@"AWS4 String to Sign: [%@]", stringToSign);
+// <6 hex digits>;chunk-signature=<signature>\r\n<payload>\r\n
+- (void)finishSignedChunk:(NSUInteger)index payloadLength:(NSUInteger)length signature:(const char *)signature {
+    uint8_t *chunk = _chunks[index];
+    uint8_t *payload = chunk + AWSS3ChunkHeaderLength;
 
-    NSData *signature = [AWSSignatureSignerUtility sha256HMacWithData:[stringToSign dataUsingEncoding:NSUTF8StringEncoding]
-                                                              withKey:self.kSigning];
-    self.priorSha256 = [self dataToHexString:signature];
-    NSString *chunkedHeader = [NSString stringWithFormat:@"%06lx;chunk-signature=%@\r\n", (unsigned long)[data length], self.priorSha256];
-    AWSDDLogVerbose(@"AWS4 Chunked Header: [%@]", chunkedHeader);
+    static const char hexDigits[] = "0123456789abcdef";
+    uint8_t *header = chunk;
+    for (int i = 5; i >= 0; i--) {
+        header[i] = hexDigits[(length >> (4 * (5 - i))) & 0xf];
+    }
+    header += 6;
+    memcpy(header, AWSS3ChunkSignaturePrefix, sizeof(AWSS3ChunkSignaturePrefix) - 1);
+    header += sizeof(AWSS3ChunkSignaturePrefix) - 1;
+    memcpy(header, signature, AWSS3ChunkSignatureLength);
+    header += AWSS3ChunkSignatureLength;
+    header[0] = '\r';
+    header[1] = '\n';
+    payload[length] = '\r';
+    payload[length + 1] = '\n';
+
+    _chunkOffsets[index] = 0;
+    _chunkLengths[index] = AWSS3ChunkHeaderLength + length + AWSS3ChunkTrailerLength;
+
+    AWSDDLogVerbose(@"AWS4 Chunked Header: [%@]", [[NSString alloc] initWithBytes:chunk
+                                                                            length:AWSS3ChunkHeaderLength - 2
+                                                                          encoding:NSASCIIStringEncoding]);
+}
 
-    NSMutableData *signedChunk = [NSMutableData data];
-    [signedChunk appendData:[chunkedHeader dataUsingEncoding:NSUTF8StringEncoding]];
-    [signedChunk appendData:data];
-    [signedChunk appendData:[@"\r\n" dataUsingEncoding:NSUTF8StringEncoding]];
+// <hex size>\r\n<payload>\r\n, and for the last chunk 0\r\n<checksum trailer>\r\n\r\n.
+// The header is written right before the payload, so the chunk starts at an offset.
+- (void)finishUnsignedChunk:(NSUInteger)index payloadLength:(NSUInteger)length {
+    static const char hexDigits[] = "0123456789abcdef";
+    uint8_t *chunk = _chunks[index];
+    uint8_t *payload = chunk + AWSS3ChunkHeaderLength;
+    uint8_t *header = payload - 2;
+
+    header[0] = '\r';
+    header[1] = '\n';
+    NSUInteger rest = length;
+    do {
+        *--header = hexDigits[rest & 0xf];
+        rest >>= 4;
+    } while (rest > 0);
+    _chunkOffsets[index] = header - chunk;
+
+    if (length > 0) {
+        _crc32c = aws_crc32c(_crc32c, payload, length);
+        payload[length] = '\r';
+        payload[length + 1] = '\n';
+        _chunkLengths[index] = AWSS3ChunkHeaderLength - _chunkOffsets[index] + length + AWSS3ChunkTrailerLength;
+        return;
+    }
 
-    self.totalLengthOfChunkSignatureSent += [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:0];
-    return signedChunk;
+    uint8_t crc[AWS_CRC32C_LENGTH];
+    aws_crc32c_bytes(_crc32c, crc);
+    NSString *checksum = [[NSData dataWithBytes:crc length:sizeof(crc)] base64EncodedStringWithOptions:0];
+    uint8_t *trailer = payload;
+    memcpy(trailer, AWSS3ChecksumTrailerName, sizeof(AWSS3ChecksumTrailerName) - 1);
+    trailer += sizeof(AWSS3ChecksumTrailerName) - 1;
+    memcpy(trailer, [checksum UTF8String], 8);
+    memcpy(trailer + 8, "\r\n\r\n", 4);
+    _chunkLengths[index] = AWSS3ChunkHeaderLength - _chunkOffsets[index] + AWSS3ChecksumTrailerLength;
+
+    AWSDDLogVerbose(@"AWS4 Checksum Trailer: [x-amz-checksum-crc32c:%@]", checksum);
 }
 
-- (NSString *)dataToHexString:(NSData *) data {
-    return [AWSSignatureSignerUtility hexEncode:[[NSString alloc] initWithData:data
-                                                                      encoding:NSASCIIStringEncoding]];
+#pragma mark Consumer
+
+// Hands the current chunk back to the producer and takes the next signed one.
+// Returns YES on a successful read, NO otherwise.
+- (BOOL)nextChunk {
+    if (self.endOfStream || self.cancelled) {
+        return NO;
+    }
+
+    if (_consumerHoldsChunk) {
+        BOOL wasLast = _chunkIsLast[_consumerIndex];
+        _consumerHoldsChunk = NO;
+        _consumerIndex ^= 1;
+        dispatch_semaphore_signal(_emptyChunks);
+        if (wasLast) {
+            self.endOfStream = YES;
+            return NO;
+        }
+    }
+
+    [self startProducer];
+    dispatch_semaphore_wait(_filledChunks, DISPATCH_TIME_FOREVER);
+
+    // return NO if stream read failed
+    if (_chunkFailed[_consumerIndex]) {
+        self.endOfStream = YES;
+        self.failed = YES;
+        AWSDDLogError(@"stream read failed streamStatus: %lu streamError: %@", (unsigned long)[self.stream streamStatus], [self.stream streamError].description);
+        return NO;
+    }
+
+    _consumerHoldsChunk = YES;
+    self.location = 0;
+    self.totalLengthOfChunkSignatureSent += _chunkOverheads[_consumerIndex];
+
+    AWSDDLogVerbose(@"chunk size: %lu", (unsigned long)_chunkLengths[_consumerIndex]);
+
+    return YES;
 }
 
 #pragma mark NSInputStream methods
 
 - (NSInteger)read:(uint8_t *)buffer maxLength:(NSUInteger)len {
-    //change the defaultChunkSize according to caller reading capacity.
-    defaultChunkSize = len - [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:0];
     // check whether there is data available
-    if ([self.chunkData length] <= self.location) {
+    if (!_consumerHoldsChunk || _chunkLengths[_consumerIndex] <= self.location) {
         // set up next chunk
-        if ([self nextChunk]) {
-            // rewind location
-            self.location = 0;
-        } else {
-            return 0;
+        if (![self nextChunk]) {
+            [self postEvent:self.failed ? NSStreamEventErrorOccurred : NSStreamEventEndEncountered];
+            return self.failed ? -1 : 0;
         }
     }
 
     // compute how many bytes to read from chunk
-    NSUInteger length = MIN(len, [self.chunkData length] - self.location);
-    NSRange range = {self.location, length};
-    [self.chunkData getBytes:(void *)buffer range:range];
+    NSUInteger length = MIN(len, _chunkLengths[_consumerIndex] - self.location);
+    memcpy(buffer, _chunks[_consumerIndex] + _chunkOffsets[_consumerIndex] + self.location, length);
 
     // Update location
     self.location += length;
 
+    [self postEvent:NSStreamEventHasBytesAvailable];
+
     return length;
 }
 
@@ -896,9 +1805,12 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
 
 - (void)open {
     [self.stream open];
+    [self postEvent:NSStreamEventOpenCompleted];
+    [self postEvent:NSStreamEventHasBytesAvailable];
 }
 
 - (void)close {
+    [self stopProducer];
 	[self.stream close];
 }
 
@@ -910,14 +1822,91 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
     }
 }
 
+#pragma mark Run loop events
+
+// The source is read with blocking reads on the producer's queue, so it must not
+// also be scheduled on a run loop. Scheduling is kept on this stream, which posts
+// its own events; the private CFReadStream entry points are implemented so that
+// NSURLSession, which schedules body streams through them, is not forwarded to
+// the source either.
+
 - (void)scheduleInRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
-	[self.stream scheduleInRunLoop:aRunLoop forMode:mode];
+    [self _scheduleInCFRunLoop:[aRunLoop getCFRunLoop] forMode:(__bridge CFStringRef)mode];
 }
 
 - (void)removeFromRunLoop:(NSRunLoop *)aRunLoop forMode:(NSString *)mode {
-	[self.stream removeFromRunLoop:aRunLoop forMode:mode];
+    [self _unscheduleFromCFRunLoop:[aRunLoop getCFRunLoop] forMode:(__bridge CFStringRef)mode];
+}
+
+- (void)_scheduleInCFRunLoop:(CFRunLoopRef)aRunLoop forMode:(CFStringRef)aMode {
+    NSArray *runLoopMode = @[(__bridge id)aRunLoop, (__bridge NSString *)aMode];
+    @synchronized(_runLoopModes) {
+        if (![_runLoopModes containsObject:runLoopMode]) {
+            [_runLoopModes addObject:runLoopMode];
+        }
+    }
+}
+
+- (void)_unscheduleFromCFRunLoop:(CFRunLoopRef)aRunLoop forMode:(CFStringRef)aMode {
+    @synchronized(_runLoopModes) {
+        [_runLoopModes removeObject:@[(__bridge id)aRunLoop, (__bridge NSString *)aMode]];
+    }
+}
+
+- (BOOL)_setCFClientFlags:(CFOptionFlags)inFlags
+                 callback:(CFReadStreamClientCallBack)inCallback
+                  context:(CFStreamClientContext *)inContext {
+    if (_clientContext.release && _clientContext.info) {
+        _clientContext.release(_clientContext.info);
+    }
+    memset(&_clientContext, 0, sizeof(_clientContext));
+    _clientFlags = 0;
+    _clientCallback = NULL;
+
+    if (inCallback != NULL) {
+        _clientFlags = inFlags;
+        _clientCallback = inCallback;
+        if (inContext) {
+            _clientContext = *inContext;
+            if (_clientContext.retain && _clientContext.info) {
+                _clientContext.info = (void *)_clientContext.retain(_clientContext.info);
+            }
+        }
+    }
+    return YES;
+}
+
+// Delivers eventCode to the delegate and the CFReadStream client on every run
+// loop the stream is scheduled on. Does nothing while unscheduled, as for any
+// stream that is read synchronously.
+- (void)postEvent:(NSStreamEvent)eventCode {
+    NSArray<NSArray *> *runLoopModes;
+    @synchronized(_runLoopModes) {
+        runLoopModes = [_runLoopModes copy];
+    }
+
+    __weak AWSS3ChunkedEncodingInputStream *weakSelf = self;
+    for (NSArray *runLoopMode in runLoopModes) {
+        CFRunLoopRef runLoop = (__bridge CFRunLoopRef)runLoopMode[0];
+        CFRunLoopPerformBlock(runLoop, (__bridge CFStringRef)runLoopMode[1], ^{
+            [weakSelf deliverEvent:eventCode];
+        });
+        CFRunLoopWakeUp(runLoop);
+    }
+}
+
+- (void)deliverEvent:(NSStreamEvent)eventCode {
+    if (_clientCallback && (_clientFlags & eventCode)) {
+        _clientCallback((__bridge CFReadStreamRef)self, (CFStreamEventType)eventCode, _clientContext.info);
+    }
+    id<NSStreamDelegate> delegate = self.delegate;
+    if (delegate != self && [delegate respondsToSelector:@selector(stream:handleEvent:)]) {
+        [delegate stream:self handleEvent:eventCode];
+    }
 }
 
+#pragma mark Stream properties
+
 - (id)propertyForKey:(NSString *)key {
 	return [self.stream propertyForKey:key];
 }
@@ -957,17 +1946,27 @@ static NSString *const emptyStringSha256 = @"e3b0c44298fc1c149afbf4c8996fb92427a
  * <data>\r\n
  **/
 + (NSUInteger)oneChunkedDataSize:(NSUInteger)dataLength {
-    return [[NSString stringWithFormat:@"%06lx;chunk-signature=%@\r\n",  (unsigned long)dataLength, emptyStringSha256] length] + dataLength + [@"\r\n" length];
+    // the size is printed with at least six hex digits
+    NSUInteger digits = 6;
+    for (NSUInteger rest = dataLength >> 24; rest > 0; rest >>= 4) {
+        digits++;
+    }
+    return digits + (sizeof(AWSS3ChunkSignaturePrefix) - 1) + AWSS3ChunkSignatureLength + 2 + dataLength + AWSS3ChunkTrailerLength;
 }
 
 + (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength {
+    return [self computeContentLengthForChunkedData:dataLength chunkSize:AWSS3ChunkedEncodingDefaultChunkSize];
+}
+
++ (NSUInteger)computeContentLengthForChunkedData:(NSUInteger)dataLength chunkSize:(NSUInteger)chunkSize {
+    chunkSize = AWSS3ChunkedEncodingClampChunkSize(chunkSize);
     NSUInteger result = 0;
 
     // length of full chunks
-    result += (dataLength / defaultChunkSize) * [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:defaultChunkSize];
+    result += (dataLength / chunkSize) * [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:chunkSize];
     
     // length of remaining data
-    NSUInteger remainingDataLength = dataLength % defaultChunkSize;
+    NSUInteger remainingDataLength = dataLength % chunkSize;
     if (remainingDataLength > 0) {
         result += [AWSS3ChunkedEncodingInputStream oneChunkedDataSize:remainingDataLength];
     }
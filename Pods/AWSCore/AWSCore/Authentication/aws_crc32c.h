@@ -0,0 +1,49 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_CRC32C_H_
+#define AWS_CRC32C_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * CRC-32C (Castagnoli), the checksum S3 accepts as x-amz-checksum-crc32c.
+ *
+ * Uses the SSE4.2 CRC32 instruction on x86-64 when the CPU has it, the ARMv8
+ * CRC32C instructions when the compiler targets them, and slicing-by-8
+ * tables everywhere else. Define AWS_CRC32C_NO_ASM to build the tables only.
+ */
+
+#define AWS_CRC32C_LENGTH 4
+
+/*
+ * Returns the CRC of everything hashed so far followed by data. Start with
+ * crc = 0 and feed the previous result back in to checksum a stream.
+ */
+uint32_t aws_crc32c(uint32_t crc, const void *data, size_t length);
+
+/* out = the CRC in network byte order, as S3 expects it before base64 */
+void aws_crc32c_bytes(uint32_t crc, uint8_t out[AWS_CRC32C_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,710 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#include "aws_sha256.h"
+
+#include <pthread.h>
+#include <string.h>
+
+#if !defined(AWS_SHA256_NO_ASM) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define AWS_SHA256_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#elif !defined(AWS_SHA256_NO_ASM) && defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_SHA2))
+#define AWS_SHA256_ARMV8
+#include <arm_neon.h>
+#endif
+
+// pointers handed to one multi-buffer pass when HMAC rehashes the inner digests
+#define AWS_SHA256_MULTI_BATCH 64
+
+// most messages a multi-buffer block function takes at once
+#define AWS_SHA256_MAX_LANES 8
+
+typedef void (*aws_sha256_compress_fn)(uint32_t state[8], const uint8_t *data, size_t blocks);
+
+// one block for each of "lanes" messages, message l reading state[l] and block[l]
+typedef void (*aws_sha256_compress_multi_fn)(uint32_t *const *state, const uint8_t *const *block);
+
+static const uint32_t aws_sha256_iv[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+static const uint32_t aws_sha256_k[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+static inline uint32_t aws_sha256_load_be32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+static inline void aws_sha256_store_be32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+// C block function
+
+#define AWS_ROTR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+// one round; the caller rotates the variable names instead of moving values
+#define AWS_SHA256_ROUND(a, b, c, d, e, f, g, h, t, wt)                                    \
+    do {                                                                                 \
+        uint32_t t1 = h + (AWS_ROTR32(e, 6) ^ AWS_ROTR32(e, 11) ^ AWS_ROTR32(e, 25))        \
+            + (g ^ (e & (f ^ g))) + aws_sha256_k[t] + (wt);                              \
+        d += t1;                                                                         \
+        h = t1 + (AWS_ROTR32(a, 2) ^ AWS_ROTR32(a, 13) ^ AWS_ROTR32(a, 22))                 \
+            + ((a & b) | (c & (a | b)));                                                 \
+    } while (0)
+
+#define AWS_SHA256_SCHEDULE(w, t)                                                         \
+    (w[(t) & 15] += (AWS_ROTR32(w[((t) + 1) & 15], 7) ^ AWS_ROTR32(w[((t) + 1) & 15], 18)  \
+                     ^ (w[((t) + 1) & 15] >> 3))                                          \
+        + w[((t) + 9) & 15]                                                              \
+        + (AWS_ROTR32(w[((t) + 14) & 15], 17) ^ AWS_ROTR32(w[((t) + 14) & 15], 19)        \
+           ^ (w[((t) + 14) & 15] >> 10)))
+
+static void aws_sha256_compress_c(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    uint32_t w[16];
+
+    while (blocks-- > 0) {
+        uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+        uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+        int t;
+
+        for (t = 0; t < 16; t++) {
+            w[t] = aws_sha256_load_be32(data + 4 * t);
+        }
+        for (t = 0; t < 16; t += 8) {
+            AWS_SHA256_ROUND(a, b, c, d, e, f, g, h, t + 0, w[t + 0]);
+            AWS_SHA256_ROUND(h, a, b, c, d, e, f, g, t + 1, w[t + 1]);
+            AWS_SHA256_ROUND(g, h, a, b, c, d, e, f, t + 2, w[t + 2]);
+            AWS_SHA256_ROUND(f, g, h, a, b, c, d, e, t + 3, w[t + 3]);
+            AWS_SHA256_ROUND(e, f, g, h, a, b, c, d, t + 4, w[t + 4]);
+            AWS_SHA256_ROUND(d, e, f, g, h, a, b, c, t + 5, w[t + 5]);
+            AWS_SHA256_ROUND(c, d, e, f, g, h, a, b, t + 6, w[t + 6]);
+            AWS_SHA256_ROUND(b, c, d, e, f, g, h, a, t + 7, w[t + 7]);
+        }
+        for (; t < 64; t += 8) {
+            AWS_SHA256_ROUND(a, b, c, d, e, f, g, h, t + 0, AWS_SHA256_SCHEDULE(w, t + 0));
+            AWS_SHA256_ROUND(h, a, b, c, d, e, f, g, t + 1, AWS_SHA256_SCHEDULE(w, t + 1));
+            AWS_SHA256_ROUND(g, h, a, b, c, d, e, f, t + 2, AWS_SHA256_SCHEDULE(w, t + 2));
+            AWS_SHA256_ROUND(f, g, h, a, b, c, d, e, t + 3, AWS_SHA256_SCHEDULE(w, t + 3));
+            AWS_SHA256_ROUND(e, f, g, h, a, b, c, d, t + 4, AWS_SHA256_SCHEDULE(w, t + 4));
+            AWS_SHA256_ROUND(d, e, f, g, h, a, b, c, t + 5, AWS_SHA256_SCHEDULE(w, t + 5));
+            AWS_SHA256_ROUND(c, d, e, f, g, h, a, b, t + 6, AWS_SHA256_SCHEDULE(w, t + 6));
+            AWS_SHA256_ROUND(b, c, d, e, f, g, h, a, t + 7, AWS_SHA256_SCHEDULE(w, t + 7));
+        }
+
+        state[0] += a;
+        state[1] += b;
+        state[2] += c;
+        state[3] += d;
+        state[4] += e;
+        state[5] += f;
+        state[6] += g;
+        state[7] += h;
+        data += AWS_SHA256_BLOCK_LENGTH;
+    }
+}
+
+// x86-64 block functions
+
+#if defined(AWS_SHA256_X86)
+
+/*
+ * SHA-NI keeps the state as ABEF/CDGH and runs four rounds per pair of
+ * SHA256RNDS2, while SHA256MSG1/MSG2 extend the schedule four words at a
+ * time. m0 holds words 4i..4i+3; the schedule is extended for the first
+ * twelve groups only.
+ */
+#define AWS_SHA256_NI_ROUNDS(s0, s1, i, m0, m1, m2, m3)                                 \
+    do {                                                                              \
+        __m128i msg = _mm_add_epi32(m0, _mm_loadu_si128((const __m128i *)(aws_sha256_k + 4 * (i)))); \
+        s1 = _mm_sha256rnds2_epu32(s1, s0, msg);                                      \
+        if ((i) < 12) {                                                               \
+            m0 = _mm_sha256msg2_epu32(_mm_add_epi32(_mm_sha256msg1_epu32(m0, m1),      \
+                                                    _mm_alignr_epi8(m3, m2, 4)), m3);  \
+        }                                                                             \
+        s0 = _mm_sha256rnds2_epu32(s0, s1, _mm_shuffle_epi32(msg, 0x0E));             \
+    } while (0)
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static inline void aws_sha256_shani_load(const uint32_t state[8], __m128i *abef, __m128i *cdgh) {
+    __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[0]), 0xB1);
+    __m128i efgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&state[4]), 0x1B);
+    *abef = _mm_alignr_epi8(cdab, efgh, 8);
+    *cdgh = _mm_blend_epi16(efgh, cdab, 0xF0);
+}
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static inline void aws_sha256_shani_store(uint32_t state[8], __m128i abef, __m128i cdgh) {
+    __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128((__m128i *)&state[0], _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128((__m128i *)&state[4], _mm_alignr_epi8(dchg, feba, 8));
+}
+
+#define AWS_SHA256_NI_LOAD(p, i) \
+    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)((p) + 16 * (i))), byteswap)
+
+__attribute__((target("sha,sse4.1,ssse3")))
+static void aws_sha256_compress_shani(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    const __m128i byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1;
+
+    aws_sha256_shani_load(state, &state0, &state1);
+
+    while (blocks-- > 0) {
+        __m128i abef = state0, cdgh = state1;
+        __m128i m0 = AWS_SHA256_NI_LOAD(data, 0);
+        __m128i m1 = AWS_SHA256_NI_LOAD(data, 1);
+        __m128i m2 = AWS_SHA256_NI_LOAD(data, 2);
+        __m128i m3 = AWS_SHA256_NI_LOAD(data, 3);
+
+        AWS_SHA256_NI_ROUNDS(state0, state1, 0, m0, m1, m2, m3);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 1, m1, m2, m3, m0);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 2, m2, m3, m0, m1);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 3, m3, m0, m1, m2);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 4, m0, m1, m2, m3);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 5, m1, m2, m3, m0);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 6, m2, m3, m0, m1);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 7, m3, m0, m1, m2);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 8, m0, m1, m2, m3);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 9, m1, m2, m3, m0);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 10, m2, m3, m0, m1);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 11, m3, m0, m1, m2);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 12, m0, m1, m2, m3);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 13, m1, m2, m3, m0);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 14, m2, m3, m0, m1);
+        AWS_SHA256_NI_ROUNDS(state0, state1, 15, m3, m0, m1, m2);
+
+        state0 = _mm_add_epi32(state0, abef);
+        state1 = _mm_add_epi32(state1, cdgh);
+        data += AWS_SHA256_BLOCK_LENGTH;
+    }
+
+    aws_sha256_shani_store(state, state0, state1);
+}
+
+/*
+ * One block each of two independent messages. SHA256RNDS2 has a long
+ * latency, so interleaving the two dependency chains keeps the unit busy
+ * where a single message would wait on its own previous rounds.
+ */
+__attribute__((target("sha,sse4.1,ssse3")))
+static void aws_sha256_compress_shani_x2(uint32_t *const *state, const uint8_t *const *block) {
+    const __m128i byteswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i x0, x1, y0, y1;
+
+    aws_sha256_shani_load(state[0], &x0, &x1);
+    aws_sha256_shani_load(state[1], &y0, &y1);
+
+    __m128i xabef = x0, xcdgh = x1, yabef = y0, ycdgh = y1;
+    __m128i m0 = AWS_SHA256_NI_LOAD(block[0], 0), n0 = AWS_SHA256_NI_LOAD(block[1], 0);
+    __m128i m1 = AWS_SHA256_NI_LOAD(block[0], 1), n1 = AWS_SHA256_NI_LOAD(block[1], 1);
+    __m128i m2 = AWS_SHA256_NI_LOAD(block[0], 2), n2 = AWS_SHA256_NI_LOAD(block[1], 2);
+    __m128i m3 = AWS_SHA256_NI_LOAD(block[0], 3), n3 = AWS_SHA256_NI_LOAD(block[1], 3);
+
+#define AWS_SHA256_NI_ROUNDS_X2(i, m0, m1, m2, m3, n0, n1, n2, n3) \
+    do {                                                          \
+        AWS_SHA256_NI_ROUNDS(x0, x1, i, m0, m1, m2, m3);          \
+        AWS_SHA256_NI_ROUNDS(y0, y1, i, n0, n1, n2, n3);          \
+    } while (0)
+
+    AWS_SHA256_NI_ROUNDS_X2(0, m0, m1, m2, m3, n0, n1, n2, n3);
+    AWS_SHA256_NI_ROUNDS_X2(1, m1, m2, m3, m0, n1, n2, n3, n0);
+    AWS_SHA256_NI_ROUNDS_X2(2, m2, m3, m0, m1, n2, n3, n0, n1);
+    AWS_SHA256_NI_ROUNDS_X2(3, m3, m0, m1, m2, n3, n0, n1, n2);
+    AWS_SHA256_NI_ROUNDS_X2(4, m0, m1, m2, m3, n0, n1, n2, n3);
+    AWS_SHA256_NI_ROUNDS_X2(5, m1, m2, m3, m0, n1, n2, n3, n0);
+    AWS_SHA256_NI_ROUNDS_X2(6, m2, m3, m0, m1, n2, n3, n0, n1);
+    AWS_SHA256_NI_ROUNDS_X2(7, m3, m0, m1, m2, n3, n0, n1, n2);
+    AWS_SHA256_NI_ROUNDS_X2(8, m0, m1, m2, m3, n0, n1, n2, n3);
+    AWS_SHA256_NI_ROUNDS_X2(9, m1, m2, m3, m0, n1, n2, n3, n0);
+    AWS_SHA256_NI_ROUNDS_X2(10, m2, m3, m0, m1, n2, n3, n0, n1);
+    AWS_SHA256_NI_ROUNDS_X2(11, m3, m0, m1, m2, n3, n0, n1, n2);
+    AWS_SHA256_NI_ROUNDS_X2(12, m0, m1, m2, m3, n0, n1, n2, n3);
+    AWS_SHA256_NI_ROUNDS_X2(13, m1, m2, m3, m0, n1, n2, n3, n0);
+    AWS_SHA256_NI_ROUNDS_X2(14, m2, m3, m0, m1, n2, n3, n0, n1);
+    AWS_SHA256_NI_ROUNDS_X2(15, m3, m0, m1, m2, n3, n0, n1, n2);
+
+#undef AWS_SHA256_NI_ROUNDS_X2
+
+    aws_sha256_shani_store(state[0], _mm_add_epi32(x0, xabef), _mm_add_epi32(x1, xcdgh));
+    aws_sha256_shani_store(state[1], _mm_add_epi32(y0, yabef), _mm_add_epi32(y1, ycdgh));
+}
+
+#define AWS_ROTR32X8(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+/*
+ * One block of eight independent messages, one per 32-bit AVX2 lane.
+ * Lane l reads its state from state[l] and its block from block[l].
+ */
+__attribute__((target("avx2")))
+static void aws_sha256_compress_x8(uint32_t *const *state, const uint8_t *const *block) {
+    __m256i w[16], v[8];
+    uint32_t out[8][8];
+
+    for (int i = 0; i < 8; i++) {
+        v[i] = _mm256_set_epi32((int)state[7][i], (int)state[6][i], (int)state[5][i], (int)state[4][i],
+                                (int)state[3][i], (int)state[2][i], (int)state[1][i], (int)state[0][i]);
+    }
+
+    __m256i a = v[0], b = v[1], c = v[2], d = v[3], e = v[4], f = v[5], g = v[6], h = v[7];
+
+    for (int t = 0; t < 64; t++) {
+        __m256i wt;
+        if (t < 16) {
+            wt = _mm256_set_epi32((int)aws_sha256_load_be32(block[7] + 4 * t), (int)aws_sha256_load_be32(block[6] + 4 * t),
+                                  (int)aws_sha256_load_be32(block[5] + 4 * t), (int)aws_sha256_load_be32(block[4] + 4 * t),
+                                  (int)aws_sha256_load_be32(block[3] + 4 * t), (int)aws_sha256_load_be32(block[2] + 4 * t),
+                                  (int)aws_sha256_load_be32(block[1] + 4 * t), (int)aws_sha256_load_be32(block[0] + 4 * t));
+        } else {
+            __m256i w15 = w[(t + 1) & 15];
+            __m256i w2 = w[(t + 14) & 15];
+            __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(AWS_ROTR32X8(w15, 7), AWS_ROTR32X8(w15, 18)),
+                                          _mm256_srli_epi32(w15, 3));
+            __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(AWS_ROTR32X8(w2, 17), AWS_ROTR32X8(w2, 19)),
+                                          _mm256_srli_epi32(w2, 10));
+            wt = _mm256_add_epi32(_mm256_add_epi32(w[t & 15], s0), _mm256_add_epi32(w[(t + 9) & 15], s1));
+        }
+        w[t & 15] = wt;
+
+        __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(AWS_ROTR32X8(e, 6), AWS_ROTR32X8(e, 11)), AWS_ROTR32X8(e, 25));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, s1),
+                                      _mm256_add_epi32(_mm256_add_epi32(ch, wt), _mm256_set1_epi32((int)aws_sha256_k[t])));
+        __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(AWS_ROTR32X8(a, 2), AWS_ROTR32X8(a, 13)), AWS_ROTR32X8(a, 22));
+        __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, t1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(t1, _mm256_add_epi32(s0, maj));
+    }
+
+    _mm256_storeu_si256((__m256i *)out[0], _mm256_add_epi32(v[0], a));
+    _mm256_storeu_si256((__m256i *)out[1], _mm256_add_epi32(v[1], b));
+    _mm256_storeu_si256((__m256i *)out[2], _mm256_add_epi32(v[2], c));
+    _mm256_storeu_si256((__m256i *)out[3], _mm256_add_epi32(v[3], d));
+    _mm256_storeu_si256((__m256i *)out[4], _mm256_add_epi32(v[4], e));
+    _mm256_storeu_si256((__m256i *)out[5], _mm256_add_epi32(v[5], f));
+    _mm256_storeu_si256((__m256i *)out[6], _mm256_add_epi32(v[6], g));
+    _mm256_storeu_si256((__m256i *)out[7], _mm256_add_epi32(v[7], h));
+    for (int l = 0; l < 8; l++) {
+        for (int i = 0; i < 8; i++) {
+            state[l][i] = out[i][l];
+        }
+    }
+}
+
+static int aws_sha256_xgetbv_enables(unsigned int mask) {
+    unsigned int eax, ebx, ecx, edx, xlo, xhi;
+
+    // ECX bit 27 = OSXSAVE, needed to read XCR0
+    __cpuid(1, eax, ebx, ecx, edx);
+    if (((ecx >> 27) & 1) == 0) {
+        return 0;
+    }
+    __asm__ __volatile__ ("xgetbv" : "=a"(xlo), "=d"(xhi) : "c"(0));
+    return (xlo & mask) == mask;
+}
+
+#elif defined(AWS_SHA256_ARMV8)
+
+// ARMv8 block function
+
+/*
+ * The ARMv8 SHA-2 instructions keep the state as ABCD/EFGH and run four
+ * rounds per SHA256H/SHA256H2 pair; SHA256SU0/SU1 extend the schedule.
+ * They are part of every 64-bit Apple CPU, so no runtime check is needed.
+ */
+#define AWS_SHA256_ARMV8_ROUNDS(i, m0, m1, m2, m3)                 \
+    do {                                                         \
+        uint32x4_t msg = vaddq_u32(m0, vld1q_u32(aws_sha256_k + 4 * (i))); \
+        uint32x4_t abcd = state0;                                \
+        if ((i) < 12) {                                          \
+            m0 = vsha256su1q_u32(vsha256su0q_u32(m0, m1), m2, m3); \
+        }                                                        \
+        state0 = vsha256hq_u32(state0, state1, msg);             \
+        state1 = vsha256h2q_u32(state1, abcd, msg);              \
+    } while (0)
+
+static void aws_sha256_compress_armv8(uint32_t state[8], const uint8_t *data, size_t blocks) {
+    uint32x4_t state0 = vld1q_u32(&state[0]);
+    uint32x4_t state1 = vld1q_u32(&state[4]);
+
+    while (blocks-- > 0) {
+        uint32x4_t abcd = state0, efgh = state1;
+        uint32x4_t m0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 0)));
+        uint32x4_t m1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+        uint32x4_t m2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+        uint32x4_t m3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+        AWS_SHA256_ARMV8_ROUNDS(0, m0, m1, m2, m3);
+        AWS_SHA256_ARMV8_ROUNDS(1, m1, m2, m3, m0);
+        AWS_SHA256_ARMV8_ROUNDS(2, m2, m3, m0, m1);
+        AWS_SHA256_ARMV8_ROUNDS(3, m3, m0, m1, m2);
+        AWS_SHA256_ARMV8_ROUNDS(4, m0, m1, m2, m3);
+        AWS_SHA256_ARMV8_ROUNDS(5, m1, m2, m3, m0);
+        AWS_SHA256_ARMV8_ROUNDS(6, m2, m3, m0, m1);
+        AWS_SHA256_ARMV8_ROUNDS(7, m3, m0, m1, m2);
+        AWS_SHA256_ARMV8_ROUNDS(8, m0, m1, m2, m3);
+        AWS_SHA256_ARMV8_ROUNDS(9, m1, m2, m3, m0);
+        AWS_SHA256_ARMV8_ROUNDS(10, m2, m3, m0, m1);
+        AWS_SHA256_ARMV8_ROUNDS(11, m3, m0, m1, m2);
+        AWS_SHA256_ARMV8_ROUNDS(12, m0, m1, m2, m3);
+        AWS_SHA256_ARMV8_ROUNDS(13, m1, m2, m3, m0);
+        AWS_SHA256_ARMV8_ROUNDS(14, m2, m3, m0, m1);
+        AWS_SHA256_ARMV8_ROUNDS(15, m3, m0, m1, m2);
+
+        state0 = vaddq_u32(state0, abcd);
+        state1 = vaddq_u32(state1, efgh);
+        data += AWS_SHA256_BLOCK_LENGTH;
+    }
+
+    vst1q_u32(&state[0], state0);
+    vst1q_u32(&state[4], state1);
+}
+
+#endif
+
+// Dispatch
+
+// chosen once per process, read without locking afterwards
+static aws_sha256_compress_fn aws_sha256_compress_selected;
+static aws_sha256_compress_multi_fn aws_sha256_compress_multi_selected;
+static size_t aws_sha256_lanes_selected;
+static pthread_once_t aws_sha256_select_once = PTHREAD_ONCE_INIT;
+
+static void aws_sha256_select(void) {
+    aws_sha256_compress_fn compress = aws_sha256_compress_c;
+    aws_sha256_compress_multi_fn multi = NULL;
+    size_t lanes = 1;
+
+#if defined(AWS_SHA256_X86)
+    unsigned int eax, ebx, ecx, edx;
+
+    if (__get_cpuid_max(0, NULL) >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        // EBX bit 29 = SHA, bit 5 = AVX2
+        int sha = (ebx >> 29) & 1;
+        int avx2 = ((ebx >> 5) & 1) && aws_sha256_xgetbv_enables(0x6);
+        __cpuid(1, eax, ebx, ecx, edx);
+        // ECX bit 19 = SSE4.1, bit 9 = SSSE3
+        // SHA-NI outruns eight AVX2 lanes, so with both the multi-buffer
+        // mode interleaves two SHA-NI messages instead
+#if defined(AWS_SHA256_NO_SHANI)
+        // for testing the AVX2 lanes on CPUs that have both
+        sha = 0;
+#endif
+        if (sha && ((ecx >> 19) & 1) && ((ecx >> 9) & 1)) {
+            compress = aws_sha256_compress_shani;
+            multi = aws_sha256_compress_shani_x2;
+            lanes = 2;
+        } else if (avx2) {
+            multi = aws_sha256_compress_x8;
+            lanes = 8;
+        }
+    }
+#elif defined(AWS_SHA256_ARMV8)
+    compress = aws_sha256_compress_armv8;
+#endif
+
+    aws_sha256_lanes_selected = lanes;
+    aws_sha256_compress_multi_selected = multi;
+    aws_sha256_compress_selected = compress;
+}
+
+static inline aws_sha256_compress_fn aws_sha256_compress(void) {
+    pthread_once(&aws_sha256_select_once, aws_sha256_select);
+    return aws_sha256_compress_selected;
+}
+
+size_t aws_sha256_multi_lanes(void) {
+    pthread_once(&aws_sha256_select_once, aws_sha256_select);
+    return aws_sha256_lanes_selected;
+}
+
+// SHA-256
+
+void aws_sha256_init(aws_sha256_ctx *ctx) {
+    memcpy(ctx->state, aws_sha256_iv, sizeof(ctx->state));
+    ctx->length = 0;
+    ctx->buffered = 0;
+}
+
+void aws_sha256_update(aws_sha256_ctx *ctx, const void *data, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)data;
+    aws_sha256_compress_fn compress = aws_sha256_compress();
+
+    ctx->length += length;
+
+    if (ctx->buffered > 0) {
+        size_t take = AWS_SHA256_BLOCK_LENGTH - ctx->buffered;
+        if (take > length) {
+            take = length;
+        }
+        memcpy(ctx->buffer + ctx->buffered, bytes, take);
+        ctx->buffered += take;
+        bytes += take;
+        length -= take;
+        if (ctx->buffered < AWS_SHA256_BLOCK_LENGTH) {
+            return;
+        }
+        compress(ctx->state, ctx->buffer, 1);
+        ctx->buffered = 0;
+    }
+
+    if (length >= AWS_SHA256_BLOCK_LENGTH) {
+        size_t blocks = length / AWS_SHA256_BLOCK_LENGTH;
+        compress(ctx->state, bytes, blocks);
+        bytes += blocks * AWS_SHA256_BLOCK_LENGTH;
+        length -= blocks * AWS_SHA256_BLOCK_LENGTH;
+    }
+
+    if (length > 0) {
+        memcpy(ctx->buffer, bytes, length);
+        ctx->buffered = length;
+    }
+}
+
+// Writes the 0x80 terminator, zero fill and bit length after the
+// "buffered" bytes already in "tail"; returns the number of blocks.
+static size_t aws_sha256_pad(uint8_t tail[2 * AWS_SHA256_BLOCK_LENGTH], size_t buffered, uint64_t length) {
+    size_t blocks = (buffered + 9 <= AWS_SHA256_BLOCK_LENGTH) ? 1 : 2;
+    size_t end = blocks * AWS_SHA256_BLOCK_LENGTH;
+    uint64_t bits = length * 8;
+
+    tail[buffered] = 0x80;
+    memset(tail + buffered + 1, 0, end - 8 - buffered - 1);
+    aws_sha256_store_be32(tail + end - 8, (uint32_t)(bits >> 32));
+    aws_sha256_store_be32(tail + end - 4, (uint32_t)bits);
+    return blocks;
+}
+
+static void aws_sha256_output(const uint32_t state[8], uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    for (int i = 0; i < 8; i++) {
+        aws_sha256_store_be32(digest + 4 * i, state[i]);
+    }
+}
+
+void aws_sha256_final(aws_sha256_ctx *ctx, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    uint8_t tail[2 * AWS_SHA256_BLOCK_LENGTH];
+
+    memcpy(tail, ctx->buffer, ctx->buffered);
+    size_t blocks = aws_sha256_pad(tail, ctx->buffered, ctx->length);
+    aws_sha256_compress()(ctx->state, tail, blocks);
+    aws_sha256_output(ctx->state, digest);
+
+    memset(ctx, 0, sizeof(*ctx));
+}
+
+void aws_sha256(const void *data, size_t length, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    aws_sha256_ctx ctx;
+
+    aws_sha256_init(&ctx);
+    aws_sha256_update(&ctx, data, length);
+    aws_sha256_final(&ctx, digest);
+}
+
+// HMAC-SHA256
+
+void aws_hmac_sha256_init(aws_hmac_sha256_ctx *ctx, const void *key, size_t keyLength) {
+    uint8_t pad[AWS_SHA256_BLOCK_LENGTH];
+
+    // keys longer than a block are replaced by their digest
+    memset(pad, 0, sizeof(pad));
+    if (keyLength > AWS_SHA256_BLOCK_LENGTH) {
+        aws_sha256(key, keyLength, pad);
+    } else if (keyLength > 0) {
+        memcpy(pad, key, keyLength);
+    }
+
+    for (size_t i = 0; i < sizeof(pad); i++) {
+        pad[i] ^= 0x36;
+    }
+    aws_sha256_init(&ctx->inner);
+    aws_sha256_update(&ctx->inner, pad, sizeof(pad));
+
+    for (size_t i = 0; i < sizeof(pad); i++) {
+        pad[i] ^= 0x36 ^ 0x5c;
+    }
+    aws_sha256_init(&ctx->outer);
+    aws_sha256_update(&ctx->outer, pad, sizeof(pad));
+
+    memset(pad, 0, sizeof(pad));
+}
+
+void aws_hmac_sha256_update(aws_hmac_sha256_ctx *ctx, const void *data, size_t length) {
+    aws_sha256_update(&ctx->inner, data, length);
+}
+
+void aws_hmac_sha256_final(aws_hmac_sha256_ctx *ctx, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    uint8_t innerDigest[AWS_SHA256_DIGEST_LENGTH];
+
+    aws_sha256_final(&ctx->inner, innerDigest);
+    aws_sha256_update(&ctx->outer, innerDigest, sizeof(innerDigest));
+    aws_sha256_final(&ctx->outer, digest);
+
+    memset(innerDigest, 0, sizeof(innerDigest));
+}
+
+void aws_hmac_sha256(const void *key, size_t keyLength,
+                     const void *data, size_t length,
+                     uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    aws_hmac_sha256_ctx ctx;
+
+    aws_hmac_sha256_init(&ctx, key, keyLength);
+    aws_hmac_sha256_update(&ctx, data, length);
+    aws_hmac_sha256_final(&ctx, digest);
+}
+
+// Multi-buffer
+
+/*
+ * Hashes every message on top of "start", a context that has already
+ * absorbed whole blocks only (the IV, or an HMAC pad block).
+ */
+static void aws_sha256_multi_from(const aws_sha256_ctx *start,
+                                  const void *const *data, const size_t *lengths, size_t count,
+                                  uint8_t (*digests)[AWS_SHA256_DIGEST_LENGTH]) {
+    size_t lanes = aws_sha256_multi_lanes();
+
+    if (count < 2 || lanes < 2) {
+        for (size_t i = 0; i < count; i++) {
+            aws_sha256_ctx ctx = *start;
+            aws_sha256_update(&ctx, data[i], lengths[i]);
+            aws_sha256_final(&ctx, digests[i]);
+        }
+        return;
+    }
+
+    // A lane works through the whole blocks of its message in place, then
+    // through one or two padded blocks copied into "tail". When a message
+    // is done the lane picks up the next one; lanes left with nothing to
+    // do hash a dummy block into a dummy state.
+    struct {
+        uint32_t state[8];
+        const uint8_t *data;
+        size_t blocks;
+        uint8_t tail[2 * AWS_SHA256_BLOCK_LENGTH];
+        size_t tailBlocks;
+        size_t tailNext;
+        size_t message;
+        int busy;
+    } lane[AWS_SHA256_MAX_LANES];
+    uint32_t idleState[8];
+    uint8_t idleBlock[AWS_SHA256_BLOCK_LENGTH];
+    uint32_t *states[AWS_SHA256_MAX_LANES];
+    const uint8_t *blocks[AWS_SHA256_MAX_LANES];
+    aws_sha256_compress_multi_fn compress = aws_sha256_compress_multi_selected;
+    size_t next = 0;
+
+    memset(idleBlock, 0, sizeof(idleBlock));
+    for (size_t l = 0; l < lanes; l++) {
+        lane[l].busy = 0;
+    }
+
+    for (;;) {
+        int busy = 0;
+
+        for (size_t l = 0; l < lanes; l++) {
+            if (lane[l].busy && lane[l].blocks == 0 && lane[l].tailNext == lane[l].tailBlocks) {
+                aws_sha256_output(lane[l].state, digests[lane[l].message]);
+                lane[l].busy = 0;
+            }
+            if (!lane[l].busy && next < count) {
+                size_t length = lengths[next];
+                size_t whole = length / AWS_SHA256_BLOCK_LENGTH;
+                size_t rest = length - whole * AWS_SHA256_BLOCK_LENGTH;
+
+                memcpy(lane[l].state, start->state, sizeof(lane[l].state));
+                lane[l].data = (const uint8_t *)data[next];
+                lane[l].blocks = whole;
+                memcpy(lane[l].tail, lane[l].data + whole * AWS_SHA256_BLOCK_LENGTH, rest);
+                lane[l].tailBlocks = aws_sha256_pad(lane[l].tail, rest, start->length + length);
+                lane[l].tailNext = 0;
+                lane[l].message = next++;
+                lane[l].busy = 1;
+            }
+
+            if (!lane[l].busy) {
+                memcpy(idleState, aws_sha256_iv, sizeof(idleState));
+                states[l] = idleState;
+                blocks[l] = idleBlock;
+                continue;
+            }
+            busy = 1;
+            states[l] = lane[l].state;
+            if (lane[l].blocks > 0) {
+                blocks[l] = lane[l].data;
+                lane[l].data += AWS_SHA256_BLOCK_LENGTH;
+                lane[l].blocks--;
+            } else {
+                blocks[l] = lane[l].tail + AWS_SHA256_BLOCK_LENGTH * lane[l].tailNext++;
+            }
+        }
+
+        if (!busy) {
+            break;
+        }
+        compress(states, blocks);
+    }
+}
+
+void aws_sha256_multi(const void *const *data, const size_t *lengths, size_t count,
+                      uint8_t (*digests)[AWS_SHA256_DIGEST_LENGTH]) {
+    aws_sha256_ctx start;
+
+    aws_sha256_init(&start);
+    aws_sha256_multi_from(&start, data, lengths, count, digests);
+}
+
+void aws_hmac_sha256_multi(const void *key, size_t keyLength,
+                           const void *const *data, const size_t *lengths, size_t count,
+                           uint8_t (*digests)[AWS_SHA256_DIGEST_LENGTH]) {
+    aws_hmac_sha256_ctx keyed;
+    const void *innerData[AWS_SHA256_MULTI_BATCH];
+    size_t innerLengths[AWS_SHA256_MULTI_BATCH];
+
+    aws_hmac_sha256_init(&keyed, key, keyLength);
+
+    // inner digests are written over digests[i], then hashed again in place
+    aws_sha256_multi_from(&keyed.inner, data, lengths, count, digests);
+    for (size_t i = 0; i < count; i += AWS_SHA256_MULTI_BATCH) {
+        size_t n = (count - i < AWS_SHA256_MULTI_BATCH) ? count - i : AWS_SHA256_MULTI_BATCH;
+        for (size_t j = 0; j < n; j++) {
+            innerData[j] = digests[i + j];
+            innerLengths[j] = AWS_SHA256_DIGEST_LENGTH;
+        }
+        aws_sha256_multi_from(&keyed.outer, innerData, innerLengths, n, digests + i);
+    }
+
+    memset(&keyed, 0, sizeof(keyed));
+}
@@ -0,0 +1,92 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_SHA256_H_
+#define AWS_SHA256_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Portable SHA-256 and HMAC-SHA256.
+ *
+ * Plain C with no platform crypto library underneath. The block function is
+ * picked once per process: SHA-NI on x86-64, the ARMv8 SHA-2 instructions
+ * when the compiler targets them, and a C loop everywhere else. Define
+ * AWS_SHA256_NO_ASM to build the C loop only, or AWS_SHA256_NO_SHANI to
+ * leave SHA-NI out so the AVX2 multi-buffer lanes are used on x86-64.
+ *
+ * Contexts are plain structs. A keyed HMAC context may be copied by value
+ * to sign several messages with one key without hashing the key again.
+ */
+
+#define AWS_SHA256_DIGEST_LENGTH 32
+#define AWS_SHA256_BLOCK_LENGTH  64
+
+typedef struct {
+    uint32_t state[8];
+    uint64_t length;                            /* bytes hashed so far */
+    uint8_t  buffer[AWS_SHA256_BLOCK_LENGTH];
+    size_t   buffered;
+} aws_sha256_ctx;
+
+typedef struct {
+    aws_sha256_ctx inner;
+    aws_sha256_ctx outer;
+} aws_hmac_sha256_ctx;
+
+void aws_sha256_init(aws_sha256_ctx *ctx);
+void aws_sha256_update(aws_sha256_ctx *ctx, const void *data, size_t length);
+void aws_sha256_final(aws_sha256_ctx *ctx, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]);
+
+/* digest = SHA-256(data) */
+void aws_sha256(const void *data, size_t length, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]);
+
+void aws_hmac_sha256_init(aws_hmac_sha256_ctx *ctx, const void *key, size_t keyLength);
+void aws_hmac_sha256_update(aws_hmac_sha256_ctx *ctx, const void *data, size_t length);
+void aws_hmac_sha256_final(aws_hmac_sha256_ctx *ctx, uint8_t digest[AWS_SHA256_DIGEST_LENGTH]);
+
+/* digest = HMAC-SHA256(key, data) */
+void aws_hmac_sha256(const void *key, size_t keyLength,
+                     const void *data, size_t length,
+                     uint8_t digest[AWS_SHA256_DIGEST_LENGTH]);
+
+/*
+ * Multi-buffer mode: digests[i] = SHA-256(data[i]) for i < count.
+ *
+ * Where the CPU can overlap them the messages are hashed side by side: two
+ * at a time with SHA-NI, eight in AVX2 lanes without it. Otherwise they are
+ * hashed one after another. digests must not overlap data.
+ */
+void aws_sha256_multi(const void *const *data, const size_t *lengths, size_t count,
+                      uint8_t (*digests)[AWS_SHA256_DIGEST_LENGTH]);
+
+/* digests[i] = HMAC-SHA256(key, data[i]) for i < count, with the key hashed once */
+void aws_hmac_sha256_multi(const void *key, size_t keyLength,
+                           const void *const *data, const size_t *lengths, size_t count,
+                           uint8_t (*digests)[AWS_SHA256_DIGEST_LENGTH]);
+
+/* number of messages aws_sha256_multi hashes side by side on this CPU */
+size_t aws_sha256_multi_lanes(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,921 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#include "aws_sigv4.h"
+#include "aws_uri.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// query parameters and headers sorted without touching the heap
+#define AWS_SIGV4_INLINE_ITEMS 32
+
+// scratch space for the encoded query before it is sorted
+#define AWS_SIGV4_QUERY_STORAGE 1024
+
+// requests or chunks hashed side by side per aws_sha256_multi call
+#define AWS_SIGV4_MULTI_BATCH 16
+
+// strings-to-sign for one batch, about 140 bytes each with a typical scope
+#define AWS_SIGV4_STRING_TO_SIGN_STORAGE 2560
+
+static const char aws_sigv4_algorithm[] = "AWS4-HMAC-SHA256";
+static const char aws_sigv4_chunk_algorithm[] = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char aws_sigv4_key_prefix[] = "AWS4";
+static const char aws_sigv4_terminator[] = "aws4_request";
+
+// SHA-256 of the empty string, hex
+static const char aws_sigv4_empty_sha256[] = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+static const char aws_sigv4_hex_lower[16] = "0123456789abcdef";
+static const char aws_sigv4_hex_upper[16] = "0123456789ABCDEF";
+
+// A-Z a-z 0-9 - . _ ~, one bit per byte value
+static const uint64_t aws_sigv4_unreserved[4] = {
+    0x03ff600000000000ULL, 0x47fffffe87fffffeULL, 0, 0
+};
+
+static inline int aws_sigv4_is_unreserved(uint8_t c) {
+    return (int)((aws_sigv4_unreserved[c >> 6] >> (c & 63)) & 1);
+}
+
+static inline int aws_sigv4_hex_value(uint8_t c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+static inline uint8_t aws_sigv4_lower(uint8_t c) {
+    return (c >= 'A' && c <= 'Z') ? (uint8_t)(c | 0x20) : c;
+}
+
+static inline int aws_sigv4_is_space(uint8_t c) {
+    return c == ' ' || c == '\t';
+}
+
+// Buffer
+
+void aws_sigv4_buf_init(aws_sigv4_buf *buf, void *storage, size_t capacity) {
+    buf->data = storage;
+    buf->length = 0;
+    buf->capacity = storage ? capacity : 0;
+    buf->storage = storage;
+    buf->storageCapacity = buf->capacity;
+}
+
+void aws_sigv4_buf_reset(aws_sigv4_buf *buf) {
+    buf->length = 0;
+}
+
+void aws_sigv4_buf_free(aws_sigv4_buf *buf) {
+    if (buf->data != buf->storage) {
+        free(buf->data);
+    }
+    buf->data = buf->storage;
+    buf->length = 0;
+    buf->capacity = buf->storageCapacity;
+}
+
+// Makes room for extra more bytes.
+static int aws_sigv4_buf_reserve(aws_sigv4_buf *buf, size_t extra) {
+    if (buf->capacity - buf->length >= extra) {
+        return 0;
+    }
+
+    size_t capacity = buf->capacity ? buf->capacity : 256;
+    while (capacity - buf->length < extra) {
+        if (capacity > ((size_t)-1) / 2) {
+            return -1;
+        }
+        capacity *= 2;
+    }
+
+    uint8_t *data;
+    if (buf->data == buf->storage) {
+        data = malloc(capacity);
+        if (data && buf->length) {
+            memcpy(data, buf->data, buf->length);
+        }
+    } else {
+        data = realloc(buf->data, capacity);
+    }
+    if (!data) {
+        return -1;
+    }
+
+    buf->data = data;
+    buf->capacity = capacity;
+    return 0;
+}
+
+int aws_sigv4_buf_append(aws_sigv4_buf *buf, const void *bytes, size_t length) {
+    if (aws_sigv4_buf_reserve(buf, length)) {
+        return -1;
+    }
+    if (length) {
+        memcpy(buf->data + buf->length, bytes, length);
+        buf->length += length;
+    }
+    return 0;
+}
+
+static inline int aws_sigv4_buf_append_byte(aws_sigv4_buf *buf, uint8_t c) {
+    if (aws_sigv4_buf_reserve(buf, 1)) {
+        return -1;
+    }
+    buf->data[buf->length++] = c;
+    return 0;
+}
+
+// Encoding
+
+void aws_sigv4_hex_encode(const uint8_t *bytes, size_t length, char *out) {
+    for (size_t i = 0; i < length; i++) {
+        out[2 * i] = aws_sigv4_hex_lower[bytes[i] >> 4];
+        out[2 * i + 1] = aws_sigv4_hex_lower[bytes[i] & 15];
+    }
+}
+
+static inline uint8_t *aws_sigv4_put_escape(uint8_t *out, uint8_t c) {
+    out[0] = '%';
+    out[1] = (uint8_t)aws_sigv4_hex_upper[c >> 4];
+    out[2] = (uint8_t)aws_sigv4_hex_upper[c & 15];
+    return out + 3;
+}
+
+int aws_sigv4_append_uri_encoded(aws_sigv4_buf *buf, const char *bytes, size_t length, int encodeSlash) {
+    if (aws_sigv4_buf_reserve(buf, 3 * length)) {
+        return -1;
+    }
+
+    buf->length += aws_uri_encode((char *)buf->data + buf->length, bytes, length,
+                                  encodeSlash ? AWS_URI_ENCODE_QUERY : AWS_URI_ENCODE_PATH);
+    return 0;
+}
+
+// Re-encodes one already encoded query key or value in canonical form.
+static int aws_sigv4_append_query_component(aws_sigv4_buf *buf, const uint8_t *bytes, size_t length) {
+    if (aws_sigv4_buf_reserve(buf, 3 * length)) {
+        return -1;
+    }
+
+    uint8_t *out = buf->data + buf->length;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t c = bytes[i];
+        if (c == '%' && i + 2 < length) {
+            int hi = aws_sigv4_hex_value(bytes[i + 1]);
+            int lo = aws_sigv4_hex_value(bytes[i + 2]);
+            if (hi >= 0 && lo >= 0) {
+                uint8_t decoded = (uint8_t)((hi << 4) | lo);
+                if (aws_sigv4_is_unreserved(decoded)) {
+                    *out++ = decoded;
+                } else {
+                    out = aws_sigv4_put_escape(out, decoded);
+                }
+                i += 2;
+                continue;
+            }
+        }
+        if (aws_sigv4_is_unreserved(c)) {
+            *out++ = c;
+        } else {
+            out = aws_sigv4_put_escape(out, c);
+        }
+    }
+    buf->length = (size_t)(out - buf->data);
+    return 0;
+}
+
+// Canonical query
+
+// A parameter as offsets into the scratch buffer, which may move while it grows.
+typedef struct {
+    size_t key;
+    size_t keyLength;
+    size_t value;
+    size_t valueLength;
+} aws_sigv4_param;
+
+static int aws_sigv4_compare_bytes(const uint8_t *a, size_t aLength, const uint8_t *b, size_t bLength) {
+    int order = memcmp(a, b, aLength < bLength ? aLength : bLength);
+    if (order) {
+        return order;
+    }
+    return (aLength > bLength) - (aLength < bLength);
+}
+
+static int aws_sigv4_compare_params(const uint8_t *base, const aws_sigv4_param *a, const aws_sigv4_param *b) {
+    int order = aws_sigv4_compare_bytes(base + a->key, a->keyLength, base + b->key, b->keyLength);
+    if (order) {
+        return order;
+    }
+    return aws_sigv4_compare_bytes(base + a->value, a->valueLength, base + b->value, b->valueLength);
+}
+
+int aws_sigv4_append_canonical_query(aws_sigv4_buf *buf, const char *query, size_t length) {
+    uint8_t scratchStorage[AWS_SIGV4_QUERY_STORAGE];
+    aws_sigv4_param paramStorage[AWS_SIGV4_INLINE_ITEMS];
+    aws_sigv4_param *params = paramStorage;
+    size_t paramCapacity = AWS_SIGV4_INLINE_ITEMS;
+    size_t count = 0;
+    int result = -1;
+
+    aws_sigv4_buf scratch;
+    aws_sigv4_buf_init(&scratch, scratchStorage, sizeof(scratchStorage));
+
+    const uint8_t *p = (const uint8_t *)query;
+    const uint8_t *end = p + length;
+    while (p < end) {
+        const uint8_t *next = memchr(p, '&', (size_t)(end - p));
+        if (!next) {
+            next = end;
+        }
+        if (next > p) {
+            const uint8_t *equals = memchr(p, '=', (size_t)(next - p));
+            const uint8_t *keyEnd = equals ? equals : next;
+            const uint8_t *value = equals ? equals + 1 : next;
+
+            if (count == paramCapacity) {
+                aws_sigv4_param *grown = malloc(2 * paramCapacity * sizeof(*grown));
+                if (!grown) {
+                    goto LBL_ERR;
+                }
+                memcpy(grown, params, count * sizeof(*grown));
+                if (params != paramStorage) {
+                    free(params);
+                }
+                params = grown;
+                paramCapacity *= 2;
+            }
+
+            aws_sigv4_param *param = &params[count++];
+            param->key = scratch.length;
+            if (aws_sigv4_append_query_component(&scratch, p, (size_t)(keyEnd - p))) {
+                goto LBL_ERR;
+            }
+            param->keyLength = scratch.length - param->key;
+            param->value = scratch.length;
+            if (aws_sigv4_append_query_component(&scratch, value, (size_t)(next - value))) {
+                goto LBL_ERR;
+            }
+            param->valueLength = scratch.length - param->value;
+        }
+        p = next + 1;
+    }
+
+    // Queries carry a handful of parameters; insertion sort keeps this allocation free.
+    for (size_t i = 1; i < count; i++) {
+        aws_sigv4_param param = params[i];
+        size_t j = i;
+        while (j > 0 && aws_sigv4_compare_params(scratch.data, &params[j - 1], &param) > 0) {
+            params[j] = params[j - 1];
+            j--;
+        }
+        params[j] = param;
+    }
+
+    // keys, values, '=' and '&' together are never longer than the scratch text plus 2 per parameter
+    if (aws_sigv4_buf_reserve(buf, scratch.length + 2 * count)) {
+        goto LBL_ERR;
+    }
+    for (size_t i = 0; i < count; i++) {
+        if (i) {
+            buf->data[buf->length++] = '&';
+        }
+        memcpy(buf->data + buf->length, scratch.data + params[i].key, params[i].keyLength);
+        buf->length += params[i].keyLength;
+        buf->data[buf->length++] = '=';
+        memcpy(buf->data + buf->length, scratch.data + params[i].value, params[i].valueLength);
+        buf->length += params[i].valueLength;
+    }
+    result = 0;
+
+LBL_ERR:
+    if (params != paramStorage) {
+        free(params);
+    }
+    aws_sigv4_buf_free(&scratch);
+    return result;
+}
+
+// Canonical headers
+
+static int aws_sigv4_compare_header_names(const aws_sigv4_header *a, const aws_sigv4_header *b) {
+    size_t length = a->nameLength < b->nameLength ? a->nameLength : b->nameLength;
+    for (size_t i = 0; i < length; i++) {
+        uint8_t ca = aws_sigv4_lower((uint8_t)a->name[i]);
+        uint8_t cb = aws_sigv4_lower((uint8_t)b->name[i]);
+        if (ca != cb) {
+            return ca < cb ? -1 : 1;
+        }
+    }
+    return (a->nameLength > b->nameLength) - (a->nameLength < b->nameLength);
+}
+
+// Appends "name:value\n" with the name lowercased and the value trimmed and collapsed.
+static int aws_sigv4_append_header(aws_sigv4_buf *buf, const aws_sigv4_header *header) {
+    if (aws_sigv4_buf_reserve(buf, header->nameLength + header->valueLength + 2)) {
+        return -1;
+    }
+
+    // Locals, since stores through out may alias *header as far as the compiler knows.
+    const uint8_t *name = (const uint8_t *)header->name;
+    size_t nameLength = header->nameLength;
+    const uint8_t *value = (const uint8_t *)header->value;
+    const uint8_t *end = value + header->valueLength;
+
+    uint8_t *out = buf->data + buf->length;
+    for (size_t i = 0; i < nameLength; i++) {
+        out[i] = aws_sigv4_lower(name[i]);
+    }
+    out += nameLength;
+    *out++ = ':';
+
+    // Copy each run of non-blank bytes, joined by single spaces.
+    uint8_t *valueStart = out;
+    while (value < end) {
+        while (value < end && aws_sigv4_is_space(*value)) {
+            value++;
+        }
+        const uint8_t *run = value;
+        while (value < end && !aws_sigv4_is_space(*value)) {
+            value++;
+        }
+        if (run == value) {
+            break;
+        }
+        if (out != valueStart) {
+            *out++ = ' ';
+        }
+        memcpy(out, run, (size_t)(value - run));
+        out += value - run;
+    }
+    *out++ = '\n';
+
+    buf->length = (size_t)(out - buf->data);
+    return 0;
+}
+
+// A header in canonical order; template entries are lowercased and trimmed already.
+typedef struct {
+    const aws_sigv4_header *header;
+    int                     canonical;
+} aws_sigv4_sorted_header;
+
+// Index after the last entry not greater than header. Binary search: names share long
+// prefixes (x-amz-meta-...), so comparisons cost more than moves.
+static size_t aws_sigv4_insertion_index(const aws_sigv4_sorted_header *sorted, size_t count,
+                                        const aws_sigv4_header *header) {
+    size_t low = 0;
+    size_t high = count;
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        if (aws_sigv4_compare_header_names(sorted[mid].header, header) > 0) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+static void aws_sigv4_insert_sorted(aws_sigv4_sorted_header *sorted, size_t count,
+                                    const aws_sigv4_header *header) {
+    size_t index = aws_sigv4_insertion_index(sorted, count, header);
+    memmove(&sorted[index + 1], &sorted[index], (count - index) * sizeof(*sorted));
+    sorted[index].header = header;
+    sorted[index].canonical = 0;
+}
+
+// Marks the first unused template entry with the same name and value bytes as header,
+// recording the header's position in the request plus one.
+static int aws_sigv4_header_template_claim(const aws_sigv4_header_template *tmpl,
+                                           const aws_sigv4_header *header, size_t position, size_t *used) {
+    for (size_t i = 0; i < tmpl->count; i++) {
+        const aws_sigv4_header *entry = &tmpl->raw[i];
+        if (!used[i]
+            && entry->nameLength == header->nameLength
+            && entry->valueLength == header->valueLength
+            && memcmp(entry->name, header->name, header->nameLength) == 0
+            && memcmp(entry->value, header->value, header->valueLength) == 0) {
+            used[i] = position + 1;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int aws_sigv4_header_template_init(aws_sigv4_header_template *tmpl,
+                                   const aws_sigv4_header *headers, size_t headerCount) {
+    aws_sigv4_sorted_header sorted[AWS_SIGV4_HEADER_TEMPLATE_MAX];
+    size_t count = headerCount < AWS_SIGV4_HEADER_TEMPLATE_MAX ? headerCount : AWS_SIGV4_HEADER_TEMPLATE_MAX;
+    size_t rawLength = 0;
+
+    memset(tmpl, 0, sizeof(*tmpl));
+    for (size_t i = 0; i < count; i++) {
+        aws_sigv4_insert_sorted(sorted, i, &headers[i]);
+    }
+
+    // A name given more than once is left to per-request sorting, which keeps such
+    // headers in request order; the template could only keep them in its own.
+    size_t kept = 0;
+    for (size_t i = 0; i < count; i++) {
+        if ((i > 0 && aws_sigv4_compare_header_names(sorted[i - 1].header, sorted[i].header) == 0)
+            || (i + 1 < count && aws_sigv4_compare_header_names(sorted[i].header, sorted[i + 1].header) == 0)) {
+            continue;
+        }
+        rawLength += sorted[i].header->nameLength + sorted[i].header->valueLength;
+        sorted[kept++] = sorted[i];
+    }
+    count = kept;
+    if (count == 0) {
+        return 0;
+    }
+
+    // [raw headers][canonical headers][raw bytes]["name:value\n" lines]
+    size_t lineCapacity = rawLength + 2 * count;
+    uint8_t *storage = malloc(2 * count * sizeof(aws_sigv4_header) + rawLength + lineCapacity);
+    if (!storage) {
+        return -1;
+    }
+    tmpl->raw = (aws_sigv4_header *)storage;
+    tmpl->canonical = tmpl->raw + count;
+    tmpl->count = count;
+    tmpl->storage = storage;
+
+    char *rawBytes = (char *)(tmpl->canonical + count);
+    aws_sigv4_buf lines;
+    aws_sigv4_buf_init(&lines, rawBytes + rawLength, lineCapacity);
+    for (size_t i = 0; i < count; i++) {
+        const aws_sigv4_header *header = sorted[i].header;
+        aws_sigv4_header *raw = &tmpl->raw[i];
+        aws_sigv4_header *canonical = &tmpl->canonical[i];
+
+        memcpy(rawBytes, header->name, header->nameLength);
+        memcpy(rawBytes + header->nameLength, header->value, header->valueLength);
+        raw->name = rawBytes;
+        raw->nameLength = header->nameLength;
+        raw->value = rawBytes + header->nameLength;
+        raw->valueLength = header->valueLength;
+        rawBytes += header->nameLength + header->valueLength;
+
+        // Fits by construction: every line is at most name + value + 2 bytes.
+        size_t lineStart = lines.length;
+        aws_sigv4_append_header(&lines, header);
+        canonical->name = (const char *)lines.data + lineStart;
+        canonical->nameLength = header->nameLength;
+        canonical->value = canonical->name + header->nameLength + 1;
+        canonical->valueLength = lines.length - lineStart - header->nameLength - 2;
+    }
+    return 0;
+}
+
+void aws_sigv4_header_template_free(aws_sigv4_header_template *tmpl) {
+    free(tmpl->storage);
+    memset(tmpl, 0, sizeof(*tmpl));
+}
+
+static int aws_sigv4_append_canonical_request(aws_sigv4_buf *buf,
+                                              const aws_sigv4_header_template *tmpl,
+                                              const char *method, size_t methodLength,
+                                              const char *path, size_t pathLength,
+                                              const char *query, size_t queryLength,
+                                              const aws_sigv4_header *headers, size_t headerCount,
+                                              const char *payloadHash, size_t payloadHashLength,
+                                              size_t *signedHeadersOffset, size_t *signedHeadersLength) {
+    aws_sigv4_sorted_header sortedStorage[2 * AWS_SIGV4_INLINE_ITEMS];
+    aws_sigv4_sorted_header *variable = sortedStorage;
+    size_t used[AWS_SIGV4_HEADER_TEMPLATE_MAX] = { 0 };
+    size_t templateCount = tmpl ? tmpl->count : 0;
+    size_t variableCount = 0;
+    size_t sortedCount = 0;
+    int result = -1;
+
+    // variable headers in [0, headerCount), the merged order after them
+    if (headerCount > AWS_SIGV4_INLINE_ITEMS) {
+        variable = malloc(2 * headerCount * sizeof(*variable));
+        if (!variable) {
+            return -1;
+        }
+    }
+    aws_sigv4_sorted_header *sorted = variable + headerCount;
+
+    for (size_t i = 0; i < headerCount; i++) {
+        if (templateCount && aws_sigv4_header_template_claim(tmpl, &headers[i], i, used)) {
+            continue;
+        }
+        aws_sigv4_insert_sorted(variable, variableCount++, &headers[i]);
+    }
+
+    // Merge the claimed template entries, already in order, with the sorted rest. Headers
+    // with the same name keep their request order, as they do when sorted without a template.
+    for (size_t t = 0, v = 0;;) {
+        while (t < templateCount && !used[t]) {
+            t++;
+        }
+        if (t == templateCount && v == variableCount) {
+            break;
+        }
+        int order = (t == templateCount || v == variableCount)
+            ? 0 : aws_sigv4_compare_header_names(&tmpl->canonical[t], variable[v].header);
+        if (t < templateCount
+            && (v == variableCount || order < 0
+                || (order == 0 && used[t] - 1 < (size_t)(variable[v].header - headers)))) {
+            sorted[sortedCount].header = &tmpl->canonical[t++];
+            sorted[sortedCount++].canonical = 1;
+        } else {
+            sorted[sortedCount++] = variable[v++];
+        }
+    }
+
+    if (aws_sigv4_buf_append(buf, method, methodLength)
+        || aws_sigv4_buf_append_byte(buf, '\n')) {
+        goto LBL_ERR;
+    }
+    if (pathLength ? aws_sigv4_buf_append(buf, path, pathLength) : aws_sigv4_buf_append_byte(buf, '/')) {
+        goto LBL_ERR;
+    }
+    if (aws_sigv4_buf_append_byte(buf, '\n')
+        || aws_sigv4_append_canonical_query(buf, query, queryLength)
+        || aws_sigv4_buf_append_byte(buf, '\n')) {
+        goto LBL_ERR;
+    }
+
+    for (size_t i = 0; i < sortedCount; i++) {
+        const aws_sigv4_header *header = sorted[i].header;
+        // a template line is contiguous "name:value\n"
+        if (sorted[i].canonical
+            ? aws_sigv4_buf_append(buf, header->name, header->nameLength + header->valueLength + 2)
+            : aws_sigv4_append_header(buf, header)) {
+            goto LBL_ERR;
+        }
+    }
+    if (aws_sigv4_buf_append_byte(buf, '\n')) {
+        goto LBL_ERR;
+    }
+
+    size_t offset = buf->length;
+    for (size_t i = 0; i < sortedCount; i++) {
+        const aws_sigv4_header *header = sorted[i].header;
+        if (i && aws_sigv4_buf_append_byte(buf, ';')) {
+            goto LBL_ERR;
+        }
+        if (aws_sigv4_buf_reserve(buf, header->nameLength)) {
+            goto LBL_ERR;
+        }
+        if (sorted[i].canonical) {
+            memcpy(buf->data + buf->length, header->name, header->nameLength);
+            buf->length += header->nameLength;
+        } else {
+            for (size_t c = 0; c < header->nameLength; c++) {
+                buf->data[buf->length++] = aws_sigv4_lower((uint8_t)header->name[c]);
+            }
+        }
+    }
+    if (signedHeadersOffset) {
+        *signedHeadersOffset = offset;
+    }
+    if (signedHeadersLength) {
+        *signedHeadersLength = buf->length - offset;
+    }
+
+    if (aws_sigv4_buf_append_byte(buf, '\n')
+        || aws_sigv4_buf_append(buf, payloadHash, payloadHashLength)) {
+        goto LBL_ERR;
+    }
+    result = 0;
+
+LBL_ERR:
+    if (variable != sortedStorage) {
+        free(variable);
+    }
+    return result;
+}
+
+int aws_sigv4_canonical_request(aws_sigv4_buf *buf,
+                                const char *method, size_t methodLength,
+                                const char *path, size_t pathLength,
+                                const char *query, size_t queryLength,
+                                const aws_sigv4_header *headers, size_t headerCount,
+                                const char *payloadHash, size_t payloadHashLength,
+                                size_t *signedHeadersOffset, size_t *signedHeadersLength) {
+    return aws_sigv4_append_canonical_request(buf, NULL,
+                                              method, methodLength,
+                                              path, pathLength,
+                                              query, queryLength,
+                                              headers, headerCount,
+                                              payloadHash, payloadHashLength,
+                                              signedHeadersOffset, signedHeadersLength);
+}
+
+int aws_sigv4_string_to_sign(aws_sigv4_buf *buf,
+                             const char *amzDate, size_t amzDateLength,
+                             const char *scope, size_t scopeLength,
+                             const uint8_t canonicalRequestHash[32]) {
+    size_t length = sizeof(aws_sigv4_algorithm) - 1 + amzDateLength + scopeLength + 64 + 3;
+    if (aws_sigv4_buf_reserve(buf, length)) {
+        return -1;
+    }
+
+    uint8_t *out = buf->data + buf->length;
+    memcpy(out, aws_sigv4_algorithm, sizeof(aws_sigv4_algorithm) - 1);
+    out += sizeof(aws_sigv4_algorithm) - 1;
+    *out++ = '\n';
+    memcpy(out, amzDate, amzDateLength);
+    out += amzDateLength;
+    *out++ = '\n';
+    memcpy(out, scope, scopeLength);
+    out += scopeLength;
+    *out++ = '\n';
+    aws_sigv4_hex_encode(canonicalRequestHash, 32, (char *)out);
+    out += 64;
+
+    buf->length = (size_t)(out - buf->data);
+    return 0;
+}
+
+// Keys and scope
+
+void aws_sigv4_derive_key(const char *secret, size_t secretLength,
+                          const char *date, size_t dateLength,
+                          const char *region, size_t regionLength,
+                          const char *service, size_t serviceLength,
+                          uint8_t key[AWS_SHA256_DIGEST_LENGTH]) {
+    uint8_t secretKey[AWS_SHA256_BLOCK_LENGTH];
+    size_t secretKeyLength = sizeof(aws_sigv4_key_prefix) - 1 + secretLength;
+
+    // "AWS4" + secret, hashed in place of copying when it is longer than a block
+    if (secretKeyLength <= sizeof(secretKey)) {
+        memcpy(secretKey, aws_sigv4_key_prefix, sizeof(aws_sigv4_key_prefix) - 1);
+        memcpy(secretKey + sizeof(aws_sigv4_key_prefix) - 1, secret, secretLength);
+    } else {
+        aws_sha256_ctx ctx;
+        aws_sha256_init(&ctx);
+        aws_sha256_update(&ctx, aws_sigv4_key_prefix, sizeof(aws_sigv4_key_prefix) - 1);
+        aws_sha256_update(&ctx, secret, secretLength);
+        aws_sha256_final(&ctx, secretKey);
+        secretKeyLength = AWS_SHA256_DIGEST_LENGTH;
+    }
+
+    aws_hmac_sha256(secretKey, secretKeyLength, date, dateLength, key);
+    aws_hmac_sha256(key, AWS_SHA256_DIGEST_LENGTH, region, regionLength, key);
+    aws_hmac_sha256(key, AWS_SHA256_DIGEST_LENGTH, service, serviceLength, key);
+    aws_hmac_sha256(key, AWS_SHA256_DIGEST_LENGTH, aws_sigv4_terminator, sizeof(aws_sigv4_terminator) - 1, key);
+    memset(secretKey, 0, sizeof(secretKey));
+}
+
+int aws_sigv4_append_scope(aws_sigv4_buf *buf,
+                           const char *date, size_t dateLength,
+                           const char *region, size_t regionLength,
+                           const char *service, size_t serviceLength) {
+    if (aws_sigv4_buf_append(buf, date, dateLength)
+        || aws_sigv4_buf_append_byte(buf, '/')
+        || aws_sigv4_buf_append(buf, region, regionLength)
+        || aws_sigv4_buf_append_byte(buf, '/')
+        || aws_sigv4_buf_append(buf, service, serviceLength)
+        || aws_sigv4_buf_append_byte(buf, '/')
+        || aws_sigv4_buf_append(buf, aws_sigv4_terminator, sizeof(aws_sigv4_terminator) - 1)) {
+        return -1;
+    }
+    return 0;
+}
+
+// Requests
+
+int aws_sigv4_sign_request(aws_sigv4_buf *buf, const aws_hmac_sha256_ctx *key,
+                           const aws_sigv4_header_template *tmpl,
+                           const char *amzDate, size_t amzDateLength,
+                           const char *scope, size_t scopeLength,
+                           const char *method, size_t methodLength,
+                           const char *path, size_t pathLength,
+                           const char *query, size_t queryLength,
+                           const aws_sigv4_header *headers, size_t headerCount,
+                           const char *payloadHash, size_t payloadHashLength,
+                           char signature[AWS_SIGV4_SIGNATURE_LENGTH],
+                           size_t *signedHeadersOffset, size_t *signedHeadersLength) {
+    uint8_t digest[AWS_SHA256_DIGEST_LENGTH];
+    size_t start = buf->length;
+
+    if (aws_sigv4_append_canonical_request(buf, tmpl,
+                                           method, methodLength,
+                                           path, pathLength,
+                                           query, queryLength,
+                                           headers, headerCount,
+                                           payloadHash, payloadHashLength,
+                                           signedHeadersOffset, signedHeadersLength)) {
+        return -1;
+    }
+    aws_sha256(buf->data + start, buf->length - start, digest);
+
+    size_t stringToSign = buf->length;
+    if (aws_sigv4_string_to_sign(buf, amzDate, amzDateLength, scope, scopeLength, digest)) {
+        return -1;
+    }
+
+    aws_hmac_sha256_ctx hmac = *key;
+    aws_hmac_sha256_update(&hmac, buf->data + stringToSign, buf->length - stringToSign);
+    aws_hmac_sha256_final(&hmac, digest);
+    memset(&hmac, 0, sizeof(hmac));
+    aws_sigv4_hex_encode(digest, AWS_SHA256_DIGEST_LENGTH, signature);
+    return 0;
+}
+
+int aws_sigv4_sign_canonical_requests(const uint8_t key[AWS_SHA256_DIGEST_LENGTH],
+                                      const char *amzDate, size_t amzDateLength,
+                                      const char *scope, size_t scopeLength,
+                                      const void *const *canonicalRequests, const size_t *lengths, size_t count,
+                                      char (*signatures)[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    uint8_t digests[AWS_SIGV4_MULTI_BATCH][AWS_SHA256_DIGEST_LENGTH];
+    const void *stringsToSign[AWS_SIGV4_MULTI_BATCH];
+    size_t stringToSignLengths[AWS_SIGV4_MULTI_BATCH];
+    uint8_t storage[AWS_SIGV4_STRING_TO_SIGN_STORAGE];
+    aws_sigv4_buf buf;
+    int result = 0;
+
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    for (size_t i = 0; i < count; i += AWS_SIGV4_MULTI_BATCH) {
+        size_t n = (count - i < AWS_SIGV4_MULTI_BATCH) ? count - i : AWS_SIGV4_MULTI_BATCH;
+
+        aws_sha256_multi(canonicalRequests + i, lengths + i, n, digests);
+
+        // every string-to-sign has the same length, so they are laid out back to back
+        aws_sigv4_buf_reset(&buf);
+        for (size_t j = 0; j < n; j++) {
+            if (aws_sigv4_string_to_sign(&buf, amzDate, amzDateLength, scope, scopeLength, digests[j])) {
+                result = -1;
+                goto done;
+            }
+        }
+        size_t stringToSignLength = buf.length / n;
+        for (size_t j = 0; j < n; j++) {
+            stringsToSign[j] = buf.data + j * stringToSignLength;
+            stringToSignLengths[j] = stringToSignLength;
+        }
+
+        aws_hmac_sha256_multi(key, AWS_SHA256_DIGEST_LENGTH, stringsToSign, stringToSignLengths, n, digests);
+        for (size_t j = 0; j < n; j++) {
+            aws_sigv4_hex_encode(digests[j], AWS_SHA256_DIGEST_LENGTH, signatures[i + j]);
+        }
+    }
+
+done:
+    memset(digests, 0, sizeof(digests));
+    aws_sigv4_buf_free(&buf);
+    return result;
+}
+
+int aws_sigv4_append_authorization(aws_sigv4_buf *buf,
+                                   const char *accessKey, size_t accessKeyLength,
+                                   const char *scope, size_t scopeLength,
+                                   const char *signedHeaders, size_t signedHeadersLength,
+                                   const char signature[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    static const char credential[] = " Credential=";
+    static const char signedHeadersName[] = ", SignedHeaders=";
+    static const char signatureName[] = ", Signature=";
+
+    if (aws_sigv4_buf_append(buf, aws_sigv4_algorithm, sizeof(aws_sigv4_algorithm) - 1)
+        || aws_sigv4_buf_append(buf, credential, sizeof(credential) - 1)
+        || aws_sigv4_buf_append(buf, accessKey, accessKeyLength)
+        || aws_sigv4_buf_append_byte(buf, '/')
+        || aws_sigv4_buf_append(buf, scope, scopeLength)
+        || aws_sigv4_buf_append(buf, signedHeadersName, sizeof(signedHeadersName) - 1)
+        || aws_sigv4_buf_append(buf, signedHeaders, signedHeadersLength)
+        || aws_sigv4_buf_append(buf, signatureName, sizeof(signatureName) - 1)
+        || aws_sigv4_buf_append(buf, signature, AWS_SIGV4_SIGNATURE_LENGTH)) {
+        return -1;
+    }
+    return 0;
+}
+
+// Presigned URLs
+
+int aws_sigv4_append_presign_query(aws_sigv4_buf *buf,
+                                   const char *accessKey, size_t accessKeyLength,
+                                   const char *scope, size_t scopeLength,
+                                   const char *amzDate, size_t amzDateLength,
+                                   uint32_t expires,
+                                   const char *signedHeaders, size_t signedHeadersLength) {
+    static const char algorithm[] = "X-Amz-Algorithm=";
+    static const char credential[] = "&X-Amz-Credential=";
+    static const char date[] = "&X-Amz-Date=";
+    static const char expiresName[] = "&X-Amz-Expires=";
+    static const char signedHeadersName[] = "&X-Amz-SignedHeaders=";
+    char digits[10];
+    size_t digitCount = 0;
+
+    do {
+        digits[sizeof(digits) - ++digitCount] = (char)('0' + expires % 10);
+        expires /= 10;
+    } while (expires > 0);
+
+    if (aws_sigv4_buf_append(buf, algorithm, sizeof(algorithm) - 1)
+        || aws_sigv4_buf_append(buf, aws_sigv4_algorithm, sizeof(aws_sigv4_algorithm) - 1)
+        || aws_sigv4_buf_append(buf, credential, sizeof(credential) - 1)
+        || aws_sigv4_append_uri_encoded(buf, accessKey, accessKeyLength, 1)
+        || aws_sigv4_append_uri_encoded(buf, "/", 1, 1)
+        || aws_sigv4_append_uri_encoded(buf, scope, scopeLength, 1)
+        || aws_sigv4_buf_append(buf, date, sizeof(date) - 1)
+        || aws_sigv4_append_uri_encoded(buf, amzDate, amzDateLength, 1)
+        || aws_sigv4_buf_append(buf, expiresName, sizeof(expiresName) - 1)
+        || aws_sigv4_buf_append(buf, digits + sizeof(digits) - digitCount, digitCount)
+        || aws_sigv4_buf_append(buf, signedHeadersName, sizeof(signedHeadersName) - 1)
+        || aws_sigv4_append_uri_encoded(buf, signedHeaders, signedHeadersLength, 1)
+        || aws_sigv4_buf_append_byte(buf, '&')) {
+        return -1;
+    }
+    return 0;
+}
+
+int aws_sigv4_append_query_param(aws_sigv4_buf *buf,
+                                 const char *key, size_t keyLength,
+                                 const char *value, size_t valueLength) {
+    if (aws_sigv4_append_uri_encoded(buf, key, keyLength, 1)
+        || aws_sigv4_buf_append_byte(buf, '=')
+        || aws_sigv4_append_uri_encoded(buf, value, valueLength, 1)
+        || aws_sigv4_buf_append_byte(buf, '&')) {
+        return -1;
+    }
+    return 0;
+}
+
+// Chunked payloads
+
+void aws_sigv4_chunk_key(aws_hmac_sha256_ctx *chunkKey, const aws_hmac_sha256_ctx *key,
+                         const char *amzDate, size_t amzDateLength,
+                         const char *scope, size_t scopeLength) {
+    *chunkKey = *key;
+    aws_hmac_sha256_update(chunkKey, aws_sigv4_chunk_algorithm, sizeof(aws_sigv4_chunk_algorithm) - 1);
+    aws_hmac_sha256_update(chunkKey, "\n", 1);
+    aws_hmac_sha256_update(chunkKey, amzDate, amzDateLength);
+    aws_hmac_sha256_update(chunkKey, "\n", 1);
+    aws_hmac_sha256_update(chunkKey, scope, scopeLength);
+    aws_hmac_sha256_update(chunkKey, "\n", 1);
+}
+
+// signature = HMAC over the previous signature and the payload hash
+static void aws_sigv4_chunk_chain(const aws_hmac_sha256_ctx *chunkKey,
+                                  const char previousSignature[AWS_SIGV4_SIGNATURE_LENGTH],
+                                  const uint8_t payloadDigest[AWS_SHA256_DIGEST_LENGTH],
+                                  char signature[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    uint8_t digest[AWS_SHA256_DIGEST_LENGTH];
+    char payloadHash[AWS_SIGV4_SIGNATURE_LENGTH];
+
+    aws_sigv4_hex_encode(payloadDigest, AWS_SHA256_DIGEST_LENGTH, payloadHash);
+
+    aws_hmac_sha256_ctx hmac = *chunkKey;
+    aws_hmac_sha256_update(&hmac, previousSignature, AWS_SIGV4_SIGNATURE_LENGTH);
+    aws_hmac_sha256_update(&hmac, "\n", 1);
+    aws_hmac_sha256_update(&hmac, aws_sigv4_empty_sha256, sizeof(aws_sigv4_empty_sha256) - 1);
+    aws_hmac_sha256_update(&hmac, "\n", 1);
+    aws_hmac_sha256_update(&hmac, payloadHash, AWS_SIGV4_SIGNATURE_LENGTH);
+    aws_hmac_sha256_final(&hmac, digest);
+    memset(&hmac, 0, sizeof(hmac));
+    aws_sigv4_hex_encode(digest, AWS_SHA256_DIGEST_LENGTH, signature);
+}
+
+void aws_sigv4_chunk_signature(const aws_hmac_sha256_ctx *chunkKey,
+                               const char previousSignature[AWS_SIGV4_SIGNATURE_LENGTH],
+                               const void *payload, size_t length,
+                               char signature[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    uint8_t digest[AWS_SHA256_DIGEST_LENGTH];
+
+    aws_sha256(payload, length, digest);
+    aws_sigv4_chunk_chain(chunkKey, previousSignature, digest, signature);
+}
+
+void aws_sigv4_chunk_signatures(const aws_hmac_sha256_ctx *chunkKey,
+                                const char previousSignature[AWS_SIGV4_SIGNATURE_LENGTH],
+                                const void *const *payloads, const size_t *lengths, size_t count,
+                                char (*signatures)[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    uint8_t digests[AWS_SIGV4_MULTI_BATCH][AWS_SHA256_DIGEST_LENGTH];
+    char previous[AWS_SIGV4_SIGNATURE_LENGTH];
+
+    // previousSignature may be one of the signatures about to be written
+    memcpy(previous, previousSignature, sizeof(previous));
+    for (size_t i = 0; i < count; i += AWS_SIGV4_MULTI_BATCH) {
+        size_t n = (count - i < AWS_SIGV4_MULTI_BATCH) ? count - i : AWS_SIGV4_MULTI_BATCH;
+
+        aws_sha256_multi(payloads + i, lengths + i, n, digests);
+        for (size_t j = 0; j < n; j++) {
+            aws_sigv4_chunk_chain(chunkKey, previous, digests[j], signatures[i + j]);
+            memcpy(previous, signatures[i + j], sizeof(previous));
+        }
+    }
+}
@@ -0,0 +1,242 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+#ifndef AWS_SIGV4_H_
+#define AWS_SIGV4_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "aws_sha256.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Portable SigV4: canonical requests, key derivation, header and query
+ * (presigned) signing, and aws-chunked chunk signatures.
+ *
+ * Everything is written as UTF-8 bytes into one aws_sigv4_buf. The buffer
+ * starts out in caller-supplied storage (usually a stack array) and only
+ * moves to the heap when a request does not fit, so a typical request is
+ * canonicalised without allocating. Functions return 0 on success and -1
+ * when growing the buffer fails.
+ *
+ * Signing takes an aws_hmac_sha256_ctx keyed with the derived key, so a
+ * caller that signs many requests in one scope derives the key once.
+ */
+
+#define AWS_SIGV4_SIGNATURE_LENGTH (2 * AWS_SHA256_DIGEST_LENGTH)
+
+typedef struct {
+    uint8_t *data;
+    size_t   length;
+    size_t   capacity;
+    uint8_t *storage;                           /* caller storage, not freed */
+    size_t   storageCapacity;
+} aws_sigv4_buf;
+
+typedef struct {
+    const char *name;
+    size_t      nameLength;
+    const char *value;
+    size_t      valueLength;
+} aws_sigv4_header;
+
+/*
+ * Headers most requests of one client repeat (host, user agent, content
+ * type, ...), lowercased, trimmed and sorted once. raw[i] is the header as
+ * callers pass it and canonical[i] its normalised form; both are in
+ * canonical order. A template is read-only after init and may be shared
+ * between threads.
+ */
+#define AWS_SIGV4_HEADER_TEMPLATE_MAX 32
+
+typedef struct {
+    aws_sigv4_header *raw;
+    aws_sigv4_header *canonical;
+    size_t            count;
+    void             *storage;
+} aws_sigv4_header_template;
+
+void aws_sigv4_buf_init(aws_sigv4_buf *buf, void *storage, size_t capacity);
+void aws_sigv4_buf_reset(aws_sigv4_buf *buf);
+void aws_sigv4_buf_free(aws_sigv4_buf *buf);
+int  aws_sigv4_buf_append(aws_sigv4_buf *buf, const void *bytes, size_t length);
+
+/* out = lowercase hex of bytes; writes 2 * length chars, no terminator */
+void aws_sigv4_hex_encode(const uint8_t *bytes, size_t length, char *out);
+
+/*
+ * Appends bytes percent-encoded with the SigV4 rules: A-Z a-z 0-9 - . _ ~
+ * pass through, everything else becomes %XX with uppercase hex. '/' is kept
+ * as is unless encodeSlash is set.
+ */
+int aws_sigv4_append_uri_encoded(aws_sigv4_buf *buf, const char *bytes, size_t length, int encodeSlash);
+
+/*
+ * Appends the canonical form of an already encoded query string: parameters
+ * sorted by key then value, escapes normalised to uppercase hex, unreserved
+ * characters decoded, and bytes that should have been escaped escaped. A
+ * parameter without '=' gets an empty value.
+ */
+int aws_sigv4_append_canonical_query(aws_sigv4_buf *buf, const char *query, size_t length);
+
+/*
+ * Appends the canonical request:
+ *
+ *   method \n path \n canonical query \n canonical headers \n signed headers \n payload hash
+ *
+ * path is used as given (it is expected to be encoded already) and an empty
+ * path becomes "/". Header names are lowercased and sorted, values trimmed
+ * with inner runs of spaces and tabs collapsed to one space. The signed
+ * headers list is also returned as an offset/length into buf so callers can
+ * reuse it in the Authorization header.
+ */
+int aws_sigv4_canonical_request(aws_sigv4_buf *buf,
+                                const char *method, size_t methodLength,
+                                const char *path, size_t pathLength,
+                                const char *query, size_t queryLength,
+                                const aws_sigv4_header *headers, size_t headerCount,
+                                const char *payloadHash, size_t payloadHashLength,
+                                size_t *signedHeadersOffset, size_t *signedHeadersLength);
+
+/*
+ * Copies up to AWS_SIGV4_HEADER_TEMPLATE_MAX headers into tmpl and
+ * normalises them; the rest, and names given more than once, are left
+ * out. Free with aws_sigv4_header_template_free.
+ */
+int  aws_sigv4_header_template_init(aws_sigv4_header_template *tmpl,
+                                    const aws_sigv4_header *headers, size_t headerCount);
+void aws_sigv4_header_template_free(aws_sigv4_header_template *tmpl);
+
+/* Appends "AWS4-HMAC-SHA256 \n amzDate \n scope \n hex(canonicalRequestHash)" */
+int aws_sigv4_string_to_sign(aws_sigv4_buf *buf,
+                             const char *amzDate, size_t amzDateLength,
+                             const char *scope, size_t scopeLength,
+                             const uint8_t canonicalRequestHash[32]);
+
+/* Keys and scope */
+
+/* key = HMAC chain from "AWS4" + secret over date, region, service and "aws4_request" */
+void aws_sigv4_derive_key(const char *secret, size_t secretLength,
+                          const char *date, size_t dateLength,
+                          const char *region, size_t regionLength,
+                          const char *service, size_t serviceLength,
+                          uint8_t key[AWS_SHA256_DIGEST_LENGTH]);
+
+/* Appends "date/region/service/aws4_request" */
+int aws_sigv4_append_scope(aws_sigv4_buf *buf,
+                           const char *date, size_t dateLength,
+                           const char *region, size_t regionLength,
+                           const char *service, size_t serviceLength);
+
+/* Requests */
+
+/*
+ * Builds the canonical request in buf, appends the string-to-sign after it
+ * and writes the hex signature. The signed headers list stays in buf as
+ * for aws_sigv4_canonical_request; buf->length covers both texts.
+ *
+ * tmpl may be NULL. Headers whose name and value bytes match a template
+ * entry reuse its canonical form; only the others are normalised and
+ * sorted, then merged in.
+ */
+int aws_sigv4_sign_request(aws_sigv4_buf *buf, const aws_hmac_sha256_ctx *key,
+                           const aws_sigv4_header_template *tmpl,
+                           const char *amzDate, size_t amzDateLength,
+                           const char *scope, size_t scopeLength,
+                           const char *method, size_t methodLength,
+                           const char *path, size_t pathLength,
+                           const char *query, size_t queryLength,
+                           const aws_sigv4_header *headers, size_t headerCount,
+                           const char *payloadHash, size_t payloadHashLength,
+                           char signature[AWS_SIGV4_SIGNATURE_LENGTH],
+                           size_t *signedHeadersOffset, size_t *signedHeadersLength);
+
+/*
+ * signatures[i] = hex signature of canonicalRequests[i], for count requests
+ * that share a derived key, date and scope (a batch of presigned URLs).
+ * The canonical requests go through aws_sha256_multi and the
+ * strings-to-sign through aws_hmac_sha256_multi, so on CPUs with more than
+ * one lane they are hashed side by side. key is the derived key itself;
+ * it is hashed into HMAC pads once per call.
+ */
+int aws_sigv4_sign_canonical_requests(const uint8_t key[AWS_SHA256_DIGEST_LENGTH],
+                                      const char *amzDate, size_t amzDateLength,
+                                      const char *scope, size_t scopeLength,
+                                      const void *const *canonicalRequests, const size_t *lengths, size_t count,
+                                      char (*signatures)[AWS_SIGV4_SIGNATURE_LENGTH]);
+
+/* Appends "AWS4-HMAC-SHA256 Credential=accessKey/scope, SignedHeaders=..., Signature=..." */
+int aws_sigv4_append_authorization(aws_sigv4_buf *buf,
+                                   const char *accessKey, size_t accessKeyLength,
+                                   const char *scope, size_t scopeLength,
+                                   const char *signedHeaders, size_t signedHeadersLength,
+                                   const char signature[AWS_SIGV4_SIGNATURE_LENGTH]);
+
+/* Presigned URLs */
+
+/*
+ * Appends the parameters a presigned query starts with, each followed by
+ * '&': X-Amz-Algorithm, X-Amz-Credential, X-Amz-Date, X-Amz-Expires and
+ * X-Amz-SignedHeaders. More parameters go after them with
+ * aws_sigv4_append_query_param; X-Amz-Signature goes last, once signed.
+ */
+int aws_sigv4_append_presign_query(aws_sigv4_buf *buf,
+                                   const char *accessKey, size_t accessKeyLength,
+                                   const char *scope, size_t scopeLength,
+                                   const char *amzDate, size_t amzDateLength,
+                                   uint32_t expires,
+                                   const char *signedHeaders, size_t signedHeadersLength);
+
+/* Appends "key=value&" with both sides percent-encoded, '/' included */
+int aws_sigv4_append_query_param(aws_sigv4_buf *buf,
+                                 const char *key, size_t keyLength,
+                                 const char *value, size_t valueLength);
+
+/* Chunked payloads (STREAMING-AWS4-HMAC-SHA256-PAYLOAD) */
+
+/* chunkKey = key fed "AWS4-HMAC-SHA256-PAYLOAD \n amzDate \n scope \n", the part every chunk shares */
+void aws_sigv4_chunk_key(aws_hmac_sha256_ctx *chunkKey, const aws_hmac_sha256_ctx *key,
+                         const char *amzDate, size_t amzDateLength,
+                         const char *scope, size_t scopeLength);
+
+/*
+ * signature = hex signature of one chunk, chained from the previous chunk's
+ * (the request's for the first chunk). signature may be previousSignature.
+ */
+void aws_sigv4_chunk_signature(const aws_hmac_sha256_ctx *chunkKey,
+                               const char previousSignature[AWS_SIGV4_SIGNATURE_LENGTH],
+                               const void *payload, size_t length,
+                               char signature[AWS_SIGV4_SIGNATURE_LENGTH]);
+
+/*
+ * Signs count consecutive chunks: signatures[0] is chained from
+ * previousSignature and signatures[i] from signatures[i - 1]. The payloads
+ * are hashed side by side with aws_sha256_multi; only the short HMAC chain
+ * runs one chunk after another. previousSignature may point into signatures.
+ */
+void aws_sigv4_chunk_signatures(const aws_hmac_sha256_ctx *chunkKey,
+                                const char previousSignature[AWS_SIGV4_SIGNATURE_LENGTH],
+                                const void *const *payloads, const size_t *lengths, size_t count,
+                                char (*signatures)[AWS_SIGV4_SIGNATURE_LENGTH]);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -95,6 +95,27 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
     AWSJSONParserInvalidParameter,
 };
 
+/**
+ One entry of a compiled service model: a member of "operations" or "shapes" and its
+ definition as compact JSON.
+ */
+typedef struct {
+    const char *name;
+    const char *JSON;
+} AWSServiceModelEntry;
+
+/**
+ A read-only dictionary over a table of AWSServiceModelEntry sorted by name. Each value is
+ parsed the first time it is looked up and kept afterwards, so a client only pays for the
+ operations and shapes it uses. Safe to share between threads.
+ */
+@interface AWSServiceModelDictionary : NSDictionary
+
+- (instancetype)initWithEntries:(const AWSServiceModelEntry *)entries
+                          count:(NSUInteger)count;
+
+@end
+
 @interface AWSJSONDictionary : NSDictionary
 
 - (instancetype)initWithDictionary:(NSDictionary *)otherDictionary
@@ -122,6 +143,13 @@ typedef NS_ENUM(NSInteger, AWSJSONParserErrorType) {
 
 + (AWSXMLParser *)sharedInstance;
 
+/**
+ Decode responses in one pass straight from the shape rules instead of building an
+ intermediate XML tree first. Responses it does not handle still go through the tree.
+ The default is NO.
+ */
+@property (nonatomic, assign) BOOL usesOnePassDecoder;
+
 - (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data
                                    actionName:(NSString *)actionName
                         serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule
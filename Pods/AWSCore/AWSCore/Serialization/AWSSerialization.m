@@ -92,6 +92,102 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @end
 
+@implementation AWSServiceModelDictionary {
+    const AWSServiceModelEntry *_entries;
+    NSUInteger _count;
+    NSMutableDictionary *_values;
+    NSArray *_keys;
+}
+
+- (instancetype)initWithEntries:(const AWSServiceModelEntry *)entries
+                          count:(NSUInteger)count {
+    if (self = [super init]) {
+        _entries = entries;
+        _count = count;
+        _values = [NSMutableDictionary new];
+    }
+    return self;
+}
+
+- (NSUInteger)count {
+    return _count;
+}
+
+- (id)objectForKey:(id)aKey {
+    if (![aKey isKindOfClass:[NSString class]]) {
+        return nil;
+    }
+
+    @synchronized (self) {
+        id value = _values[aKey];
+        if (value) {
+            return value;
+        }
+    }
+
+    const char *name = [aKey UTF8String];
+    const AWSServiceModelEntry *entry = NULL;
+    NSUInteger low = 0;
+    NSUInteger high = _count;
+    while (low < high) {
+        NSUInteger middle = low + (high - low) / 2;
+        int order = strcmp(name, _entries[middle].name);
+        if (order == 0) {
+            entry = &_entries[middle];
+            break;
+        } else if (order < 0) {
+            high = middle;
+        } else {
+            low = middle + 1;
+        }
+    }
+    if (!entry) {
+        return nil;
+    }
+
+    NSError *error = nil;
+    NSData *data = [NSData dataWithBytesNoCopy:(void *)entry->JSON
+                                        length:strlen(entry->JSON)
+                                  freeWhenDone:NO];
+    id value = [NSJSONSerialization JSONObjectWithData:data
+                                               options:kNilOptions
+                                                 error:&error];
+    if (!value) {
+        AWSDDLogError(@"Failed to parse JSON service definition of %@: %@", aKey, error);
+        return nil;
+    }
+
+    @synchronized (self) {
+        // Another thread may have parsed it first; hand out a single instance.
+        id existing = _values[aKey];
+        if (existing) {
+            return existing;
+        }
+        _values[aKey] = value;
+    }
+    return value;
+}
+
+- (NSEnumerator *)keyEnumerator {
+    @synchronized (self) {
+        if (!_keys) {
+            NSMutableArray *keys = [NSMutableArray arrayWithCapacity:_count];
+            for (NSUInteger i = 0; i < _count; i++) {
+                [keys addObject:[NSString stringWithUTF8String:_entries[i].name]];
+            }
+            _keys = keys;
+        }
+        return [_keys objectEnumerator];
+    }
+}
+
+// Immutable: copying (AWSJSONDictionary copies the shapes it is given) must not parse every entry.
+- (id)copyWithZone:(NSZone *)zone {
+    return self;
+}
+
+@end
+
 @implementation AWSXMLBuilder
 
 + (BOOL)failWithCode:(NSInteger)code description:(NSString *)description error:(NSError *__autoreleasing *)error {
@@ -358,10 +454,34 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @end
 
+/**
+ Decodes an XML response into the same dictionary the tree walk in AWSXMLParser produces,
+ in one pass over the NSXMLParser events and without building the intermediate tree.
+
+ Only responses that walk would decode plainly are handled here: errors, repeated members
+ that are not lists, text where a structure or list is expected, rule errors and empty results
+ make it give up, and the caller falls back to the tree.
+ */
+@interface AWSXMLResponseDecoder : NSObject <NSXMLParserDelegate>
+
+- (instancetype)initWithActionName:(NSString *)actionName
+                        actionRule:(NSDictionary *)actionRule
+                   definitionRules:(NSDictionary *)definitionRules
+             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+
+// Returns nil when the response has to go through the tree instead.
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data;
+
+@end
+
 @interface AWSXMLParser ()
 
+// Configuration only; each response is parsed by a copy, so parses run concurrently.
 @property (nonatomic, strong) AWSXMLDictionaryParser *xmlDictionaryParser;
 
++ (NSString *)findKeyNameByXMLName:(NSString *)xmlName rules:(NSDictionary *)rules;
++ (id)parseMember:(id)values rules:(AWSJSONDictionary *)rules error:(NSError *__autoreleasing *)error;
+
 @end
 
 @implementation AWSXMLParser
@@ -460,9 +580,19 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
     NSMutableDictionary *rootXmlDictionary = nil;
     if ([data isKindOfClass:[NSData class]]) {
-        @synchronized (self) {
-            rootXmlDictionary = [[self.xmlDictionaryParser dictionaryWithData:data] mutableCopy]; //TODO: need error parameters for parsing
+        if (self.usesOnePassDecoder && !*error) {
+            AWSXMLResponseDecoder *decoder = [[AWSXMLResponseDecoder alloc] initWithActionName:actionName
+                                                                                    actionRule:actionRule
+                                                                               definitionRules:definitionRules
+                                                                         serviceDefinitionRule:serviceDefinitionRule];
+            NSMutableDictionary *parsedData = [decoder dictionaryForXMLData:data];
+            if (parsedData) {
+                return parsedData;
+            }
         }
+
+        AWSXMLDictionaryParser *xmlDictionaryParser = [self.xmlDictionaryParser copy];
+        rootXmlDictionary = [[xmlDictionaryParser dictionaryWithData:data] mutableCopy]; //TODO: need error parameters for parsing
     }
 
     NSString *rootNodeName = [[rootXmlDictionary allKeys] firstObject];
@@ -838,6 +968,567 @@ NSString *const AWSJSONParserErrorDomain = @"com.amazonaws.AWSJSONParserErrorDom
 
 @end
 
+#pragma mark - AWSXMLResponseDecoder
+
+typedef NS_ENUM(NSInteger, AWSXMLDecoderFrameKind) {
+    AWSXMLDecoderFrameKindRoot,
+    AWSXMLDecoderFrameKindStructure,
+    AWSXMLDecoderFrameKindList,
+    AWSXMLDecoderFrameKindScalar,
+    AWSXMLDecoderFrameKindCapture, // built as a small tree and handed to +parseMember:rules:error:
+    AWSXMLDecoderFrameKindSkip,
+};
+
+// What decoding needs to know about one rule, worked out the first time the rule is reached.
+@interface AWSXMLDecoderShape : NSObject
+
+@property (nonatomic, strong) AWSJSONDictionary *rules;
+@property (nonatomic, assign) AWSXMLDecoderFrameKind kind;
+@property (nonatomic, assign) BOOL stringType;
+@property (nonatomic, strong) AWSJSONDictionary *memberRules;
+@property (nonatomic, strong) NSMutableDictionary *members; // structure: XML name -> AWSXMLDecoderMember or NSNull
+@property (nonatomic, assign) BOOL flattened;
+@property (nonatomic, strong) NSString *memberName;
+@property (nonatomic, strong) AWSXMLDecoderShape *itemShape;
+
++ (instancetype)structureShapeWithMemberRules:(AWSJSONDictionary *)memberRules;
++ (instancetype)shapeWithRules:(AWSJSONDictionary *)rules;
+
+@end
+
+@interface AWSXMLDecoderMember : NSObject
+
+@property (nonatomic, strong) NSString *name;
+@property (nonatomic, strong) AWSXMLDecoderShape *shape;
+// Flattened lists and captured members collect every element of their name before they are decoded.
+@property (nonatomic, assign) BOOL accumulates;
+
+@end
+
+@interface AWSXMLDecoderAccumulator : NSObject
+
+@property (nonatomic, strong) AWSXMLDecoderMember *member;
+@property (nonatomic, strong) NSMutableArray *values;
+@property (nonatomic, strong) NSString *firstText;
+
+@end
+
+@interface AWSXMLDecoderFrame : NSObject
+
+@property (nonatomic, assign) AWSXMLDecoderFrameKind kind;
+@property (nonatomic, strong) AWSXMLDecoderShape *shape;
+@property (nonatomic, strong) AWSXMLDecoderMember *member;
+@property (nonatomic, strong) NSString *wrapperName;
+@property (nonatomic, assign) BOOL item;
+@property (nonatomic, assign) BOOL hasChildren;
+@property (nonatomic, assign) BOOL hasText;
+@property (nonatomic, strong) NSMutableString *text;
+@property (nonatomic, strong) NSMutableDictionary *data;
+@property (nonatomic, strong) NSMutableDictionary *pending;
+@property (nonatomic, strong) NSMutableArray *items;
+@property (nonatomic, strong) NSString *firstItemText;
+@property (nonatomic, strong) NSMutableDictionary *node;
+
+@end
+
+@implementation AWSXMLDecoderShape
+
++ (instancetype)structureShapeWithMemberRules:(AWSJSONDictionary *)memberRules {
+    AWSXMLDecoderShape *shape = [AWSXMLDecoderShape new];
+    shape.kind = AWSXMLDecoderFrameKindStructure;
+    shape.memberRules = memberRules;
+    shape.members = [NSMutableDictionary new];
+    return shape;
+}
+
++ (instancetype)shapeWithRules:(AWSJSONDictionary *)rules {
+    NSString *rulesType = rules[@"type"];
+    AWSXMLDecoderShape *shape = nil;
+    if ([rulesType isEqualToString:@"structure"]) {
+        shape = [AWSXMLDecoderShape structureShapeWithMemberRules:rules[@"members"]?rules[@"members"]:@{}];
+    } else {
+        shape = [AWSXMLDecoderShape new];
+        if ([rulesType isEqualToString:@"list"]) {
+            shape.kind = AWSXMLDecoderFrameKindList;
+            shape.flattened = [rules[@"flattened"] boolValue];
+            shape.memberRules = rules[@"member"]?rules[@"member"]:@{};
+            shape.memberName = shape.memberRules[@"locationName"]?shape.memberRules[@"locationName"]:@"member";
+        } else if ([rulesType isEqualToString:@"string"] || [rulesType isEqualToString:@"character"]) {
+            shape.kind = AWSXMLDecoderFrameKindScalar;
+            shape.stringType = YES;
+        } else if ([rulesType isEqualToString:@"integer"] || [rulesType isEqualToString:@"long"]
+                   || [rulesType isEqualToString:@"float"] || [rulesType isEqualToString:@"double"]
+                   || [rulesType isEqualToString:@"boolean"] || [rulesType isEqualToString:@"timestamp"]
+                   || [rulesType isEqualToString:@"blob"]) {
+            shape.kind = AWSXMLDecoderFrameKindScalar;
+        } else {
+            shape.kind = AWSXMLDecoderFrameKindCapture;
+        }
+    }
+    shape.rules = rules;
+    return shape;
+}
+
+- (AWSXMLDecoderShape *)itemShape {
+    // Built on first use: shapes may be recursive.
+    if (!_itemShape) {
+        _itemShape = [AWSXMLDecoderShape shapeWithRules:self.memberRules];
+    }
+    return _itemShape;
+}
+
+@end
+
+@implementation AWSXMLDecoderMember
+
+@end
+
+@implementation AWSXMLDecoderAccumulator
+
+@end
+
+@implementation AWSXMLDecoderFrame
+
+@end
+
+@interface AWSXMLResponseDecoder ()
+
+@property (nonatomic, strong) AWSJSONDictionary *rules;
+@property (nonatomic, strong) NSString *payloadName;
+@property (nonatomic, strong) AWSXMLDecoderShape *rootShape;
+@property (nonatomic, strong) NSArray<NSString *> *wrapperNames;
+@property (nonatomic, strong) NSMutableDictionary *wrapped;
+// Frames are reused by depth, so a long list does not allocate one frame per element.
+@property (nonatomic, strong) NSMutableArray<AWSXMLDecoderFrame *> *frames;
+@property (nonatomic, assign) NSUInteger depth;
+@property (nonatomic, assign) BOOL failed;
+
+@end
+
+@implementation AWSXMLResponseDecoder
+
+- (instancetype)initWithActionName:(NSString *)actionName
+                        actionRule:(NSDictionary *)actionRule
+                   definitionRules:(NSDictionary *)definitionRules
+             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule {
+    if (self = [super init]) {
+        _rules = [[AWSJSONDictionary alloc] initWithDictionary:actionRule JSONDefinitionRule:definitionRules];
+
+        NSString *serviceTypeStr = serviceDefinitionRule[@"metadata"][@"type"]?serviceDefinitionRule[@"metadata"][@"type"]:serviceDefinitionRule[@"metadata"][@"protocol"];
+        NSNumber *isResultWrapped = serviceDefinitionRule[@"metadata"][@"resultWrapped"];
+        if ([serviceTypeStr isEqualToString:@"query"] && !(isResultWrapped && ![isResultWrapped boolValue])) {
+            // Same preference as +preprocessDictionary:operationName:actionRule:serviceDefinitionRule:.
+            NSMutableArray *wrapperNames = [NSMutableArray new];
+            if (_rules[@"resultWrapper"]) {
+                [wrapperNames addObject:_rules[@"resultWrapper"]];
+            }
+            if (actionName) {
+                [wrapperNames addObject:[actionName stringByAppendingString:@"Result"]];
+            }
+            _wrapperNames = wrapperNames;
+        }
+
+        _payloadName = _rules[@"payload"];
+        AWSJSONDictionary *memberRules = _rules[@"members"]?_rules[@"members"]:@{};
+        if (_payloadName) {
+            memberRules = memberRules[_payloadName][@"members"];
+        }
+        _rootShape = [AWSXMLDecoderShape structureShapeWithMemberRules:memberRules];
+    }
+
+    return self;
+}
+
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data {
+    if (self.payloadName && self.rules[@"members"][self.payloadName][@"streaming"]) {
+        return nil;
+    }
+
+    self.frames = [NSMutableArray new];
+    self.depth = 0;
+    self.failed = NO;
+    self.wrapped = [NSMutableDictionary new];
+
+    NSXMLParser *parser = [[NSXMLParser alloc] initWithData:data];
+    parser.delegate = self;
+    if (![parser parse] || self.failed || [self.frames count] == 0 || !self.frames[0].hasChildren) {
+        return nil;
+    }
+
+    NSMutableDictionary *parsedData = self.frames[0].data;
+    for (NSString *wrapperName in self.wrapperNames) {
+        if (self.wrapped[wrapperName]) {
+            parsedData = self.wrapped[wrapperName];
+            break;
+        }
+    }
+    if (self.payloadName) {
+        parsedData = [@{self.payloadName : parsedData} mutableCopy];
+    }
+
+    // An empty result may still be recovered by the tree walk's second attempt.
+    return [parsedData count] > 0 ? parsedData : nil;
+}
+
+- (void)fail:(NSXMLParser *)parser {
+    self.failed = YES;
+    [parser abortParsing];
+}
+
+- (AWSXMLDecoderFrame *)pushFrameWithKind:(AWSXMLDecoderFrameKind)kind shape:(AWSXMLDecoderShape *)shape member:(AWSXMLDecoderMember *)member {
+    AWSXMLDecoderFrame *frame = nil;
+    if (self.depth < [self.frames count]) {
+        frame = self.frames[self.depth];
+    } else {
+        frame = [AWSXMLDecoderFrame new];
+        [self.frames addObject:frame];
+    }
+    self.depth++;
+
+    frame.kind = kind;
+    frame.shape = shape;
+    frame.member = member;
+    frame.wrapperName = nil;
+    frame.item = NO;
+    frame.hasChildren = NO;
+    frame.hasText = NO;
+    frame.text = nil;
+    frame.data = nil;
+    frame.pending = nil;
+    frame.items = nil;
+    frame.firstItemText = nil;
+    frame.node = nil;
+    switch (kind) {
+        case AWSXMLDecoderFrameKindRoot:
+        case AWSXMLDecoderFrameKindStructure:
+            frame.data = [NSMutableDictionary new];
+            break;
+        case AWSXMLDecoderFrameKindList:
+            frame.items = [NSMutableArray new];
+            break;
+        case AWSXMLDecoderFrameKindCapture:
+            frame.node = [NSMutableDictionary new];
+            break;
+        default:
+            break;
+    }
+    return frame;
+}
+
+- (AWSXMLDecoderMember *)memberNamed:(NSString *)xmlName inShape:(AWSXMLDecoderShape *)shape {
+    id member = shape.members[xmlName];
+    if (!member) {
+        NSString *keyName = [AWSXMLParser findKeyNameByXMLName:xmlName rules:shape.memberRules];
+        if (keyName) {
+            AWSJSONDictionary *rule = shape.memberRules[keyName];
+            AWSXMLDecoderMember *decoderMember = [AWSXMLDecoderMember new];
+            decoderMember.name = rule[@"name"]?rule[@"name"]:keyName;
+            decoderMember.shape = [AWSXMLDecoderShape shapeWithRules:rule];
+            decoderMember.accumulates = decoderMember.shape.kind == AWSXMLDecoderFrameKindCapture
+                || (decoderMember.shape.kind == AWSXMLDecoderFrameKindList && decoderMember.shape.flattened);
+            member = decoderMember;
+        } else {
+            member = [NSNull null];
+        }
+        shape.members[xmlName] = member;
+    }
+    return member == [NSNull null] ? nil : member;
+}
+
+// Mirrors how AWSXMLDictionaryParser files text: each run becomes (another) text entry of its node.
+- (void)flushCapturedText:(AWSXMLDecoderFrame *)frame {
+    if ([frame.text length]) {
+        id existing = frame.node[AWSXMLDictionaryTextKey];
+        if ([existing isKindOfClass:[NSArray class]]) {
+            [existing addObject:frame.text];
+        } else if (existing) {
+            frame.node[AWSXMLDictionaryTextKey] = [@[existing, frame.text] mutableCopy];
+        } else {
+            frame.node[AWSXMLDictionaryTextKey] = frame.text;
+        }
+    }
+    frame.text = nil;
+}
+
+- (void)parser:(NSXMLParser *)parser didStartElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName attributes:(NSDictionary *)attributeDict {
+    if (self.failed) {
+        return;
+    }
+
+    if (self.depth == 0) {
+        if ([self.frames count] > 0 || [elementName isEqualToString:@"Error"]) {
+            [self fail:parser];
+            return;
+        }
+        [self pushFrameWithKind:AWSXMLDecoderFrameKindRoot shape:self.rootShape member:nil];
+        return;
+    }
+
+    AWSXMLDecoderFrame *parent = self.frames[self.depth - 1];
+    parent.hasChildren = YES;
+
+    switch (parent.kind) {
+        case AWSXMLDecoderFrameKindSkip:
+            [self pushFrameWithKind:AWSXMLDecoderFrameKindSkip shape:nil member:nil];
+            return;
+
+        case AWSXMLDecoderFrameKindScalar:
+            [self fail:parser];
+            return;
+
+        case AWSXMLDecoderFrameKindCapture: {
+            [self flushCapturedText:parent];
+            AWSXMLDecoderFrame *frame = [self pushFrameWithKind:AWSXMLDecoderFrameKindCapture shape:nil member:nil];
+            id existing = parent.node[elementName];
+            if ([existing isKindOfClass:[NSArray class]]) {
+                [existing addObject:frame.node];
+            } else if (existing) {
+                parent.node[elementName] = [@[existing, frame.node] mutableCopy];
+            } else {
+                parent.node[elementName] = frame.node;
+            }
+            return;
+        }
+
+        case AWSXMLDecoderFrameKindList:
+            if ([elementName isEqualToString:parent.shape.memberName]) {
+                AWSXMLDecoderShape *itemShape = parent.shape.itemShape;
+                [self pushFrameWithKind:itemShape.kind shape:itemShape member:nil].item = YES;
+            } else {
+                [self pushFrameWithKind:AWSXMLDecoderFrameKindSkip shape:nil member:nil];
+            }
+            return;
+
+        case AWSXMLDecoderFrameKindRoot:
+            if ([elementName isEqualToString:@"Error"] || [elementName isEqualToString:@"Errors"]) {
+                [self fail:parser];
+                return;
+            }
+            if ([self.wrapperNames containsObject:elementName]) {
+                if (self.wrapped[elementName]) {
+                    [self fail:parser];
+                    return;
+                }
+                [self pushFrameWithKind:AWSXMLDecoderFrameKindStructure shape:self.rootShape member:nil].wrapperName = elementName;
+                return;
+            }
+            break;
+
+        case AWSXMLDecoderFrameKindStructure:
+            break;
+    }
+
+    AWSXMLDecoderMember *member = [self memberNamed:elementName inShape:parent.shape];
+    if (!member) {
+        if (![elementName isEqualToString:@"_xmlns"] &&
+            ![elementName isEqualToString:@"requestId"] &&
+            ![elementName isEqualToString:@"ResponseMetadata"]) {
+            AWSDDLogWarn(@"Response element ignored: no rule for %@", elementName);
+        }
+        [self pushFrameWithKind:AWSXMLDecoderFrameKindSkip shape:nil member:nil];
+        return;
+    }
+
+    AWSXMLDecoderAccumulator *accumulator = parent.pending[member.name];
+    if (parent.data[member.name] || (accumulator && accumulator.member != member)) {
+        [self fail:parser];
+        return;
+    }
+
+    if (!member.accumulates) {
+        [self pushFrameWithKind:member.shape.kind shape:member.shape member:member];
+        return;
+    }
+
+    if (!accumulator) {
+        accumulator = [AWSXMLDecoderAccumulator new];
+        accumulator.member = member;
+        accumulator.values = [NSMutableArray new];
+        if (!parent.pending) {
+            parent.pending = [NSMutableDictionary new];
+        }
+        parent.pending[member.name] = accumulator;
+    }
+    if (member.shape.kind == AWSXMLDecoderFrameKindCapture) {
+        [self pushFrameWithKind:AWSXMLDecoderFrameKindCapture shape:member.shape member:member];
+    } else {
+        AWSXMLDecoderShape *itemShape = member.shape.itemShape;
+        AWSXMLDecoderFrame *frame = [self pushFrameWithKind:itemShape.kind shape:itemShape member:member];
+        frame.item = YES;
+    }
+}
+
+- (void)appendText:(NSString *)string {
+    if (self.failed || self.depth == 0 || [string length] == 0) {
+        return;
+    }
+
+    AWSXMLDecoderFrame *frame = self.frames[self.depth - 1];
+    switch (frame.kind) {
+        case AWSXMLDecoderFrameKindScalar:
+        case AWSXMLDecoderFrameKindCapture:
+            if (!frame.text) {
+                frame.text = [NSMutableString stringWithString:string];
+            } else {
+                [frame.text appendString:string];
+            }
+            break;
+        case AWSXMLDecoderFrameKindSkip:
+            break;
+        default:
+            frame.hasText = YES;
+            break;
+    }
+}
+
+- (void)parser:(NSXMLParser *)parser foundCharacters:(NSString *)string {
+    [self appendText:string];
+}
+
+- (void)parser:(NSXMLParser *)parser foundCDATA:(NSData *)CDATABlock {
+    [self appendText:[[NSString alloc] initWithData:CDATABlock encoding:NSUTF8StringEncoding]];
+}
+
+- (BOOL)finishStructure:(AWSXMLDecoderFrame *)frame {
+    for (NSString *name in frame.pending) {
+        AWSXMLDecoderAccumulator *accumulator = frame.pending[name];
+        if (accumulator.member.shape.kind == AWSXMLDecoderFrameKindCapture) {
+            id value = [accumulator.values count] == 1 ? accumulator.values[0] : accumulator.values;
+            NSError *error = nil;
+            frame.data[name] = [AWSXMLParser parseMember:value rules:accumulator.member.shape.rules error:&error];
+            if (error) {
+                return NO;
+            }
+        } else if ([accumulator.values count] == 1 && accumulator.firstText) {
+            // A lone list member that is only text is passed through undecoded by +parseList:rules:error:.
+            frame.data[name] = @[accumulator.firstText];
+        } else {
+            frame.data[name] = accumulator.values;
+        }
+    }
+    return YES;
+}
+
+- (void)parser:(NSXMLParser *)parser didEndElement:(NSString *)elementName namespaceURI:(NSString *)namespaceURI qualifiedName:(NSString *)qName {
+    if (self.failed || self.depth == 0) {
+        return;
+    }
+
+    AWSXMLDecoderFrame *frame = self.frames[self.depth - 1];
+    self.depth--;
+
+    id value = nil;
+    NSString *text = nil;
+    switch (frame.kind) {
+        case AWSXMLDecoderFrameKindSkip:
+            return;
+
+        case AWSXMLDecoderFrameKindRoot:
+            if (![self finishStructure:frame]) {
+                [self fail:parser];
+            }
+            return;
+
+        case AWSXMLDecoderFrameKindStructure:
+            if ((!frame.hasChildren && frame.hasText) || ![self finishStructure:frame]) {
+                [self fail:parser];
+                return;
+            }
+            value = frame.data;
+            break;
+
+        case AWSXMLDecoderFrameKindList:
+            if (!frame.hasChildren) {
+                if (frame.hasText) {
+                    [self fail:parser];
+                    return;
+                }
+                value = @[];
+            } else if ([frame.items count] == 0) {
+                [self fail:parser];
+                return;
+            } else if ([frame.items count] == 1 && frame.firstItemText) {
+                value = @[frame.firstItemText];
+            } else {
+                value = frame.items;
+            }
+            break;
+
+        case AWSXMLDecoderFrameKindScalar:
+            text = [frame.text length] ? [frame.text copy] : nil;
+            if (frame.shape.stringType) {
+                value = text?text:@"";
+            } else {
+                NSError *error = nil;
+                value = [AWSXMLParser parseMember:text?text:[NSMutableDictionary new] rules:frame.shape.rules error:&error];
+                if (error) {
+                    [self fail:parser];
+                    return;
+                }
+            }
+            break;
+
+        case AWSXMLDecoderFrameKindCapture: {
+            [self flushCapturedText:frame];
+            value = frame.node;
+            if ([frame.node count] == 0 || ([frame.node count] == 1 && frame.node[AWSXMLDictionaryTextKey])) {
+                id innerText = [frame.node awsxml_innerText];
+                if (innerText) {
+                    value = innerText;
+                    text = innerText;
+                }
+            }
+            if (frame.shape == nil) {
+                // Inside a captured subtree: replace the node with its text, as the tree does.
+                if (value != frame.node) {
+                    AWSXMLDecoderFrame *parent = self.frames[self.depth - 1];
+                    id existing = parent.node[elementName];
+                    if ([existing isKindOfClass:[NSArray class]]) {
+                        existing[[existing count] - 1] = value;
+                    } else {
+                        parent.node[elementName] = value;
+                    }
+                }
+                return;
+            }
+            if (frame.item) {
+                NSError *error = nil;
+                value = [AWSXMLParser parseMember:value rules:frame.shape.rules error:&error];
+                if (error) {
+                    [self fail:parser];
+                    return;
+                }
+            }
+            break;
+        }
+    }
+
+    if (!value) {
+        [self fail:parser];
+        return;
+    }
+
+    AWSXMLDecoderFrame *parent = self.frames[self.depth - 1];
+    if (frame.wrapperName) {
+        self.wrapped[frame.wrapperName] = value;
+    } else if (parent.kind == AWSXMLDecoderFrameKindList) {
+        [parent.items addObject:value];
+        if ([parent.items count] == 1) {
+            parent.firstItemText = text;
+        }
+    } else if (frame.member.accumulates) {
+        AWSXMLDecoderAccumulator *accumulator = parent.pending[frame.member.name];
+        [accumulator.values addObject:value];
+        if ([accumulator.values count] == 1) {
+            accumulator.firstText = frame.item ? text : nil;
+        }
+    } else {
+        parent.data[frame.member.name] = value;
+    }
+}
+
+@end
+
 
 @implementation AWSQueryParamBuilder
 
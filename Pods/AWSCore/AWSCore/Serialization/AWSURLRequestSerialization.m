@@ -22,6 +22,7 @@
 #import "AWSCategory.h"
 #import "AWSCocoaLumberjack.h"
 #import "AWSClientContext.h"
+#import "AWSSignature.h"
 
 @interface NSMutableURLRequest (AWSRequestSerializer)
 
@@ -37,9 +38,11 @@
         || [self.HTTPMethod isEqualToString:@"DELETE"]) {
         if (self.HTTPBody) {
             self.HTTPBody = nil;
+            [NSURLProtocol removePropertyForKey:AWSSignatureV2QueryParametersKey inRequest:self];
         }
         if (self.HTTPBodyStream) {
             self.HTTPBodyStream = nil;
+            [NSURLProtocol removePropertyForKey:AWSSignatureV4PayloadFileURLKey inRequest:self];
         }
     }
 }
@@ -330,6 +333,8 @@
                 if ([value isKindOfClass:[NSURL class]]) {
                     if ([value checkResourceIsReachableAndReturnError:&blockErr]) {
                         request.HTTPBodyStream = [NSInputStream inputStreamWithURL:value];
+                        // lets the signer hash the file without consuming the body stream
+                        [NSURLProtocol setProperty:value forKey:AWSSignatureV4PayloadFileURLKey inRequest:request];
                     } else {
                         //URL is not reachable, stop enumeration
                         isValid = NO;
@@ -456,33 +461,19 @@
 
 }
 
-- (void)processParameters:(NSDictionary *)parameters queryString:(NSMutableString *)queryString {
+- (void)processParameters:(NSDictionary *)parameters flattenedParameters:(NSMutableDictionary<NSString *, NSString *> *)flattenedParameters {
     for (NSString *key in parameters) {
         id obj = parameters[key];
 
         if ([obj isKindOfClass:[NSDictionary class]]) {
-            [self processParameters:obj queryString:queryString];
+            [self processParameters:obj flattenedParameters:flattenedParameters];
+        } else if ([obj isKindOfClass:[NSString class]]) {
+            flattenedParameters[key] = obj;
+        } else if ([obj isKindOfClass:[NSNumber class]]) {
+            flattenedParameters[key] = [obj stringValue];
         } else {
-
-            if ([queryString length] > 0) {
-                [queryString appendString:@"&"];
-            }
-
-            if ([obj isKindOfClass:[NSString class]]) {
-                [queryString appendString:[key aws_stringWithURLEncoding]];
-                [queryString appendString:@"="];
-                NSString *urlEncodedString = [obj aws_stringWithURLEncoding];
-                [queryString appendString:urlEncodedString];
-            } else if ([obj isKindOfClass:[NSNumber class]]) {
-                [queryString appendString:[key aws_stringWithURLEncoding]];
-                [queryString appendString:@"="];
-                [queryString appendString:[[obj stringValue] aws_stringWithURLEncoding]];
-            } else {
-                AWSDDLogError(@"key[%@] is invalid.", key);
-                [queryString appendString:[key aws_stringWithURLEncoding]];
-                [queryString appendString:@"="];
-                [queryString appendString:[[obj description]aws_stringWithURLEncoding]];
-            }
+            AWSDDLogError(@"key[%@] is invalid.", key);
+            flattenedParameters[key] = [obj description];
         }
     }
 
@@ -507,11 +498,23 @@
         return [AWSTask taskWithError:error];
     }
 
+    NSMutableDictionary<NSString *, NSString *> *flattenedParameters = [NSMutableDictionary new];
+    [self processParameters:formattedParams flattenedParameters:flattenedParameters];
+
     NSMutableString *queryString = [NSMutableString new];
-    [self processParameters:formattedParams queryString:queryString];
+    [flattenedParameters enumerateKeysAndObjectsUsingBlock:^(NSString *key, NSString *value, BOOL *stop) {
+        if ([queryString length] > 0) {
+            [queryString appendString:@"&"];
+        }
+        [queryString appendString:[key aws_stringWithURLEncoding]];
+        [queryString appendString:@"="];
+        [queryString appendString:[value aws_stringWithURLEncoding]];
+    }];
 
     if ([queryString length] > 0) {
         request.HTTPBody = [queryString dataUsingEncoding:NSUTF8StringEncoding];
+        // Lets the SigV2 signer canonicalize the parameters without parsing the body back.
+        [NSURLProtocol setProperty:flattenedParameters forKey:AWSSignatureV2QueryParametersKey inRequest:request];
     }
 
     //contruct additional headers
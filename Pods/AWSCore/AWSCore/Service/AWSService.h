@@ -93,6 +93,21 @@ typedef NS_ENUM(NSInteger, AWSServiceErrorType) {
 @property (nonatomic, strong, readonly) AWSEndpoint *endpoint;
 @property (nonatomic, readonly) NSString *userAgent;
 
+/**
+ Sign HTTPS requests with `UNSIGNED-PAYLOAD` instead of a hash of the body. This saves reading large uploads twice, once to hash them and once to send them, and relies on TLS for body integrity. Only honored by services that accept unsigned payloads, currently Amazon S3. The default is NO.
+ */
+@property (nonatomic, assign) BOOL allowsUnsignedPayload;
+
+/**
+ Payload bytes per signed chunk when a streamed upload is sent with `aws-chunked` encoding, between 64 KiB and 8 MiB. Larger chunks spend less time signing and less bandwidth on chunk headers; smaller ones hold less memory. 0, the default, uses 64 KiB. Only honored by Amazon S3.
+ */
+@property (nonatomic, assign) NSUInteger signedChunkSize;
+
+/**
+ Send streamed HTTPS uploads as `STREAMING-UNSIGNED-PAYLOAD-TRAILER`: only the request headers are signed, and a CRC32C of the body computed while it streams follows as an `x-amz-checksum-crc32c` trailer. This avoids hashing and signing every chunk while keeping the body verified. Takes precedence over `allowsUnsignedPayload` for streamed bodies. Only honored by Amazon S3, and only for requests sent with a body stream through the service client; uploads through presigned URLs, such as those of `AWSS3TransferUtility` and their multipart parts, are not checksummed. The default is NO.
+ */
+@property (nonatomic, assign) BOOL usesChecksumTrailer;
+
 + (NSString *)baseUserAgent;
 
 + (void)addGlobalUserAgentProductToken:(NSString *)productToken;
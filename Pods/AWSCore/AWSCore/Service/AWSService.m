@@ -209,6 +209,9 @@ static NSMutableArray *_globalUserAgentPrefixes = nil;
     configuration.credentialsProvider = self.credentialsProvider;
     configuration.userAgentProductTokens = self.userAgentProductTokens;
     configuration.endpoint = self.endpoint;
+    configuration.allowsUnsignedPayload = self.allowsUnsignedPayload;
+    configuration.signedChunkSize = self.signedChunkSize;
+    configuration.usesChecksumTrailer = self.usesChecksumTrailer;
     
     return configuration;
 }
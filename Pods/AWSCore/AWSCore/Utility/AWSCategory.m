@@ -19,6 +19,7 @@
 #import "AWSCocoaLumberjack.h"
 #import "AWSGZIP.h"
 #import "AWSMantle.h"
+#import "aws_uri.h"
 
 NSString *const AWSDateRFC822DateFormat1 = @"EEE, dd MMM yyyy HH:mm:ss z";
 NSString *const AWSDateISO8601DateFormat1 = @"yyyy-MM-dd'T'HH:mm:ss'Z'";
@@ -358,6 +359,68 @@ static NSTimeInterval _clockskew = 0.0;
 
 @end
 
+// Percent-encodes the UTF-8 bytes of string. With decodeFirst, existing escapes are decoded first
+// unless they are malformed or decode to bytes that are not UTF-8, as stringByRemovingPercentEncoding does.
+static NSString *AWSURLEncodedString(NSString *string, BOOL decodeFirst, aws_uri_encode_mode mode) {
+    // The length comes from the string, not strlen, so an embedded U+0000 is encoded as %00
+    // instead of ending the string.
+    size_t length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+    const char *bytes = CFStringGetCStringPtr((__bridge CFStringRef)string, kCFStringEncodingUTF8);
+    NSMutableData *utf8 = nil;
+    if (!bytes) {
+        utf8 = [NSMutableData dataWithLength:length];
+        NSUInteger usedLength = 0;
+        if (!utf8
+            || ![string getBytes:[utf8 mutableBytes]
+                       maxLength:length
+                      usedLength:&usedLength
+                        encoding:NSUTF8StringEncoding
+                         options:0
+                           range:NSMakeRange(0, [string length])
+                  remainingRange:NULL]
+            || usedLength != length) {
+            return length == 0 ? @"" : nil;
+        }
+        bytes = [utf8 bytes];
+    }
+
+    NSMutableData *decoded = nil;
+    if (decodeFirst && memchr(bytes, '%', length)) {
+        decoded = [NSMutableData dataWithLength:length];
+        size_t decodedLength = 0;
+        if (aws_uri_decode([decoded mutableBytes], &decodedLength, bytes, length) == 0
+            && [[NSString alloc] initWithBytesNoCopy:[decoded mutableBytes]
+                                              length:decodedLength
+                                            encoding:NSUTF8StringEncoding
+                                        freeWhenDone:NO]) {
+            bytes = [decoded bytes];
+            length = decodedLength;
+        } else {
+            decoded = nil;
+        }
+    }
+
+    // Most keys and paths need no escaping at all.
+    if (aws_uri_unescaped_length(bytes, length, mode) == length) {
+        return decoded ? [[NSString alloc] initWithBytes:bytes length:length encoding:NSASCIIStringEncoding] : [string copy];
+    }
+
+    char storage[1024];
+    char *encoded = storage;
+    if (length > sizeof(storage) / 3) {
+        encoded = malloc(3 * length);
+        if (!encoded) {
+            return nil;
+        }
+    }
+    size_t encodedLength = aws_uri_encode(encoded, bytes, length, mode);
+    NSString *result = [[NSString alloc] initWithBytes:encoded length:encodedLength encoding:NSASCIIStringEncoding];
+    if (encoded != storage) {
+        free(encoded);
+    }
+    return result;
+}
+
 @implementation NSString (AWS)
 
 + (NSString *)aws_base64md5FromData:(NSData *)data {
@@ -390,39 +453,21 @@ static NSTimeInterval _clockskew = 0.0;
 }
 
 - (NSString *)aws_stringWithURLEncoding {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)[self aws_decodeURLEncoding],
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,/?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSURLEncodedString(self, YES, AWS_URI_ENCODE_QUERY);
 }
 
 - (NSString *)aws_stringWithURLEncodingPath {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)[self aws_decodeURLEncoding],
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSURLEncodedString(self, YES, AWS_URI_ENCODE_PATH);
 }
 
 - (NSString *)aws_stringWithURLEncodingPathWithoutPriorDecoding {
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-    return (NSString *)CFBridgingRelease(CFURLCreateStringByAddingPercentEscapes(kCFAllocatorDefault,
-                                                                                 (__bridge CFStringRef)self,
-                                                                                 NULL,
-                                                                                 (CFStringRef)@"!*'\();:@&=+$,?%#[] ",
-                                                                                 kCFStringEncodingUTF8));
-#pragma clang diagnostic pop
+    return AWSURLEncodedString(self, NO, AWS_URI_ENCODE_PATH);
 }
 
 - (NSString *)aws_decodeURLEncoding {
+    if ([self rangeOfString:@"%" options:NSLiteralSearch].location == NSNotFound) {
+        return self;
+    }
     NSString *result = [self stringByRemovingPercentEncoding];
     return result?result:self;
 }
@@ -0,0 +1,202 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+
+#include "aws_uri.h"
+
+#include <string.h>
+
+#if !defined(AWS_URI_NO_ASM) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define AWS_URI_SSE2
+#include <emmintrin.h>
+#elif !defined(AWS_URI_NO_ASM) && defined(__aarch64__) && defined(__ARM_NEON)
+#define AWS_URI_NEON
+#include <arm_neon.h>
+#endif
+
+// "00" to "FF", so an escape is one two-byte copy
+static const char aws_uri_hex_pairs[512 + 1] =
+    "000102030405060708090A0B0C0D0E0F101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAFB0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECFD0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEFF0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+// aws_uri_unreserved[mode] has one bit per byte value that encodes to itself:
+// A-Z a-z 0-9 - . _ ~, plus '/' in path mode
+static const uint64_t aws_uri_unreserved[2][4] = {
+    { 0x03ff600000000000ULL, 0x47fffffe87fffffeULL, 0, 0 },
+    { 0x03ffe00000000000ULL, 0x47fffffe87fffffeULL, 0, 0 },
+};
+
+static inline int aws_uri_is_unreserved(const uint64_t *table, uint8_t c) {
+    return c < 128 && (int)((table[c >> 6] >> (c & 63)) & 1);
+}
+
+static inline int aws_uri_hex_value(uint8_t c) {
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    c |= 0x20;
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    }
+    return -1;
+}
+
+// Scanning
+
+#if defined(AWS_URI_SSE2)
+
+// Bytes are compared as signed, so anything >= 0x80 falls outside every range.
+static size_t aws_uri_unescaped_blocks(const uint8_t *data, size_t length, int keepSlash) {
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+    const __m128i beforeA = _mm_set1_epi8('a' - 1);
+    const __m128i afterZ = _mm_set1_epi8('z' + 1);
+    const __m128i before0 = _mm_set1_epi8('0' - 1);
+    const __m128i after9 = _mm_set1_epi8('9' + 1);
+    const __m128i dash = _mm_set1_epi8('-');
+    const __m128i dot = _mm_set1_epi8('.');
+    const __m128i underscore = _mm_set1_epi8('_');
+    const __m128i tilde = _mm_set1_epi8('~');
+    const __m128i slash = _mm_set1_epi8(keepSlash ? '/' : '-');  // '-' matches nothing new
+    size_t offset = 0;
+
+    for (; offset + 16 <= length; offset += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i *)(data + offset));
+        __m128i lower = _mm_or_si128(v, caseBit);
+        __m128i letter = _mm_and_si128(_mm_cmpgt_epi8(lower, beforeA), _mm_cmplt_epi8(lower, afterZ));
+        __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, before0), _mm_cmplt_epi8(v, after9));
+        __m128i mark = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, dash), _mm_cmpeq_epi8(v, dot)),
+                                    _mm_or_si128(_mm_cmpeq_epi8(v, underscore), _mm_cmpeq_epi8(v, tilde)));
+        mark = _mm_or_si128(mark, _mm_cmpeq_epi8(v, slash));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(letter, digit), mark));
+        if (mask != 0xffff) {
+            return offset + (size_t)__builtin_ctz(~mask);
+        }
+    }
+    return offset;
+}
+
+#elif defined(AWS_URI_NEON)
+
+static size_t aws_uri_unescaped_blocks(const uint8_t *data, size_t length, int keepSlash) {
+    const uint8x16_t caseBit = vdupq_n_u8(0x20);
+    const uint8x16_t slash = vdupq_n_u8(keepSlash ? '/' : '-');   // '-' matches nothing new
+    size_t offset = 0;
+
+    for (; offset + 16 <= length; offset += 16) {
+        uint8x16_t v = vld1q_u8(data + offset);
+        uint8x16_t lower = vorrq_u8(v, caseBit);
+        uint8x16_t letter = vandq_u8(vcgeq_u8(lower, vdupq_n_u8('a')), vcleq_u8(lower, vdupq_n_u8('z')));
+        uint8x16_t digit = vandq_u8(vcgeq_u8(v, vdupq_n_u8('0')), vcleq_u8(v, vdupq_n_u8('9')));
+        uint8x16_t mark = vorrq_u8(vorrq_u8(vceqq_u8(v, vdupq_n_u8('-')), vceqq_u8(v, vdupq_n_u8('.'))),
+                                   vorrq_u8(vceqq_u8(v, vdupq_n_u8('_')), vceqq_u8(v, vdupq_n_u8('~'))));
+        mark = vorrq_u8(mark, vceqq_u8(v, slash));
+        if (vminvq_u8(vorrq_u8(vorrq_u8(letter, digit), mark)) != 0xff) {
+            break;                                  // the table loop finds the byte
+        }
+    }
+    return offset;
+}
+
+#endif
+
+static inline size_t aws_uri_unescaped_run(const uint8_t *bytes, size_t length, const uint64_t *table, int keepSlash) {
+    size_t offset = 0;
+
+#if defined(AWS_URI_SSE2) || defined(AWS_URI_NEON)
+    if (length >= 16) {
+        offset = aws_uri_unescaped_blocks(bytes, length, keepSlash);
+    }
+#else
+    (void)keepSlash;
+#endif
+    while (offset < length && aws_uri_is_unreserved(table, bytes[offset])) {
+        offset++;
+    }
+    return offset;
+}
+
+size_t aws_uri_unescaped_length(const void *data, size_t length, aws_uri_encode_mode mode) {
+    return aws_uri_unescaped_run(data, length, aws_uri_unreserved[mode == AWS_URI_ENCODE_PATH], mode == AWS_URI_ENCODE_PATH);
+}
+
+// Encoding
+
+size_t aws_uri_encode(char *out, const void *data, size_t length, aws_uri_encode_mode mode) {
+    const uint8_t *bytes = data;
+    const int keepSlash = mode == AWS_URI_ENCODE_PATH;
+    const uint64_t *table = aws_uri_unreserved[keepSlash];
+    char *start = out;
+    size_t offset = 0;
+
+    while (offset < length) {
+        uint8_t c = bytes[offset];
+        if (!aws_uri_is_unreserved(table, c)) {
+            out[0] = '%';
+            memcpy(out + 1, aws_uri_hex_pairs + 2 * c, 2);
+            out += 3;
+        } else if (length - offset >= 16) {
+            // Long enough for the block scan and one copy to beat copying byte by byte
+            size_t run = aws_uri_unescaped_run(bytes + offset, length - offset, table, keepSlash);
+            memcpy(out, bytes + offset, run);
+            out += run;
+            offset += run;
+            continue;
+        } else {
+            *out++ = (char)c;
+        }
+        offset++;
+    }
+    return (size_t)(out - start);
+}
+
+// Decoding
+
+int aws_uri_decode(void *out, size_t *outLength, const void *data, size_t length) {
+    const uint8_t *bytes = data;
+    const uint8_t *end = bytes + length;
+    uint8_t *dst = out;
+
+    while (bytes < end) {
+        // memchr is already vectorised by the platform libc
+        const uint8_t *percent = memchr(bytes, '%', (size_t)(end - bytes));
+        size_t run = (size_t)((percent ? percent : end) - bytes);
+        if (dst != bytes) {
+            memmove(dst, bytes, run);
+        }
+        dst += run;
+        bytes += run;
+        if (!percent) {
+            break;
+        }
+        if (end - percent < 3) {
+            return -1;
+        }
+        int hi = aws_uri_hex_value(percent[1]);
+        int lo = aws_uri_hex_value(percent[2]);
+        if (hi < 0 || lo < 0) {
+            return -1;
+        }
+        *dst++ = (uint8_t)((hi << 4) | lo);
+        bytes = percent + 3;
+    }
+    *outLength = (size_t)(dst - (uint8_t *)out);
+    return 0;
+}
@@ -0,0 +1,60 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+
+#ifndef AWS_URI_H_
+#define AWS_URI_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * RFC 3986 percent-encoding over UTF-8 buffers.
+ *
+ * A-Z a-z 0-9 - . _ ~ pass through and every other byte becomes %XX with
+ * uppercase hex, the rule both request serialisation and SigV4 use. Path
+ * mode also passes '/'. Runs that need no escaping are found 16 bytes at a
+ * time with SSE2 on x86-64 and NEON on arm64, so a key or path without
+ * special characters is little more than a scan. Define AWS_URI_NO_ASM to
+ * build the table loop only.
+ */
+
+typedef enum {
+    AWS_URI_ENCODE_QUERY = 0,                   /* '/' is escaped */
+    AWS_URI_ENCODE_PATH  = 1                    /* '/' is kept */
+} aws_uri_encode_mode;
+
+/* number of leading bytes of data that encode to themselves */
+size_t aws_uri_unescaped_length(const void *data, size_t length, aws_uri_encode_mode mode);
+
+/* out = data percent-encoded; out holds at least 3 * length bytes. Returns the bytes written. */
+size_t aws_uri_encode(char *out, const void *data, size_t length, aws_uri_encode_mode mode);
+
+/*
+ * out = data with every %XX decoded; out holds at least length bytes and
+ * may be data. '+' is left alone. Returns 0, or -1 when a '%' is not
+ * followed by two hex digits.
+ */
+int aws_uri_decode(void *out, size_t *outLength, const void *data, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
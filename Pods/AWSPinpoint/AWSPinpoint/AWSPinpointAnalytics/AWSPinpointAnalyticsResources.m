@@ -15,6 +15,33 @@
 
 #import "AWSPinpointAnalyticsResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSSerialization.h>
+
+// Generated by sdk/compile_service_models.py from the AWS Event Recorder Service model. Do not edit.
+
+// Everything in the model but its operations and shapes.
+static const char AWSPinpointAnalyticsDefinition[] = "{\"metadata\":{\"apiVersion\":\"2014-06-30\",\"endpointPrefix\":\"mobileanalytics\",\"jsonVersion\":\"1.1\",\"serviceFullName\":\"AWS Event Recorder Service\",\"signatureVersion\":\"v4\",\"targetPrefix\":\"AmazonMobileAnalytics\",\"type\":\"json\"}}";
+
+static const AWSServiceModelEntry AWSPinpointAnalyticsOperations[] = {
+    {"PutEvents", "{\"errors\":[{\"error\":{\"httpStatusCode\":400},\"exception\":true,\"shape\":\"BadRequestException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/2014-06-05/events\",\"responseCode\":202},\"input\":{\"shape\":\"PutEventsInput\"},\"name\":\"PutEvents\"}"},
+};
+
+static const AWSServiceModelEntry AWSPinpointAnalyticsShapes[] = {
+    {"BadRequestException", "{\"error\":{\"httpStatusCode\":400},\"exception\":true,\"members\":{\"message\":{\"shape\":\"String\"}},\"type\":\"structure\"}"},
+    {"Double", "{\"type\":\"double\"}"},
+    {"Event", "{\"members\":{\"attributes\":{\"shape\":\"MapOfStringToString\"},\"eventType\":{\"shape\":\"String50Chars\"},\"metrics\":{\"shape\":\"MapOfStringToNumber\"},\"session\":{\"shape\":\"Session\"},\"timestamp\":{\"shape\":\"ISO8601Timestamp\"},\"version\":{\"shape\":\"String10Chars\"}},\"required\":[\"eventType\",\"timestamp\",\"session\"],\"type\":\"structure\"}"},
+    {"EventListDefinition", "{\"member\":{\"shape\":\"Event\"},\"type\":\"list\"}"},
+    {"ISO8601Timestamp", "{\"type\":\"string\"}"},
+    {"Long", "{\"type\":\"long\"}"},
+    {"MapOfStringToNumber", "{\"key\":{\"shape\":\"String50Chars\"},\"max\":50,\"min\":0,\"type\":\"map\",\"value\":{\"shape\":\"Double\"}}"},
+    {"MapOfStringToString", "{\"key\":{\"shape\":\"String50Chars\"},\"max\":50,\"min\":0,\"type\":\"map\",\"value\":{\"shape\":\"String0to1000Chars\"}}"},
+    {"PutEventsInput", "{\"members\":{\"clientContext\":{\"location\":\"header\",\"locationName\":\"x-amz-Client-Context\",\"shape\":\"String\"},\"events\":{\"shape\":\"EventListDefinition\"}},\"required\":[\"events\",\"clientContext\"],\"type\":\"structure\"}"},
+    {"Session", "{\"members\":{\"duration\":{\"shape\":\"Long\"},\"id\":{\"shape\":\"String50Chars\"},\"startTimestamp\":{\"shape\":\"ISO8601Timestamp\"},\"stopTimestamp\":{\"shape\":\"ISO8601Timestamp\"}},\"required\":[\"id\"],\"type\":\"structure\"}"},
+    {"String", "{\"type\":\"string\"}"},
+    {"String0to1000Chars", "{\"max\":1000,\"min\":0,\"type\":\"string\"}"},
+    {"String10Chars", "{\"max\":10,\"min\":1,\"type\":\"string\"}"},
+    {"String50Chars", "{\"max\":50,\"min\":1,\"type\":\"string\"}"},
+};
 
 @interface AWSPinpointAnalyticsResources ()
 
@@ -43,144 +70,25 @@
     if (self = [super init]) {
         //init method
         NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
-        if (_definitionDictionary == nil) {
+        NSDictionary *definitionDictionary = [NSJSONSerialization JSONObjectWithData:[NSData dataWithBytesNoCopy:(void *)AWSPinpointAnalyticsDefinition
+                                                                                                           length:sizeof(AWSPinpointAnalyticsDefinition) - 1
+                                                                                                     freeWhenDone:NO]
+                                                                               options:kNilOptions
+                                                                                 error:&error];
+        if (definitionDictionary == nil) {
             if (error) {
                 AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
             }
+        } else {
+            NSMutableDictionary *mutableDefinitionDictionary = [definitionDictionary mutableCopy];
+            mutableDefinitionDictionary[@"operations"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSPinpointAnalyticsOperations
+                                                                                                      count:sizeof(AWSPinpointAnalyticsOperations) / sizeof(AWSPinpointAnalyticsOperations[0])];
+            mutableDefinitionDictionary[@"shapes"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSPinpointAnalyticsShapes
+                                                                                                  count:sizeof(AWSPinpointAnalyticsShapes) / sizeof(AWSPinpointAnalyticsShapes[0])];
+            _definitionDictionary = [mutableDefinitionDictionary copy];
         }
     }
     return self;
 }
 
-- (NSString *)definitionString {
-    return @"{\
-  \"metadata\":{\
-    \"apiVersion\":\"2014-06-30\",\
-    \"endpointPrefix\":\"mobileanalytics\",\
-    \"jsonVersion\":\"1.1\",\
-    \"serviceFullName\":\"AWS Event Recorder Service\",\
-    \"signatureVersion\":\"v4\",\
-    \"targetPrefix\":\"AmazonMobileAnalytics\",\
-    \"type\":\"json\"\
-  },\
-  \"documentation\":\"A service which is used to record Amazon Mobile Analytics events\",\
-  \"operations\":{\
-    \"PutEvents\":{\
-      \"name\":\"PutEvents\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/2014-06-05/events\",\
-        \"responseCode\":202\
-      },\
-      \"input\":{\
-        \"shape\":\"PutEventsInput\",\
-        \"documentation\":\"Describes a set of events\"\
-      },\
-      \"errors\":[\
-        {\
-          \"shape\":\"BadRequestException\",\
-          \"error\":{\"httpStatusCode\":400},\
-          \"exception\":true\
-        }\
-      ],\
-      \"documentation\":\"Record a batch of events\"\
-    }\
-  },\
-  \"shapes\":{\
-    \"BadRequestException\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"message\":{\"shape\":\"String\"}\
-      },\
-      \"error\":{\"httpStatusCode\":400},\
-      \"exception\":true\
-    },\
-    \"Double\":{\"type\":\"double\"},\
-    \"Event\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"eventType\",\
-        \"timestamp\",\
-        \"session\"\
-      ],\
-      \"members\":{\
-        \"eventType\":{\"shape\":\"String50Chars\"},\
-        \"timestamp\":{\"shape\":\"ISO8601Timestamp\"},\
-        \"session\":{\"shape\":\"Session\"},\
-        \"version\":{\"shape\":\"String10Chars\"},\
-        \"attributes\":{\"shape\":\"MapOfStringToString\"},\
-        \"metrics\":{\"shape\":\"MapOfStringToNumber\"}\
-      },\
-      \"documentation\":\"Represents a single event that happened on a client device. Attributes and metrics are optional.\"\
-    },\
-    \"EventListDefinition\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Event\"}\
-    },\
-    \"ISO8601Timestamp\":{\"type\":\"string\"},\
-    \"Long\":{\"type\":\"long\"},\
-    \"MapOfStringToNumber\":{\
-      \"type\":\"map\",\
-      \"key\":{\"shape\":\"String50Chars\"},\
-      \"value\":{\"shape\":\"Double\"},\
-      \"min\":0,\
-      \"max\":50\
-    },\
-    \"MapOfStringToString\":{\
-      \"type\":\"map\",\
-      \"key\":{\"shape\":\"String50Chars\"},\
-      \"value\":{\"shape\":\"String0to1000Chars\"},\
-      \"min\":0,\
-      \"max\":50\
-    },\
-    \"PutEventsInput\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"events\",\
-        \"clientContext\"\
-      ],\
-      \"members\":{\
-        \"events\":{\"shape\":\"EventListDefinition\"},\
-        \"clientContext\":{\
-          \"shape\":\"String\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-Client-Context\"\
-        }\
-      },\
-      \"documentation\":\"Describes a set of events\"\
-    },\
-    \"Session\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"id\"],\
-      \"members\":{\
-        \"id\":{\"shape\":\"String50Chars\"},\
-        \"duration\":{\"shape\":\"Long\"},\
-        \"startTimestamp\":{\"shape\":\"ISO8601Timestamp\"},\
-        \"stopTimestamp\":{\"shape\":\"ISO8601Timestamp\"}\
-      }\
-    },\
-    \"String\":{\"type\":\"string\"},\
-    \"String0to1000Chars\":{\
-      \"type\":\"string\",\
-      \"min\":0,\
-      \"max\":1000\
-    },\
-    \"String10Chars\":{\
-      \"type\":\"string\",\
-      \"min\":1,\
-      \"max\":10\
-    },\
-    \"String50Chars\":{\
-      \"type\":\"string\",\
-      \"min\":1,\
-      \"max\":50\
-    }\
-  }\
-}\
-";
-}
-
 @end
@@ -15,6 +15,248 @@
 
 #import "AWSPinpointTargetingResources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSSerialization.h>
+
+// Generated by sdk/compile_service_models.py from the Amazon Pinpoint model. Do not edit.
+
+// Everything in the model but its operations and shapes.
+static const char AWSPinpointTargetingDefinition[] = "{\"metadata\":{\"apiVersion\":\"2016-12-01\",\"endpointPrefix\":\"pinpoint\",\"jsonVersion\":\"1.1\",\"protocol\":\"rest-json\",\"serviceFullName\":\"Amazon Pinpoint\",\"signatureVersion\":\"v4\",\"signingName\":\"mobiletargeting\"}}";
+
+static const AWSServiceModelEntry AWSPinpointTargetingOperations[] = {
+    {"CreateCampaign", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/v1/apps/{application-id}/campaigns\",\"responseCode\":201},\"input\":{\"shape\":\"CreateCampaignRequest\"},\"name\":\"CreateCampaign\",\"output\":{\"shape\":\"CreateCampaignResponse\"}}"},
+    {"CreateImportJob", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/v1/apps/{application-id}/jobs/import\",\"responseCode\":201},\"input\":{\"shape\":\"CreateImportJobRequest\"},\"name\":\"CreateImportJob\",\"output\":{\"shape\":\"CreateImportJobResponse\"}}"},
+    {"CreateSegment", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/v1/apps/{application-id}/segments\",\"responseCode\":201},\"input\":{\"shape\":\"CreateSegmentRequest\"},\"name\":\"CreateSegment\",\"output\":{\"shape\":\"CreateSegmentResponse\"}}"},
+    {"DeleteApnsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteApnsChannelRequest\"},\"name\":\"DeleteApnsChannel\",\"output\":{\"shape\":\"DeleteApnsChannelResponse\"}}"},
+    {"DeleteApnsSandboxChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns_sandbox\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteApnsSandboxChannelRequest\"},\"name\":\"DeleteApnsSandboxChannel\",\"output\":{\"shape\":\"DeleteApnsSandboxChannelResponse\"}}"},
+    {"DeleteCampaign", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteCampaignRequest\"},\"name\":\"DeleteCampaign\",\"output\":{\"shape\":\"DeleteCampaignResponse\"}}"},
+    {"DeleteEmailChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/channels/email\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteEmailChannelRequest\"},\"name\":\"DeleteEmailChannel\",\"output\":{\"shape\":\"DeleteEmailChannelResponse\"}}"},
+    {"DeleteEventStream", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/eventstream\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteEventStreamRequest\"},\"name\":\"DeleteEventStream\",\"output\":{\"shape\":\"DeleteEventStreamResponse\"}}"},
+    {"DeleteGcmChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/channels/gcm\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteGcmChannelRequest\"},\"name\":\"DeleteGcmChannel\",\"output\":{\"shape\":\"DeleteGcmChannelResponse\"}}"},
+    {"DeleteSegment", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteSegmentRequest\"},\"name\":\"DeleteSegment\",\"output\":{\"shape\":\"DeleteSegmentResponse\"}}"},
+    {"DeleteSmsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/v1/apps/{application-id}/channels/sms\",\"responseCode\":200},\"input\":{\"shape\":\"DeleteSmsChannelRequest\"},\"name\":\"DeleteSmsChannel\",\"output\":{\"shape\":\"DeleteSmsChannelResponse\"}}"},
+    {"GetApnsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns\",\"responseCode\":200},\"input\":{\"shape\":\"GetApnsChannelRequest\"},\"name\":\"GetApnsChannel\",\"output\":{\"shape\":\"GetApnsChannelResponse\"}}"},
+    {"GetApnsSandboxChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns_sandbox\",\"responseCode\":200},\"input\":{\"shape\":\"GetApnsSandboxChannelRequest\"},\"name\":\"GetApnsSandboxChannel\",\"output\":{\"shape\":\"GetApnsSandboxChannelResponse\"}}"},
+    {"GetApplicationSettings", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/settings\",\"responseCode\":200},\"input\":{\"shape\":\"GetApplicationSettingsRequest\"},\"name\":\"GetApplicationSettings\",\"output\":{\"shape\":\"GetApplicationSettingsResponse\"}}"},
+    {"GetCampaign", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}\",\"responseCode\":200},\"input\":{\"shape\":\"GetCampaignRequest\"},\"name\":\"GetCampaign\",\"output\":{\"shape\":\"GetCampaignResponse\"}}"},
+    {"GetCampaignActivities", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}/activities\",\"responseCode\":200},\"input\":{\"shape\":\"GetCampaignActivitiesRequest\"},\"name\":\"GetCampaignActivities\",\"output\":{\"shape\":\"GetCampaignActivitiesResponse\"}}"},
+    {"GetCampaignVersion", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}/versions/{version}\",\"responseCode\":200},\"input\":{\"shape\":\"GetCampaignVersionRequest\"},\"name\":\"GetCampaignVersion\",\"output\":{\"shape\":\"GetCampaignVersionResponse\"}}"},
+    {"GetCampaignVersions", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}/versions\",\"responseCode\":200},\"input\":{\"shape\":\"GetCampaignVersionsRequest\"},\"name\":\"GetCampaignVersions\",\"output\":{\"shape\":\"GetCampaignVersionsResponse\"}}"},
+    {"GetCampaigns", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/campaigns\",\"responseCode\":200},\"input\":{\"shape\":\"GetCampaignsRequest\"},\"name\":\"GetCampaigns\",\"output\":{\"shape\":\"GetCampaignsResponse\"}}"},
+    {"GetEmailChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/channels/email\",\"responseCode\":200},\"input\":{\"shape\":\"GetEmailChannelRequest\"},\"name\":\"GetEmailChannel\",\"output\":{\"shape\":\"GetEmailChannelResponse\"}}"},
+    {"GetEndpoint", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/endpoints/{endpoint-id}\",\"responseCode\":200},\"input\":{\"shape\":\"GetEndpointRequest\"},\"name\":\"GetEndpoint\",\"output\":{\"shape\":\"GetEndpointResponse\"}}"},
+    {"GetEventStream", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/eventstream\",\"responseCode\":200},\"input\":{\"shape\":\"GetEventStreamRequest\"},\"name\":\"GetEventStream\",\"output\":{\"shape\":\"GetEventStreamResponse\"}}"},
+    {"GetGcmChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/channels/gcm\",\"responseCode\":200},\"input\":{\"shape\":\"GetGcmChannelRequest\"},\"name\":\"GetGcmChannel\",\"output\":{\"shape\":\"GetGcmChannelResponse\"}}"},
+    {"GetImportJob", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/jobs/import/{job-id}\",\"responseCode\":200},\"input\":{\"shape\":\"GetImportJobRequest\"},\"name\":\"GetImportJob\",\"output\":{\"shape\":\"GetImportJobResponse\"}}"},
+    {"GetImportJobs", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/jobs/import\",\"responseCode\":200},\"input\":{\"shape\":\"GetImportJobsRequest\"},\"name\":\"GetImportJobs\",\"output\":{\"shape\":\"GetImportJobsResponse\"}}"},
+    {"GetSegment", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}\",\"responseCode\":200},\"input\":{\"shape\":\"GetSegmentRequest\"},\"name\":\"GetSegment\",\"output\":{\"shape\":\"GetSegmentResponse\"}}"},
+    {"GetSegmentImportJobs", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}/jobs/import\",\"responseCode\":200},\"input\":{\"shape\":\"GetSegmentImportJobsRequest\"},\"name\":\"GetSegmentImportJobs\",\"output\":{\"shape\":\"GetSegmentImportJobsResponse\"}}"},
+    {"GetSegmentVersion", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}/versions/{version}\",\"responseCode\":200},\"input\":{\"shape\":\"GetSegmentVersionRequest\"},\"name\":\"GetSegmentVersion\",\"output\":{\"shape\":\"GetSegmentVersionResponse\"}}"},
+    {"GetSegmentVersions", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}/versions\",\"responseCode\":200},\"input\":{\"shape\":\"GetSegmentVersionsRequest\"},\"name\":\"GetSegmentVersions\",\"output\":{\"shape\":\"GetSegmentVersionsResponse\"}}"},
+    {"GetSegments", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/segments\",\"responseCode\":200},\"input\":{\"shape\":\"GetSegmentsRequest\"},\"name\":\"GetSegments\",\"output\":{\"shape\":\"GetSegmentsResponse\"}}"},
+    {"GetSmsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/v1/apps/{application-id}/channels/sms\",\"responseCode\":200},\"input\":{\"shape\":\"GetSmsChannelRequest\"},\"name\":\"GetSmsChannel\",\"output\":{\"shape\":\"GetSmsChannelResponse\"}}"},
+    {"PutEventStream", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/v1/apps/{application-id}/eventstream\",\"responseCode\":200},\"input\":{\"shape\":\"PutEventStreamRequest\"},\"name\":\"PutEventStream\",\"output\":{\"shape\":\"PutEventStreamResponse\"}}"},
+    {"SendMessages", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/v1/apps/{application-id}/messages\",\"responseCode\":200},\"input\":{\"shape\":\"SendMessagesRequest\"},\"name\":\"SendMessages\",\"output\":{\"shape\":\"SendMessagesResponse\"}}"},
+    {"UpdateApnsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateApnsChannelRequest\"},\"name\":\"UpdateApnsChannel\",\"output\":{\"shape\":\"UpdateApnsChannelResponse\"}}"},
+    {"UpdateApnsSandboxChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/channels/apns_sandbox\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateApnsSandboxChannelRequest\"},\"name\":\"UpdateApnsSandboxChannel\",\"output\":{\"shape\":\"UpdateApnsSandboxChannelResponse\"}}"},
+    {"UpdateApplicationSettings", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/settings\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateApplicationSettingsRequest\"},\"name\":\"UpdateApplicationSettings\",\"output\":{\"shape\":\"UpdateApplicationSettingsResponse\"}}"},
+    {"UpdateCampaign", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/campaigns/{campaign-id}\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateCampaignRequest\"},\"name\":\"UpdateCampaign\",\"output\":{\"shape\":\"UpdateCampaignResponse\"}}"},
+    {"UpdateEmailChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/channels/email\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateEmailChannelRequest\"},\"name\":\"UpdateEmailChannel\",\"output\":{\"shape\":\"UpdateEmailChannelResponse\"}}"},
+    {"UpdateEndpoint", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/endpoints/{endpoint-id}\",\"responseCode\":202},\"input\":{\"shape\":\"UpdateEndpointRequest\"},\"name\":\"UpdateEndpoint\",\"output\":{\"shape\":\"UpdateEndpointResponse\"}}"},
+    {"UpdateEndpointsBatch", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/endpoints\",\"responseCode\":202},\"input\":{\"shape\":\"UpdateEndpointsBatchRequest\"},\"name\":\"UpdateEndpointsBatch\",\"output\":{\"shape\":\"UpdateEndpointsBatchResponse\"}}"},
+    {"UpdateGcmChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/channels/gcm\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateGcmChannelRequest\"},\"name\":\"UpdateGcmChannel\",\"output\":{\"shape\":\"UpdateGcmChannelResponse\"}}"},
+    {"UpdateSegment", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/segments/{segment-id}\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateSegmentRequest\"},\"name\":\"UpdateSegment\",\"output\":{\"shape\":\"UpdateSegmentResponse\"}}"},
+    {"UpdateSmsChannel", "{\"errors\":[{\"shape\":\"BadRequestException\"},{\"shape\":\"InternalServerErrorException\"},{\"shape\":\"ForbiddenException\"},{\"shape\":\"NotFoundException\"},{\"shape\":\"MethodNotAllowedException\"},{\"shape\":\"TooManyRequestsException\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/v1/apps/{application-id}/channels/sms\",\"responseCode\":200},\"input\":{\"shape\":\"UpdateSmsChannelRequest\"},\"name\":\"UpdateSmsChannel\",\"output\":{\"shape\":\"UpdateSmsChannelResponse\"}}"},
+};
+
+static const AWSServiceModelEntry AWSPinpointTargetingShapes[] = {
+    {"APNSChannelRequest", "{\"members\":{\"Certificate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"PrivateKey\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"APNSChannelResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"Id\":{\"shape\":\"__string\"},\"IsArchived\":{\"shape\":\"__boolean\"},\"LastModifiedBy\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"APNSMessage", "{\"members\":{\"Action\":{\"shape\":\"Action\"},\"Badge\":{\"shape\":\"__integer\"},\"Body\":{\"shape\":\"__string\"},\"Category\":{\"shape\":\"__string\"},\"Data\":{\"shape\":\"MapOf__string\"},\"MediaUrl\":{\"shape\":\"__string\"},\"RawContent\":{\"shape\":\"__string\"},\"SilentPush\":{\"shape\":\"__boolean\"},\"Sound\":{\"shape\":\"__string\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"},\"ThreadId\":{\"shape\":\"__string\"},\"Title\":{\"shape\":\"__string\"},\"Url\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"APNSSandboxChannelRequest", "{\"members\":{\"Certificate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"PrivateKey\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"APNSSandboxChannelResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"Id\":{\"shape\":\"__string\"},\"IsArchived\":{\"shape\":\"__boolean\"},\"LastModifiedBy\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"Action", "{\"enum\":[\"OPEN_APP\",\"DEEP_LINK\",\"URL\"],\"type\":\"string\"}"},
+    {"ActivitiesResponse", "{\"members\":{\"Item\":{\"shape\":\"ListOfActivityResponse\"}},\"type\":\"structure\"}"},
+    {"ActivityResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CampaignId\":{\"shape\":\"__string\"},\"End\":{\"shape\":\"__string\"},\"Id\":{\"shape\":\"__string\"},\"Result\":{\"shape\":\"__string\"},\"ScheduledStart\":{\"shape\":\"__string\"},\"Start\":{\"shape\":\"__string\"},\"State\":{\"shape\":\"__string\"},\"SuccessfulEndpointCount\":{\"shape\":\"__integer\"},\"TimezonesCompletedCount\":{\"shape\":\"__integer\"},\"TimezonesTotalCount\":{\"shape\":\"__integer\"},\"TotalEndpointCount\":{\"shape\":\"__integer\"},\"TreatmentId\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"AddressConfiguration", "{\"members\":{\"BodyOverride\":{\"shape\":\"__string\"},\"ChannelType\":{\"shape\":\"ChannelType\"},\"Context\":{\"shape\":\"MapOf__string\"},\"RawContent\":{\"shape\":\"__string\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"},\"TitleOverride\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ApplicationSettingsResource", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Limits\":{\"shape\":\"CampaignLimits\"},\"QuietTime\":{\"shape\":\"QuietTime\"}},\"type\":\"structure\"}"},
+    {"AttributeDimension", "{\"members\":{\"AttributeType\":{\"shape\":\"AttributeType\"},\"Values\":{\"shape\":\"ListOf__string\"}},\"type\":\"structure\"}"},
+    {"AttributeType", "{\"enum\":[\"INCLUSIVE\",\"EXCLUSIVE\"],\"type\":\"string\"}"},
+    {"BadRequestException", "{\"error\":{\"httpStatusCode\":400},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"CampaignEmailMessage", "{\"members\":{\"Body\":{\"shape\":\"__string\"},\"HtmlBody\":{\"shape\":\"__string\"},\"Title\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"CampaignLimits", "{\"members\":{\"Daily\":{\"shape\":\"__integer\"},\"Total\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"CampaignResponse", "{\"members\":{\"AdditionalTreatments\":{\"shape\":\"ListOfTreatmentResource\"},\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"DefaultState\":{\"shape\":\"CampaignState\"},\"Description\":{\"shape\":\"__string\"},\"HoldoutPercent\":{\"shape\":\"__integer\"},\"Id\":{\"shape\":\"__string\"},\"IsPaused\":{\"shape\":\"__boolean\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Limits\":{\"shape\":\"CampaignLimits\"},\"MessageConfiguration\":{\"shape\":\"MessageConfiguration\"},\"Name\":{\"shape\":\"__string\"},\"Schedule\":{\"shape\":\"Schedule\"},\"SegmentId\":{\"shape\":\"__string\"},\"SegmentVersion\":{\"shape\":\"__integer\"},\"State\":{\"shape\":\"CampaignState\"},\"TreatmentDescription\":{\"shape\":\"__string\"},\"TreatmentName\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"CampaignSmsMessage", "{\"members\":{\"Body\":{\"shape\":\"__string\"},\"MessageType\":{\"shape\":\"MessageType\"},\"SenderId\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"CampaignState", "{\"members\":{\"CampaignStatus\":{\"shape\":\"CampaignStatus\"}},\"type\":\"structure\"}"},
+    {"CampaignStatus", "{\"enum\":[\"SCHEDULED\",\"EXECUTING\",\"PENDING_NEXT_RUN\",\"COMPLETED\",\"PAUSED\"],\"type\":\"string\"}"},
+    {"CampaignsResponse", "{\"members\":{\"Item\":{\"shape\":\"ListOfCampaignResponse\"},\"NextToken\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ChannelType", "{\"enum\":[\"GCM\",\"APNS\",\"APNS_SANDBOX\",\"ADM\",\"SMS\",\"EMAIL\"],\"type\":\"string\"}"},
+    {"CreateCampaignRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"WriteCampaignRequest\":{\"shape\":\"WriteCampaignRequest\"}},\"payload\":\"WriteCampaignRequest\",\"required\":[\"ApplicationId\",\"WriteCampaignRequest\"],\"type\":\"structure\"}"},
+    {"CreateCampaignResponse", "{\"members\":{\"CampaignResponse\":{\"shape\":\"CampaignResponse\"}},\"payload\":\"CampaignResponse\",\"required\":[\"CampaignResponse\"],\"type\":\"structure\"}"},
+    {"CreateImportJobRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"ImportJobRequest\":{\"shape\":\"ImportJobRequest\"}},\"payload\":\"ImportJobRequest\",\"required\":[\"ApplicationId\",\"ImportJobRequest\"],\"type\":\"structure\"}"},
+    {"CreateImportJobResponse", "{\"members\":{\"ImportJobResponse\":{\"shape\":\"ImportJobResponse\"}},\"payload\":\"ImportJobResponse\",\"required\":[\"ImportJobResponse\"],\"type\":\"structure\"}"},
+    {"CreateSegmentRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"WriteSegmentRequest\":{\"shape\":\"WriteSegmentRequest\"}},\"payload\":\"WriteSegmentRequest\",\"required\":[\"ApplicationId\",\"WriteSegmentRequest\"],\"type\":\"structure\"}"},
+    {"CreateSegmentResponse", "{\"members\":{\"SegmentResponse\":{\"shape\":\"SegmentResponse\"}},\"payload\":\"SegmentResponse\",\"required\":[\"SegmentResponse\"],\"type\":\"structure\"}"},
+    {"DefaultMessage", "{\"members\":{\"Body\":{\"shape\":\"__string\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"}},\"type\":\"structure\"}"},
+    {"DefaultPushNotificationMessage", "{\"members\":{\"Action\":{\"shape\":\"Action\"},\"Body\":{\"shape\":\"__string\"},\"Data\":{\"shape\":\"MapOf__string\"},\"SilentPush\":{\"shape\":\"__boolean\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"},\"Title\":{\"shape\":\"__string\"},\"Url\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"DeleteApnsChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteApnsChannelResponse", "{\"members\":{\"APNSChannelResponse\":{\"shape\":\"APNSChannelResponse\"}},\"payload\":\"APNSChannelResponse\",\"required\":[\"APNSChannelResponse\"],\"type\":\"structure\"}"},
+    {"DeleteApnsSandboxChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteApnsSandboxChannelResponse", "{\"members\":{\"APNSSandboxChannelResponse\":{\"shape\":\"APNSSandboxChannelResponse\"}},\"payload\":\"APNSSandboxChannelResponse\",\"required\":[\"APNSSandboxChannelResponse\"],\"type\":\"structure\"}"},
+    {"DeleteCampaignRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"}},\"required\":[\"CampaignId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteCampaignResponse", "{\"members\":{\"CampaignResponse\":{\"shape\":\"CampaignResponse\"}},\"payload\":\"CampaignResponse\",\"required\":[\"CampaignResponse\"],\"type\":\"structure\"}"},
+    {"DeleteEmailChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteEmailChannelResponse", "{\"members\":{\"EmailChannelResponse\":{\"shape\":\"EmailChannelResponse\"}},\"payload\":\"EmailChannelResponse\",\"required\":[\"EmailChannelResponse\"],\"type\":\"structure\"}"},
+    {"DeleteEventStreamRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteEventStreamResponse", "{\"members\":{\"EventStream\":{\"shape\":\"EventStream\"}},\"payload\":\"EventStream\",\"required\":[\"EventStream\"],\"type\":\"structure\"}"},
+    {"DeleteGcmChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteGcmChannelResponse", "{\"members\":{\"GCMChannelResponse\":{\"shape\":\"GCMChannelResponse\"}},\"payload\":\"GCMChannelResponse\",\"required\":[\"GCMChannelResponse\"],\"type\":\"structure\"}"},
+    {"DeleteSegmentRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"}},\"required\":[\"SegmentId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteSegmentResponse", "{\"members\":{\"SegmentResponse\":{\"shape\":\"SegmentResponse\"}},\"payload\":\"SegmentResponse\",\"required\":[\"SegmentResponse\"],\"type\":\"structure\"}"},
+    {"DeleteSmsChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"DeleteSmsChannelResponse", "{\"members\":{\"SMSChannelResponse\":{\"shape\":\"SMSChannelResponse\"}},\"payload\":\"SMSChannelResponse\",\"required\":[\"SMSChannelResponse\"],\"type\":\"structure\"}"},
+    {"DeliveryStatus", "{\"enum\":[\"SUCCESSFUL\",\"THROTTLED\",\"TEMPORARY_FAILURE\",\"PERMANENT_FAILURE\"],\"type\":\"string\"}"},
+    {"DimensionType", "{\"enum\":[\"INCLUSIVE\",\"EXCLUSIVE\"],\"type\":\"string\"}"},
+    {"DirectMessageConfiguration", "{\"members\":{\"APNSMessage\":{\"shape\":\"APNSMessage\"},\"DefaultMessage\":{\"shape\":\"DefaultMessage\"},\"DefaultPushNotificationMessage\":{\"shape\":\"DefaultPushNotificationMessage\"},\"GCMMessage\":{\"shape\":\"GCMMessage\"},\"SMSMessage\":{\"shape\":\"SMSMessage\"}},\"type\":\"structure\"}"},
+    {"Duration", "{\"enum\":[\"HR_24\",\"DAY_7\",\"DAY_14\",\"DAY_30\"],\"type\":\"string\"}"},
+    {"EmailChannelRequest", "{\"members\":{\"Enabled\":{\"shape\":\"__boolean\"},\"FromAddress\":{\"shape\":\"__string\"},\"Identity\":{\"shape\":\"__string\"},\"RoleArn\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"EmailChannelResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"FromAddress\":{\"shape\":\"__string\"},\"Id\":{\"shape\":\"__string\"},\"Identity\":{\"shape\":\"__string\"},\"IsArchived\":{\"shape\":\"__boolean\"},\"LastModifiedBy\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"RoleArn\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"EndpointBatchItem", "{\"members\":{\"Address\":{\"shape\":\"__string\"},\"Attributes\":{\"shape\":\"MapOfListOf__string\"},\"ChannelType\":{\"shape\":\"ChannelType\"},\"Demographic\":{\"shape\":\"EndpointDemographic\"},\"EffectiveDate\":{\"shape\":\"__string\"},\"EndpointStatus\":{\"shape\":\"__string\"},\"Id\":{\"shape\":\"__string\"},\"Location\":{\"shape\":\"EndpointLocation\"},\"Metrics\":{\"shape\":\"MapOf__double\"},\"OptOut\":{\"shape\":\"__string\"},\"RequestId\":{\"shape\":\"__string\"},\"User\":{\"shape\":\"EndpointUser\"}},\"type\":\"structure\"}"},
+    {"EndpointBatchRequest", "{\"members\":{\"Item\":{\"shape\":\"ListOfEndpointBatchItem\"}},\"type\":\"structure\"}"},
+    {"EndpointDemographic", "{\"members\":{\"AppVersion\":{\"shape\":\"__string\"},\"Locale\":{\"shape\":\"__string\"},\"Make\":{\"shape\":\"__string\"},\"Model\":{\"shape\":\"__string\"},\"ModelVersion\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"PlatformVersion\":{\"shape\":\"__string\"},\"Timezone\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"EndpointLocation", "{\"members\":{\"City\":{\"shape\":\"__string\"},\"Country\":{\"shape\":\"__string\"},\"Latitude\":{\"shape\":\"__double\"},\"Longitude\":{\"shape\":\"__double\"},\"PostalCode\":{\"shape\":\"__string\"},\"Region\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"EndpointRequest", "{\"members\":{\"Address\":{\"shape\":\"__string\"},\"Attributes\":{\"shape\":\"MapOfListOf__string\"},\"ChannelType\":{\"shape\":\"ChannelType\"},\"Demographic\":{\"shape\":\"EndpointDemographic\"},\"EffectiveDate\":{\"shape\":\"__string\"},\"EndpointStatus\":{\"shape\":\"__string\"},\"Location\":{\"shape\":\"EndpointLocation\"},\"Metrics\":{\"shape\":\"MapOf__double\"},\"OptOut\":{\"shape\":\"__string\"},\"RequestId\":{\"shape\":\"__string\"},\"User\":{\"shape\":\"EndpointUser\"}},\"type\":\"structure\"}"},
+    {"EndpointResponse", "{\"members\":{\"Address\":{\"shape\":\"__string\"},\"ApplicationId\":{\"shape\":\"__string\"},\"Attributes\":{\"shape\":\"MapOfListOf__string\"},\"ChannelType\":{\"shape\":\"ChannelType\"},\"CohortId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Demographic\":{\"shape\":\"EndpointDemographic\"},\"EffectiveDate\":{\"shape\":\"__string\"},\"EndpointStatus\":{\"shape\":\"__string\"},\"Id\":{\"shape\":\"__string\"},\"Location\":{\"shape\":\"EndpointLocation\"},\"Metrics\":{\"shape\":\"MapOf__double\"},\"OptOut\":{\"shape\":\"__string\"},\"RequestId\":{\"shape\":\"__string\"},\"ShardId\":{\"shape\":\"__string\"},\"User\":{\"shape\":\"EndpointUser\"}},\"type\":\"structure\"}"},
+    {"EndpointUser", "{\"members\":{\"UserAttributes\":{\"shape\":\"MapOfListOf__string\"},\"UserId\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"EventStream", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"DestinationStreamArn\":{\"shape\":\"__string\"},\"ExternalId\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"LastUpdatedBy\":{\"shape\":\"__string\"},\"RoleArn\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ForbiddenException", "{\"error\":{\"httpStatusCode\":403},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"Format", "{\"enum\":[\"CSV\",\"JSON\"],\"type\":\"string\"}"},
+    {"Frequency", "{\"enum\":[\"ONCE\",\"HOURLY\",\"DAILY\",\"WEEKLY\",\"MONTHLY\"],\"type\":\"string\"}"},
+    {"GCMChannelRequest", "{\"members\":{\"ApiKey\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"}},\"type\":\"structure\"}"},
+    {"GCMChannelResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Credential\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"Id\":{\"shape\":\"__string\"},\"IsArchived\":{\"shape\":\"__boolean\"},\"LastModifiedBy\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"GCMMessage", "{\"members\":{\"Action\":{\"shape\":\"Action\"},\"Body\":{\"shape\":\"__string\"},\"CollapseKey\":{\"shape\":\"__string\"},\"Data\":{\"shape\":\"MapOf__string\"},\"IconReference\":{\"shape\":\"__string\"},\"ImageIconUrl\":{\"shape\":\"__string\"},\"ImageUrl\":{\"shape\":\"__string\"},\"RawContent\":{\"shape\":\"__string\"},\"RestrictedPackageName\":{\"shape\":\"__string\"},\"SilentPush\":{\"shape\":\"__boolean\"},\"SmallImageIconUrl\":{\"shape\":\"__string\"},\"Sound\":{\"shape\":\"__string\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"},\"Title\":{\"shape\":\"__string\"},\"Url\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"GetApnsChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetApnsChannelResponse", "{\"members\":{\"APNSChannelResponse\":{\"shape\":\"APNSChannelResponse\"}},\"payload\":\"APNSChannelResponse\",\"required\":[\"APNSChannelResponse\"],\"type\":\"structure\"}"},
+    {"GetApnsSandboxChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetApnsSandboxChannelResponse", "{\"members\":{\"APNSSandboxChannelResponse\":{\"shape\":\"APNSSandboxChannelResponse\"}},\"payload\":\"APNSSandboxChannelResponse\",\"required\":[\"APNSSandboxChannelResponse\"],\"type\":\"structure\"}"},
+    {"GetApplicationSettingsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetApplicationSettingsResponse", "{\"members\":{\"ApplicationSettingsResource\":{\"shape\":\"ApplicationSettingsResource\"}},\"payload\":\"ApplicationSettingsResource\",\"required\":[\"ApplicationSettingsResource\"],\"type\":\"structure\"}"},
+    {"GetCampaignActivitiesRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\",\"CampaignId\"],\"type\":\"structure\"}"},
+    {"GetCampaignActivitiesResponse", "{\"members\":{\"ActivitiesResponse\":{\"shape\":\"ActivitiesResponse\"}},\"payload\":\"ActivitiesResponse\",\"required\":[\"ActivitiesResponse\"],\"type\":\"structure\"}"},
+    {"GetCampaignRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"}},\"required\":[\"CampaignId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetCampaignResponse", "{\"members\":{\"CampaignResponse\":{\"shape\":\"CampaignResponse\"}},\"payload\":\"CampaignResponse\",\"required\":[\"CampaignResponse\"],\"type\":\"structure\"}"},
+    {"GetCampaignVersionRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"},\"Version\":{\"location\":\"uri\",\"locationName\":\"version\",\"shape\":\"__string\"}},\"required\":[\"Version\",\"ApplicationId\",\"CampaignId\"],\"type\":\"structure\"}"},
+    {"GetCampaignVersionResponse", "{\"members\":{\"CampaignResponse\":{\"shape\":\"CampaignResponse\"}},\"payload\":\"CampaignResponse\",\"required\":[\"CampaignResponse\"],\"type\":\"structure\"}"},
+    {"GetCampaignVersionsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\",\"CampaignId\"],\"type\":\"structure\"}"},
+    {"GetCampaignVersionsResponse", "{\"members\":{\"CampaignsResponse\":{\"shape\":\"CampaignsResponse\"}},\"payload\":\"CampaignsResponse\",\"required\":[\"CampaignsResponse\"],\"type\":\"structure\"}"},
+    {"GetCampaignsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetCampaignsResponse", "{\"members\":{\"CampaignsResponse\":{\"shape\":\"CampaignsResponse\"}},\"payload\":\"CampaignsResponse\",\"required\":[\"CampaignsResponse\"],\"type\":\"structure\"}"},
+    {"GetEmailChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetEmailChannelResponse", "{\"members\":{\"EmailChannelResponse\":{\"shape\":\"EmailChannelResponse\"}},\"payload\":\"EmailChannelResponse\",\"required\":[\"EmailChannelResponse\"],\"type\":\"structure\"}"},
+    {"GetEndpointRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"EndpointId\":{\"location\":\"uri\",\"locationName\":\"endpoint-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\",\"EndpointId\"],\"type\":\"structure\"}"},
+    {"GetEndpointResponse", "{\"members\":{\"EndpointResponse\":{\"shape\":\"EndpointResponse\"}},\"payload\":\"EndpointResponse\",\"required\":[\"EndpointResponse\"],\"type\":\"structure\"}"},
+    {"GetEventStreamRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetEventStreamResponse", "{\"members\":{\"EventStream\":{\"shape\":\"EventStream\"}},\"payload\":\"EventStream\",\"required\":[\"EventStream\"],\"type\":\"structure\"}"},
+    {"GetGcmChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetGcmChannelResponse", "{\"members\":{\"GCMChannelResponse\":{\"shape\":\"GCMChannelResponse\"}},\"payload\":\"GCMChannelResponse\",\"required\":[\"GCMChannelResponse\"],\"type\":\"structure\"}"},
+    {"GetImportJobRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"JobId\":{\"location\":\"uri\",\"locationName\":\"job-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\",\"JobId\"],\"type\":\"structure\"}"},
+    {"GetImportJobResponse", "{\"members\":{\"ImportJobResponse\":{\"shape\":\"ImportJobResponse\"}},\"payload\":\"ImportJobResponse\",\"required\":[\"ImportJobResponse\"],\"type\":\"structure\"}"},
+    {"GetImportJobsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetImportJobsResponse", "{\"members\":{\"ImportJobsResponse\":{\"shape\":\"ImportJobsResponse\"}},\"payload\":\"ImportJobsResponse\",\"required\":[\"ImportJobsResponse\"],\"type\":\"structure\"}"},
+    {"GetSegmentImportJobsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"SegmentId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSegmentImportJobsResponse", "{\"members\":{\"ImportJobsResponse\":{\"shape\":\"ImportJobsResponse\"}},\"payload\":\"ImportJobsResponse\",\"required\":[\"ImportJobsResponse\"],\"type\":\"structure\"}"},
+    {"GetSegmentRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"}},\"required\":[\"SegmentId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSegmentResponse", "{\"members\":{\"SegmentResponse\":{\"shape\":\"SegmentResponse\"}},\"payload\":\"SegmentResponse\",\"required\":[\"SegmentResponse\"],\"type\":\"structure\"}"},
+    {"GetSegmentVersionRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"},\"Version\":{\"location\":\"uri\",\"locationName\":\"version\",\"shape\":\"__string\"}},\"required\":[\"SegmentId\",\"Version\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSegmentVersionResponse", "{\"members\":{\"SegmentResponse\":{\"shape\":\"SegmentResponse\"}},\"payload\":\"SegmentResponse\",\"required\":[\"SegmentResponse\"],\"type\":\"structure\"}"},
+    {"GetSegmentVersionsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"SegmentId\",\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSegmentVersionsResponse", "{\"members\":{\"SegmentsResponse\":{\"shape\":\"SegmentsResponse\"}},\"payload\":\"SegmentsResponse\",\"required\":[\"SegmentsResponse\"],\"type\":\"structure\"}"},
+    {"GetSegmentsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"PageSize\":{\"location\":\"querystring\",\"locationName\":\"page-size\",\"shape\":\"__string\"},\"Token\":{\"location\":\"querystring\",\"locationName\":\"token\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSegmentsResponse", "{\"members\":{\"SegmentsResponse\":{\"shape\":\"SegmentsResponse\"}},\"payload\":\"SegmentsResponse\",\"required\":[\"SegmentsResponse\"],\"type\":\"structure\"}"},
+    {"GetSmsChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"required\":[\"ApplicationId\"],\"type\":\"structure\"}"},
+    {"GetSmsChannelResponse", "{\"members\":{\"SMSChannelResponse\":{\"shape\":\"SMSChannelResponse\"}},\"payload\":\"SMSChannelResponse\",\"required\":[\"SMSChannelResponse\"],\"type\":\"structure\"}"},
+    {"ImportJobRequest", "{\"members\":{\"DefineSegment\":{\"shape\":\"__boolean\"},\"ExternalId\":{\"shape\":\"__string\"},\"Format\":{\"shape\":\"Format\"},\"RegisterEndpoints\":{\"shape\":\"__boolean\"},\"RoleArn\":{\"shape\":\"__string\"},\"S3Url\":{\"shape\":\"__string\"},\"SegmentId\":{\"shape\":\"__string\"},\"SegmentName\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ImportJobResource", "{\"members\":{\"DefineSegment\":{\"shape\":\"__boolean\"},\"ExternalId\":{\"shape\":\"__string\"},\"Format\":{\"shape\":\"Format\"},\"RegisterEndpoints\":{\"shape\":\"__boolean\"},\"RoleArn\":{\"shape\":\"__string\"},\"S3Url\":{\"shape\":\"__string\"},\"SegmentId\":{\"shape\":\"__string\"},\"SegmentName\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ImportJobResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CompletedPieces\":{\"shape\":\"__integer\"},\"CompletionDate\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Definition\":{\"shape\":\"ImportJobResource\"},\"FailedPieces\":{\"shape\":\"__integer\"},\"Failures\":{\"shape\":\"ListOf__string\"},\"Id\":{\"shape\":\"__string\"},\"JobStatus\":{\"shape\":\"JobStatus\"},\"TotalFailures\":{\"shape\":\"__integer\"},\"TotalPieces\":{\"shape\":\"__integer\"},\"TotalProcessed\":{\"shape\":\"__integer\"},\"Type\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"ImportJobsResponse", "{\"members\":{\"Item\":{\"shape\":\"ListOfImportJobResponse\"},\"NextToken\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"InternalServerErrorException", "{\"error\":{\"httpStatusCode\":500},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"JobStatus", "{\"enum\":[\"CREATED\",\"INITIALIZING\",\"PROCESSING\",\"COMPLETING\",\"COMPLETED\",\"FAILING\",\"FAILED\"],\"type\":\"string\"}"},
+    {"ListOfActivityResponse", "{\"member\":{\"shape\":\"ActivityResponse\"},\"type\":\"list\"}"},
+    {"ListOfCampaignResponse", "{\"member\":{\"shape\":\"CampaignResponse\"},\"type\":\"list\"}"},
+    {"ListOfEndpointBatchItem", "{\"member\":{\"shape\":\"EndpointBatchItem\"},\"type\":\"list\"}"},
+    {"ListOfImportJobResponse", "{\"member\":{\"shape\":\"ImportJobResponse\"},\"type\":\"list\"}"},
+    {"ListOfSegmentResponse", "{\"member\":{\"shape\":\"SegmentResponse\"},\"type\":\"list\"}"},
+    {"ListOfTreatmentResource", "{\"member\":{\"shape\":\"TreatmentResource\"},\"type\":\"list\"}"},
+    {"ListOfWriteTreatmentResource", "{\"member\":{\"shape\":\"WriteTreatmentResource\"},\"type\":\"list\"}"},
+    {"ListOf__string", "{\"member\":{\"shape\":\"__string\"},\"type\":\"list\"}"},
+    {"MapOfAddressConfiguration", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"AddressConfiguration\"}}"},
+    {"MapOfAttributeDimension", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"AttributeDimension\"}}"},
+    {"MapOfListOf__string", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"ListOf__string\"}}"},
+    {"MapOfMessageResult", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"MessageResult\"}}"},
+    {"MapOf__double", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"__double\"}}"},
+    {"MapOf__integer", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"__integer\"}}"},
+    {"MapOf__string", "{\"key\":{\"shape\":\"__string\"},\"type\":\"map\",\"value\":{\"shape\":\"__string\"}}"},
+    {"Message", "{\"members\":{\"Action\":{\"shape\":\"Action\"},\"Body\":{\"shape\":\"__string\"},\"ImageIconUrl\":{\"shape\":\"__string\"},\"ImageSmallIconUrl\":{\"shape\":\"__string\"},\"ImageUrl\":{\"shape\":\"__string\"},\"JsonBody\":{\"shape\":\"__string\"},\"MediaUrl\":{\"shape\":\"__string\"},\"SilentPush\":{\"shape\":\"__boolean\"},\"Title\":{\"shape\":\"__string\"},\"Url\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"MessageBody", "{\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"MessageConfiguration", "{\"members\":{\"APNSMessage\":{\"shape\":\"Message\"},\"DefaultMessage\":{\"shape\":\"Message\"},\"EmailMessage\":{\"shape\":\"CampaignEmailMessage\"},\"GCMMessage\":{\"shape\":\"Message\"},\"SMSMessage\":{\"shape\":\"CampaignSmsMessage\"}},\"type\":\"structure\"}"},
+    {"MessageRequest", "{\"members\":{\"Addresses\":{\"shape\":\"MapOfAddressConfiguration\"},\"Context\":{\"shape\":\"MapOf__string\"},\"MessageConfiguration\":{\"shape\":\"DirectMessageConfiguration\"}},\"type\":\"structure\"}"},
+    {"MessageResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"RequestId\":{\"shape\":\"__string\"},\"Result\":{\"shape\":\"MapOfMessageResult\"}},\"type\":\"structure\"}"},
+    {"MessageResult", "{\"members\":{\"DeliveryStatus\":{\"shape\":\"DeliveryStatus\"},\"StatusCode\":{\"shape\":\"__integer\"},\"StatusMessage\":{\"shape\":\"__string\"},\"UpdatedToken\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"MessageType", "{\"enum\":[\"TRANSACTIONAL\",\"PROMOTIONAL\"],\"type\":\"string\"}"},
+    {"MethodNotAllowedException", "{\"error\":{\"httpStatusCode\":405},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"NotFoundException", "{\"error\":{\"httpStatusCode\":404},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"PutEventStreamRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"WriteEventStream\":{\"shape\":\"WriteEventStream\"}},\"payload\":\"WriteEventStream\",\"required\":[\"ApplicationId\",\"WriteEventStream\"],\"type\":\"structure\"}"},
+    {"PutEventStreamResponse", "{\"members\":{\"EventStream\":{\"shape\":\"EventStream\"}},\"payload\":\"EventStream\",\"required\":[\"EventStream\"],\"type\":\"structure\"}"},
+    {"QuietTime", "{\"members\":{\"End\":{\"shape\":\"__string\"},\"Start\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"RecencyDimension", "{\"members\":{\"Duration\":{\"shape\":\"Duration\"},\"RecencyType\":{\"shape\":\"RecencyType\"}},\"type\":\"structure\"}"},
+    {"RecencyType", "{\"enum\":[\"ACTIVE\",\"INACTIVE\"],\"type\":\"string\"}"},
+    {"SMSChannelRequest", "{\"members\":{\"Enabled\":{\"shape\":\"__boolean\"},\"SenderId\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"SMSChannelResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Enabled\":{\"shape\":\"__boolean\"},\"Id\":{\"shape\":\"__string\"},\"IsArchived\":{\"shape\":\"__boolean\"},\"LastModifiedBy\":{\"shape\":\"__string\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Platform\":{\"shape\":\"__string\"},\"SenderId\":{\"shape\":\"__string\"},\"ShortCode\":{\"shape\":\"__string\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"SMSMessage", "{\"members\":{\"Body\":{\"shape\":\"__string\"},\"MessageType\":{\"shape\":\"MessageType\"},\"SenderId\":{\"shape\":\"__string\"},\"Substitutions\":{\"shape\":\"MapOfListOf__string\"}},\"type\":\"structure\"}"},
+    {"Schedule", "{\"members\":{\"EndTime\":{\"shape\":\"__string\"},\"Frequency\":{\"shape\":\"Frequency\"},\"IsLocalTime\":{\"shape\":\"__boolean\"},\"QuietTime\":{\"shape\":\"QuietTime\"},\"StartTime\":{\"shape\":\"__string\"},\"Timezone\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"SegmentBehaviors", "{\"members\":{\"Recency\":{\"shape\":\"RecencyDimension\"}},\"type\":\"structure\"}"},
+    {"SegmentDemographics", "{\"members\":{\"AppVersion\":{\"shape\":\"SetDimension\"},\"Channel\":{\"shape\":\"SetDimension\"},\"DeviceType\":{\"shape\":\"SetDimension\"},\"Make\":{\"shape\":\"SetDimension\"},\"Model\":{\"shape\":\"SetDimension\"},\"Platform\":{\"shape\":\"SetDimension\"}},\"type\":\"structure\"}"},
+    {"SegmentDimensions", "{\"members\":{\"Attributes\":{\"shape\":\"MapOfAttributeDimension\"},\"Behavior\":{\"shape\":\"SegmentBehaviors\"},\"Demographic\":{\"shape\":\"SegmentDemographics\"},\"Location\":{\"shape\":\"SegmentLocation\"},\"UserAttributes\":{\"shape\":\"MapOfAttributeDimension\"}},\"type\":\"structure\"}"},
+    {"SegmentImportResource", "{\"members\":{\"ChannelCounts\":{\"shape\":\"MapOf__integer\"},\"ExternalId\":{\"shape\":\"__string\"},\"Format\":{\"shape\":\"Format\"},\"RoleArn\":{\"shape\":\"__string\"},\"S3Url\":{\"shape\":\"__string\"},\"Size\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"SegmentLocation", "{\"members\":{\"Country\":{\"shape\":\"SetDimension\"}},\"type\":\"structure\"}"},
+    {"SegmentResponse", "{\"members\":{\"ApplicationId\":{\"shape\":\"__string\"},\"CreationDate\":{\"shape\":\"__string\"},\"Dimensions\":{\"shape\":\"SegmentDimensions\"},\"Id\":{\"shape\":\"__string\"},\"ImportDefinition\":{\"shape\":\"SegmentImportResource\"},\"LastModifiedDate\":{\"shape\":\"__string\"},\"Name\":{\"shape\":\"__string\"},\"SegmentType\":{\"shape\":\"SegmentType\"},\"Version\":{\"shape\":\"__integer\"}},\"type\":\"structure\"}"},
+    {"SegmentType", "{\"enum\":[\"DIMENSIONAL\",\"IMPORT\"],\"type\":\"string\"}"},
+    {"SegmentsResponse", "{\"members\":{\"Item\":{\"shape\":\"ListOfSegmentResponse\"},\"NextToken\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"SendMessagesRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"MessageRequest\":{\"shape\":\"MessageRequest\"}},\"payload\":\"MessageRequest\",\"required\":[\"ApplicationId\",\"MessageRequest\"],\"type\":\"structure\"}"},
+    {"SendMessagesResponse", "{\"members\":{\"MessageResponse\":{\"shape\":\"MessageResponse\"}},\"payload\":\"MessageResponse\",\"required\":[\"MessageResponse\"],\"type\":\"structure\"}"},
+    {"SetDimension", "{\"members\":{\"DimensionType\":{\"shape\":\"DimensionType\"},\"Values\":{\"shape\":\"ListOf__string\"}},\"type\":\"structure\"}"},
+    {"TooManyRequestsException", "{\"error\":{\"httpStatusCode\":429},\"exception\":true,\"members\":{\"Message\":{\"shape\":\"__string\"},\"RequestID\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"TreatmentResource", "{\"members\":{\"Id\":{\"shape\":\"__string\"},\"MessageConfiguration\":{\"shape\":\"MessageConfiguration\"},\"Schedule\":{\"shape\":\"Schedule\"},\"SizePercent\":{\"shape\":\"__integer\"},\"State\":{\"shape\":\"CampaignState\"},\"TreatmentDescription\":{\"shape\":\"__string\"},\"TreatmentName\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"UpdateApnsChannelRequest", "{\"members\":{\"APNSChannelRequest\":{\"shape\":\"APNSChannelRequest\"},\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"payload\":\"APNSChannelRequest\",\"required\":[\"ApplicationId\",\"APNSChannelRequest\"],\"type\":\"structure\"}"},
+    {"UpdateApnsChannelResponse", "{\"members\":{\"APNSChannelResponse\":{\"shape\":\"APNSChannelResponse\"}},\"payload\":\"APNSChannelResponse\",\"required\":[\"APNSChannelResponse\"],\"type\":\"structure\"}"},
+    {"UpdateApnsSandboxChannelRequest", "{\"members\":{\"APNSSandboxChannelRequest\":{\"shape\":\"APNSSandboxChannelRequest\"},\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"}},\"payload\":\"APNSSandboxChannelRequest\",\"required\":[\"ApplicationId\",\"APNSSandboxChannelRequest\"],\"type\":\"structure\"}"},
+    {"UpdateApnsSandboxChannelResponse", "{\"members\":{\"APNSSandboxChannelResponse\":{\"shape\":\"APNSSandboxChannelResponse\"}},\"payload\":\"APNSSandboxChannelResponse\",\"required\":[\"APNSSandboxChannelResponse\"],\"type\":\"structure\"}"},
+    {"UpdateApplicationSettingsRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"WriteApplicationSettingsRequest\":{\"shape\":\"WriteApplicationSettingsRequest\"}},\"payload\":\"WriteApplicationSettingsRequest\",\"required\":[\"ApplicationId\",\"WriteApplicationSettingsRequest\"],\"type\":\"structure\"}"},
+    {"UpdateApplicationSettingsResponse", "{\"members\":{\"ApplicationSettingsResource\":{\"shape\":\"ApplicationSettingsResource\"}},\"payload\":\"ApplicationSettingsResource\",\"required\":[\"ApplicationSettingsResource\"],\"type\":\"structure\"}"},
+    {"UpdateCampaignRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"CampaignId\":{\"location\":\"uri\",\"locationName\":\"campaign-id\",\"shape\":\"__string\"},\"WriteCampaignRequest\":{\"shape\":\"WriteCampaignRequest\"}},\"payload\":\"WriteCampaignRequest\",\"required\":[\"CampaignId\",\"ApplicationId\",\"WriteCampaignRequest\"],\"type\":\"structure\"}"},
+    {"UpdateCampaignResponse", "{\"members\":{\"CampaignResponse\":{\"shape\":\"CampaignResponse\"}},\"payload\":\"CampaignResponse\",\"required\":[\"CampaignResponse\"],\"type\":\"structure\"}"},
+    {"UpdateEmailChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"EmailChannelRequest\":{\"shape\":\"EmailChannelRequest\"}},\"payload\":\"EmailChannelRequest\",\"required\":[\"ApplicationId\",\"EmailChannelRequest\"],\"type\":\"structure\"}"},
+    {"UpdateEmailChannelResponse", "{\"members\":{\"EmailChannelResponse\":{\"shape\":\"EmailChannelResponse\"}},\"payload\":\"EmailChannelResponse\",\"required\":[\"EmailChannelResponse\"],\"type\":\"structure\"}"},
+    {"UpdateEndpointRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"EndpointId\":{\"location\":\"uri\",\"locationName\":\"endpoint-id\",\"shape\":\"__string\"},\"EndpointRequest\":{\"shape\":\"EndpointRequest\"}},\"payload\":\"EndpointRequest\",\"required\":[\"ApplicationId\",\"EndpointId\",\"EndpointRequest\"],\"type\":\"structure\"}"},
+    {"UpdateEndpointResponse", "{\"members\":{\"MessageBody\":{\"shape\":\"MessageBody\"}},\"payload\":\"MessageBody\",\"required\":[\"MessageBody\"],\"type\":\"structure\"}"},
+    {"UpdateEndpointsBatchRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"EndpointBatchRequest\":{\"shape\":\"EndpointBatchRequest\"}},\"payload\":\"EndpointBatchRequest\",\"required\":[\"ApplicationId\",\"EndpointBatchRequest\"],\"type\":\"structure\"}"},
+    {"UpdateEndpointsBatchResponse", "{\"members\":{\"MessageBody\":{\"shape\":\"MessageBody\"}},\"payload\":\"MessageBody\",\"required\":[\"MessageBody\"],\"type\":\"structure\"}"},
+    {"UpdateGcmChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"GCMChannelRequest\":{\"shape\":\"GCMChannelRequest\"}},\"payload\":\"GCMChannelRequest\",\"required\":[\"ApplicationId\",\"GCMChannelRequest\"],\"type\":\"structure\"}"},
+    {"UpdateGcmChannelResponse", "{\"members\":{\"GCMChannelResponse\":{\"shape\":\"GCMChannelResponse\"}},\"payload\":\"GCMChannelResponse\",\"required\":[\"GCMChannelResponse\"],\"type\":\"structure\"}"},
+    {"UpdateSegmentRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"SegmentId\":{\"location\":\"uri\",\"locationName\":\"segment-id\",\"shape\":\"__string\"},\"WriteSegmentRequest\":{\"shape\":\"WriteSegmentRequest\"}},\"payload\":\"WriteSegmentRequest\",\"required\":[\"SegmentId\",\"ApplicationId\",\"WriteSegmentRequest\"],\"type\":\"structure\"}"},
+    {"UpdateSegmentResponse", "{\"members\":{\"SegmentResponse\":{\"shape\":\"SegmentResponse\"}},\"payload\":\"SegmentResponse\",\"required\":[\"SegmentResponse\"],\"type\":\"structure\"}"},
+    {"UpdateSmsChannelRequest", "{\"members\":{\"ApplicationId\":{\"location\":\"uri\",\"locationName\":\"application-id\",\"shape\":\"__string\"},\"SMSChannelRequest\":{\"shape\":\"SMSChannelRequest\"}},\"payload\":\"SMSChannelRequest\",\"required\":[\"ApplicationId\",\"SMSChannelRequest\"],\"type\":\"structure\"}"},
+    {"UpdateSmsChannelResponse", "{\"members\":{\"SMSChannelResponse\":{\"shape\":\"SMSChannelResponse\"}},\"payload\":\"SMSChannelResponse\",\"required\":[\"SMSChannelResponse\"],\"type\":\"structure\"}"},
+    {"WriteApplicationSettingsRequest", "{\"members\":{\"Limits\":{\"shape\":\"CampaignLimits\"},\"QuietTime\":{\"shape\":\"QuietTime\"}},\"type\":\"structure\"}"},
+    {"WriteCampaignRequest", "{\"members\":{\"AdditionalTreatments\":{\"shape\":\"ListOfWriteTreatmentResource\"},\"Description\":{\"shape\":\"__string\"},\"HoldoutPercent\":{\"shape\":\"__integer\"},\"IsPaused\":{\"shape\":\"__boolean\"},\"Limits\":{\"shape\":\"CampaignLimits\"},\"MessageConfiguration\":{\"shape\":\"MessageConfiguration\"},\"Name\":{\"shape\":\"__string\"},\"Schedule\":{\"shape\":\"Schedule\"},\"SegmentId\":{\"shape\":\"__string\"},\"SegmentVersion\":{\"shape\":\"__integer\"},\"TreatmentDescription\":{\"shape\":\"__string\"},\"TreatmentName\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"WriteEventStream", "{\"members\":{\"DestinationStreamArn\":{\"shape\":\"__string\"},\"ExternalId\":{\"shape\":\"__string\"},\"RoleArn\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"WriteSegmentRequest", "{\"members\":{\"Dimensions\":{\"shape\":\"SegmentDimensions\"},\"Name\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"WriteTreatmentResource", "{\"members\":{\"MessageConfiguration\":{\"shape\":\"MessageConfiguration\"},\"Schedule\":{\"shape\":\"Schedule\"},\"SizePercent\":{\"shape\":\"__integer\"},\"TreatmentDescription\":{\"shape\":\"__string\"},\"TreatmentName\":{\"shape\":\"__string\"}},\"type\":\"structure\"}"},
+    {"__boolean", "{\"type\":\"boolean\"}"},
+    {"__double", "{\"type\":\"double\"}"},
+    {"__integer", "{\"type\":\"integer\"}"},
+    {"__string", "{\"type\":\"string\"}"},
+    {"__timestamp", "{\"type\":\"timestamp\"}"},
+};
 
 @interface AWSPinpointTargetingResources ()
 
@@ -43,4460 +285,25 @@
     if (self = [super init]) {
         //init method
         NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
-        if (_definitionDictionary == nil) {
+        NSDictionary *definitionDictionary = [NSJSONSerialization JSONObjectWithData:[NSData dataWithBytesNoCopy:(void *)AWSPinpointTargetingDefinition
+                                                                                                           length:sizeof(AWSPinpointTargetingDefinition) - 1
+                                                                                                     freeWhenDone:NO]
+                                                                               options:kNilOptions
+                                                                                 error:&error];
+        if (definitionDictionary == nil) {
             if (error) {
                 AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
             }
+        } else {
+            NSMutableDictionary *mutableDefinitionDictionary = [definitionDictionary mutableCopy];
+            mutableDefinitionDictionary[@"operations"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSPinpointTargetingOperations
+                                                                                                      count:sizeof(AWSPinpointTargetingOperations) / sizeof(AWSPinpointTargetingOperations[0])];
+            mutableDefinitionDictionary[@"shapes"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSPinpointTargetingShapes
+                                                                                                  count:sizeof(AWSPinpointTargetingShapes) / sizeof(AWSPinpointTargetingShapes[0])];
+            _definitionDictionary = [mutableDefinitionDictionary copy];
         }
     }
     return self;
 }
 
-- (NSString *)definitionString {
-    return @"{\
-  \"metadata\" : {\
-    \"apiVersion\" : \"2016-12-01\",\
-    \"endpointPrefix\" : \"pinpoint\",\
-    \"signingName\" : \"mobiletargeting\",\
-    \"signatureVersion\":\"v4\",\
-    \"serviceFullName\" : \"Amazon Pinpoint\",\
-    \"protocol\" : \"rest-json\",\
-    \"jsonVersion\" : \"1.1\"\
-  },\
-  \"operations\" : {\
-    \"CreateCampaign\" : {\
-      \"name\" : \"CreateCampaign\",\
-      \"http\" : {\
-        \"method\" : \"POST\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns\",\
-        \"responseCode\" : 201\
-      },\
-      \"input\" : {\
-        \"shape\" : \"CreateCampaignRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"CreateCampaignResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Creates or updates a campaign.\"\
-    },\
-    \"CreateImportJob\" : {\
-      \"name\" : \"CreateImportJob\",\
-      \"http\" : {\
-        \"method\" : \"POST\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/jobs/import\",\
-        \"responseCode\" : 201\
-      },\
-      \"input\" : {\
-        \"shape\" : \"CreateImportJobRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"CreateImportJobResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Creates or updates an import job.\"\
-    },\
-    \"CreateSegment\" : {\
-      \"name\" : \"CreateSegment\",\
-      \"http\" : {\
-        \"method\" : \"POST\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments\",\
-        \"responseCode\" : 201\
-      },\
-      \"input\" : {\
-        \"shape\" : \"CreateSegmentRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"CreateSegmentResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Used to create or update a segment.\"\
-    },\
-    \"DeleteApnsChannel\" : {\
-      \"name\" : \"DeleteApnsChannel\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteApnsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteApnsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Deletes the APNs channel for an app.\"\
-    },\
-    \"DeleteApnsSandboxChannel\" : {\
-      \"name\" : \"DeleteApnsSandboxChannel\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns_sandbox\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteApnsSandboxChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteApnsSandboxChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Delete an APNS sandbox channel\"\
-    },\
-    \"DeleteCampaign\" : {\
-      \"name\" : \"DeleteCampaign\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteCampaignRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteCampaignResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Deletes a campaign.\"\
-    },\
-    \"DeleteEmailChannel\" : {\
-      \"name\" : \"DeleteEmailChannel\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/email\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteEmailChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteEmailChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Delete an email channel\"\
-    },\
-    \"DeleteEventStream\" : {\
-      \"name\" : \"DeleteEventStream\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/eventstream\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteEventStreamRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteEventStreamResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Deletes the event stream for an app.\"\
-    },\
-    \"DeleteGcmChannel\" : {\
-      \"name\" : \"DeleteGcmChannel\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/gcm\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteGcmChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteGcmChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Deletes the GCM channel for an app.\"\
-    },\
-    \"DeleteSegment\" : {\
-      \"name\" : \"DeleteSegment\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteSegmentRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteSegmentResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Deletes a segment.\"\
-    },\
-    \"DeleteSmsChannel\" : {\
-      \"name\" : \"DeleteSmsChannel\",\
-      \"http\" : {\
-        \"method\" : \"DELETE\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/sms\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"DeleteSmsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"DeleteSmsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Delete an SMS channel\"\
-    },\
-    \"GetApnsChannel\" : {\
-      \"name\" : \"GetApnsChannel\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetApnsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetApnsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about the APNs channel for an app.\"\
-    },\
-    \"GetApnsSandboxChannel\" : {\
-      \"name\" : \"GetApnsSandboxChannel\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns_sandbox\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetApnsSandboxChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetApnsSandboxChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Get an APNS sandbox channel\"\
-    },\
-    \"GetApplicationSettings\" : {\
-      \"name\" : \"GetApplicationSettings\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/settings\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetApplicationSettingsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetApplicationSettingsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Used to request the settings for an app.\"\
-    },\
-    \"GetCampaign\" : {\
-      \"name\" : \"GetCampaign\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetCampaignRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetCampaignResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about a campaign.\"\
-    },\
-    \"GetCampaignActivities\" : {\
-      \"name\" : \"GetCampaignActivities\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}/activities\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetCampaignActivitiesRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetCampaignActivitiesResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about the activity performed by a campaign.\"\
-    },\
-    \"GetCampaignVersion\" : {\
-      \"name\" : \"GetCampaignVersion\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}/versions/{version}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetCampaignVersionRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetCampaignVersionResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about a specific version of a campaign.\"\
-    },\
-    \"GetCampaignVersions\" : {\
-      \"name\" : \"GetCampaignVersions\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}/versions\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetCampaignVersionsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetCampaignVersionsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about your campaign versions.\"\
-    },\
-    \"GetCampaigns\" : {\
-      \"name\" : \"GetCampaigns\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetCampaignsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetCampaignsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about your campaigns.\"\
-    },\
-    \"GetEmailChannel\" : {\
-      \"name\" : \"GetEmailChannel\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/email\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetEmailChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetEmailChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Get an email channel\"\
-    },\
-    \"GetEndpoint\" : {\
-      \"name\" : \"GetEndpoint\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/endpoints/{endpoint-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetEndpointRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetEndpointResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about an endpoint.\"\
-    },\
-    \"GetEventStream\" : {\
-      \"name\" : \"GetEventStream\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/eventstream\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetEventStreamRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetEventStreamResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns the event stream for an app.\"\
-    },\
-    \"GetGcmChannel\" : {\
-      \"name\" : \"GetGcmChannel\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/gcm\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetGcmChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetGcmChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about the GCM channel for an app.\"\
-    },\
-    \"GetImportJob\" : {\
-      \"name\" : \"GetImportJob\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/jobs/import/{job-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetImportJobRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetImportJobResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about an import job.\"\
-    },\
-    \"GetImportJobs\" : {\
-      \"name\" : \"GetImportJobs\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/jobs/import\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetImportJobsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetImportJobsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about your import jobs.\"\
-    },\
-    \"GetSegment\" : {\
-      \"name\" : \"GetSegment\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSegmentRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSegmentResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about a segment.\"\
-    },\
-    \"GetSegmentImportJobs\" : {\
-      \"name\" : \"GetSegmentImportJobs\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}/jobs/import\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSegmentImportJobsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSegmentImportJobsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns a list of import jobs for a specific segment.\"\
-    },\
-    \"GetSegmentVersion\" : {\
-      \"name\" : \"GetSegmentVersion\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}/versions/{version}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSegmentVersionRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSegmentVersionResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about a segment version.\"\
-    },\
-    \"GetSegmentVersions\" : {\
-      \"name\" : \"GetSegmentVersions\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}/versions\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSegmentVersionsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSegmentVersionsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Returns information about your segment versions.\"\
-    },\
-    \"GetSegments\" : {\
-      \"name\" : \"GetSegments\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSegmentsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSegmentsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Used to get information about your segments.\"\
-    },\
-    \"GetSmsChannel\" : {\
-      \"name\" : \"GetSmsChannel\",\
-      \"http\" : {\
-        \"method\" : \"GET\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/sms\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"GetSmsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"GetSmsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Get an SMS channel\"\
-    },\
-    \"PutEventStream\" : {\
-      \"name\" : \"PutEventStream\",\
-      \"http\" : {\
-        \"method\" : \"POST\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/eventstream\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"PutEventStreamRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"PutEventStreamResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to create or update the event stream for an app.\"\
-    },\
-    \"SendMessages\" : {\
-      \"name\" : \"SendMessages\",\
-      \"http\" : {\
-        \"method\" : \"POST\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/messages\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"SendMessagesRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"SendMessagesResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Send a batch of messages\"\
-    },\
-    \"UpdateApnsChannel\" : {\
-      \"name\" : \"UpdateApnsChannel\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateApnsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateApnsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update the APNs channel for an app.\"\
-    },\
-    \"UpdateApnsSandboxChannel\" : {\
-      \"name\" : \"UpdateApnsSandboxChannel\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/apns_sandbox\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateApnsSandboxChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateApnsSandboxChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Update an APNS sandbox channel\"\
-    },\
-    \"UpdateApplicationSettings\" : {\
-      \"name\" : \"UpdateApplicationSettings\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/settings\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateApplicationSettingsRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateApplicationSettingsResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Used to update the settings for an app.\"\
-    },\
-    \"UpdateCampaign\" : {\
-      \"name\" : \"UpdateCampaign\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/campaigns/{campaign-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateCampaignRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateCampaignResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update a campaign.\"\
-    },\
-    \"UpdateEmailChannel\" : {\
-      \"name\" : \"UpdateEmailChannel\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/email\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateEmailChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateEmailChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Update an email channel\"\
-    },\
-    \"UpdateEndpoint\" : {\
-      \"name\" : \"UpdateEndpoint\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/endpoints/{endpoint-id}\",\
-        \"responseCode\" : 202\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateEndpointRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateEndpointResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update an endpoint.\"\
-    },\
-    \"UpdateEndpointsBatch\" : {\
-      \"name\" : \"UpdateEndpointsBatch\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/endpoints\",\
-        \"responseCode\" : 202\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateEndpointsBatchRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateEndpointsBatchResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update a batch of endpoints.\"\
-    },\
-    \"UpdateGcmChannel\" : {\
-      \"name\" : \"UpdateGcmChannel\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/gcm\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateGcmChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateGcmChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update the GCM channel for an app.\"\
-    },\
-    \"UpdateSegment\" : {\
-      \"name\" : \"UpdateSegment\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/segments/{segment-id}\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateSegmentRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateSegmentResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Use to update a segment.\"\
-    },\
-    \"UpdateSmsChannel\" : {\
-      \"name\" : \"UpdateSmsChannel\",\
-      \"http\" : {\
-        \"method\" : \"PUT\",\
-        \"requestUri\" : \"/v1/apps/{application-id}/channels/sms\",\
-        \"responseCode\" : 200\
-      },\
-      \"input\" : {\
-        \"shape\" : \"UpdateSmsChannelRequest\"\
-      },\
-      \"output\" : {\
-        \"shape\" : \"UpdateSmsChannelResponse\"\
-      },\
-      \"errors\" : [ {\
-        \"shape\" : \"BadRequestException\"\
-      }, {\
-        \"shape\" : \"InternalServerErrorException\"\
-      }, {\
-        \"shape\" : \"ForbiddenException\"\
-      }, {\
-        \"shape\" : \"NotFoundException\"\
-      }, {\
-        \"shape\" : \"MethodNotAllowedException\"\
-      }, {\
-        \"shape\" : \"TooManyRequestsException\"\
-      } ],\
-      \"documentation\" : \"Update an SMS channel\"\
-    }\
-  },\
-  \"shapes\" : {\
-    \"APNSChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Certificate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The distribution certificate from Apple.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"PrivateKey\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The certificate private key.\"\
-        }\
-      },\
-      \"documentation\" : \"Apple Push Notification Service channel definition.\"\
-    },\
-    \"APNSChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application to which the channel applies.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"When was this segment created\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Channel ID. Not used, only for backwards compatibility.\"\
-        },\
-        \"IsArchived\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Is this channel archived\"\
-        },\
-        \"LastModifiedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Who last updated this entry\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Last date this was updated\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The platform type. Will be APNS.\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Version of channel\"\
-        }\
-      },\
-      \"documentation\" : \"Apple Distribution Push Notification Service channel definition.\"\
-    },\
-    \"APNSMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Action\" : {\
-          \"shape\" : \"Action\",\
-          \"documentation\" : \"The action that occurs if the user taps a push notification delivered by the campaign: OPEN_APP - Your app launches, or it becomes the foreground app if it has been sent to the background. This is the default action. DEEP_LINK - Uses deep linking features in iOS and Android to open your app and display a designated user interface within the app. URL - The default mobile browser on the user's device launches and opens a web page at the URL you specify. Possible values include: OPEN_APP | DEEP_LINK | URL\"\
-        },\
-        \"Badge\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Include this key when you want the system to modify the badge of your app icon. If this key is not included in the dictionary, the badge is not changed. To remove the badge, set the value of this key to 0.\"\
-        },\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body of the notification, the email body or the text message.\"\
-        },\
-        \"Category\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Provide this key with a string value that represents the notification's type. This value corresponds to the value in the identifier property of one of your app's registered categories.\"\
-        },\
-        \"Data\" : {\
-          \"shape\" : \"MapOf__string\",\
-          \"documentation\" : \"The data payload used for a silent push. This payload is added to the notifications' data.pinpoint.jsonBody' object\"\
-        },\
-        \"MediaUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to a video used in the push notification.\"\
-        },\
-        \"RawContent\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Raw JSON formatted string to be used as the payload. This value overrides the message.\"\
-        },\
-        \"SilentPush\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates if the message should display on the users device. Silent pushes can be used for Remote Configuration and Phone Home use cases.\"\
-        },\
-        \"Sound\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Include this key when you want the system to play a sound. The value of this key is the name of a sound file in your app's main bundle or in the Library/Sounds folder of your app's data container. If the sound file cannot be found, or if you specify defaultfor the value, the system plays the default alert sound.\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Default message substitutions. Can be overridden by individual address substitutions.\"\
-        },\
-        \"ThreadId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Provide this key with a string value that represents the app-specific identifier for grouping notifications. If you provide a Notification Content app extension, you can use this value to group your notifications together.\"\
-        },\
-        \"Title\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message title that displays above the message on the user's device.\"\
-        },\
-        \"Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL to open in the user's mobile browser. Used if the value for Action is URL.\"\
-        }\
-      },\
-      \"documentation\" : \"APNS Message.\"\
-    },\
-    \"APNSSandboxChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Certificate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The distribution certificate from Apple.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"PrivateKey\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The certificate private key.\"\
-        }\
-      },\
-      \"documentation\" : \"Apple Development Push Notification Service channel definition.\"\
-    },\
-    \"APNSSandboxChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Application id\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"When was this segment created\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Channel ID. Not used, only for backwards compatibility.\"\
-        },\
-        \"IsArchived\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Is this channel archived\"\
-        },\
-        \"LastModifiedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Who last updated this entry\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Last date this was updated\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The platform type. Will be APNS.\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Version of channel\"\
-        }\
-      },\
-      \"documentation\" : \"Apple Development Push Notification Service channel definition.\"\
-    },\
-    \"Action\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"OPEN_APP\", \"DEEP_LINK\", \"URL\" ]\
-    },\
-    \"ActivitiesResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Item\" : {\
-          \"shape\" : \"ListOfActivityResponse\",\
-          \"documentation\" : \"List of campaign activities\"\
-        }\
-      },\
-      \"documentation\" : \"Activities for campaign.\"\
-    },\
-    \"ActivityResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application to which the campaign applies.\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the campaign to which the activity applies.\"\
-        },\
-        \"End\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The actual time the activity was marked CANCELLED or COMPLETED. Provided in ISO 8601 format.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique activity ID.\"\
-        },\
-        \"Result\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Indicates whether the activity succeeded.\\n\\nValid values: SUCCESS, FAIL\"\
-        },\
-        \"ScheduledStart\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The scheduled start time for the activity in ISO 8601 format.\"\
-        },\
-        \"Start\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The actual start time of the activity in ISO 8601 format.\"\
-        },\
-        \"State\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The state of the activity.\\n\\nValid values: PENDING, INITIALIZING, RUNNING, PAUSED, CANCELLED, COMPLETED\"\
-        },\
-        \"SuccessfulEndpointCount\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The total number of endpoints to which the campaign successfully delivered messages.\"\
-        },\
-        \"TimezonesCompletedCount\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The total number of timezones completed.\"\
-        },\
-        \"TimezonesTotalCount\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The total number of unique timezones present in the segment.\"\
-        },\
-        \"TotalEndpointCount\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The total number of endpoints to which the campaign attempts to deliver messages.\"\
-        },\
-        \"TreatmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of a variation of the campaign used for A/B testing.\"\
-        }\
-      },\
-      \"documentation\" : \"Activity definition\"\
-    },\
-    \"AddressConfiguration\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"BodyOverride\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Body override. If specified will override default body.\"\
-        },\
-        \"ChannelType\" : {\
-          \"shape\" : \"ChannelType\",\
-          \"documentation\" : \"Type of channel of this address\"\
-        },\
-        \"Context\" : {\
-          \"shape\" : \"MapOf__string\",\
-          \"documentation\" : \"A map of custom attributes to attributes to be attached to the message for this address. This payload is added to the push notification's 'data.pinpoint' object or added to the email/sms delivery receipt event attributes.\"\
-        },\
-        \"RawContent\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Raw JSON formatted string to be used as the payload. This value overrides the message.\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"A map of substitution values for the message to be merged with the DefaultMessage's substitutions. Substitutions on this map take precedence over the all other substitutions.\"\
-        },\
-        \"TitleOverride\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Title override. If specified will override default title if applicable.\"\
-        }\
-      },\
-      \"documentation\" : \"Address configuration.\"\
-    },\
-    \"ApplicationSettingsResource\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID for the application.\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date that the settings were last updated in ISO 8601 format.\"\
-        },\
-        \"Limits\" : {\
-          \"shape\" : \"CampaignLimits\",\
-          \"documentation\" : \"The default campaign limits for the app. These limits apply to each campaign for the app, unless the campaign overrides the default with limits of its own.\"\
-        },\
-        \"QuietTime\" : {\
-          \"shape\" : \"QuietTime\",\
-          \"documentation\" : \"The default quiet time for the app. Each campaign for this app sends no messages during this time unless the campaign overrides the default with a quiet time of its own.\"\
-        }\
-      },\
-      \"documentation\" : \"Application settings.\"\
-    },\
-    \"AttributeDimension\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"AttributeType\" : {\
-          \"shape\" : \"AttributeType\",\
-          \"documentation\" : \"The type of dimension:\\nINCLUSIVE - Endpoints that match the criteria are included in the segment.\\nEXCLUSIVE - Endpoints that match the criteria are excluded from the segment.\"\
-        },\
-        \"Values\" : {\
-          \"shape\" : \"ListOf__string\",\
-          \"documentation\" : \"The criteria values for the segment dimension. Endpoints with matching attribute values are included or excluded from the segment, depending on the setting for Type.\"\
-        }\
-      },\
-      \"documentation\" : \"Custom attibute dimension\"\
-    },\
-    \"AttributeType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"INCLUSIVE\", \"EXCLUSIVE\" ]\
-    },\
-    \"BadRequestException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 400\
-      }\
-    },\
-    \"CampaignEmailMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The email text body.\"\
-        },\
-        \"HtmlBody\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The email html body.\"\
-        },\
-        \"Title\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The email title (Or subject).\"\
-        }\
-      },\
-      \"documentation\" : \"The email message configuration.\"\
-    },\
-    \"CampaignLimits\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Daily\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The maximum number of messages that the campaign can send daily.\"\
-        },\
-        \"Total\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The maximum total number of messages that the campaign can send.\"\
-        }\
-      },\
-      \"documentation\" : \"Campaign Limits are used to limit the number of messages that can be sent to a user.\"\
-    },\
-    \"CampaignResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"AdditionalTreatments\" : {\
-          \"shape\" : \"ListOfTreatmentResource\",\
-          \"documentation\" : \"Treatments that are defined in addition to the default treatment.\"\
-        },\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application to which the campaign applies.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the campaign was created in ISO 8601 format.\"\
-        },\
-        \"DefaultState\" : {\
-          \"shape\" : \"CampaignState\",\
-          \"documentation\" : \"The status of the campaign's default treatment. Only present for A/B test campaigns.\"\
-        },\
-        \"Description\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A description of the campaign.\"\
-        },\
-        \"HoldoutPercent\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The allocated percentage of end users who will not receive messages from this campaign.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique campaign ID.\"\
-        },\
-        \"IsPaused\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates whether the campaign is paused. A paused campaign does not send messages unless you resume it by setting IsPaused to false.\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the campaign was last updated in ISO 8601 format.\\t\"\
-        },\
-        \"Limits\" : {\
-          \"shape\" : \"CampaignLimits\",\
-          \"documentation\" : \"The campaign limits settings.\"\
-        },\
-        \"MessageConfiguration\" : {\
-          \"shape\" : \"MessageConfiguration\",\
-          \"documentation\" : \"The message configuration settings.\"\
-        },\
-        \"Name\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of the campaign.\"\
-        },\
-        \"Schedule\" : {\
-          \"shape\" : \"Schedule\",\
-          \"documentation\" : \"The campaign schedule.\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the segment to which the campaign sends messages.\"\
-        },\
-        \"SegmentVersion\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The version of the segment to which the campaign sends messages.\"\
-        },\
-        \"State\" : {\
-          \"shape\" : \"CampaignState\",\
-          \"documentation\" : \"The campaign status.\\n\\nAn A/B test campaign will have a status of COMPLETED only when all treatments have a status of COMPLETED.\"\
-        },\
-        \"TreatmentDescription\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom description for the treatment.\"\
-        },\
-        \"TreatmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of a variation of the campaign used for A/B testing.\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The campaign version number.\"\
-        }\
-      },\
-      \"documentation\" : \"Campaign definition\"\
-    },\
-    \"CampaignSmsMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The SMS text body.\"\
-        },\
-        \"MessageType\" : {\
-          \"shape\" : \"MessageType\",\
-          \"documentation\" : \"Is this is a transactional SMS message, otherwise a promotional message.\"\
-        },\
-        \"SenderId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Sender ID of sent message.\"\
-        }\
-      },\
-      \"documentation\" : \"SMS message configuration.\"\
-    },\
-    \"CampaignState\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignStatus\" : {\
-          \"shape\" : \"CampaignStatus\",\
-          \"documentation\" : \"The status of the campaign, or the status of a treatment that belongs to an A/B test campaign.\\n\\nValid values: SCHEDULED, EXECUTING, PENDING_NEXT_RUN, COMPLETED, PAUSED\"\
-        }\
-      },\
-      \"documentation\" : \"State of the Campaign\"\
-    },\
-    \"CampaignStatus\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"SCHEDULED\", \"EXECUTING\", \"PENDING_NEXT_RUN\", \"COMPLETED\", \"PAUSED\" ]\
-    },\
-    \"CampaignsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Item\" : {\
-          \"shape\" : \"ListOfCampaignResponse\",\
-          \"documentation\" : \"A list of campaigns.\"\
-        },\
-        \"NextToken\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The string that you use in a subsequent request to get the next page of results in a paginated response.\"\
-        }\
-      },\
-      \"documentation\" : \"List of available campaigns.\"\
-    },\
-    \"ChannelType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"GCM\", \"APNS\", \"APNS_SANDBOX\", \"ADM\", \"SMS\", \"EMAIL\" ]\
-    },\
-    \"CreateCampaignRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"WriteCampaignRequest\" : {\
-          \"shape\" : \"WriteCampaignRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"WriteCampaignRequest\" ],\
-      \"payload\" : \"WriteCampaignRequest\"\
-    },\
-    \"CreateCampaignResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignResponse\" : {\
-          \"shape\" : \"CampaignResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignResponse\" ],\
-      \"payload\" : \"CampaignResponse\"\
-    },\
-    \"CreateImportJobRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"ImportJobRequest\" : {\
-          \"shape\" : \"ImportJobRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"ImportJobRequest\" ],\
-      \"payload\" : \"ImportJobRequest\"\
-    },\
-    \"CreateImportJobResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ImportJobResponse\" : {\
-          \"shape\" : \"ImportJobResponse\"\
-        }\
-      },\
-      \"required\" : [ \"ImportJobResponse\" ],\
-      \"payload\" : \"ImportJobResponse\"\
-    },\
-    \"CreateSegmentRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"WriteSegmentRequest\" : {\
-          \"shape\" : \"WriteSegmentRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"WriteSegmentRequest\" ],\
-      \"payload\" : \"WriteSegmentRequest\"\
-    },\
-    \"CreateSegmentResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentResponse\" : {\
-          \"shape\" : \"SegmentResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentResponse\" ],\
-      \"payload\" : \"SegmentResponse\"\
-    },\
-    \"DefaultMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body of the notification, the email body or the text message.\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Default message substitutions. Can be overridden by individual address substitutions.\"\
-        }\
-      },\
-      \"documentation\" : \"Default Message across push notification, email, and sms.\"\
-    },\
-    \"DefaultPushNotificationMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Action\" : {\
-          \"shape\" : \"Action\",\
-          \"documentation\" : \"The action that occurs if the user taps a push notification delivered by the campaign: OPEN_APP - Your app launches, or it becomes the foreground app if it has been sent to the background. This is the default action. DEEP_LINK - Uses deep linking features in iOS and Android to open your app and display a designated user interface within the app. URL - The default mobile browser on the user's device launches and opens a web page at the URL you specify. Possible values include: OPEN_APP | DEEP_LINK | URL\"\
-        },\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body of the notification, the email body or the text message.\"\
-        },\
-        \"Data\" : {\
-          \"shape\" : \"MapOf__string\",\
-          \"documentation\" : \"The data payload used for a silent push. This payload is added to the notifications' data.pinpoint.jsonBody' object\"\
-        },\
-        \"SilentPush\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates if the message should display on the users device. Silent pushes can be used for Remote Configuration and Phone Home use cases.\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Default message substitutions. Can be overridden by individual address substitutions.\"\
-        },\
-        \"Title\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message title that displays above the message on the user's device.\"\
-        },\
-        \"Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL to open in the user's mobile browser. Used if the value for Action is URL.\"\
-        }\
-      },\
-      \"documentation\" : \"Default Push Notification Message.\"\
-    },\
-    \"DeleteApnsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"DeleteApnsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSChannelResponse\" : {\
-          \"shape\" : \"APNSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSChannelResponse\" ],\
-      \"payload\" : \"APNSChannelResponse\"\
-    },\
-    \"DeleteApnsSandboxChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"DeleteApnsSandboxChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSSandboxChannelResponse\" : {\
-          \"shape\" : \"APNSSandboxChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSSandboxChannelResponse\" ],\
-      \"payload\" : \"APNSSandboxChannelResponse\"\
-    },\
-    \"DeleteCampaignRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignId\", \"ApplicationId\" ]\
-    },\
-    \"DeleteCampaignResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignResponse\" : {\
-          \"shape\" : \"CampaignResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignResponse\" ],\
-      \"payload\" : \"CampaignResponse\"\
-    },\
-    \"DeleteEmailChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"DeleteEmailChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EmailChannelResponse\" : {\
-          \"shape\" : \"EmailChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"EmailChannelResponse\" ],\
-      \"payload\" : \"EmailChannelResponse\"\
-    },\
-    \"DeleteEventStreamRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\",\
-          \"documentation\": \"ApplicationId\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ],\
-      \"documentation\": \"DeleteEventStream Request\"\
-    },\
-    \"DeleteEventStreamResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EventStream\" : {\
-          \"shape\" : \"EventStream\"\
-        }\
-      },\
-      \"required\" : [ \"EventStream\" ],\
-      \"payload\" : \"EventStream\",\
-      \"documentation\": \"DeleteEventStream Response\"\
-    },\
-    \"DeleteGcmChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"DeleteGcmChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"GCMChannelResponse\" : {\
-          \"shape\" : \"GCMChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"GCMChannelResponse\" ],\
-      \"payload\" : \"GCMChannelResponse\"\
-    },\
-    \"DeleteSegmentRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"ApplicationId\" ]\
-    },\
-    \"DeleteSegmentResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentResponse\" : {\
-          \"shape\" : \"SegmentResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentResponse\" ],\
-      \"payload\" : \"SegmentResponse\"\
-    },\
-    \"DeleteSmsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"DeleteSmsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SMSChannelResponse\" : {\
-          \"shape\" : \"SMSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SMSChannelResponse\" ],\
-      \"payload\" : \"SMSChannelResponse\"\
-    },\
-    \"DeliveryStatus\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"SUCCESSFUL\", \"THROTTLED\", \"TEMPORARY_FAILURE\", \"PERMANENT_FAILURE\" ]\
-    },\
-    \"DimensionType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"INCLUSIVE\", \"EXCLUSIVE\" ]\
-    },\
-    \"DirectMessageConfiguration\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSMessage\" : {\
-          \"shape\" : \"APNSMessage\",\
-          \"documentation\" : \"The message to APNS channels. Overrides the default push notification message.\"\
-        },\
-        \"DefaultMessage\" : {\
-          \"shape\" : \"DefaultMessage\",\
-          \"documentation\" : \"The default message for all channels.\"\
-        },\
-        \"DefaultPushNotificationMessage\" : {\
-          \"shape\" : \"DefaultPushNotificationMessage\",\
-          \"documentation\" : \"The default push notification message for all push channels.\"\
-        },\
-        \"GCMMessage\" : {\
-          \"shape\" : \"GCMMessage\",\
-          \"documentation\" : \"The message to GCM channels. Overrides the default push notification message.\"\
-        },\
-        \"SMSMessage\" : {\
-          \"shape\" : \"SMSMessage\",\
-          \"documentation\" : \"The message to SMS channels. Overrides the default message.\"\
-        }\
-      },\
-      \"documentation\" : \"The message configuration.\"\
-    },\
-    \"Duration\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"HR_24\", \"DAY_7\", \"DAY_14\", \"DAY_30\" ]\
-    },\
-    \"EmailChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"FromAddress\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The email address used to send emails from.\"\
-        },\
-        \"Identity\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ARN of an identity verified with SES.\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ARN of an IAM Role used to submit events to Mobile Analytics' event ingestion service\"\
-        }\
-      },\
-      \"documentation\" : \"Email Channel Request\"\
-    },\
-    \"EmailChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Application id\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date that the settings were last updated in ISO 8601 format.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"FromAddress\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The email address used to send emails from.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Channel ID. Not used, only for backwards compatibility.\"\
-        },\
-        \"Identity\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ARN of an identity verified with SES.\"\
-        },\
-        \"IsArchived\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Is this channel archived\"\
-        },\
-        \"LastModifiedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Who last updated this entry\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Last date this was updated\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Platform type. Will be \\\"EMAIL\\\"\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ARN of an IAM Role used to submit events to Mobile Analytics' event ingestion service\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Version of channel\"\
-        }\
-      },\
-      \"documentation\" : \"Email Channel Response.\"\
-    },\
-    \"EndpointBatchItem\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Address\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The address or token of the endpoint as provided by your push provider (e.g. DeviceToken or RegistrationId).\"\
-        },\
-        \"Attributes\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Custom attributes that your app reports to Amazon Pinpoint. You can use these attributes as selection criteria when you create a segment.\"\
-        },\
-        \"ChannelType\" : {\
-          \"shape\" : \"ChannelType\",\
-          \"documentation\" : \"The channel type.\\n\\nValid values: APNS, GCM\"\
-        },\
-        \"Demographic\" : {\
-          \"shape\" : \"EndpointDemographic\",\
-          \"documentation\" : \"The endpoint demographic attributes.\"\
-        },\
-        \"EffectiveDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The last time the endpoint was updated. Provided in ISO 8601 format.\"\
-        },\
-        \"EndpointStatus\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint status. Can be either ACTIVE or INACTIVE. Will be set to INACTIVE if a delivery fails. Will be set to ACTIVE if the address is updated.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique Id for the Endpoint in the batch.\"\
-        },\
-        \"Location\" : {\
-          \"shape\" : \"EndpointLocation\",\
-          \"documentation\" : \"The endpoint location attributes.\"\
-        },\
-        \"Metrics\" : {\
-          \"shape\" : \"MapOf__double\",\
-          \"documentation\" : \"Custom metrics that your app reports to Amazon Pinpoint.\"\
-        },\
-        \"OptOut\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Indicates whether a user has opted out of receiving messages with one of the following values:\\n\\nALL Ã¢â¬â User receives all messages.\\nNONE Ã¢â¬â User receives no messages.\"\
-        },\
-        \"RequestId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID for the most recent request to update the endpoint.\"\
-        },\
-        \"User\" : {\
-          \"shape\" : \"EndpointUser\",\
-          \"documentation\" : \"Custom user-specific attributes that your app reports to Amazon Pinpoint.\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint update request\"\
-    },\
-    \"EndpointBatchRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Item\" : {\
-          \"shape\" : \"ListOfEndpointBatchItem\",\
-          \"documentation\" : \"List of items to update. Maximum 100 items\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint batch update request.\"\
-    },\
-    \"EndpointDemographic\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"AppVersion\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The version of the application associated with the endpoint.\"\
-        },\
-        \"Locale\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint locale in the following format: The ISO 639-1 alpha-2 code, followed by an underscore, followed by an ISO 3166-1 alpha-2 value.\\n\"\
-        },\
-        \"Make\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint make, such as such as Apple or Samsung.\"\
-        },\
-        \"Model\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint model, such as iPhone.\"\
-        },\
-        \"ModelVersion\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint model version.\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint platform, such as ios or android.\"\
-        },\
-        \"PlatformVersion\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint platform version.\"\
-        },\
-        \"Timezone\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The timezone of the endpoint. Specified as a tz database value, such as Americas/Los_Angeles.\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint demographic data\"\
-    },\
-    \"EndpointLocation\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"City\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The city where the endpoint is located.\"\
-        },\
-        \"Country\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Country according to ISO 3166-1 Alpha-2 codes. For example, US.\"\
-        },\
-        \"Latitude\" : {\
-          \"shape\" : \"__double\",\
-          \"documentation\" : \"The latitude of the endpoint location. Rounded to one decimal (Roughly corresponding to a mile).\"\
-        },\
-        \"Longitude\" : {\
-          \"shape\" : \"__double\",\
-          \"documentation\" : \"The longitude of the endpoint location. Rounded to one decimal (Roughly corresponding to a mile).\"\
-        },\
-        \"PostalCode\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The postal code or zip code of the endpoint.\"\
-        },\
-        \"Region\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The region of the endpoint location. For example, corresponds to a state in US.\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint location data\"\
-    },\
-    \"EndpointRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Address\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The address or token of the endpoint as provided by your push provider (e.g. DeviceToken or RegistrationId).\"\
-        },\
-        \"Attributes\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Custom attributes that your app reports to Amazon Pinpoint. You can use these attributes as selection criteria when you create a segment.\"\
-        },\
-        \"ChannelType\" : {\
-          \"shape\" : \"ChannelType\",\
-          \"documentation\" : \"The channel type.\\n\\nValid values: APNS, GCM\"\
-        },\
-        \"Demographic\" : {\
-          \"shape\" : \"EndpointDemographic\",\
-          \"documentation\" : \"The endpoint demographic attributes.\"\
-        },\
-        \"EffectiveDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The last time the endpoint was updated. Provided in ISO 8601 format.\"\
-        },\
-        \"EndpointStatus\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint status. Can be either ACTIVE or INACTIVE. Will be set to INACTIVE if a delivery fails. Will be set to ACTIVE if the address is updated.\"\
-        },\
-        \"Location\" : {\
-          \"shape\" : \"EndpointLocation\",\
-          \"documentation\" : \"The endpoint location attributes.\"\
-        },\
-        \"Metrics\" : {\
-          \"shape\" : \"MapOf__double\",\
-          \"documentation\" : \"Custom metrics that your app reports to Amazon Pinpoint.\"\
-        },\
-        \"OptOut\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Indicates whether a user has opted out of receiving messages with one of the following values:\\n\\nALL Ã¢â¬â User receives all messages.\\nNONE Ã¢â¬â User receives no messages.\"\
-        },\
-        \"RequestId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID for the most recent request to update the endpoint.\"\
-        },\
-        \"User\" : {\
-          \"shape\" : \"EndpointUser\",\
-          \"documentation\" : \"Custom user-specific attributes that your app reports to Amazon Pinpoint.\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint update request\"\
-    },\
-    \"EndpointResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Address\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The address or token of the endpoint as provided by your push provider (e.g. DeviceToken or RegistrationId).\"\
-        },\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application associated with the endpoint.\"\
-        },\
-        \"Attributes\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Custom attributes that your app reports to Amazon Pinpoint. You can use these attributes as selection criteria when you create a segment.\"\
-        },\
-        \"ChannelType\" : {\
-          \"shape\" : \"ChannelType\",\
-          \"documentation\" : \"The channel type.\\n\\nValid values: APNS, GCM\"\
-        },\
-        \"CohortId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A number from 0 - 99 that represents the cohort the endpoint is assigned to. Endpoints are grouped into cohorts randomly, and each cohort contains approximately 1 percent of the endpoints for an app. Amazon Pinpoint assigns cohorts to the holdout or treatment allocations for a campaign.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The last time the endpoint was created. Provided in ISO 8601 format.\"\
-        },\
-        \"Demographic\" : {\
-          \"shape\" : \"EndpointDemographic\",\
-          \"documentation\" : \"The endpoint demographic attributes.\"\
-        },\
-        \"EffectiveDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The last time the endpoint was updated. Provided in ISO 8601 format.\"\
-        },\
-        \"EndpointStatus\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The endpoint status. Can be either ACTIVE or INACTIVE. Will be set to INACTIVE if a delivery fails. Will be set to ACTIVE if the address is updated.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID that you assigned to the endpoint. The ID should be a globally unique identifier (GUID) to ensure that it is unique compared to all other endpoints for the application.\"\
-        },\
-        \"Location\" : {\
-          \"shape\" : \"EndpointLocation\",\
-          \"documentation\" : \"The endpoint location attributes.\"\
-        },\
-        \"Metrics\" : {\
-          \"shape\" : \"MapOf__double\",\
-          \"documentation\" : \"Custom metrics that your app reports to Amazon Pinpoint.\"\
-        },\
-        \"OptOut\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Indicates whether a user has opted out of receiving messages with one of the following values:\\n\\nALL Ã¢â¬â User receives all messages.\\nNONE Ã¢â¬â User receives no messages.\"\
-        },\
-        \"RequestId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID for the most recent request to update the endpoint.\"\
-        },\
-        \"User\" : {\
-          \"shape\" : \"EndpointUser\",\
-          \"documentation\" : \"Custom user-specific attributes that your app reports to Amazon Pinpoint.\"\
-        },\
-        \"ShardId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ShardId of endpoint\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint response\"\
-    },\
-    \"EndpointUser\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"UserAttributes\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Custom attributes specific to the user.\"\
-        },\
-        \"UserId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID of the user.\"\
-        }\
-      },\
-      \"documentation\" : \"Endpoint user specific custom userAttributes\"\
-    },\
-    \"EventStream\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application from which events should be published.\"\
-        },\
-        \"DestinationStreamArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Amazon Resource Name (ARN) of the Amazon Kinesis stream or Firehose delivery stream to which you want to publish events.\\n Firehose ARN: arn:aws:firehose:REGION:ACCOUNT_ID:deliverystream/STREAM_NAME\\n Kinesis ARN: arn:aws:kinesis:REGION:ACCOUNT_ID:stream/STREAM_NAME\"\
-        },\
-        \"ExternalId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The external ID assigned the IAM role that authorizes Amazon Pinpoint to publish to the stream.\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the event stream was last updated in ISO 8601 format.\"\
-        },\
-        \"LastUpdatedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The IAM user who last modified the event stream.\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The IAM role that authorizes Amazon Pinpoint to publish events to the stream in your account.\"\
-        }\
-      },\
-      \"documentation\" : \"Model for an event publishing subscription export.\"\
-    },\
-    \"ForbiddenException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 403\
-      }\
-    },\
-    \"Format\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"CSV\", \"JSON\" ]\
-    },\
-    \"Frequency\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"ONCE\", \"HOURLY\", \"DAILY\", \"WEEKLY\", \"MONTHLY\" ]\
-    },\
-    \"GCMChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApiKey\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Platform credential API key from Google.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        }\
-      },\
-      \"documentation\" : \"Google Cloud Messaging credentials\"\
-    },\
-    \"GCMChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application to which the channel applies.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"When was this segment created\"\
-        },\
-        \"Credential\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The GCM API key from Google.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Channel ID. Not used, only for backwards compatibility.\"\
-        },\
-        \"IsArchived\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Is this channel archived\"\
-        },\
-        \"LastModifiedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Who last updated this entry\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Last date this was updated\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The platform type. Will be GCM\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Version of channel\"\
-        }\
-      },\
-      \"documentation\" : \"Google Cloud Messaging channel definition\"\
-    },\
-    \"GCMMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Action\" : {\
-          \"shape\" : \"Action\",\
-          \"documentation\" : \"The action that occurs if the user taps a push notification delivered by the campaign: OPEN_APP - Your app launches, or it becomes the foreground app if it has been sent to the background. This is the default action. DEEP_LINK - Uses deep linking features in iOS and Android to open your app and display a designated user interface within the app. URL - The default mobile browser on the user's device launches and opens a web page at the URL you specify. Possible values include: OPEN_APP | DEEP_LINK | URL\"\
-        },\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body of the notification, the email body or the text message.\"\
-        },\
-        \"CollapseKey\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"This parameter identifies a group of messages (e.g., with collapse_key: \\\"Updates Available\\\") that can be collapsed, so that only the last message gets sent when delivery can be resumed. This is intended to avoid sending too many of the same messages when the device comes back online or becomes active.\"\
-        },\
-        \"Data\" : {\
-          \"shape\" : \"MapOf__string\",\
-          \"documentation\" : \"The data payload used for a silent push. This payload is added to the notifications' data.pinpoint.jsonBody' object\"\
-        },\
-        \"IconReference\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The icon image name of the asset saved in your application.\"\
-        },\
-        \"ImageIconUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to an image used as the large icon to the notification content view.\"\
-        },\
-        \"ImageUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to an image used in the push notification.\"\
-        },\
-        \"RawContent\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Raw JSON formatted string to be used as the payload. This value overrides the message.\"\
-        },\
-        \"RestrictedPackageName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"This parameter specifies the package name of the application where the registration tokens must match in order to receive the message.\"\
-        },\
-        \"SilentPush\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates if the message should display on the users device. Silent pushes can be used for Remote Configuration and Phone Home use cases.\"\
-        },\
-        \"SmallImageIconUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to an image used as the small icon for the notification which will be used to represent the notification in the status bar and content view\"\
-        },\
-        \"Sound\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Indicates a sound to play when the device receives the notification. Supports default, or the filename of a sound resource bundled in the app. Android sound files must reside in /res/raw/\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Default message substitutions. Can be overridden by individual address substitutions.\"\
-        },\
-        \"Title\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message title that displays above the message on the user's device.\"\
-        },\
-        \"Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL to open in the user's mobile browser. Used if the value for Action is URL.\"\
-        }\
-      },\
-      \"documentation\" : \"GCM Message.\"\
-    },\
-    \"GetApnsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetApnsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSChannelResponse\" : {\
-          \"shape\" : \"APNSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSChannelResponse\" ],\
-      \"payload\" : \"APNSChannelResponse\"\
-    },\
-    \"GetApnsSandboxChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetApnsSandboxChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSSandboxChannelResponse\" : {\
-          \"shape\" : \"APNSSandboxChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSSandboxChannelResponse\" ],\
-      \"payload\" : \"APNSSandboxChannelResponse\"\
-    },\
-    \"GetApplicationSettingsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetApplicationSettingsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationSettingsResource\" : {\
-          \"shape\" : \"ApplicationSettingsResource\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationSettingsResource\" ],\
-      \"payload\" : \"ApplicationSettingsResource\"\
-    },\
-    \"GetCampaignActivitiesRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"CampaignId\" ]\
-    },\
-    \"GetCampaignActivitiesResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ActivitiesResponse\" : {\
-          \"shape\" : \"ActivitiesResponse\"\
-        }\
-      },\
-      \"required\" : [ \"ActivitiesResponse\" ],\
-      \"payload\" : \"ActivitiesResponse\"\
-    },\
-    \"GetCampaignRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignId\", \"ApplicationId\" ]\
-    },\
-    \"GetCampaignResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignResponse\" : {\
-          \"shape\" : \"CampaignResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignResponse\" ],\
-      \"payload\" : \"CampaignResponse\"\
-    },\
-    \"GetCampaignVersionRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"version\"\
-        }\
-      },\
-      \"required\" : [ \"Version\", \"ApplicationId\", \"CampaignId\" ]\
-    },\
-    \"GetCampaignVersionResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignResponse\" : {\
-          \"shape\" : \"CampaignResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignResponse\" ],\
-      \"payload\" : \"CampaignResponse\"\
-    },\
-    \"GetCampaignVersionsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"CampaignId\" ]\
-    },\
-    \"GetCampaignVersionsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignsResponse\" : {\
-          \"shape\" : \"CampaignsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignsResponse\" ],\
-      \"payload\" : \"CampaignsResponse\"\
-    },\
-    \"GetCampaignsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetCampaignsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignsResponse\" : {\
-          \"shape\" : \"CampaignsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignsResponse\" ],\
-      \"payload\" : \"CampaignsResponse\"\
-    },\
-    \"GetEmailChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetEmailChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EmailChannelResponse\" : {\
-          \"shape\" : \"EmailChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"EmailChannelResponse\" ],\
-      \"payload\" : \"EmailChannelResponse\"\
-    },\
-    \"GetEndpointRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"EndpointId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"endpoint-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"EndpointId\" ]\
-    },\
-    \"GetEndpointResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EndpointResponse\" : {\
-          \"shape\" : \"EndpointResponse\"\
-        }\
-      },\
-      \"required\" : [ \"EndpointResponse\" ],\
-      \"payload\" : \"EndpointResponse\"\
-    },\
-    \"GetEventStreamRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\",\
-          \"documentation\": \"ApplicationId\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ],\
-      \"documentation\": \"GetEventStream Request\"\
-    },\
-    \"GetEventStreamResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EventStream\" : {\
-          \"shape\" : \"EventStream\"\
-        }\
-      },\
-      \"required\" : [ \"EventStream\" ],\
-      \"payload\" : \"EventStream\",\
-      \"documentation\": \"GetEventStream Response\"\
-    },\
-    \"GetGcmChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetGcmChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"GCMChannelResponse\" : {\
-          \"shape\" : \"GCMChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"GCMChannelResponse\" ],\
-      \"payload\" : \"GCMChannelResponse\"\
-    },\
-    \"GetImportJobRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"JobId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"job-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"JobId\" ]\
-    },\
-    \"GetImportJobResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ImportJobResponse\" : {\
-          \"shape\" : \"ImportJobResponse\"\
-        }\
-      },\
-      \"required\" : [ \"ImportJobResponse\" ],\
-      \"payload\" : \"ImportJobResponse\"\
-    },\
-    \"GetImportJobsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetImportJobsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ImportJobsResponse\" : {\
-          \"shape\" : \"ImportJobsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"ImportJobsResponse\" ],\
-      \"payload\" : \"ImportJobsResponse\"\
-    },\
-    \"GetSegmentImportJobsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"ApplicationId\" ]\
-    },\
-    \"GetSegmentImportJobsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ImportJobsResponse\" : {\
-          \"shape\" : \"ImportJobsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"ImportJobsResponse\" ],\
-      \"payload\" : \"ImportJobsResponse\"\
-    },\
-    \"GetSegmentRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"ApplicationId\" ]\
-    },\
-    \"GetSegmentResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentResponse\" : {\
-          \"shape\" : \"SegmentResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentResponse\" ],\
-      \"payload\" : \"SegmentResponse\"\
-    },\
-    \"GetSegmentVersionRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"version\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"Version\", \"ApplicationId\" ]\
-    },\
-    \"GetSegmentVersionResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentResponse\" : {\
-          \"shape\" : \"SegmentResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentResponse\" ],\
-      \"payload\" : \"SegmentResponse\"\
-    },\
-    \"GetSegmentVersionsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"ApplicationId\" ]\
-    },\
-    \"GetSegmentVersionsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentsResponse\" : {\
-          \"shape\" : \"SegmentsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentsResponse\" ],\
-      \"payload\" : \"SegmentsResponse\"\
-    },\
-    \"GetSegmentsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"PageSize\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"page-size\"\
-        },\
-        \"Token\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"querystring\",\
-          \"locationName\" : \"token\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetSegmentsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentsResponse\" : {\
-          \"shape\" : \"SegmentsResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentsResponse\" ],\
-      \"payload\" : \"SegmentsResponse\"\
-    },\
-    \"GetSmsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\" ]\
-    },\
-    \"GetSmsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SMSChannelResponse\" : {\
-          \"shape\" : \"SMSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SMSChannelResponse\" ],\
-      \"payload\" : \"SMSChannelResponse\"\
-    },\
-    \"ImportJobRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"DefineSegment\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Sets whether the endpoints create a segment when they are imported.\"\
-        },\
-        \"ExternalId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A unique, custom ID assigned to the IAM role that restricts who can assume the role.\\t\"\
-        },\
-        \"Format\" : {\
-          \"shape\" : \"Format\",\
-          \"documentation\" : \"The format of the files that contain the endpoint definitions.\\nValid values: CSV, JSON\"\
-        },\
-        \"RegisterEndpoints\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Sets whether the endpoints are registered with Amazon Pinpoint when they are imported.\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Amazon Resource Name (ARN) of an IAM role that grants Amazon Pinpoint access to the Amazon S3 location that contains the endpoints to import.\"\
-        },\
-        \"S3Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A URL that points to the location within an Amazon S3 bucket that contains the endpoints to import. The location can be a folder or a single file.\\nThe URL should follow this format: s3://bucket-name/folder-name/file-name\\n\\nAmazon Pinpoint will import endpoints from this location and any subfolders it contains.\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the segment to update if the import job is meant to update an existing segment.\"\
-        },\
-        \"SegmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom name for the segment created by the import job. Use if DefineSegment is true.\"\
-        }\
-      }\
-    },\
-    \"ImportJobResource\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"DefineSegment\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Sets whether the endpoints create a segment when they are imported.\"\
-        },\
-        \"ExternalId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A unique, custom ID assigned to the IAM role that restricts who can assume the role.\\t\"\
-        },\
-        \"Format\" : {\
-          \"shape\" : \"Format\",\
-          \"documentation\" : \"The format of the files that contain the endpoint definitions.\\nValid values: CSV, JSON\"\
-        },\
-        \"RegisterEndpoints\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Sets whether the endpoints are registered with Amazon Pinpoint when they are imported.\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Amazon Resource Name (ARN) of an IAM role that grants Amazon Pinpoint access to the Amazon S3 location that contains the endpoints to import.\"\
-        },\
-        \"S3Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A URL that points to the location within an Amazon S3 bucket that contains the endpoints to import. The location can be a folder or a single file.\\nThe URL should follow this format: s3://bucket-name/folder-name/file-name\\n\\nAmazon Pinpoint will import endpoints from this location and any subfolders it contains.\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the segment to update if the import job is meant to update an existing segment.\"\
-        },\
-        \"SegmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom name for the segment created by the import job. Use if DefineSegment is true.\"\
-        }\
-      }\
-    },\
-    \"ImportJobResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID of the application to which the import job applies.\"\
-        },\
-        \"CompletedPieces\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The number of pieces that have successfully imported as of the time of the request.\"\
-        },\
-        \"CompletionDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the import job completed in ISO 8601 format.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the import job was created in ISO 8601 format.\"\
-        },\
-        \"Definition\" : {\
-          \"shape\" : \"ImportJobResource\",\
-          \"documentation\" : \"The import job settings.\"\
-        },\
-        \"FailedPieces\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The number of pieces that have failed to import as of the time of the request.\"\
-        },\
-        \"Failures\" : {\
-          \"shape\" : \"ListOf__string\",\
-          \"documentation\" : \"Provides up to 100 of the first failed entries for the job, if any exist.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique ID of the import job.\"\
-        },\
-        \"JobStatus\" : {\
-          \"shape\" : \"JobStatus\",\
-          \"documentation\" : \"The status of the import job.\\nValid values: CREATED, INITIALIZING, PROCESSING, COMPLETING, COMPLETED, FAILING, FAILED\\n\\nThe job status is FAILED if one or more pieces failed to import.\"\
-        },\
-        \"TotalFailures\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The number of endpoints that failed to import; for example, because of syntax errors.\"\
-        },\
-        \"TotalPieces\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The total number of pieces that must be imported to finish the job. Each piece is an approximately equal portion of the endpoints to import.\"\
-        },\
-        \"TotalProcessed\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The number of endpoints that were processed by the import job.\"\
-        },\
-        \"Type\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The job type. Will be Import.\"\
-        }\
-      }\
-    },\
-    \"ImportJobsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Item\" : {\
-          \"shape\" : \"ListOfImportJobResponse\",\
-          \"documentation\" : \"A list of import jobs for the application.\"\
-        },\
-        \"NextToken\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The string that you use in a subsequent request to get the next page of results in a paginated response.\"\
-        }\
-      },\
-      \"documentation\" : \"Import job list.\"\
-    },\
-    \"InternalServerErrorException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 500\
-      }\
-    },\
-    \"JobStatus\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"CREATED\", \"INITIALIZING\", \"PROCESSING\", \"COMPLETING\", \"COMPLETED\", \"FAILING\", \"FAILED\" ]\
-    },\
-    \"ListOfActivityResponse\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"ActivityResponse\"\
-      }\
-    },\
-    \"ListOfCampaignResponse\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"CampaignResponse\"\
-      }\
-    },\
-    \"ListOfEndpointBatchItem\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"EndpointBatchItem\"\
-      }\
-    },\
-    \"ListOfImportJobResponse\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"ImportJobResponse\"\
-      }\
-    },\
-    \"ListOfSegmentResponse\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"SegmentResponse\"\
-      }\
-    },\
-    \"ListOfTreatmentResource\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"TreatmentResource\"\
-      }\
-    },\
-    \"ListOfWriteTreatmentResource\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"WriteTreatmentResource\"\
-      }\
-    },\
-    \"ListOf__string\" : {\
-      \"type\" : \"list\",\
-      \"member\" : {\
-        \"shape\" : \"__string\"\
-      }\
-    },\
-    \"MapOfAddressConfiguration\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"AddressConfiguration\"\
-      }\
-    },\
-    \"MapOfAttributeDimension\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"AttributeDimension\"\
-      }\
-    },\
-    \"MapOfListOf__string\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"ListOf__string\"\
-      }\
-    },\
-    \"MapOfMessageResult\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"MessageResult\"\
-      }\
-    },\
-    \"MapOf__double\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"__double\"\
-      }\
-    },\
-    \"MapOf__integer\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"__integer\"\
-      }\
-    },\
-    \"MapOf__string\" : {\
-      \"type\" : \"map\",\
-      \"key\" : {\
-        \"shape\" : \"__string\"\
-      },\
-      \"value\" : {\
-        \"shape\" : \"__string\"\
-      }\
-    },\
-    \"Message\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Action\" : {\
-          \"shape\" : \"Action\",\
-          \"documentation\" : \"The action that occurs if the user taps a push notification delivered by the campaign:\\nOPEN_APP - Your app launches, or it becomes the foreground app if it has been sent to the background. This is the default action.\\n\\nDEEP_LINK - Uses deep linking features in iOS and Android to open your app and display a designated user interface within the app.\\n\\nURL - The default mobile browser on the user's device launches and opens a web page at the URL you specify.\"\
-        },\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body. Can include up to 140 characters.\"\
-        },\
-        \"ImageIconUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to the icon image for the push notification icon, for example, the app icon.\"\
-        },\
-        \"ImageSmallIconUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to the small icon image for the push notification icon, for example, the app icon.\"\
-        },\
-        \"ImageUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to an image used in the push notification.\"\
-        },\
-        \"JsonBody\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The JSON payload used for a silent push.\"\
-        },\
-        \"MediaUrl\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL that points to the media resource, for example a .mp4 or .gif file.\"\
-        },\
-        \"SilentPush\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates if the message should display on the users device.\\n\\nSilent pushes can be used for Remote Configuration and Phone Home use cases. \"\
-        },\
-        \"Title\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message title that displays above the message on the user's device.\"\
-        },\
-        \"Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The URL to open in the user's mobile browser. Used if the value for Action is URL.\"\
-        }\
-      }\
-    },\
-    \"MessageBody\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\"\
-    },\
-    \"MessageConfiguration\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSMessage\" : {\
-          \"shape\" : \"Message\",\
-          \"documentation\" : \"The message that the campaign delivers to APNS channels. Overrides the default message.\"\
-        },\
-        \"DefaultMessage\" : {\
-          \"shape\" : \"Message\",\
-          \"documentation\" : \"The default message for all channels.\"\
-        },\
-        \"EmailMessage\" : {\
-          \"shape\" : \"CampaignEmailMessage\",\
-          \"documentation\" : \"The email message configuration.\"\
-        },\
-        \"GCMMessage\" : {\
-          \"shape\" : \"Message\",\
-          \"documentation\" : \"The message that the campaign delivers to GCM channels. Overrides the default message.\"\
-        },\
-        \"SMSMessage\" : {\
-          \"shape\" : \"CampaignSmsMessage\",\
-          \"documentation\" : \"The SMS message configuration.\"\
-        }\
-      },\
-      \"documentation\" : \"Message configuration for a campaign.\"\
-    },\
-    \"MessageRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Addresses\" : {\
-          \"shape\" : \"MapOfAddressConfiguration\",\
-          \"documentation\" : \"A map of destination addresses, with the address as the key(Email address, phone number or push token) and the Address Configuration as the value.\"\
-        },\
-        \"Context\" : {\
-          \"shape\" : \"MapOf__string\",\
-          \"documentation\" : \"A map of custom attributes to attributes to be attached to the message. This payload is added to the push notification's 'data.pinpoint' object or added to the email/sms delivery receipt event attributes.\"\
-        },\
-        \"MessageConfiguration\" : {\
-          \"shape\" : \"DirectMessageConfiguration\",\
-          \"documentation\" : \"Message configuration.\"\
-        }\
-      },\
-      \"documentation\" : \"Send message request.\"\
-    },\
-    \"MessageResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Application id of the message.\"\
-        },\
-        \"RequestId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Original request Id for which this message was delivered.\"\
-        },\
-        \"Result\" : {\
-          \"shape\" : \"MapOfMessageResult\",\
-          \"documentation\" : \"A map containing a multi part response for each address, with the address as the key(Email address, phone number or push token) and the result as the value.\"\
-        }\
-      },\
-      \"documentation\" : \"Send message response.\"\
-    },\
-    \"MessageResult\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"DeliveryStatus\" : {\
-          \"shape\" : \"DeliveryStatus\",\
-          \"documentation\" : \"Delivery status of message.\"\
-        },\
-        \"StatusCode\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Downstream service status code.\"\
-        },\
-        \"StatusMessage\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Status message for message delivery.\"\
-        },\
-        \"UpdatedToken\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"If token was updated as part of delivery. (This is GCM Specific)\"\
-        }\
-      },\
-      \"documentation\" : \"The result from sending a message to an address.\"\
-    },\
-    \"MessageType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"TRANSACTIONAL\", \"PROMOTIONAL\" ]\
-    },\
-    \"MethodNotAllowedException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 405\
-      }\
-    },\
-    \"NotFoundException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 404\
-      }\
-    },\
-    \"PutEventStreamRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\",\
-          \"documentation\": \"ApplicationId\"\
-        },\
-        \"WriteEventStream\" : {\
-          \"shape\" : \"WriteEventStream\",\
-          \"documentation\": \"EventStream to write.\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"WriteEventStream\" ],\
-      \"payload\" : \"WriteEventStream\",\
-      \"documentation\": \"PutEventStream Request\"\
-    },\
-    \"PutEventStreamResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EventStream\" : {\
-          \"shape\" : \"EventStream\"\
-        }\
-      },\
-      \"required\" : [ \"EventStream\" ],\
-      \"payload\" : \"EventStream\",\
-      \"documentation\": \"PutEventStream Response\"\
-    },\
-    \"QuietTime\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"End\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The default end time for quiet time in ISO 8601 format.\"\
-        },\
-        \"Start\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The default start time for quiet time in ISO 8601 format.\"\
-        }\
-      },\
-      \"documentation\" : \"Quiet Time\"\
-    },\
-    \"RecencyDimension\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Duration\" : {\
-          \"shape\" : \"Duration\",\
-          \"documentation\" : \"The length of time during which users have been active or inactive with your app.\\nValid values: HR_24, DAY_7, DAY_14, DAY_30\"\
-        },\
-        \"RecencyType\" : {\
-          \"shape\" : \"RecencyType\",\
-          \"documentation\" : \"The recency dimension type:\\nACTIVE - Users who have used your app within the specified duration are included in the segment.\\nINACTIVE - Users who have not used your app within the specified duration are included in the segment.\"\
-        }\
-      },\
-      \"documentation\" : \"Define how a segment based on recency of use.\"\
-    },\
-    \"RecencyType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"ACTIVE\", \"INACTIVE\" ]\
-    },\
-    \"SMSChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"SenderId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Sender identifier of your messages.\"\
-        }\
-      },\
-      \"documentation\" : \"SMS Channel Request\"\
-    },\
-    \"SMSChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Application id\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date that the settings were last updated in ISO 8601 format.\"\
-        },\
-        \"Enabled\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"If the channel is enabled for sending messages.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Channel ID. Not used, only for backwards compatibility.\"\
-        },\
-        \"IsArchived\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Is this channel archived\"\
-        },\
-        \"LastModifiedBy\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Who last updated this entry\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Last date this was updated\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Platform type. Will be \\\"SMS\\\"\"\
-        },\
-        \"SenderId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Sender identifier of your messages.\"\
-        },\
-        \"ShortCode\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The short code registered with the phone provider.\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"Version of channel\"\
-        }\
-      },\
-      \"documentation\" : \"SMS Channel Response.\"\
-    },\
-    \"SMSMessage\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Body\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The message body of the notification, the email body or the text message.\"\
-        },\
-        \"MessageType\" : {\
-          \"shape\" : \"MessageType\",\
-          \"documentation\" : \"Is this a transaction priority message or lower priority.\"\
-        },\
-        \"SenderId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"Sender ID of sent message.\"\
-        },\
-        \"Substitutions\" : {\
-          \"shape\" : \"MapOfListOf__string\",\
-          \"documentation\" : \"Default message substitutions. Can be overridden by individual address substitutions.\"\
-        }\
-      },\
-      \"documentation\" : \"SMS Message.\"\
-    },\
-    \"Schedule\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EndTime\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The scheduled time that the campaign ends in ISO 8601 format.\"\
-        },\
-        \"Frequency\" : {\
-          \"shape\" : \"Frequency\",\
-          \"documentation\" : \"How often the campaign delivers messages.\\n\\nValid values: ONCE, HOURLY, DAILY, WEEKLY, MONTHLY\"\
-        },\
-        \"IsLocalTime\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates whether the campaign schedule takes effect according to each user's local time.\"\
-        },\
-        \"QuietTime\" : {\
-          \"shape\" : \"QuietTime\",\
-          \"documentation\" : \"The time during which the campaign sends no messages.\"\
-        },\
-        \"StartTime\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The scheduled time that the campaign begins in ISO 8601 format.\"\
-        },\
-        \"Timezone\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The starting UTC offset for the schedule if the value for isLocalTime is true\\n\\nValid values: \\nUTC\\nUTC+01\\nUTC+02\\nUTC+03\\nUTC+03:30\\nUTC+04\\nUTC+04:30\\nUTC+05\\nUTC+05:30\\nUTC+05:45\\nUTC+06\\nUTC+06:30\\nUTC+07\\nUTC+08\\nUTC+09\\nUTC+09:30\\nUTC+10\\nUTC+10:30\\nUTC+11\\nUTC+12\\nUTC+13\\nUTC-02\\nUTC-03\\nUTC-04\\nUTC-05\\nUTC-06\\nUTC-07\\nUTC-08\\nUTC-09\\nUTC-10\\nUTC-11\"\
-        }\
-      },\
-      \"documentation\" : \"Shcedule that defines when a campaign is run.\"\
-    },\
-    \"SegmentBehaviors\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Recency\" : {\
-          \"shape\" : \"RecencyDimension\",\
-          \"documentation\" : \"The recency of use.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment behavior dimensions\"\
-    },\
-    \"SegmentDemographics\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"AppVersion\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The app version criteria for the segment.\"\
-        },\
-        \"Channel\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The channel criteria for the segment.\"\
-        },\
-        \"DeviceType\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The device type criteria for the segment.\"\
-        },\
-        \"Make\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The device make criteria for the segment.\"\
-        },\
-        \"Model\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The device model criteria for the segment.\"\
-        },\
-        \"Platform\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The device platform criteria for the segment.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment demographic dimensions\"\
-    },\
-    \"SegmentDimensions\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Attributes\" : {\
-          \"shape\" : \"MapOfAttributeDimension\",\
-          \"documentation\" : \"Custom segment attributes.\"\
-        },\
-        \"Behavior\" : {\
-          \"shape\" : \"SegmentBehaviors\",\
-          \"documentation\" : \"The segment behaviors attributes.\"\
-        },\
-        \"Demographic\" : {\
-          \"shape\" : \"SegmentDemographics\",\
-          \"documentation\" : \"The segment demographics attributes.\"\
-        },\
-        \"Location\" : {\
-          \"shape\" : \"SegmentLocation\",\
-          \"documentation\" : \"The segment location attributes.\"\
-        },\
-        \"UserAttributes\" : {\
-          \"shape\" : \"MapOfAttributeDimension\",\
-          \"documentation\" : \"Custom segment user attributes.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment dimensions\"\
-    },\
-    \"SegmentImportResource\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ChannelCounts\" : {\
-          \"shape\" : \"MapOf__integer\",\
-          \"documentation\" : \"Channel type counts\"\
-        },\
-        \"ExternalId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A unique, custom ID assigned to the IAM role that restricts who can assume the role.\"\
-        },\
-        \"Format\" : {\
-          \"shape\" : \"Format\",\
-          \"documentation\" : \"The format of the endpoint files that were imported to create this segment.\\nValid values: CSV, JSON\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Amazon Resource Name (ARN) of an IAM role that grants Amazon Pinpoint access to the endpoints in Amazon S3.\"\
-        },\
-        \"S3Url\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A URL that points to the Amazon S3 location from which the endpoints for this segment were imported.\"\
-        },\
-        \"Size\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The number of endpoints that were successfully imported to create this segment.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment import definition.\"\
-    },\
-    \"SegmentLocation\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Country\" : {\
-          \"shape\" : \"SetDimension\",\
-          \"documentation\" : \"The country filter according to ISO 3166-1 Alpha-2 codes.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment location dimensions\"\
-    },\
-    \"SegmentResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the application to which the segment applies.\"\
-        },\
-        \"CreationDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the segment was created in ISO 8601 format.\"\
-        },\
-        \"Dimensions\" : {\
-          \"shape\" : \"SegmentDimensions\",\
-          \"documentation\" : \"The segment dimensions attributes.\"\
-        },\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique segment ID.\"\
-        },\
-        \"ImportDefinition\" : {\
-          \"shape\" : \"SegmentImportResource\",\
-          \"documentation\" : \"The import job settings.\"\
-        },\
-        \"LastModifiedDate\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The date the segment was last updated in ISO 8601 format.\"\
-        },\
-        \"Name\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The name of segment\"\
-        },\
-        \"SegmentType\" : {\
-          \"shape\" : \"SegmentType\",\
-          \"documentation\" : \"The segment type:\\nDIMENSIONAL - A dynamic segment built from selection criteria based on endpoint data reported by your app. You create this type of segment by using the segment builder in the Amazon Pinpoint console or by making a POST request to the segments resource.\\nIMPORT - A static segment built from an imported set of endpoint definitions. You create this type of segment by importing a segment in the Amazon Pinpoint console or by making a POST request to the jobs/import resource.\"\
-        },\
-        \"Version\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The segment version number.\"\
-        }\
-      },\
-      \"documentation\" : \"Segment definition.\"\
-    },\
-    \"SegmentType\" : {\
-      \"type\" : \"string\",\
-      \"enum\" : [ \"DIMENSIONAL\", \"IMPORT\" ]\
-    },\
-    \"SegmentsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Item\" : {\
-          \"shape\" : \"ListOfSegmentResponse\",\
-          \"documentation\" : \"The list of segments.\"\
-        },\
-        \"NextToken\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"An identifier used to retrieve the next page of results. The token is null if no additional pages exist.\"\
-        }\
-      },\
-      \"documentation\" : \"Segments in your account.\"\
-    },\
-    \"SendMessagesRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"MessageRequest\" : {\
-          \"shape\" : \"MessageRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"MessageRequest\" ],\
-      \"payload\" : \"MessageRequest\"\
-    },\
-    \"SendMessagesResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"MessageResponse\" : {\
-          \"shape\" : \"MessageResponse\"\
-        }\
-      },\
-      \"required\" : [ \"MessageResponse\" ],\
-      \"payload\" : \"MessageResponse\"\
-    },\
-    \"SetDimension\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"DimensionType\" : {\
-          \"shape\" : \"DimensionType\",\
-          \"documentation\" : \"The type of dimension:\\nINCLUSIVE - Endpoints that match the criteria are included in the segment.\\nEXCLUSIVE - Endpoints that match the criteria are excluded from the segment.\"\
-        },\
-        \"Values\" : {\
-          \"shape\" : \"ListOf__string\",\
-          \"documentation\" : \"The criteria values for the segment dimension. Endpoints with matching attribute values are included or excluded from the segment, depending on the setting for Type.\"\
-        }\
-      },\
-      \"documentation\" : \"Dimension specification of a segment.\"\
-    },\
-    \"TooManyRequestsException\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Message\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The error message returned from the API.\"\
-        },\
-        \"RequestID\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique message body ID.\"\
-        }\
-      },\
-      \"documentation\" : \"Simple message object.\",\
-      \"exception\" : true,\
-      \"error\" : {\
-        \"httpStatusCode\" : 429\
-      }\
-    },\
-    \"TreatmentResource\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Id\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The unique treatment ID.\"\
-        },\
-        \"MessageConfiguration\" : {\
-          \"shape\" : \"MessageConfiguration\",\
-          \"documentation\" : \"The message configuration settings.\"\
-        },\
-        \"Schedule\" : {\
-          \"shape\" : \"Schedule\",\
-          \"documentation\" : \"The campaign schedule.\"\
-        },\
-        \"SizePercent\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The allocated percentage of users for this treatment.\"\
-        },\
-        \"State\" : {\
-          \"shape\" : \"CampaignState\",\
-          \"documentation\" : \"The treatment status.\"\
-        },\
-        \"TreatmentDescription\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom description for the treatment.\"\
-        },\
-        \"TreatmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of a variation of the campaign used for A/B testing.\"\
-        }\
-      },\
-      \"documentation\" : \"Treatment resource\"\
-    },\
-    \"UpdateApnsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSChannelRequest\" : {\
-          \"shape\" : \"APNSChannelRequest\"\
-        },\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"APNSChannelRequest\" ],\
-      \"payload\" : \"APNSChannelRequest\"\
-    },\
-    \"UpdateApnsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSChannelResponse\" : {\
-          \"shape\" : \"APNSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSChannelResponse\" ],\
-      \"payload\" : \"APNSChannelResponse\"\
-    },\
-    \"UpdateApnsSandboxChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSSandboxChannelRequest\" : {\
-          \"shape\" : \"APNSSandboxChannelRequest\"\
-        },\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"APNSSandboxChannelRequest\" ],\
-      \"payload\" : \"APNSSandboxChannelRequest\"\
-    },\
-    \"UpdateApnsSandboxChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"APNSSandboxChannelResponse\" : {\
-          \"shape\" : \"APNSSandboxChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"APNSSandboxChannelResponse\" ],\
-      \"payload\" : \"APNSSandboxChannelResponse\"\
-    },\
-    \"UpdateApplicationSettingsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"WriteApplicationSettingsRequest\" : {\
-          \"shape\" : \"WriteApplicationSettingsRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"WriteApplicationSettingsRequest\" ],\
-      \"payload\" : \"WriteApplicationSettingsRequest\"\
-    },\
-    \"UpdateApplicationSettingsResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationSettingsResource\" : {\
-          \"shape\" : \"ApplicationSettingsResource\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationSettingsResource\" ],\
-      \"payload\" : \"ApplicationSettingsResource\"\
-    },\
-    \"UpdateCampaignRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"CampaignId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"campaign-id\"\
-        },\
-        \"WriteCampaignRequest\" : {\
-          \"shape\" : \"WriteCampaignRequest\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignId\", \"ApplicationId\", \"WriteCampaignRequest\" ],\
-      \"payload\" : \"WriteCampaignRequest\"\
-    },\
-    \"UpdateCampaignResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"CampaignResponse\" : {\
-          \"shape\" : \"CampaignResponse\"\
-        }\
-      },\
-      \"required\" : [ \"CampaignResponse\" ],\
-      \"payload\" : \"CampaignResponse\"\
-    },\
-    \"UpdateEmailChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"EmailChannelRequest\" : {\
-          \"shape\" : \"EmailChannelRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"EmailChannelRequest\" ],\
-      \"payload\" : \"EmailChannelRequest\"\
-    },\
-    \"UpdateEmailChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"EmailChannelResponse\" : {\
-          \"shape\" : \"EmailChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"EmailChannelResponse\" ],\
-      \"payload\" : \"EmailChannelResponse\"\
-    },\
-    \"UpdateEndpointRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"EndpointId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"endpoint-id\"\
-        },\
-        \"EndpointRequest\" : {\
-          \"shape\" : \"EndpointRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"EndpointId\", \"EndpointRequest\" ],\
-      \"payload\" : \"EndpointRequest\"\
-    },\
-    \"UpdateEndpointResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"MessageBody\" : {\
-          \"shape\" : \"MessageBody\"\
-        }\
-      },\
-      \"required\" : [ \"MessageBody\" ],\
-      \"payload\" : \"MessageBody\"\
-    },\
-    \"UpdateEndpointsBatchRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"EndpointBatchRequest\" : {\
-          \"shape\" : \"EndpointBatchRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"EndpointBatchRequest\" ],\
-      \"payload\" : \"EndpointBatchRequest\"\
-    },\
-    \"UpdateEndpointsBatchResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"MessageBody\" : {\
-          \"shape\" : \"MessageBody\"\
-        }\
-      },\
-      \"required\" : [ \"MessageBody\" ],\
-      \"payload\" : \"MessageBody\"\
-    },\
-    \"UpdateGcmChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"GCMChannelRequest\" : {\
-          \"shape\" : \"GCMChannelRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"GCMChannelRequest\" ],\
-      \"payload\" : \"GCMChannelRequest\"\
-    },\
-    \"UpdateGcmChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"GCMChannelResponse\" : {\
-          \"shape\" : \"GCMChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"GCMChannelResponse\" ],\
-      \"payload\" : \"GCMChannelResponse\"\
-    },\
-    \"UpdateSegmentRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"segment-id\"\
-        },\
-        \"WriteSegmentRequest\" : {\
-          \"shape\" : \"WriteSegmentRequest\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentId\", \"ApplicationId\", \"WriteSegmentRequest\" ],\
-      \"payload\" : \"WriteSegmentRequest\"\
-    },\
-    \"UpdateSegmentResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SegmentResponse\" : {\
-          \"shape\" : \"SegmentResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SegmentResponse\" ],\
-      \"payload\" : \"SegmentResponse\"\
-    },\
-    \"UpdateSmsChannelRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"ApplicationId\" : {\
-          \"shape\" : \"__string\",\
-          \"location\" : \"uri\",\
-          \"locationName\" : \"application-id\"\
-        },\
-        \"SMSChannelRequest\" : {\
-          \"shape\" : \"SMSChannelRequest\"\
-        }\
-      },\
-      \"required\" : [ \"ApplicationId\", \"SMSChannelRequest\" ],\
-      \"payload\" : \"SMSChannelRequest\"\
-    },\
-    \"UpdateSmsChannelResponse\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"SMSChannelResponse\" : {\
-          \"shape\" : \"SMSChannelResponse\"\
-        }\
-      },\
-      \"required\" : [ \"SMSChannelResponse\" ],\
-      \"payload\" : \"SMSChannelResponse\"\
-    },\
-    \"WriteApplicationSettingsRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Limits\" : {\
-          \"shape\" : \"CampaignLimits\",\
-          \"documentation\" : \"The default campaign limits for the app. These limits apply to each campaign for the app, unless the campaign overrides the default with limits of its own.\"\
-        },\
-        \"QuietTime\" : {\
-          \"shape\" : \"QuietTime\",\
-          \"documentation\" : \"The default quiet time for the app. Each campaign for this app sends no messages during this time unless the campaign overrides the default with a quiet time of its own.\"\
-        }\
-      },\
-      \"documentation\" : \"Creating application setting request\"\
-    },\
-    \"WriteCampaignRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"AdditionalTreatments\" : {\
-          \"shape\" : \"ListOfWriteTreatmentResource\",\
-          \"documentation\" : \"Treatments that are defined in addition to the default treatment.\"\
-        },\
-        \"Description\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A description of the campaign.\"\
-        },\
-        \"HoldoutPercent\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The allocated percentage of end users who will not receive messages from this campaign.\"\
-        },\
-        \"IsPaused\" : {\
-          \"shape\" : \"__boolean\",\
-          \"documentation\" : \"Indicates whether the campaign is paused. A paused campaign does not send messages unless you resume it by setting IsPaused to false.\"\
-        },\
-        \"Limits\" : {\
-          \"shape\" : \"CampaignLimits\",\
-          \"documentation\" : \"The campaign limits settings.\"\
-        },\
-        \"MessageConfiguration\" : {\
-          \"shape\" : \"MessageConfiguration\",\
-          \"documentation\" : \"The message configuration settings.\"\
-        },\
-        \"Name\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of the campaign.\"\
-        },\
-        \"Schedule\" : {\
-          \"shape\" : \"Schedule\",\
-          \"documentation\" : \"The campaign schedule.\"\
-        },\
-        \"SegmentId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The ID of the segment to which the campaign sends messages.\"\
-        },\
-        \"SegmentVersion\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The version of the segment to which the campaign sends messages.\"\
-        },\
-        \"TreatmentDescription\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom description for the treatment.\"\
-        },\
-        \"TreatmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of a variation of the campaign used for A/B testing.\"\
-        }\
-      },\
-      \"documentation\" : \"Used to create a campaign.\"\
-    },\
-    \"WriteEventStream\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"DestinationStreamArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The Amazon Resource Name (ARN) of the Amazon Kinesis stream or Firehose delivery stream to which you want to publish events.\\n Firehose ARN: arn:aws:firehose:REGION:ACCOUNT_ID:deliverystream/STREAM_NAME\\n Kinesis ARN: arn:aws:kinesis:REGION:ACCOUNT_ID:stream/STREAM_NAME\"\
-        },\
-        \"ExternalId\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The external ID assigned the IAM role that authorizes Amazon Pinpoint to publish to the stream.\"\
-        },\
-        \"RoleArn\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The IAM role that authorizes Amazon Pinpoint to publish events to the stream in your account.\"\
-        }\
-      },\
-      \"documentation\" : \"Request to save an EventStream.\"\
-    },\
-    \"WriteSegmentRequest\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"Dimensions\" : {\
-          \"shape\" : \"SegmentDimensions\",\
-          \"documentation\" : \"The segment dimensions attributes.\"\
-        },\
-        \"Name\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The name of segment\"\
-        }\
-      },\
-      \"documentation\" : \"Segment definition.\"\
-    },\
-    \"WriteTreatmentResource\" : {\
-      \"type\" : \"structure\",\
-      \"members\" : {\
-        \"MessageConfiguration\" : {\
-          \"shape\" : \"MessageConfiguration\",\
-          \"documentation\" : \"The message configuration settings.\"\
-        },\
-        \"Schedule\" : {\
-          \"shape\" : \"Schedule\",\
-          \"documentation\" : \"The campaign schedule.\"\
-        },\
-        \"SizePercent\" : {\
-          \"shape\" : \"__integer\",\
-          \"documentation\" : \"The allocated percentage of users for this treatment.\"\
-        },\
-        \"TreatmentDescription\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"A custom description for the treatment.\"\
-        },\
-        \"TreatmentName\" : {\
-          \"shape\" : \"__string\",\
-          \"documentation\" : \"The custom name of a variation of the campaign used for A/B testing.\"\
-        }\
-      },\
-      \"documentation\" : \"Used to create a campaign treatment.\"\
-    },\
-    \"__boolean\" : {\
-      \"type\" : \"boolean\"\
-    },\
-    \"__double\" : {\
-      \"type\" : \"double\"\
-    },\
-    \"__integer\" : {\
-      \"type\" : \"integer\"\
-    },\
-    \"__string\" : {\
-      \"type\" : \"string\"\
-    },\
-    \"__timestamp\" : {\
-      \"type\" : \"timestamp\"\
-    }\
-  }\
-}";
-}
-
 @end
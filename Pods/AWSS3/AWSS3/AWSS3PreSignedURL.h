@@ -196,6 +196,22 @@ typedef NS_ENUM(NSInteger, AWSS3PresignedURLErrorType) {
  */
 - (AWSTask<NSURL *> *)getPreSignedURL:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest;
 
+/**
+ Build time-limited pre-signed URLs for many objects at once. Credentials are resolved once and every URL is signed with the same date and derived key, so this is much cheaper per URL than calling `getPreSignedURL:` in a loop.
+
+ URLs are cached by the builder. A URL built earlier for an identical request is returned again while at least half of the lifetime asked for by `expires` remains, and never past the expiration of the credentials it was signed with.
+
+ @param getPreSignedURLRequests The AWSS3GetPreSignedURLRequest objects that define the URLs.
+ @return The pre-signed NSURLs in the order of the requests. The task fails if any request is invalid.
+ @see AWSS3GetPreSignedURLRequest
+ */
+- (AWSTask<NSArray<NSURL *> *> *)getPreSignedURLs:(NSArray<AWSS3GetPreSignedURLRequest *> *)getPreSignedURLRequests;
+
+/**
+ Drops the URLs cached by `getPreSignedURLs:`, for example after the signed-in user changes.
+ */
+- (void)removeAllCachedPreSignedURLs;
+
 @end
 
 /** The GetPreSignedURLRequest contains the parameters used to create
@@ -28,9 +28,26 @@ static NSString *const AWSS3PreSignedURLBuilderAcceleratedEndpoint = @"s3-accele
 static NSString *const AWSInfoS3PreSignedURLBuilder = @"S3PreSignedURLBuilder";
 static NSString *const AWSS3PreSignedURLBuilderSDKVersion = @"2.6.17";
 
+// URLs kept by getPreSignedURLs: per builder
+static const NSUInteger AWSS3PreSignedURLBuilderCacheCountLimit = 1024;
+
+@interface AWSS3PreSignedURLCacheEntry : NSObject
+
+@property (nonatomic, strong) NSURL *URL;
+
+// When the URL stops working: its own expiry or the credentials', whichever comes first
+@property (nonatomic, strong) NSDate *expires;
+
+@end
+
+@implementation AWSS3PreSignedURLCacheEntry
+
+@end
+
 @interface AWSS3PreSignedURLBuilder()
 
 @property (nonatomic, strong) AWSServiceConfiguration *configuration;
+@property (nonatomic, strong) NSCache<NSString *, AWSS3PreSignedURLCacheEntry *> *preSignedURLCache;
 
 @end
 
@@ -147,170 +164,331 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
             [_configuration.endpoint setRegion:_configuration.regionType
                                        service:AWSServiceS3];
         }
+
+        _preSignedURLCache = [NSCache new];
+        _preSignedURLCache.countLimit = AWSS3PreSignedURLBuilderCacheCountLimit;
     }
 
     return self;
 }
 
 - (AWSTask<NSURL *> *)getPreSignedURL:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest {
-    //retrive parameters from request;
-    NSString *bucketName = getPreSignedURLRequest.bucket;
-    NSString *keyName = getPreSignedURLRequest.key;
-    AWSHTTPMethod httpMethod = getPreSignedURLRequest.HTTPMethod;
-    AWSServiceConfiguration *configuration = self.configuration;
-    id<AWSCredentialsProvider>credentialsProvider = configuration.credentialsProvider;
-    AWSEndpoint *endpoint = self.configuration.endpoint;
-    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
+    return [[[AWSTask taskWithResult:nil] continueWithBlock:^id(AWSTask *task) {
+        NSError *error = [self validatePreSignedURLRequest:getPreSignedURLRequest];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
 
-    NSDate *expires = getPreSignedURLRequest.expires;
+        return [self credentialsWithMinimumExpirationInterval:getPreSignedURLRequest.minimumCredentialsExpirationInterval];
+    }] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        NSError *error = nil;
+        NSURL *preSignedURL = [self preSignedURLForRequest:getPreSignedURLRequest
+                                               credentials:task.result
+                                                      date:[NSDate aws_clockSkewFixedDate]
+                                                     error:&error];
+        if (error) {
+            return [AWSTask taskWithError:error];
+        }
 
-    return [[[AWSTask taskWithResult:nil] continueWithBlock:^id(AWSTask *task) {
+        return preSignedURL;
+    }];
+}
 
-        //validate additionalParams
-        for (id key in getPreSignedURLRequest.requestParameters) {
-            id value = getPreSignedURLRequest.requestParameters[key];
-            if (![key isKindOfClass:[NSString class]]
-                || ![value isKindOfClass:[NSString class]]) {
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorInvalidRequestParameters
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"requestParameters can only contain key-value pairs in NSString type."}]
-                        ];
+- (AWSTask<NSArray<NSURL *> *> *)getPreSignedURLs:(NSArray<AWSS3GetPreSignedURLRequest *> *)getPreSignedURLRequests {
+    return [[[AWSTask taskWithResult:nil] continueWithBlock:^id(AWSTask *task) {
+        NSTimeInterval minimumCredentialsExpirationInterval = 0;
+        for (AWSS3GetPreSignedURLRequest *getPreSignedURLRequest in getPreSignedURLRequests) {
+            NSError *error = [self validatePreSignedURLRequest:getPreSignedURLRequest];
+            if (error) {
+                return [AWSTask taskWithError:error];
             }
+            minimumCredentialsExpirationInterval = MAX(minimumCredentialsExpirationInterval, getPreSignedURLRequest.minimumCredentialsExpirationInterval);
         }
 
-        //validate endpoint
-        if (!endpoint) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorEndpointIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"endpoint in configuration can not be nil"}]
-                    ];
-        } else if (endpoint.serviceType != AWSServiceS3) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidServiceType
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"Invalid serviceType: serviceType in endpoint must be AWSServiceS3"}]
-                    ];
-        }
+        return [self credentialsWithMinimumExpirationInterval:minimumCredentialsExpirationInterval];
+    }] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        AWSCredentials *credentials = task.result;
+
+        // One date for the whole batch, so every URL is signed with the same derived key
+        // and the URLs not found in the cache can be signed together.
+        NSDate *date = [NSDate aws_clockSkewFixedDate];
+        NSMutableArray *preSignedURLs = [NSMutableArray arrayWithCapacity:[getPreSignedURLRequests count]];
+        NSMutableArray<AWSSignatureV4QueryStringRequest *> *queryStringRequests = [NSMutableArray array];
+        NSMutableIndexSet *pending = [NSMutableIndexSet indexSet];
+        NSMutableArray<NSString *> *cacheKeys = [NSMutableArray arrayWithCapacity:[getPreSignedURLRequests count]];
+        for (AWSS3GetPreSignedURLRequest *getPreSignedURLRequest in getPreSignedURLRequests) {
+            NSString *cacheKey = [self cacheKeyForRequest:getPreSignedURLRequest credentials:credentials];
+            AWSS3PreSignedURLCacheEntry *entry = [self.preSignedURLCache objectForKey:cacheKey];
+            [cacheKeys addObject:cacheKey];
+
+            // Reuse a URL while at least half of the requested lifetime remains, and
+            // never one that outlives the requested expiry.
+            if (entry
+                && [entry.expires compare:getPreSignedURLRequest.expires] != NSOrderedDescending
+                && [entry.expires timeIntervalSinceNow] >= [getPreSignedURLRequest.expires timeIntervalSinceNow] / 2) {
+                [preSignedURLs addObject:entry.URL];
+                continue;
+            }
 
-        //validate credentialsProvider
-        if (!credentialsProvider) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PreSignedURLErrorCredentialProviderIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"credentialsProvider in configuration can not be nil"}]
-                    ];
+            NSError *error = nil;
+            AWSSignatureV4QueryStringRequest *queryStringRequest = [self queryStringRequestForRequest:getPreSignedURLRequest
+                                                                                                error:&error];
+            if (error) {
+                return [AWSTask taskWithError:error];
+            }
+            [pending addIndex:[preSignedURLs count]];
+            [queryStringRequests addObject:queryStringRequest];
+            [preSignedURLs addObject:[NSNull null]];
         }
 
-        //validate bucketName
-        if (!bucketName || [bucketName length] < 1) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorBucketNameIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"S3 bucket can not be nil or empty"}]];
-        }
+        NSArray *signedURLs = [AWSSignatureV4Signer generateQueryStringsForSignatureV4WithCredentials:credentials
+                                                                                                 date:date
+                                                                                             requests:queryStringRequests];
+        NSUInteger i = 0;
+        for (NSUInteger idx = [pending firstIndex]; idx != NSNotFound; idx = [pending indexGreaterThanIndex:idx], i++) {
+            AWSS3GetPreSignedURLRequest *getPreSignedURLRequest = getPreSignedURLRequests[idx];
+            NSURL *preSignedURL = signedURLs[i];
+            if (![preSignedURL isKindOfClass:[NSURL class]]) {
+                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                                                  code:AWSS3PreSignedURLErrorInternalError
+                                                              userInfo:@{NSLocalizedDescriptionKey: [NSString stringWithFormat:@"Failed to sign a URL for %@", getPreSignedURLRequest.key]}]];
+            }
 
-        // Validates the buket name for transfer acceleration.
-        if (isAccelerateModeEnabled && ![bucketName aws_isVirtualHostedStyleCompliant]) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidBucketNameForAccelerateModeEnabled
-                                                          userInfo:@{
-                                                                     NSLocalizedDescriptionKey: @"For your bucket to work with transfer acceleration, the bucket name must conform to DNS naming requirements and must not contain periods."}]];
-        }
+            // A URL signed with temporary credentials stops working when they expire.
+            AWSS3PreSignedURLCacheEntry *entry = [AWSS3PreSignedURLCacheEntry new];
+            entry.URL = preSignedURL;
+            entry.expires = getPreSignedURLRequest.expires;
+            if (credentials.expiration) {
+                entry.expires = [entry.expires earlierDate:credentials.expiration];
+            }
+            [self.preSignedURLCache setObject:entry forKey:cacheKeys[idx]];
 
-        //validate keyName
-        if (!keyName || [keyName length] < 1) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorKeyNameIsNil
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"S3 key can not be nil or empty"}]
-                    ];
+            preSignedURLs[idx] = preSignedURL;
         }
 
-        //validate expires Date
-        if (!expires) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"expires can not be nil"}]
-                    ];
-        }else if ([expires timeIntervalSinceNow] < 0.0) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"expires can not be in past"}]
-                    ];
-        }
+        return preSignedURLs;
+    }];
+}
 
-        //validate httpMethod
-        switch (httpMethod) {
-            case AWSHTTPMethodGET:
-            case AWSHTTPMethodPUT:
-            case AWSHTTPMethodHEAD:
-            case AWSHTTPMethodDELETE:
-                break;
-            default:
-                return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                                  code:AWSS3PresignedURLErrorUnsupportedHTTPVerbs
-                                                              userInfo:@{NSLocalizedDescriptionKey: @"unsupported HTTP Method, currently only support AWSHTTPMethodGET, AWSHTTPMethodPUT, AWSHTTPMethodHEAD, AWSHTTPMethodDELETE"}]
-                        ];
-                break;
+- (NSError *)validatePreSignedURLRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest {
+    NSString *bucketName = getPreSignedURLRequest.bucket;
+    NSString *keyName = getPreSignedURLRequest.key;
+    AWSHTTPMethod httpMethod = getPreSignedURLRequest.HTTPMethod;
+    id<AWSCredentialsProvider>credentialsProvider = self.configuration.credentialsProvider;
+    AWSEndpoint *endpoint = self.configuration.endpoint;
+    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
+    NSDate *expires = getPreSignedURLRequest.expires;
+
+    //validate additionalParams
+    for (id key in getPreSignedURLRequest.requestParameters) {
+        id value = getPreSignedURLRequest.requestParameters[key];
+        if (![key isKindOfClass:[NSString class]]
+            || ![value isKindOfClass:[NSString class]]) {
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorInvalidRequestParameters
+                                   userInfo:@{NSLocalizedDescriptionKey: @"requestParameters can only contain key-value pairs in NSString type."}];
         }
+    }
 
-        return [[credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
-            AWSCredentials *credentials = task.result;
-            if ([credentials.expiration timeIntervalSinceNow] < getPreSignedURLRequest.minimumCredentialsExpirationInterval) {
-                [credentialsProvider invalidateCachedTemporaryCredentials];
-            }
+    //validate endpoint
+    if (!endpoint) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorEndpointIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"endpoint in configuration can not be nil"}];
+    } else if (endpoint.serviceType != AWSServiceS3) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidServiceType
+                               userInfo:@{NSLocalizedDescriptionKey: @"Invalid serviceType: serviceType in endpoint must be AWSServiceS3"}];
+    }
 
-            return credentialsProvider;
-        }];
-    }] continueWithSuccessBlock:^id _Nullable(AWSTask * _Nonnull task) {
-        //generate baseURL String (use virtualHostStyle if possible)
-        //base url is not url encoded.
-        NSString *keyPath = nil;
-        if (bucketName == nil || [bucketName aws_isVirtualHostedStyleCompliant]) {
-            keyPath = (keyName == nil ? @"" : [NSString stringWithFormat:@"%@", [keyName aws_stringWithURLEncodingPath]]);
-        } else {
-            keyPath = (keyName == nil ? [NSString stringWithFormat:@"%@", bucketName] : [NSString stringWithFormat:@"%@/%@", bucketName, [keyName aws_stringWithURLEncodingPath]]);
+    //validate credentialsProvider
+    if (!credentialsProvider) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PreSignedURLErrorCredentialProviderIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"credentialsProvider in configuration can not be nil"}];
+    }
+
+    //validate bucketName
+    if (!bucketName || [bucketName length] < 1) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorBucketNameIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"S3 bucket can not be nil or empty"}];
+    }
+
+    // Validates the buket name for transfer acceleration.
+    if (isAccelerateModeEnabled && ![bucketName aws_isVirtualHostedStyleCompliant]) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidBucketNameForAccelerateModeEnabled
+                               userInfo:@{
+                                          NSLocalizedDescriptionKey: @"For your bucket to work with transfer acceleration, the bucket name must conform to DNS naming requirements and must not contain periods."}];
+    }
+
+    //validate keyName
+    if (!keyName || [keyName length] < 1) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorKeyNameIsNil
+                               userInfo:@{NSLocalizedDescriptionKey: @"S3 key can not be nil or empty"}];
+    }
+
+    //validate expires Date
+    if (!expires) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidExpiresDate
+                               userInfo:@{NSLocalizedDescriptionKey: @"expires can not be nil"}];
+    }else if ([expires timeIntervalSinceNow] < 0.0) {
+        return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                   code:AWSS3PresignedURLErrorInvalidExpiresDate
+                               userInfo:@{NSLocalizedDescriptionKey: @"expires can not be in past"}];
+    }
+
+    //validate httpMethod
+    switch (httpMethod) {
+        case AWSHTTPMethodGET:
+        case AWSHTTPMethodPUT:
+        case AWSHTTPMethodHEAD:
+        case AWSHTTPMethodDELETE:
+            break;
+        default:
+            return [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                       code:AWSS3PresignedURLErrorUnsupportedHTTPVerbs
+                                   userInfo:@{NSLocalizedDescriptionKey: @"unsupported HTTP Method, currently only support AWSHTTPMethodGET, AWSHTTPMethodPUT, AWSHTTPMethodHEAD, AWSHTTPMethodDELETE"}];
+            break;
+    }
+
+    return nil;
+}
+
+// Refreshes temporary credentials that expire within the interval.
+- (AWSTask<AWSCredentials *> *)credentialsWithMinimumExpirationInterval:(NSTimeInterval)minimumCredentialsExpirationInterval {
+    id<AWSCredentialsProvider>credentialsProvider = self.configuration.credentialsProvider;
+
+    return [[credentialsProvider credentials] continueWithSuccessBlock:^id _Nullable(AWSTask<AWSCredentials *> * _Nonnull task) {
+        AWSCredentials *credentials = task.result;
+        if ([credentials.expiration timeIntervalSinceNow] < minimumCredentialsExpirationInterval) {
+            [credentialsProvider invalidateCachedTemporaryCredentials];
+            return [credentialsProvider credentials];
         }
 
-        //generate correct hostName (use virtualHostStyle if possible)
-        NSString *host = nil;
-        if (bucketName && [bucketName aws_isVirtualHostedStyleCompliant]) {
-            if (isAccelerateModeEnabled) {
-                host = [NSString stringWithFormat:@"%@.%@", bucketName, AWSS3PreSignedURLBuilderAcceleratedEndpoint];
-            } else {
-                host = [NSString stringWithFormat:@"%@.%@", bucketName, endpoint.hostName];
-            }
+        return task;
+    }];
+}
+
+- (NSURL *)preSignedURLForRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest
+                      credentials:(AWSCredentials *)credentials
+                             date:(NSDate *)date
+                            error:(NSError **)error {
+    AWSSignatureV4QueryStringRequest *queryStringRequest = [self queryStringRequestForRequest:getPreSignedURLRequest
+                                                                                        error:error];
+    if (!queryStringRequest) {
+        return nil;
+    }
+
+    return [AWSSignatureV4Signer generateQueryStringForSignatureV4WithCredentials:credentials
+                                                                             date:date
+                                                                       httpMethod:queryStringRequest.httpMethod
+                                                                   expireDuration:queryStringRequest.expireDuration
+                                                                         endpoint:queryStringRequest.endpoint
+                                                                          keyPath:queryStringRequest.keyPath
+                                                                   requestHeaders:queryStringRequest.requestHeaders
+                                                                requestParameters:queryStringRequest.requestParameters
+                                                                         signBody:queryStringRequest.signBody];
+}
+
+// What the signer needs for one URL: host, endpoint, key path and parameters.
+- (AWSSignatureV4QueryStringRequest *)queryStringRequestForRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest
+                                                            error:(NSError **)error {
+    NSString *bucketName = getPreSignedURLRequest.bucket;
+    NSString *keyName = getPreSignedURLRequest.key;
+    AWSHTTPMethod httpMethod = getPreSignedURLRequest.HTTPMethod;
+    AWSServiceConfiguration *configuration = self.configuration;
+    AWSEndpoint *endpoint = self.configuration.endpoint;
+    BOOL isAccelerateModeEnabled = getPreSignedURLRequest.isAccelerateModeEnabled;
+    NSDate *expires = getPreSignedURLRequest.expires;
+
+    //generate baseURL String (use virtualHostStyle if possible)
+    //base url is not url encoded.
+    NSString *keyPath = nil;
+    if (bucketName == nil || [bucketName aws_isVirtualHostedStyleCompliant]) {
+        keyPath = (keyName == nil ? @"" : [NSString stringWithFormat:@"%@", [keyName aws_stringWithURLEncodingPath]]);
+    } else {
+        keyPath = (keyName == nil ? [NSString stringWithFormat:@"%@", bucketName] : [NSString stringWithFormat:@"%@/%@", bucketName, [keyName aws_stringWithURLEncodingPath]]);
+    }
+
+    //generate correct hostName (use virtualHostStyle if possible)
+    NSString *host = nil;
+    if (bucketName && [bucketName aws_isVirtualHostedStyleCompliant]) {
+        if (isAccelerateModeEnabled) {
+            host = [NSString stringWithFormat:@"%@.%@", bucketName, AWSS3PreSignedURLBuilderAcceleratedEndpoint];
         } else {
-            host = endpoint.hostName;
-        }
-        [getPreSignedURLRequest setValue:host forRequestHeader:@"host"];
-        
-        //If this is a presigned request for a multipart upload, set the uploadID and partNumber on the request.
-        if (getPreSignedURLRequest.uploadID
-            && getPreSignedURLRequest.partNumber) {
-            
-            [getPreSignedURLRequest setValue:getPreSignedURLRequest.uploadID
-                         forRequestParameter:@"uploadId"];
-            
-            [getPreSignedURLRequest setValue:[NSString stringWithFormat:@"%@", getPreSignedURLRequest.partNumber]
-                         forRequestParameter:@"partNumber"];
+            host = [NSString stringWithFormat:@"%@.%@", bucketName, endpoint.hostName];
         }
+    } else {
+        host = endpoint.hostName;
+    }
+    [getPreSignedURLRequest setValue:host forRequestHeader:@"host"];
+    
+    //If this is a presigned request for a multipart upload, set the uploadID and partNumber on the request.
+    if (getPreSignedURLRequest.uploadID
+        && getPreSignedURLRequest.partNumber) {
         
-        AWSEndpoint *newEndpoint = [[AWSEndpoint alloc]initWithRegion:configuration.regionType service:AWSServiceS3 URL:[NSURL URLWithString:[NSString stringWithFormat:@"%@://%@", endpoint.useUnsafeURL?@"http":@"https", host]]];
+        [getPreSignedURLRequest setValue:getPreSignedURLRequest.uploadID
+                     forRequestParameter:@"uploadId"];
         
-        int32_t expireDuration = [expires timeIntervalSinceNow];
-        if (expireDuration > 604800) {
-            return [AWSTask taskWithError:[NSError errorWithDomain:AWSS3PresignedURLErrorDomain
-                                                              code:AWSS3PresignedURLErrorInvalidExpiresDate
-                                                          userInfo:@{NSLocalizedDescriptionKey: @"Invalid ExpiresDate, must be less than seven days in future"}]
-                    ];
+        [getPreSignedURLRequest setValue:[NSString stringWithFormat:@"%@", getPreSignedURLRequest.partNumber]
+                     forRequestParameter:@"partNumber"];
+    }
+    
+    AWSEndpoint *newEndpoint = [[AWSEndpoint alloc]initWithRegion:configuration.regionType service:AWSServiceS3 URL:[NSURL URLWithString:[NSString stringWithFormat:@"%@://%@", endpoint.useUnsafeURL?@"http":@"https", host]]];
+    
+    int32_t expireDuration = [expires timeIntervalSinceNow];
+    if (expireDuration > 604800) {
+        if (error) {
+            *error = [NSError errorWithDomain:AWSS3PresignedURLErrorDomain
+                                         code:AWSS3PresignedURLErrorInvalidExpiresDate
+                                     userInfo:@{NSLocalizedDescriptionKey: @"Invalid ExpiresDate, must be less than seven days in future"}];
         }
+        return nil;
+    }
 
-        return [AWSSignatureV4Signer  generateQueryStringForSignatureV4WithCredentialProvider:task.result
-                                                                                   httpMethod:httpMethod
-                                                                               expireDuration:expireDuration
-                                                                                     endpoint:newEndpoint
-                                                                                      keyPath:keyPath
-                                                                               requestHeaders:getPreSignedURLRequest.requestHeaders
-                                                                            requestParameters:getPreSignedURLRequest.requestParameters
-                                                                                     signBody:NO];
-    }];
+    AWSSignatureV4QueryStringRequest *queryStringRequest = [AWSSignatureV4QueryStringRequest new];
+    queryStringRequest.httpMethod = httpMethod;
+    queryStringRequest.expireDuration = expireDuration;
+    queryStringRequest.endpoint = newEndpoint;
+    queryStringRequest.keyPath = keyPath;
+    queryStringRequest.requestHeaders = getPreSignedURLRequest.requestHeaders;
+    queryStringRequest.requestParameters = getPreSignedURLRequest.requestParameters;
+    queryStringRequest.signBody = NO;
+    return queryStringRequest;
+}
+
+// Everything that goes into a URL except the host header, which follows from the bucket.
+- (NSString *)cacheKeyForRequest:(AWSS3GetPreSignedURLRequest *)getPreSignedURLRequest
+                     credentials:(AWSCredentials *)credentials {
+    NSMutableString *cacheKey = [NSMutableString stringWithFormat:@"%ld\n%@\n%@\n%d\n%@\n%@\n%@",
+                                 (long)getPreSignedURLRequest.HTTPMethod,
+                                 getPreSignedURLRequest.bucket,
+                                 getPreSignedURLRequest.key,
+                                 getPreSignedURLRequest.isAccelerateModeEnabled,
+                                 credentials.accessKey,
+                                 getPreSignedURLRequest.uploadID,
+                                 getPreSignedURLRequest.partNumber];
+
+    NSDictionary<NSString *, NSString *> *requestHeaders = getPreSignedURLRequest.requestHeaders;
+    for (NSString *name in [[requestHeaders allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        if ([name caseInsensitiveCompare:@"host"] != NSOrderedSame) {
+            [cacheKey appendFormat:@"\nh:%@=%@", name, requestHeaders[name]];
+        }
+    }
+    NSDictionary<NSString *, NSString *> *requestParameters = getPreSignedURLRequest.requestParameters;
+    for (NSString *name in [[requestParameters allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        [cacheKey appendFormat:@"\np:%@=%@", name, requestParameters[name]];
+    }
+
+    return cacheKey;
+}
+
+- (void)removeAllCachedPreSignedURLs {
+    [self.preSignedURLCache removeAllObjects];
 }
 
 @end
@@ -15,6 +15,557 @@
 
 #import "AWSS3Resources.h"
 #import <AWSCore/AWSCocoaLumberjack.h>
+#import <AWSCore/AWSSerialization.h>
+
+// Generated by sdk/compile_service_models.py from the Amazon Simple Storage Service model. Do not edit.
+
+// Everything in the model but its operations and shapes.
+static const char AWSS3Definition[] = "{\"metadata\":{\"apiVersion\":\"2006-03-01\",\"checksumFormat\":\"md5\",\"endpointPrefix\":\"s3\",\"globalEndpoint\":\"s3.amazonaws.com\",\"protocol\":\"rest-xml\",\"serviceAbbreviation\":\"Amazon S3\",\"serviceFullName\":\"Amazon Simple Storage Service\",\"serviceId\":\"S3\",\"signatureVersion\":\"s3\",\"timestampFormat\":\"rfc822\",\"uid\":\"s3-2006-03-01\"},\"version\":\"2.0\"}";
+
+static const AWSServiceModelEntry AWSS3Operations[] = {
+    {"AbortMultipartUpload", "{\"errors\":[{\"shape\":\"NoSuchUpload\"}],\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"AbortMultipartUploadRequest\"},\"name\":\"AbortMultipartUpload\",\"output\":{\"shape\":\"AbortMultipartUploadOutput\"}}"},
+    {"CompleteMultipartUpload", "{\"http\":{\"method\":\"POST\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"CompleteMultipartUploadRequest\"},\"name\":\"CompleteMultipartUpload\",\"output\":{\"shape\":\"CompleteMultipartUploadOutput\"}}"},
+    {"CopyObject", "{\"alias\":\"PutObjectCopy\",\"errors\":[{\"shape\":\"ObjectNotInActiveTierError\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"CopyObjectRequest\"},\"name\":\"CopyObject\",\"output\":{\"shape\":\"CopyObjectOutput\"}}"},
+    {"CreateBucket", "{\"alias\":\"PutBucket\",\"errors\":[{\"shape\":\"BucketAlreadyExists\"},{\"shape\":\"BucketAlreadyOwnedByYou\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\"},\"input\":{\"shape\":\"CreateBucketRequest\"},\"name\":\"CreateBucket\",\"output\":{\"shape\":\"CreateBucketOutput\"}}"},
+    {"CreateMultipartUpload", "{\"alias\":\"InitiateMultipartUpload\",\"http\":{\"method\":\"POST\",\"requestUri\":\"/{Bucket}/{Key+}\?uploads\"},\"input\":{\"shape\":\"CreateMultipartUploadRequest\"},\"name\":\"CreateMultipartUpload\",\"output\":{\"shape\":\"CreateMultipartUploadOutput\"}}"},
+    {"DeleteBucket", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\"},\"input\":{\"shape\":\"DeleteBucketRequest\"},\"name\":\"DeleteBucket\"}"},
+    {"DeleteBucketAnalyticsConfiguration", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?analytics\"},\"input\":{\"shape\":\"DeleteBucketAnalyticsConfigurationRequest\"},\"name\":\"DeleteBucketAnalyticsConfiguration\"}"},
+    {"DeleteBucketCors", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?cors\"},\"input\":{\"shape\":\"DeleteBucketCorsRequest\"},\"name\":\"DeleteBucketCors\"}"},
+    {"DeleteBucketEncryption", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?encryption\"},\"input\":{\"shape\":\"DeleteBucketEncryptionRequest\"},\"name\":\"DeleteBucketEncryption\"}"},
+    {"DeleteBucketInventoryConfiguration", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?inventory\"},\"input\":{\"shape\":\"DeleteBucketInventoryConfigurationRequest\"},\"name\":\"DeleteBucketInventoryConfiguration\"}"},
+    {"DeleteBucketLifecycle", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?lifecycle\"},\"input\":{\"shape\":\"DeleteBucketLifecycleRequest\"},\"name\":\"DeleteBucketLifecycle\"}"},
+    {"DeleteBucketMetricsConfiguration", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?metrics\"},\"input\":{\"shape\":\"DeleteBucketMetricsConfigurationRequest\"},\"name\":\"DeleteBucketMetricsConfiguration\"}"},
+    {"DeleteBucketPolicy", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?policy\"},\"input\":{\"shape\":\"DeleteBucketPolicyRequest\"},\"name\":\"DeleteBucketPolicy\"}"},
+    {"DeleteBucketReplication", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?replication\"},\"input\":{\"shape\":\"DeleteBucketReplicationRequest\"},\"name\":\"DeleteBucketReplication\"}"},
+    {"DeleteBucketTagging", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?tagging\"},\"input\":{\"shape\":\"DeleteBucketTaggingRequest\"},\"name\":\"DeleteBucketTagging\"}"},
+    {"DeleteBucketWebsite", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}\?website\"},\"input\":{\"shape\":\"DeleteBucketWebsiteRequest\"},\"name\":\"DeleteBucketWebsite\"}"},
+    {"DeleteObject", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"DeleteObjectRequest\"},\"name\":\"DeleteObject\",\"output\":{\"shape\":\"DeleteObjectOutput\"}}"},
+    {"DeleteObjectTagging", "{\"http\":{\"method\":\"DELETE\",\"requestUri\":\"/{Bucket}/{Key+}\?tagging\"},\"input\":{\"shape\":\"DeleteObjectTaggingRequest\"},\"name\":\"DeleteObjectTagging\",\"output\":{\"shape\":\"DeleteObjectTaggingOutput\"}}"},
+    {"DeleteObjects", "{\"alias\":\"DeleteMultipleObjects\",\"http\":{\"method\":\"POST\",\"requestUri\":\"/{Bucket}\?delete\"},\"input\":{\"shape\":\"DeleteObjectsRequest\"},\"name\":\"DeleteObjects\",\"output\":{\"shape\":\"DeleteObjectsOutput\"}}"},
+    {"GetBucketAccelerateConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?accelerate\"},\"input\":{\"shape\":\"GetBucketAccelerateConfigurationRequest\"},\"name\":\"GetBucketAccelerateConfiguration\",\"output\":{\"shape\":\"GetBucketAccelerateConfigurationOutput\"}}"},
+    {"GetBucketAcl", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?acl\"},\"input\":{\"shape\":\"GetBucketAclRequest\"},\"name\":\"GetBucketAcl\",\"output\":{\"shape\":\"GetBucketAclOutput\"}}"},
+    {"GetBucketAnalyticsConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?analytics\"},\"input\":{\"shape\":\"GetBucketAnalyticsConfigurationRequest\"},\"name\":\"GetBucketAnalyticsConfiguration\",\"output\":{\"shape\":\"GetBucketAnalyticsConfigurationOutput\"}}"},
+    {"GetBucketCors", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?cors\"},\"input\":{\"shape\":\"GetBucketCorsRequest\"},\"name\":\"GetBucketCors\",\"output\":{\"shape\":\"GetBucketCorsOutput\"}}"},
+    {"GetBucketEncryption", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?encryption\"},\"input\":{\"shape\":\"GetBucketEncryptionRequest\"},\"name\":\"GetBucketEncryption\",\"output\":{\"shape\":\"GetBucketEncryptionOutput\"}}"},
+    {"GetBucketInventoryConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?inventory\"},\"input\":{\"shape\":\"GetBucketInventoryConfigurationRequest\"},\"name\":\"GetBucketInventoryConfiguration\",\"output\":{\"shape\":\"GetBucketInventoryConfigurationOutput\"}}"},
+    {"GetBucketLifecycle", "{\"deprecated\":true,\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?lifecycle\"},\"input\":{\"shape\":\"GetBucketLifecycleRequest\"},\"name\":\"GetBucketLifecycle\",\"output\":{\"shape\":\"GetBucketLifecycleOutput\"}}"},
+    {"GetBucketLifecycleConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?lifecycle\"},\"input\":{\"shape\":\"GetBucketLifecycleConfigurationRequest\"},\"name\":\"GetBucketLifecycleConfiguration\",\"output\":{\"shape\":\"GetBucketLifecycleConfigurationOutput\"}}"},
+    {"GetBucketLocation", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?location\"},\"input\":{\"shape\":\"GetBucketLocationRequest\"},\"name\":\"GetBucketLocation\",\"output\":{\"shape\":\"GetBucketLocationOutput\"}}"},
+    {"GetBucketLogging", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?logging\"},\"input\":{\"shape\":\"GetBucketLoggingRequest\"},\"name\":\"GetBucketLogging\",\"output\":{\"shape\":\"GetBucketLoggingOutput\"}}"},
+    {"GetBucketMetricsConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?metrics\"},\"input\":{\"shape\":\"GetBucketMetricsConfigurationRequest\"},\"name\":\"GetBucketMetricsConfiguration\",\"output\":{\"shape\":\"GetBucketMetricsConfigurationOutput\"}}"},
+    {"GetBucketNotification", "{\"deprecated\":true,\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?notification\"},\"input\":{\"shape\":\"GetBucketNotificationConfigurationRequest\"},\"name\":\"GetBucketNotification\",\"output\":{\"shape\":\"NotificationConfigurationDeprecated\"}}"},
+    {"GetBucketNotificationConfiguration", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?notification\"},\"input\":{\"shape\":\"GetBucketNotificationConfigurationRequest\"},\"name\":\"GetBucketNotificationConfiguration\",\"output\":{\"shape\":\"NotificationConfiguration\"}}"},
+    {"GetBucketPolicy", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?policy\"},\"input\":{\"shape\":\"GetBucketPolicyRequest\"},\"name\":\"GetBucketPolicy\",\"output\":{\"shape\":\"GetBucketPolicyOutput\"}}"},
+    {"GetBucketReplication", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?replication\"},\"input\":{\"shape\":\"GetBucketReplicationRequest\"},\"name\":\"GetBucketReplication\",\"output\":{\"shape\":\"GetBucketReplicationOutput\"}}"},
+    {"GetBucketRequestPayment", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?requestPayment\"},\"input\":{\"shape\":\"GetBucketRequestPaymentRequest\"},\"name\":\"GetBucketRequestPayment\",\"output\":{\"shape\":\"GetBucketRequestPaymentOutput\"}}"},
+    {"GetBucketTagging", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?tagging\"},\"input\":{\"shape\":\"GetBucketTaggingRequest\"},\"name\":\"GetBucketTagging\",\"output\":{\"shape\":\"GetBucketTaggingOutput\"}}"},
+    {"GetBucketVersioning", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?versioning\"},\"input\":{\"shape\":\"GetBucketVersioningRequest\"},\"name\":\"GetBucketVersioning\",\"output\":{\"shape\":\"GetBucketVersioningOutput\"}}"},
+    {"GetBucketWebsite", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?website\"},\"input\":{\"shape\":\"GetBucketWebsiteRequest\"},\"name\":\"GetBucketWebsite\",\"output\":{\"shape\":\"GetBucketWebsiteOutput\"}}"},
+    {"GetObject", "{\"errors\":[{\"shape\":\"NoSuchKey\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"GetObjectRequest\"},\"name\":\"GetObject\",\"output\":{\"shape\":\"GetObjectOutput\"}}"},
+    {"GetObjectAcl", "{\"errors\":[{\"shape\":\"NoSuchKey\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}/{Key+}\?acl\"},\"input\":{\"shape\":\"GetObjectAclRequest\"},\"name\":\"GetObjectAcl\",\"output\":{\"shape\":\"GetObjectAclOutput\"}}"},
+    {"GetObjectTagging", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}/{Key+}\?tagging\"},\"input\":{\"shape\":\"GetObjectTaggingRequest\"},\"name\":\"GetObjectTagging\",\"output\":{\"shape\":\"GetObjectTaggingOutput\"}}"},
+    {"GetObjectTorrent", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}/{Key+}\?torrent\"},\"input\":{\"shape\":\"GetObjectTorrentRequest\"},\"name\":\"GetObjectTorrent\",\"output\":{\"shape\":\"GetObjectTorrentOutput\"}}"},
+    {"HeadBucket", "{\"errors\":[{\"shape\":\"NoSuchBucket\"}],\"http\":{\"method\":\"HEAD\",\"requestUri\":\"/{Bucket}\"},\"input\":{\"shape\":\"HeadBucketRequest\"},\"name\":\"HeadBucket\"}"},
+    {"HeadObject", "{\"errors\":[{\"shape\":\"NoSuchKey\"}],\"http\":{\"method\":\"HEAD\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"HeadObjectRequest\"},\"name\":\"HeadObject\",\"output\":{\"shape\":\"HeadObjectOutput\"}}"},
+    {"ListBucketAnalyticsConfigurations", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?analytics\"},\"input\":{\"shape\":\"ListBucketAnalyticsConfigurationsRequest\"},\"name\":\"ListBucketAnalyticsConfigurations\",\"output\":{\"shape\":\"ListBucketAnalyticsConfigurationsOutput\"}}"},
+    {"ListBucketInventoryConfigurations", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?inventory\"},\"input\":{\"shape\":\"ListBucketInventoryConfigurationsRequest\"},\"name\":\"ListBucketInventoryConfigurations\",\"output\":{\"shape\":\"ListBucketInventoryConfigurationsOutput\"}}"},
+    {"ListBucketMetricsConfigurations", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?metrics\"},\"input\":{\"shape\":\"ListBucketMetricsConfigurationsRequest\"},\"name\":\"ListBucketMetricsConfigurations\",\"output\":{\"shape\":\"ListBucketMetricsConfigurationsOutput\"}}"},
+    {"ListBuckets", "{\"alias\":\"GetService\",\"http\":{\"method\":\"GET\",\"requestUri\":\"/\"},\"name\":\"ListBuckets\",\"output\":{\"shape\":\"ListBucketsOutput\"}}"},
+    {"ListMultipartUploads", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?uploads\"},\"input\":{\"shape\":\"ListMultipartUploadsRequest\"},\"name\":\"ListMultipartUploads\",\"output\":{\"shape\":\"ListMultipartUploadsOutput\"}}"},
+    {"ListObjectVersions", "{\"alias\":\"GetBucketObjectVersions\",\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?versions\"},\"input\":{\"shape\":\"ListObjectVersionsRequest\"},\"name\":\"ListObjectVersions\",\"output\":{\"shape\":\"ListObjectVersionsOutput\"}}"},
+    {"ListObjects", "{\"alias\":\"GetBucket\",\"errors\":[{\"shape\":\"NoSuchBucket\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\"},\"input\":{\"shape\":\"ListObjectsRequest\"},\"name\":\"ListObjects\",\"output\":{\"shape\":\"ListObjectsOutput\"}}"},
+    {"ListObjectsV2", "{\"errors\":[{\"shape\":\"NoSuchBucket\"}],\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}\?list-type=2\"},\"input\":{\"shape\":\"ListObjectsV2Request\"},\"name\":\"ListObjectsV2\",\"output\":{\"shape\":\"ListObjectsV2Output\"}}"},
+    {"ListParts", "{\"http\":{\"method\":\"GET\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"ListPartsRequest\"},\"name\":\"ListParts\",\"output\":{\"shape\":\"ListPartsOutput\"}}"},
+    {"PutBucketAccelerateConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?accelerate\"},\"input\":{\"shape\":\"PutBucketAccelerateConfigurationRequest\"},\"name\":\"PutBucketAccelerateConfiguration\"}"},
+    {"PutBucketAcl", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?acl\"},\"input\":{\"shape\":\"PutBucketAclRequest\"},\"name\":\"PutBucketAcl\"}"},
+    {"PutBucketAnalyticsConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?analytics\"},\"input\":{\"shape\":\"PutBucketAnalyticsConfigurationRequest\"},\"name\":\"PutBucketAnalyticsConfiguration\"}"},
+    {"PutBucketCors", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?cors\"},\"input\":{\"shape\":\"PutBucketCorsRequest\"},\"name\":\"PutBucketCors\"}"},
+    {"PutBucketEncryption", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?encryption\"},\"input\":{\"shape\":\"PutBucketEncryptionRequest\"},\"name\":\"PutBucketEncryption\"}"},
+    {"PutBucketInventoryConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?inventory\"},\"input\":{\"shape\":\"PutBucketInventoryConfigurationRequest\"},\"name\":\"PutBucketInventoryConfiguration\"}"},
+    {"PutBucketLifecycle", "{\"deprecated\":true,\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?lifecycle\"},\"input\":{\"shape\":\"PutBucketLifecycleRequest\"},\"name\":\"PutBucketLifecycle\"}"},
+    {"PutBucketLifecycleConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?lifecycle\"},\"input\":{\"shape\":\"PutBucketLifecycleConfigurationRequest\"},\"name\":\"PutBucketLifecycleConfiguration\"}"},
+    {"PutBucketLogging", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?logging\"},\"input\":{\"shape\":\"PutBucketLoggingRequest\"},\"name\":\"PutBucketLogging\"}"},
+    {"PutBucketMetricsConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?metrics\"},\"input\":{\"shape\":\"PutBucketMetricsConfigurationRequest\"},\"name\":\"PutBucketMetricsConfiguration\"}"},
+    {"PutBucketNotification", "{\"deprecated\":true,\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?notification\"},\"input\":{\"shape\":\"PutBucketNotificationRequest\"},\"name\":\"PutBucketNotification\"}"},
+    {"PutBucketNotificationConfiguration", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?notification\"},\"input\":{\"shape\":\"PutBucketNotificationConfigurationRequest\"},\"name\":\"PutBucketNotificationConfiguration\"}"},
+    {"PutBucketPolicy", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?policy\"},\"input\":{\"shape\":\"PutBucketPolicyRequest\"},\"name\":\"PutBucketPolicy\"}"},
+    {"PutBucketReplication", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?replication\"},\"input\":{\"shape\":\"PutBucketReplicationRequest\"},\"name\":\"PutBucketReplication\"}"},
+    {"PutBucketRequestPayment", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?requestPayment\"},\"input\":{\"shape\":\"PutBucketRequestPaymentRequest\"},\"name\":\"PutBucketRequestPayment\"}"},
+    {"PutBucketTagging", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?tagging\"},\"input\":{\"shape\":\"PutBucketTaggingRequest\"},\"name\":\"PutBucketTagging\"}"},
+    {"PutBucketVersioning", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?versioning\"},\"input\":{\"shape\":\"PutBucketVersioningRequest\"},\"name\":\"PutBucketVersioning\"}"},
+    {"PutBucketWebsite", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}\?website\"},\"input\":{\"shape\":\"PutBucketWebsiteRequest\"},\"name\":\"PutBucketWebsite\"}"},
+    {"PutObject", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"PutObjectRequest\"},\"name\":\"PutObject\",\"output\":{\"shape\":\"PutObjectOutput\"}}"},
+    {"PutObjectAcl", "{\"errors\":[{\"shape\":\"NoSuchKey\"}],\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\?acl\"},\"input\":{\"shape\":\"PutObjectAclRequest\"},\"name\":\"PutObjectAcl\",\"output\":{\"shape\":\"PutObjectAclOutput\"}}"},
+    {"PutObjectTagging", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\?tagging\"},\"input\":{\"shape\":\"PutObjectTaggingRequest\"},\"name\":\"PutObjectTagging\",\"output\":{\"shape\":\"PutObjectTaggingOutput\"}}"},
+    {"RestoreObject", "{\"alias\":\"PostObjectRestore\",\"errors\":[{\"shape\":\"ObjectAlreadyInActiveTierError\"}],\"http\":{\"method\":\"POST\",\"requestUri\":\"/{Bucket}/{Key+}\?restore\"},\"input\":{\"shape\":\"RestoreObjectRequest\"},\"name\":\"RestoreObject\",\"output\":{\"shape\":\"RestoreObjectOutput\"}}"},
+    {"SelectObjectContent", "{\"http\":{\"method\":\"POST\",\"requestUri\":\"/{Bucket}/{Key+}\?select&select-type=2\"},\"input\":{\"locationName\":\"SelectObjectContentRequest\",\"shape\":\"SelectObjectContentRequest\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"name\":\"SelectObjectContent\",\"output\":{\"shape\":\"SelectObjectContentOutput\"}}"},
+    {"UploadPart", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"UploadPartRequest\"},\"name\":\"UploadPart\",\"output\":{\"shape\":\"UploadPartOutput\"}}"},
+    {"UploadPartCopy", "{\"http\":{\"method\":\"PUT\",\"requestUri\":\"/{Bucket}/{Key+}\"},\"input\":{\"shape\":\"UploadPartCopyRequest\"},\"name\":\"UploadPartCopy\",\"output\":{\"shape\":\"UploadPartCopyOutput\"}}"},
+};
+
+static const AWSServiceModelEntry AWSS3Shapes[] = {
+    {"AbortDate", "{\"type\":\"timestamp\"}"},
+    {"AbortIncompleteMultipartUpload", "{\"members\":{\"DaysAfterInitiation\":{\"shape\":\"DaysAfterInitiation\"}},\"type\":\"structure\"}"},
+    {"AbortMultipartUploadOutput", "{\"members\":{\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"}},\"type\":\"structure\"}"},
+    {"AbortMultipartUploadRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"UploadId\":{\"location\":\"querystring\",\"locationName\":\"uploadId\",\"shape\":\"MultipartUploadId\"}},\"required\":[\"Bucket\",\"Key\",\"UploadId\"],\"type\":\"structure\"}"},
+    {"AbortRuleId", "{\"type\":\"string\"}"},
+    {"AccelerateConfiguration", "{\"members\":{\"Status\":{\"shape\":\"BucketAccelerateStatus\"}},\"type\":\"structure\"}"},
+    {"AcceptRanges", "{\"type\":\"string\"}"},
+    {"AccessControlPolicy", "{\"members\":{\"Grants\":{\"locationName\":\"AccessControlList\",\"shape\":\"Grants\"},\"Owner\":{\"shape\":\"Owner\"}},\"type\":\"structure\"}"},
+    {"AccessControlTranslation", "{\"members\":{\"Owner\":{\"shape\":\"OwnerOverride\"}},\"required\":[\"Owner\"],\"type\":\"structure\"}"},
+    {"AccountId", "{\"type\":\"string\"}"},
+    {"AllowedHeader", "{\"type\":\"string\"}"},
+    {"AllowedHeaders", "{\"flattened\":true,\"member\":{\"shape\":\"AllowedHeader\"},\"type\":\"list\"}"},
+    {"AllowedMethod", "{\"type\":\"string\"}"},
+    {"AllowedMethods", "{\"flattened\":true,\"member\":{\"shape\":\"AllowedMethod\"},\"type\":\"list\"}"},
+    {"AllowedOrigin", "{\"type\":\"string\"}"},
+    {"AllowedOrigins", "{\"flattened\":true,\"member\":{\"shape\":\"AllowedOrigin\"},\"type\":\"list\"}"},
+    {"AnalyticsAndOperator", "{\"members\":{\"Prefix\":{\"shape\":\"Prefix\"},\"Tags\":{\"flattened\":true,\"locationName\":\"Tag\",\"shape\":\"TagSet\"}},\"type\":\"structure\"}"},
+    {"AnalyticsConfiguration", "{\"members\":{\"Filter\":{\"shape\":\"AnalyticsFilter\"},\"Id\":{\"shape\":\"AnalyticsId\"},\"StorageClassAnalysis\":{\"shape\":\"StorageClassAnalysis\"}},\"required\":[\"Id\",\"StorageClassAnalysis\"],\"type\":\"structure\"}"},
+    {"AnalyticsConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"AnalyticsConfiguration\"},\"type\":\"list\"}"},
+    {"AnalyticsExportDestination", "{\"members\":{\"S3BucketDestination\":{\"shape\":\"AnalyticsS3BucketDestination\"}},\"required\":[\"S3BucketDestination\"],\"type\":\"structure\"}"},
+    {"AnalyticsFilter", "{\"members\":{\"And\":{\"shape\":\"AnalyticsAndOperator\"},\"Prefix\":{\"shape\":\"Prefix\"},\"Tag\":{\"shape\":\"Tag\"}},\"type\":\"structure\"}"},
+    {"AnalyticsId", "{\"type\":\"string\"}"},
+    {"AnalyticsS3BucketDestination", "{\"members\":{\"Bucket\":{\"shape\":\"BucketName\"},\"BucketAccountId\":{\"shape\":\"AccountId\"},\"Format\":{\"shape\":\"AnalyticsS3ExportFileFormat\"},\"Prefix\":{\"shape\":\"Prefix\"}},\"required\":[\"Format\",\"Bucket\"],\"type\":\"structure\"}"},
+    {"AnalyticsS3ExportFileFormat", "{\"enum\":[\"CSV\"],\"type\":\"string\"}"},
+    {"Body", "{\"type\":\"blob\"}"},
+    {"Bucket", "{\"members\":{\"CreationDate\":{\"shape\":\"CreationDate\"},\"Name\":{\"shape\":\"BucketName\"}},\"type\":\"structure\"}"},
+    {"BucketAccelerateStatus", "{\"enum\":[\"Enabled\",\"Suspended\"],\"type\":\"string\"}"},
+    {"BucketAlreadyExists", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"BucketAlreadyOwnedByYou", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"BucketCannedACL", "{\"enum\":[\"private\",\"public-read\",\"public-read-write\",\"authenticated-read\"],\"type\":\"string\"}"},
+    {"BucketLifecycleConfiguration", "{\"members\":{\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"LifecycleRules\"}},\"required\":[\"Rules\"],\"type\":\"structure\"}"},
+    {"BucketLocationConstraint", "{\"enum\":[\"\",\"EU\",\"eu-west-1\",\"us-west-1\",\"us-west-2\",\"eu-west-2\",\"eu-west-3\",\"us-east-2\",\"ap-south-1\",\"ap-southeast-1\",\"ap-southeast-2\",\"ap-northeast-1\",\"ap-northeast-2\",\"sa-east-1\",\"cn-north-1\",\"cn-northwest-1\",\"us-gov-west-1\",\"eu-central-1\",\"ca-central-1\"],\"type\":\"string\"}"},
+    {"BucketLoggingStatus", "{\"members\":{\"LoggingEnabled\":{\"shape\":\"LoggingEnabled\"}},\"type\":\"structure\"}"},
+    {"BucketLogsPermission", "{\"enum\":[\"FULL_CONTROL\",\"READ\",\"WRITE\"],\"type\":\"string\"}"},
+    {"BucketName", "{\"type\":\"string\"}"},
+    {"BucketVersioningStatus", "{\"enum\":[\"Enabled\",\"Suspended\"],\"type\":\"string\"}"},
+    {"Buckets", "{\"member\":{\"locationName\":\"Bucket\",\"shape\":\"Bucket\"},\"type\":\"list\"}"},
+    {"BytesProcessed", "{\"type\":\"long\"}"},
+    {"BytesScanned", "{\"type\":\"long\"}"},
+    {"CORSConfiguration", "{\"members\":{\"CORSRules\":{\"locationName\":\"CORSRule\",\"shape\":\"CORSRules\"}},\"required\":[\"CORSRules\"],\"type\":\"structure\"}"},
+    {"CORSRule", "{\"members\":{\"AllowedHeaders\":{\"locationName\":\"AllowedHeader\",\"shape\":\"AllowedHeaders\"},\"AllowedMethods\":{\"locationName\":\"AllowedMethod\",\"shape\":\"AllowedMethods\"},\"AllowedOrigins\":{\"locationName\":\"AllowedOrigin\",\"shape\":\"AllowedOrigins\"},\"ExposeHeaders\":{\"locationName\":\"ExposeHeader\",\"shape\":\"ExposeHeaders\"},\"MaxAgeSeconds\":{\"shape\":\"MaxAgeSeconds\"}},\"required\":[\"AllowedMethods\",\"AllowedOrigins\"],\"type\":\"structure\"}"},
+    {"CORSRules", "{\"flattened\":true,\"member\":{\"shape\":\"CORSRule\"},\"type\":\"list\"}"},
+    {"CSVInput", "{\"members\":{\"Comments\":{\"shape\":\"Comments\"},\"FieldDelimiter\":{\"shape\":\"FieldDelimiter\"},\"FileHeaderInfo\":{\"shape\":\"FileHeaderInfo\"},\"QuoteCharacter\":{\"shape\":\"QuoteCharacter\"},\"QuoteEscapeCharacter\":{\"shape\":\"QuoteEscapeCharacter\"},\"RecordDelimiter\":{\"shape\":\"RecordDelimiter\"}},\"type\":\"structure\"}"},
+    {"CSVOutput", "{\"members\":{\"FieldDelimiter\":{\"shape\":\"FieldDelimiter\"},\"QuoteCharacter\":{\"shape\":\"QuoteCharacter\"},\"QuoteEscapeCharacter\":{\"shape\":\"QuoteEscapeCharacter\"},\"QuoteFields\":{\"shape\":\"QuoteFields\"},\"RecordDelimiter\":{\"shape\":\"RecordDelimiter\"}},\"type\":\"structure\"}"},
+    {"CacheControl", "{\"type\":\"string\"}"},
+    {"CloudFunction", "{\"type\":\"string\"}"},
+    {"CloudFunctionConfiguration", "{\"members\":{\"CloudFunction\":{\"shape\":\"CloudFunction\"},\"Event\":{\"deprecated\":true,\"shape\":\"Event\"},\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Id\":{\"shape\":\"NotificationId\"},\"InvocationRole\":{\"shape\":\"CloudFunctionInvocationRole\"}},\"type\":\"structure\"}"},
+    {"CloudFunctionInvocationRole", "{\"type\":\"string\"}"},
+    {"Code", "{\"type\":\"string\"}"},
+    {"Comments", "{\"type\":\"string\"}"},
+    {"CommonPrefix", "{\"members\":{\"Prefix\":{\"shape\":\"Prefix\"}},\"type\":\"structure\"}"},
+    {"CommonPrefixList", "{\"flattened\":true,\"member\":{\"shape\":\"CommonPrefix\"},\"type\":\"list\"}"},
+    {"CompleteMultipartUploadOutput", "{\"members\":{\"Bucket\":{\"shape\":\"BucketName\"},\"ETag\":{\"shape\":\"ETag\"},\"Expiration\":{\"location\":\"header\",\"locationName\":\"x-amz-expiration\",\"shape\":\"Expiration\"},\"Key\":{\"shape\":\"ObjectKey\"},\"Location\":{\"shape\":\"Location\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"CompleteMultipartUploadRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"MultipartUpload\":{\"locationName\":\"CompleteMultipartUpload\",\"shape\":\"CompletedMultipartUpload\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"UploadId\":{\"location\":\"querystring\",\"locationName\":\"uploadId\",\"shape\":\"MultipartUploadId\"}},\"payload\":\"MultipartUpload\",\"required\":[\"Bucket\",\"Key\",\"UploadId\"],\"type\":\"structure\"}"},
+    {"CompletedMultipartUpload", "{\"members\":{\"Parts\":{\"locationName\":\"Part\",\"shape\":\"CompletedPartList\"}},\"type\":\"structure\"}"},
+    {"CompletedPart", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"PartNumber\":{\"shape\":\"PartNumber\"}},\"type\":\"structure\"}"},
+    {"CompletedPartList", "{\"flattened\":true,\"member\":{\"shape\":\"CompletedPart\"},\"type\":\"list\"}"},
+    {"CompressionType", "{\"enum\":[\"NONE\",\"GZIP\"],\"type\":\"string\"}"},
+    {"Condition", "{\"members\":{\"HttpErrorCodeReturnedEquals\":{\"shape\":\"HttpErrorCodeReturnedEquals\"},\"KeyPrefixEquals\":{\"shape\":\"KeyPrefixEquals\"}},\"type\":\"structure\"}"},
+    {"ConfirmRemoveSelfBucketAccess", "{\"type\":\"boolean\"}"},
+    {"ContentDisposition", "{\"type\":\"string\"}"},
+    {"ContentEncoding", "{\"type\":\"string\"}"},
+    {"ContentLanguage", "{\"type\":\"string\"}"},
+    {"ContentLength", "{\"type\":\"long\"}"},
+    {"ContentMD5", "{\"type\":\"string\"}"},
+    {"ContentRange", "{\"type\":\"string\"}"},
+    {"ContentType", "{\"type\":\"string\"}"},
+    {"ContinuationEvent", "{\"event\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"CopyObjectOutput", "{\"members\":{\"CopyObjectResult\":{\"shape\":\"CopyObjectResult\"},\"CopySourceVersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-version-id\",\"shape\":\"CopySourceVersionId\"},\"Expiration\":{\"location\":\"header\",\"locationName\":\"x-amz-expiration\",\"shape\":\"Expiration\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"payload\":\"CopyObjectResult\",\"type\":\"structure\"}"},
+    {"CopyObjectRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"ObjectCannedACL\"},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CacheControl\":{\"location\":\"header\",\"locationName\":\"Cache-Control\",\"shape\":\"CacheControl\"},\"ContentDisposition\":{\"location\":\"header\",\"locationName\":\"Content-Disposition\",\"shape\":\"ContentDisposition\"},\"ContentEncoding\":{\"location\":\"header\",\"locationName\":\"Content-Encoding\",\"shape\":\"ContentEncoding\"},\"ContentLanguage\":{\"location\":\"header\",\"locationName\":\"Content-Language\",\"shape\":\"ContentLanguage\"},\"ContentType\":{\"location\":\"header\",\"locationName\":\"Content-Type\",\"shape\":\"ContentType\"},\"CopySource\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source\",\"shape\":\"CopySource\"},\"CopySourceIfMatch\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-match\",\"shape\":\"CopySourceIfMatch\"},\"CopySourceIfModifiedSince\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-modified-since\",\"shape\":\"CopySourceIfModifiedSince\"},\"CopySourceIfNoneMatch\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-none-match\",\"shape\":\"CopySourceIfNoneMatch\"},\"CopySourceIfUnmodifiedSince\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-unmodified-since\",\"shape\":\"CopySourceIfUnmodifiedSince\"},\"CopySourceSSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-algorithm\",\"shape\":\"CopySourceSSECustomerAlgorithm\"},\"CopySourceSSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key\",\"shape\":\"CopySourceSSECustomerKey\"},\"CopySourceSSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key-MD5\",\"shape\":\"CopySourceSSECustomerKeyMD5\"},\"Expires\":{\"location\":\"header\",\"locationName\":\"Expires\",\"shape\":\"Expires\"},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"Metadata\":{\"location\":\"headers\",\"locationName\":\"x-amz-meta-\",\"shape\":\"Metadata\"},\"MetadataDirective\":{\"location\":\"header\",\"locationName\":\"x-amz-metadata-directive\",\"shape\":\"MetadataDirective\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"StorageClass\":{\"location\":\"header\",\"locationName\":\"x-amz-storage-class\",\"shape\":\"StorageClass\"},\"Tagging\":{\"location\":\"header\",\"locationName\":\"x-amz-tagging\",\"shape\":\"TaggingHeader\"},\"TaggingDirective\":{\"location\":\"header\",\"locationName\":\"x-amz-tagging-directive\",\"shape\":\"TaggingDirective\"},\"WebsiteRedirectLocation\":{\"location\":\"header\",\"locationName\":\"x-amz-website-redirect-location\",\"shape\":\"WebsiteRedirectLocation\"}},\"required\":[\"Bucket\",\"CopySource\",\"Key\"],\"type\":\"structure\"}"},
+    {"CopyObjectResult", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"LastModified\":{\"shape\":\"LastModified\"}},\"type\":\"structure\"}"},
+    {"CopyPartResult", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"LastModified\":{\"shape\":\"LastModified\"}},\"type\":\"structure\"}"},
+    {"CopySource", "{\"pattern\":\"\\\\/.+\\\\/.+\",\"type\":\"string\"}"},
+    {"CopySourceIfMatch", "{\"type\":\"string\"}"},
+    {"CopySourceIfModifiedSince", "{\"type\":\"timestamp\"}"},
+    {"CopySourceIfNoneMatch", "{\"type\":\"string\"}"},
+    {"CopySourceIfUnmodifiedSince", "{\"type\":\"timestamp\"}"},
+    {"CopySourceRange", "{\"type\":\"string\"}"},
+    {"CopySourceSSECustomerAlgorithm", "{\"type\":\"string\"}"},
+    {"CopySourceSSECustomerKey", "{\"sensitive\":true,\"type\":\"string\"}"},
+    {"CopySourceSSECustomerKeyMD5", "{\"type\":\"string\"}"},
+    {"CopySourceVersionId", "{\"type\":\"string\"}"},
+    {"CreateBucketConfiguration", "{\"members\":{\"LocationConstraint\":{\"shape\":\"BucketLocationConstraint\"}},\"type\":\"structure\"}"},
+    {"CreateBucketOutput", "{\"members\":{\"Location\":{\"location\":\"header\",\"locationName\":\"Location\",\"shape\":\"Location\"}},\"type\":\"structure\"}"},
+    {"CreateBucketRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"BucketCannedACL\"},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CreateBucketConfiguration\":{\"locationName\":\"CreateBucketConfiguration\",\"shape\":\"CreateBucketConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWrite\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write\",\"shape\":\"GrantWrite\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"}},\"payload\":\"CreateBucketConfiguration\",\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"CreateMultipartUploadOutput", "{\"members\":{\"AbortDate\":{\"location\":\"header\",\"locationName\":\"x-amz-abort-date\",\"shape\":\"AbortDate\"},\"AbortRuleId\":{\"location\":\"header\",\"locationName\":\"x-amz-abort-rule-id\",\"shape\":\"AbortRuleId\"},\"Bucket\":{\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"shape\":\"ObjectKey\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"UploadId\":{\"shape\":\"MultipartUploadId\"}},\"type\":\"structure\"}"},
+    {"CreateMultipartUploadRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"ObjectCannedACL\"},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CacheControl\":{\"location\":\"header\",\"locationName\":\"Cache-Control\",\"shape\":\"CacheControl\"},\"ContentDisposition\":{\"location\":\"header\",\"locationName\":\"Content-Disposition\",\"shape\":\"ContentDisposition\"},\"ContentEncoding\":{\"location\":\"header\",\"locationName\":\"Content-Encoding\",\"shape\":\"ContentEncoding\"},\"ContentLanguage\":{\"location\":\"header\",\"locationName\":\"Content-Language\",\"shape\":\"ContentLanguage\"},\"ContentType\":{\"location\":\"header\",\"locationName\":\"Content-Type\",\"shape\":\"ContentType\"},\"Expires\":{\"location\":\"header\",\"locationName\":\"Expires\",\"shape\":\"Expires\"},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"Metadata\":{\"location\":\"headers\",\"locationName\":\"x-amz-meta-\",\"shape\":\"Metadata\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"StorageClass\":{\"location\":\"header\",\"locationName\":\"x-amz-storage-class\",\"shape\":\"StorageClass\"},\"Tagging\":{\"location\":\"header\",\"locationName\":\"x-amz-tagging\",\"shape\":\"TaggingHeader\"},\"WebsiteRedirectLocation\":{\"location\":\"header\",\"locationName\":\"x-amz-website-redirect-location\",\"shape\":\"WebsiteRedirectLocation\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"CreationDate", "{\"type\":\"timestamp\"}"},
+    {"Date", "{\"timestampFormat\":\"iso8601\",\"type\":\"timestamp\"}"},
+    {"Days", "{\"type\":\"integer\"}"},
+    {"DaysAfterInitiation", "{\"type\":\"integer\"}"},
+    {"Delete", "{\"members\":{\"Objects\":{\"locationName\":\"Object\",\"shape\":\"ObjectIdentifierList\"},\"Quiet\":{\"shape\":\"Quiet\"}},\"required\":[\"Objects\"],\"type\":\"structure\"}"},
+    {"DeleteBucketAnalyticsConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"AnalyticsId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"DeleteBucketCorsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketEncryptionRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketInventoryConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"InventoryId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"DeleteBucketLifecycleRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketMetricsConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"MetricsId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"DeleteBucketPolicyRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketReplicationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteBucketWebsiteRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DeleteMarker", "{\"type\":\"boolean\"}"},
+    {"DeleteMarkerEntry", "{\"members\":{\"IsLatest\":{\"shape\":\"IsLatest\"},\"Key\":{\"shape\":\"ObjectKey\"},\"LastModified\":{\"shape\":\"LastModified\"},\"Owner\":{\"shape\":\"Owner\"},\"VersionId\":{\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"DeleteMarkerVersionId", "{\"type\":\"string\"}"},
+    {"DeleteMarkers", "{\"flattened\":true,\"member\":{\"shape\":\"DeleteMarkerEntry\"},\"type\":\"list\"}"},
+    {"DeleteObjectOutput", "{\"members\":{\"DeleteMarker\":{\"location\":\"header\",\"locationName\":\"x-amz-delete-marker\",\"shape\":\"DeleteMarker\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"DeleteObjectRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"MFA\":{\"location\":\"header\",\"locationName\":\"x-amz-mfa\",\"shape\":\"MFA\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"DeleteObjectTaggingOutput", "{\"members\":{\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"DeleteObjectTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"DeleteObjectsOutput", "{\"members\":{\"Deleted\":{\"shape\":\"DeletedObjects\"},\"Errors\":{\"locationName\":\"Error\",\"shape\":\"Errors\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"}},\"type\":\"structure\"}"},
+    {"DeleteObjectsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Delete\":{\"locationName\":\"Delete\",\"shape\":\"Delete\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"MFA\":{\"location\":\"header\",\"locationName\":\"x-amz-mfa\",\"shape\":\"MFA\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"}},\"payload\":\"Delete\",\"required\":[\"Bucket\",\"Delete\"],\"type\":\"structure\"}"},
+    {"DeletedObject", "{\"members\":{\"DeleteMarker\":{\"shape\":\"DeleteMarker\"},\"DeleteMarkerVersionId\":{\"shape\":\"DeleteMarkerVersionId\"},\"Key\":{\"shape\":\"ObjectKey\"},\"VersionId\":{\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"DeletedObjects", "{\"flattened\":true,\"member\":{\"shape\":\"DeletedObject\"},\"type\":\"list\"}"},
+    {"Delimiter", "{\"type\":\"string\"}"},
+    {"Description", "{\"type\":\"string\"}"},
+    {"Destination", "{\"members\":{\"AccessControlTranslation\":{\"shape\":\"AccessControlTranslation\"},\"Account\":{\"shape\":\"AccountId\"},\"Bucket\":{\"shape\":\"BucketName\"},\"EncryptionConfiguration\":{\"shape\":\"EncryptionConfiguration\"},\"StorageClass\":{\"shape\":\"StorageClass\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"DisplayName", "{\"type\":\"string\"}"},
+    {"ETag", "{\"type\":\"string\"}"},
+    {"EmailAddress", "{\"type\":\"string\"}"},
+    {"EnableRequestProgress", "{\"type\":\"boolean\"}"},
+    {"EncodingType", "{\"enum\":[\"url\"],\"type\":\"string\"}"},
+    {"Encryption", "{\"members\":{\"EncryptionType\":{\"shape\":\"ServerSideEncryption\"},\"KMSContext\":{\"shape\":\"KMSContext\"},\"KMSKeyId\":{\"shape\":\"SSEKMSKeyId\"}},\"required\":[\"EncryptionType\"],\"type\":\"structure\"}"},
+    {"EncryptionConfiguration", "{\"members\":{\"ReplicaKmsKeyID\":{\"shape\":\"ReplicaKmsKeyID\"}},\"type\":\"structure\"}"},
+    {"EndEvent", "{\"event\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"Error", "{\"members\":{\"Code\":{\"shape\":\"Code\"},\"Key\":{\"shape\":\"ObjectKey\"},\"Message\":{\"shape\":\"Message\"},\"VersionId\":{\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"ErrorDocument", "{\"members\":{\"Key\":{\"shape\":\"ObjectKey\"}},\"required\":[\"Key\"],\"type\":\"structure\"}"},
+    {"Errors", "{\"flattened\":true,\"member\":{\"shape\":\"Error\"},\"type\":\"list\"}"},
+    {"Event", "{\"enum\":[\"s3:ReducedRedundancyLostObject\",\"s3:ObjectCreated:*\",\"s3:ObjectCreated:Put\",\"s3:ObjectCreated:Post\",\"s3:ObjectCreated:Copy\",\"s3:ObjectCreated:CompleteMultipartUpload\",\"s3:ObjectRemoved:*\",\"s3:ObjectRemoved:Delete\",\"s3:ObjectRemoved:DeleteMarkerCreated\"],\"type\":\"string\"}"},
+    {"EventList", "{\"flattened\":true,\"member\":{\"shape\":\"Event\"},\"type\":\"list\"}"},
+    {"Expiration", "{\"type\":\"string\"}"},
+    {"ExpirationStatus", "{\"enum\":[\"Enabled\",\"Disabled\"],\"type\":\"string\"}"},
+    {"ExpiredObjectDeleteMarker", "{\"type\":\"boolean\"}"},
+    {"Expires", "{\"type\":\"timestamp\"}"},
+    {"ExposeHeader", "{\"type\":\"string\"}"},
+    {"ExposeHeaders", "{\"flattened\":true,\"member\":{\"shape\":\"ExposeHeader\"},\"type\":\"list\"}"},
+    {"Expression", "{\"type\":\"string\"}"},
+    {"ExpressionType", "{\"enum\":[\"SQL\"],\"type\":\"string\"}"},
+    {"FetchOwner", "{\"type\":\"boolean\"}"},
+    {"FieldDelimiter", "{\"type\":\"string\"}"},
+    {"FileHeaderInfo", "{\"enum\":[\"USE\",\"IGNORE\",\"NONE\"],\"type\":\"string\"}"},
+    {"FilterRule", "{\"members\":{\"Name\":{\"shape\":\"FilterRuleName\"},\"Value\":{\"shape\":\"FilterRuleValue\"}},\"type\":\"structure\"}"},
+    {"FilterRuleList", "{\"flattened\":true,\"member\":{\"shape\":\"FilterRule\"},\"type\":\"list\"}"},
+    {"FilterRuleName", "{\"enum\":[\"prefix\",\"suffix\"],\"type\":\"string\"}"},
+    {"FilterRuleValue", "{\"type\":\"string\"}"},
+    {"GetBucketAccelerateConfigurationOutput", "{\"members\":{\"Status\":{\"shape\":\"BucketAccelerateStatus\"}},\"type\":\"structure\"}"},
+    {"GetBucketAccelerateConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketAclOutput", "{\"members\":{\"Grants\":{\"locationName\":\"AccessControlList\",\"shape\":\"Grants\"},\"Owner\":{\"shape\":\"Owner\"}},\"type\":\"structure\"}"},
+    {"GetBucketAclRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketAnalyticsConfigurationOutput", "{\"members\":{\"AnalyticsConfiguration\":{\"shape\":\"AnalyticsConfiguration\"}},\"payload\":\"AnalyticsConfiguration\",\"type\":\"structure\"}"},
+    {"GetBucketAnalyticsConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"AnalyticsId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"GetBucketCorsOutput", "{\"members\":{\"CORSRules\":{\"locationName\":\"CORSRule\",\"shape\":\"CORSRules\"}},\"type\":\"structure\"}"},
+    {"GetBucketCorsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketEncryptionOutput", "{\"members\":{\"ServerSideEncryptionConfiguration\":{\"shape\":\"ServerSideEncryptionConfiguration\"}},\"payload\":\"ServerSideEncryptionConfiguration\",\"type\":\"structure\"}"},
+    {"GetBucketEncryptionRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketInventoryConfigurationOutput", "{\"members\":{\"InventoryConfiguration\":{\"shape\":\"InventoryConfiguration\"}},\"payload\":\"InventoryConfiguration\",\"type\":\"structure\"}"},
+    {"GetBucketInventoryConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"InventoryId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"GetBucketLifecycleConfigurationOutput", "{\"members\":{\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"LifecycleRules\"}},\"type\":\"structure\"}"},
+    {"GetBucketLifecycleConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketLifecycleOutput", "{\"members\":{\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"Rules\"}},\"type\":\"structure\"}"},
+    {"GetBucketLifecycleRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketLocationOutput", "{\"members\":{\"LocationConstraint\":{\"shape\":\"BucketLocationConstraint\"}},\"type\":\"structure\"}"},
+    {"GetBucketLocationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketLoggingOutput", "{\"members\":{\"LoggingEnabled\":{\"shape\":\"LoggingEnabled\"}},\"type\":\"structure\"}"},
+    {"GetBucketLoggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketMetricsConfigurationOutput", "{\"members\":{\"MetricsConfiguration\":{\"shape\":\"MetricsConfiguration\"}},\"payload\":\"MetricsConfiguration\",\"type\":\"structure\"}"},
+    {"GetBucketMetricsConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"MetricsId\"}},\"required\":[\"Bucket\",\"Id\"],\"type\":\"structure\"}"},
+    {"GetBucketNotificationConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketPolicyOutput", "{\"members\":{\"Policy\":{\"shape\":\"Policy\"}},\"payload\":\"Policy\",\"type\":\"structure\"}"},
+    {"GetBucketPolicyRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketReplicationOutput", "{\"members\":{\"ReplicationConfiguration\":{\"shape\":\"ReplicationConfiguration\"}},\"payload\":\"ReplicationConfiguration\",\"type\":\"structure\"}"},
+    {"GetBucketReplicationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketRequestPaymentOutput", "{\"members\":{\"Payer\":{\"shape\":\"Payer\"}},\"type\":\"structure\"}"},
+    {"GetBucketRequestPaymentRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketTaggingOutput", "{\"members\":{\"TagSet\":{\"shape\":\"TagSet\"}},\"required\":[\"TagSet\"],\"type\":\"structure\"}"},
+    {"GetBucketTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketVersioningOutput", "{\"members\":{\"MFADelete\":{\"locationName\":\"MfaDelete\",\"shape\":\"MFADeleteStatus\"},\"Status\":{\"shape\":\"BucketVersioningStatus\"}},\"type\":\"structure\"}"},
+    {"GetBucketVersioningRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetBucketWebsiteOutput", "{\"members\":{\"ErrorDocument\":{\"shape\":\"ErrorDocument\"},\"IndexDocument\":{\"shape\":\"IndexDocument\"},\"RedirectAllRequestsTo\":{\"shape\":\"RedirectAllRequestsTo\"},\"RoutingRules\":{\"shape\":\"RoutingRules\"}},\"type\":\"structure\"}"},
+    {"GetBucketWebsiteRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"GetObjectAclOutput", "{\"members\":{\"Grants\":{\"locationName\":\"AccessControlList\",\"shape\":\"Grants\"},\"Owner\":{\"shape\":\"Owner\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"}},\"type\":\"structure\"}"},
+    {"GetObjectAclRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"GetObjectOutput", "{\"members\":{\"AcceptRanges\":{\"location\":\"header\",\"locationName\":\"accept-ranges\",\"shape\":\"AcceptRanges\"},\"Body\":{\"shape\":\"Body\",\"streaming\":true},\"CacheControl\":{\"location\":\"header\",\"locationName\":\"Cache-Control\",\"shape\":\"CacheControl\"},\"ContentDisposition\":{\"location\":\"header\",\"locationName\":\"Content-Disposition\",\"shape\":\"ContentDisposition\"},\"ContentEncoding\":{\"location\":\"header\",\"locationName\":\"Content-Encoding\",\"shape\":\"ContentEncoding\"},\"ContentLanguage\":{\"location\":\"header\",\"locationName\":\"Content-Language\",\"shape\":\"ContentLanguage\"},\"ContentLength\":{\"location\":\"header\",\"locationName\":\"Content-Length\",\"shape\":\"ContentLength\"},\"ContentRange\":{\"location\":\"header\",\"locationName\":\"Content-Range\",\"shape\":\"ContentRange\"},\"ContentType\":{\"location\":\"header\",\"locationName\":\"Content-Type\",\"shape\":\"ContentType\"},\"DeleteMarker\":{\"location\":\"header\",\"locationName\":\"x-amz-delete-marker\",\"shape\":\"DeleteMarker\"},\"ETag\":{\"location\":\"header\",\"locationName\":\"ETag\",\"shape\":\"ETag\"},\"Expiration\":{\"location\":\"header\",\"locationName\":\"x-amz-expiration\",\"shape\":\"Expiration\"},\"Expires\":{\"location\":\"header\",\"locationName\":\"Expires\",\"shape\":\"Expires\"},\"LastModified\":{\"location\":\"header\",\"locationName\":\"Last-Modified\",\"shape\":\"LastModified\"},\"Metadata\":{\"location\":\"headers\",\"locationName\":\"x-amz-meta-\",\"shape\":\"Metadata\"},\"MissingMeta\":{\"location\":\"header\",\"locationName\":\"x-amz-missing-meta\",\"shape\":\"MissingMeta\"},\"PartsCount\":{\"location\":\"header\",\"locationName\":\"x-amz-mp-parts-count\",\"shape\":\"PartsCount\"},\"ReplicationStatus\":{\"location\":\"header\",\"locationName\":\"x-amz-replication-status\",\"shape\":\"ReplicationStatus\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"Restore\":{\"location\":\"header\",\"locationName\":\"x-amz-restore\",\"shape\":\"Restore\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"StorageClass\":{\"location\":\"header\",\"locationName\":\"x-amz-storage-class\",\"shape\":\"StorageClass\"},\"TagCount\":{\"location\":\"header\",\"locationName\":\"x-amz-tagging-count\",\"shape\":\"TagCount\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"},\"WebsiteRedirectLocation\":{\"location\":\"header\",\"locationName\":\"x-amz-website-redirect-location\",\"shape\":\"WebsiteRedirectLocation\"}},\"payload\":\"Body\",\"type\":\"structure\"}"},
+    {"GetObjectRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"IfMatch\":{\"location\":\"header\",\"locationName\":\"If-Match\",\"shape\":\"IfMatch\"},\"IfModifiedSince\":{\"location\":\"header\",\"locationName\":\"If-Modified-Since\",\"shape\":\"IfModifiedSince\"},\"IfNoneMatch\":{\"location\":\"header\",\"locationName\":\"If-None-Match\",\"shape\":\"IfNoneMatch\"},\"IfUnmodifiedSince\":{\"location\":\"header\",\"locationName\":\"If-Unmodified-Since\",\"shape\":\"IfUnmodifiedSince\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"PartNumber\":{\"location\":\"querystring\",\"locationName\":\"partNumber\",\"shape\":\"PartNumber\"},\"Range\":{\"location\":\"header\",\"locationName\":\"Range\",\"shape\":\"Range\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"ResponseCacheControl\":{\"location\":\"querystring\",\"locationName\":\"response-cache-control\",\"shape\":\"ResponseCacheControl\"},\"ResponseContentDisposition\":{\"location\":\"querystring\",\"locationName\":\"response-content-disposition\",\"shape\":\"ResponseContentDisposition\"},\"ResponseContentEncoding\":{\"location\":\"querystring\",\"locationName\":\"response-content-encoding\",\"shape\":\"ResponseContentEncoding\"},\"ResponseContentLanguage\":{\"location\":\"querystring\",\"locationName\":\"response-content-language\",\"shape\":\"ResponseContentLanguage\"},\"ResponseContentType\":{\"location\":\"querystring\",\"locationName\":\"response-content-type\",\"shape\":\"ResponseContentType\"},\"ResponseExpires\":{\"location\":\"querystring\",\"locationName\":\"response-expires\",\"shape\":\"ResponseExpires\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"GetObjectTaggingOutput", "{\"members\":{\"TagSet\":{\"shape\":\"TagSet\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"TagSet\"],\"type\":\"structure\"}"},
+    {"GetObjectTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"GetObjectTorrentOutput", "{\"members\":{\"Body\":{\"shape\":\"Body\",\"streaming\":true},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"}},\"payload\":\"Body\",\"type\":\"structure\"}"},
+    {"GetObjectTorrentRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"GlacierJobParameters", "{\"members\":{\"Tier\":{\"shape\":\"Tier\"}},\"required\":[\"Tier\"],\"type\":\"structure\"}"},
+    {"Grant", "{\"members\":{\"Grantee\":{\"shape\":\"Grantee\"},\"Permission\":{\"shape\":\"Permission\"}},\"type\":\"structure\"}"},
+    {"GrantFullControl", "{\"type\":\"string\"}"},
+    {"GrantRead", "{\"type\":\"string\"}"},
+    {"GrantReadACP", "{\"type\":\"string\"}"},
+    {"GrantWrite", "{\"type\":\"string\"}"},
+    {"GrantWriteACP", "{\"type\":\"string\"}"},
+    {"Grantee", "{\"members\":{\"DisplayName\":{\"shape\":\"DisplayName\"},\"EmailAddress\":{\"shape\":\"EmailAddress\"},\"ID\":{\"shape\":\"ID\"},\"Type\":{\"locationName\":\"xsi:type\",\"shape\":\"Type\",\"xmlAttribute\":true},\"URI\":{\"shape\":\"URI\"}},\"required\":[\"Type\"],\"type\":\"structure\",\"xmlNamespace\":{\"prefix\":\"xsi\",\"uri\":\"http://www.w3.org/2001/XMLSchema-instance\"}}"},
+    {"Grants", "{\"member\":{\"locationName\":\"Grant\",\"shape\":\"Grant\"},\"type\":\"list\"}"},
+    {"HeadBucketRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"HeadObjectOutput", "{\"members\":{\"AcceptRanges\":{\"location\":\"header\",\"locationName\":\"accept-ranges\",\"shape\":\"AcceptRanges\"},\"CacheControl\":{\"location\":\"header\",\"locationName\":\"Cache-Control\",\"shape\":\"CacheControl\"},\"ContentDisposition\":{\"location\":\"header\",\"locationName\":\"Content-Disposition\",\"shape\":\"ContentDisposition\"},\"ContentEncoding\":{\"location\":\"header\",\"locationName\":\"Content-Encoding\",\"shape\":\"ContentEncoding\"},\"ContentLanguage\":{\"location\":\"header\",\"locationName\":\"Content-Language\",\"shape\":\"ContentLanguage\"},\"ContentLength\":{\"location\":\"header\",\"locationName\":\"Content-Length\",\"shape\":\"ContentLength\"},\"ContentType\":{\"location\":\"header\",\"locationName\":\"Content-Type\",\"shape\":\"ContentType\"},\"DeleteMarker\":{\"location\":\"header\",\"locationName\":\"x-amz-delete-marker\",\"shape\":\"DeleteMarker\"},\"ETag\":{\"location\":\"header\",\"locationName\":\"ETag\",\"shape\":\"ETag\"},\"Expiration\":{\"location\":\"header\",\"locationName\":\"x-amz-expiration\",\"shape\":\"Expiration\"},\"Expires\":{\"location\":\"header\",\"locationName\":\"Expires\",\"shape\":\"Expires\"},\"LastModified\":{\"location\":\"header\",\"locationName\":\"Last-Modified\",\"shape\":\"LastModified\"},\"Metadata\":{\"location\":\"headers\",\"locationName\":\"x-amz-meta-\",\"shape\":\"Metadata\"},\"MissingMeta\":{\"location\":\"header\",\"locationName\":\"x-amz-missing-meta\",\"shape\":\"MissingMeta\"},\"PartsCount\":{\"location\":\"header\",\"locationName\":\"x-amz-mp-parts-count\",\"shape\":\"PartsCount\"},\"ReplicationStatus\":{\"location\":\"header\",\"locationName\":\"x-amz-replication-status\",\"shape\":\"ReplicationStatus\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"Restore\":{\"location\":\"header\",\"locationName\":\"x-amz-restore\",\"shape\":\"Restore\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"StorageClass\":{\"location\":\"header\",\"locationName\":\"x-amz-storage-class\",\"shape\":\"StorageClass\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"},\"WebsiteRedirectLocation\":{\"location\":\"header\",\"locationName\":\"x-amz-website-redirect-location\",\"shape\":\"WebsiteRedirectLocation\"}},\"type\":\"structure\"}"},
+    {"HeadObjectRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"IfMatch\":{\"location\":\"header\",\"locationName\":\"If-Match\",\"shape\":\"IfMatch\"},\"IfModifiedSince\":{\"location\":\"header\",\"locationName\":\"If-Modified-Since\",\"shape\":\"IfModifiedSince\"},\"IfNoneMatch\":{\"location\":\"header\",\"locationName\":\"If-None-Match\",\"shape\":\"IfNoneMatch\"},\"IfUnmodifiedSince\":{\"location\":\"header\",\"locationName\":\"If-Unmodified-Since\",\"shape\":\"IfUnmodifiedSince\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"PartNumber\":{\"location\":\"querystring\",\"locationName\":\"partNumber\",\"shape\":\"PartNumber\"},\"Range\":{\"location\":\"header\",\"locationName\":\"Range\",\"shape\":\"Range\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"HostName", "{\"type\":\"string\"}"},
+    {"HttpErrorCodeReturnedEquals", "{\"type\":\"string\"}"},
+    {"HttpRedirectCode", "{\"type\":\"string\"}"},
+    {"ID", "{\"type\":\"string\"}"},
+    {"IfMatch", "{\"type\":\"string\"}"},
+    {"IfModifiedSince", "{\"type\":\"timestamp\"}"},
+    {"IfNoneMatch", "{\"type\":\"string\"}"},
+    {"IfUnmodifiedSince", "{\"type\":\"timestamp\"}"},
+    {"IndexDocument", "{\"members\":{\"Suffix\":{\"shape\":\"Suffix\"}},\"required\":[\"Suffix\"],\"type\":\"structure\"}"},
+    {"Initiated", "{\"type\":\"timestamp\"}"},
+    {"Initiator", "{\"members\":{\"DisplayName\":{\"shape\":\"DisplayName\"},\"ID\":{\"shape\":\"ID\"}},\"type\":\"structure\"}"},
+    {"InputSerialization", "{\"members\":{\"CSV\":{\"shape\":\"CSVInput\"},\"CompressionType\":{\"shape\":\"CompressionType\"},\"JSON\":{\"shape\":\"JSONInput\"}},\"type\":\"structure\"}"},
+    {"InventoryConfiguration", "{\"members\":{\"Destination\":{\"shape\":\"InventoryDestination\"},\"Filter\":{\"shape\":\"InventoryFilter\"},\"Id\":{\"shape\":\"InventoryId\"},\"IncludedObjectVersions\":{\"shape\":\"InventoryIncludedObjectVersions\"},\"IsEnabled\":{\"shape\":\"IsEnabled\"},\"OptionalFields\":{\"shape\":\"InventoryOptionalFields\"},\"Schedule\":{\"shape\":\"InventorySchedule\"}},\"required\":[\"Destination\",\"IsEnabled\",\"Id\",\"IncludedObjectVersions\",\"Schedule\"],\"type\":\"structure\"}"},
+    {"InventoryConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"InventoryConfiguration\"},\"type\":\"list\"}"},
+    {"InventoryDestination", "{\"members\":{\"S3BucketDestination\":{\"shape\":\"InventoryS3BucketDestination\"}},\"required\":[\"S3BucketDestination\"],\"type\":\"structure\"}"},
+    {"InventoryEncryption", "{\"members\":{\"SSEKMS\":{\"locationName\":\"SSE-KMS\",\"shape\":\"SSEKMS\"},\"SSES3\":{\"locationName\":\"SSE-S3\",\"shape\":\"SSES3\"}},\"type\":\"structure\"}"},
+    {"InventoryFilter", "{\"members\":{\"Prefix\":{\"shape\":\"Prefix\"}},\"required\":[\"Prefix\"],\"type\":\"structure\"}"},
+    {"InventoryFormat", "{\"enum\":[\"CSV\",\"ORC\"],\"type\":\"string\"}"},
+    {"InventoryFrequency", "{\"enum\":[\"Daily\",\"Weekly\"],\"type\":\"string\"}"},
+    {"InventoryId", "{\"type\":\"string\"}"},
+    {"InventoryIncludedObjectVersions", "{\"enum\":[\"All\",\"Current\"],\"type\":\"string\"}"},
+    {"InventoryOptionalField", "{\"enum\":[\"Size\",\"LastModifiedDate\",\"StorageClass\",\"ETag\",\"IsMultipartUploaded\",\"ReplicationStatus\",\"EncryptionStatus\"],\"type\":\"string\"}"},
+    {"InventoryOptionalFields", "{\"member\":{\"locationName\":\"Field\",\"shape\":\"InventoryOptionalField\"},\"type\":\"list\"}"},
+    {"InventoryS3BucketDestination", "{\"members\":{\"AccountId\":{\"shape\":\"AccountId\"},\"Bucket\":{\"shape\":\"BucketName\"},\"Encryption\":{\"shape\":\"InventoryEncryption\"},\"Format\":{\"shape\":\"InventoryFormat\"},\"Prefix\":{\"shape\":\"Prefix\"}},\"required\":[\"Bucket\",\"Format\"],\"type\":\"structure\"}"},
+    {"InventorySchedule", "{\"members\":{\"Frequency\":{\"shape\":\"InventoryFrequency\"}},\"required\":[\"Frequency\"],\"type\":\"structure\"}"},
+    {"IsEnabled", "{\"type\":\"boolean\"}"},
+    {"IsLatest", "{\"type\":\"boolean\"}"},
+    {"IsTruncated", "{\"type\":\"boolean\"}"},
+    {"JSONInput", "{\"members\":{\"Type\":{\"shape\":\"JSONType\"}},\"type\":\"structure\"}"},
+    {"JSONOutput", "{\"members\":{\"RecordDelimiter\":{\"shape\":\"RecordDelimiter\"}},\"type\":\"structure\"}"},
+    {"JSONType", "{\"enum\":[\"DOCUMENT\",\"LINES\"],\"type\":\"string\"}"},
+    {"KMSContext", "{\"type\":\"string\"}"},
+    {"KeyCount", "{\"type\":\"integer\"}"},
+    {"KeyMarker", "{\"type\":\"string\"}"},
+    {"KeyPrefixEquals", "{\"type\":\"string\"}"},
+    {"LambdaFunctionArn", "{\"type\":\"string\"}"},
+    {"LambdaFunctionConfiguration", "{\"members\":{\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Filter\":{\"shape\":\"NotificationConfigurationFilter\"},\"Id\":{\"shape\":\"NotificationId\"},\"LambdaFunctionArn\":{\"locationName\":\"CloudFunction\",\"shape\":\"LambdaFunctionArn\"}},\"required\":[\"LambdaFunctionArn\",\"Events\"],\"type\":\"structure\"}"},
+    {"LambdaFunctionConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"LambdaFunctionConfiguration\"},\"type\":\"list\"}"},
+    {"LastModified", "{\"type\":\"timestamp\"}"},
+    {"LifecycleConfiguration", "{\"members\":{\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"Rules\"}},\"required\":[\"Rules\"],\"type\":\"structure\"}"},
+    {"LifecycleExpiration", "{\"members\":{\"Date\":{\"shape\":\"Date\"},\"Days\":{\"shape\":\"Days\"},\"ExpiredObjectDeleteMarker\":{\"shape\":\"ExpiredObjectDeleteMarker\"}},\"type\":\"structure\"}"},
+    {"LifecycleRule", "{\"members\":{\"AbortIncompleteMultipartUpload\":{\"shape\":\"AbortIncompleteMultipartUpload\"},\"Expiration\":{\"shape\":\"LifecycleExpiration\"},\"Filter\":{\"shape\":\"LifecycleRuleFilter\"},\"ID\":{\"shape\":\"ID\"},\"NoncurrentVersionExpiration\":{\"shape\":\"NoncurrentVersionExpiration\"},\"NoncurrentVersionTransitions\":{\"locationName\":\"NoncurrentVersionTransition\",\"shape\":\"NoncurrentVersionTransitionList\"},\"Prefix\":{\"deprecated\":true,\"shape\":\"Prefix\"},\"Status\":{\"shape\":\"ExpirationStatus\"},\"Transitions\":{\"locationName\":\"Transition\",\"shape\":\"TransitionList\"}},\"required\":[\"Status\"],\"type\":\"structure\"}"},
+    {"LifecycleRuleAndOperator", "{\"members\":{\"Prefix\":{\"shape\":\"Prefix\"},\"Tags\":{\"flattened\":true,\"locationName\":\"Tag\",\"shape\":\"TagSet\"}},\"type\":\"structure\"}"},
+    {"LifecycleRuleFilter", "{\"members\":{\"And\":{\"shape\":\"LifecycleRuleAndOperator\"},\"Prefix\":{\"shape\":\"Prefix\"},\"Tag\":{\"shape\":\"Tag\"}},\"type\":\"structure\"}"},
+    {"LifecycleRules", "{\"flattened\":true,\"member\":{\"shape\":\"LifecycleRule\"},\"type\":\"list\"}"},
+    {"ListBucketAnalyticsConfigurationsOutput", "{\"members\":{\"AnalyticsConfigurationList\":{\"locationName\":\"AnalyticsConfiguration\",\"shape\":\"AnalyticsConfigurationList\"},\"ContinuationToken\":{\"shape\":\"Token\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"NextContinuationToken\":{\"shape\":\"NextToken\"}},\"type\":\"structure\"}"},
+    {"ListBucketAnalyticsConfigurationsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContinuationToken\":{\"location\":\"querystring\",\"locationName\":\"continuation-token\",\"shape\":\"Token\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListBucketInventoryConfigurationsOutput", "{\"members\":{\"ContinuationToken\":{\"shape\":\"Token\"},\"InventoryConfigurationList\":{\"locationName\":\"InventoryConfiguration\",\"shape\":\"InventoryConfigurationList\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"NextContinuationToken\":{\"shape\":\"NextToken\"}},\"type\":\"structure\"}"},
+    {"ListBucketInventoryConfigurationsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContinuationToken\":{\"location\":\"querystring\",\"locationName\":\"continuation-token\",\"shape\":\"Token\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListBucketMetricsConfigurationsOutput", "{\"members\":{\"ContinuationToken\":{\"shape\":\"Token\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"MetricsConfigurationList\":{\"locationName\":\"MetricsConfiguration\",\"shape\":\"MetricsConfigurationList\"},\"NextContinuationToken\":{\"shape\":\"NextToken\"}},\"type\":\"structure\"}"},
+    {"ListBucketMetricsConfigurationsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContinuationToken\":{\"location\":\"querystring\",\"locationName\":\"continuation-token\",\"shape\":\"Token\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListBucketsOutput", "{\"members\":{\"Buckets\":{\"shape\":\"Buckets\"},\"Owner\":{\"shape\":\"Owner\"}},\"type\":\"structure\"}"},
+    {"ListMultipartUploadsOutput", "{\"members\":{\"Bucket\":{\"shape\":\"BucketName\"},\"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\"Delimiter\":{\"shape\":\"Delimiter\"},\"EncodingType\":{\"shape\":\"EncodingType\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"KeyMarker\":{\"shape\":\"KeyMarker\"},\"MaxUploads\":{\"shape\":\"MaxUploads\"},\"NextKeyMarker\":{\"shape\":\"NextKeyMarker\"},\"NextUploadIdMarker\":{\"shape\":\"NextUploadIdMarker\"},\"Prefix\":{\"shape\":\"Prefix\"},\"UploadIdMarker\":{\"shape\":\"UploadIdMarker\"},\"Uploads\":{\"locationName\":\"Upload\",\"shape\":\"MultipartUploadList\"}},\"type\":\"structure\"}"},
+    {"ListMultipartUploadsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Delimiter\":{\"location\":\"querystring\",\"locationName\":\"delimiter\",\"shape\":\"Delimiter\"},\"EncodingType\":{\"location\":\"querystring\",\"locationName\":\"encoding-type\",\"shape\":\"EncodingType\"},\"KeyMarker\":{\"location\":\"querystring\",\"locationName\":\"key-marker\",\"shape\":\"KeyMarker\"},\"MaxUploads\":{\"location\":\"querystring\",\"locationName\":\"max-uploads\",\"shape\":\"MaxUploads\"},\"Prefix\":{\"location\":\"querystring\",\"locationName\":\"prefix\",\"shape\":\"Prefix\"},\"UploadIdMarker\":{\"location\":\"querystring\",\"locationName\":\"upload-id-marker\",\"shape\":\"UploadIdMarker\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListObjectVersionsOutput", "{\"members\":{\"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\"DeleteMarkers\":{\"locationName\":\"DeleteMarker\",\"shape\":\"DeleteMarkers\"},\"Delimiter\":{\"shape\":\"Delimiter\"},\"EncodingType\":{\"shape\":\"EncodingType\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"KeyMarker\":{\"shape\":\"KeyMarker\"},\"MaxKeys\":{\"shape\":\"MaxKeys\"},\"Name\":{\"shape\":\"BucketName\"},\"NextKeyMarker\":{\"shape\":\"NextKeyMarker\"},\"NextVersionIdMarker\":{\"shape\":\"NextVersionIdMarker\"},\"Prefix\":{\"shape\":\"Prefix\"},\"VersionIdMarker\":{\"shape\":\"VersionIdMarker\"},\"Versions\":{\"locationName\":\"Version\",\"shape\":\"ObjectVersionList\"}},\"type\":\"structure\"}"},
+    {"ListObjectVersionsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Delimiter\":{\"location\":\"querystring\",\"locationName\":\"delimiter\",\"shape\":\"Delimiter\"},\"EncodingType\":{\"location\":\"querystring\",\"locationName\":\"encoding-type\",\"shape\":\"EncodingType\"},\"KeyMarker\":{\"location\":\"querystring\",\"locationName\":\"key-marker\",\"shape\":\"KeyMarker\"},\"MaxKeys\":{\"location\":\"querystring\",\"locationName\":\"max-keys\",\"shape\":\"MaxKeys\"},\"Prefix\":{\"location\":\"querystring\",\"locationName\":\"prefix\",\"shape\":\"Prefix\"},\"VersionIdMarker\":{\"location\":\"querystring\",\"locationName\":\"version-id-marker\",\"shape\":\"VersionIdMarker\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListObjectsOutput", "{\"members\":{\"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\"Contents\":{\"shape\":\"ObjectList\"},\"Delimiter\":{\"shape\":\"Delimiter\"},\"EncodingType\":{\"shape\":\"EncodingType\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"Marker\":{\"shape\":\"Marker\"},\"MaxKeys\":{\"shape\":\"MaxKeys\"},\"Name\":{\"shape\":\"BucketName\"},\"NextMarker\":{\"shape\":\"NextMarker\"},\"Prefix\":{\"shape\":\"Prefix\"}},\"type\":\"structure\"}"},
+    {"ListObjectsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Delimiter\":{\"location\":\"querystring\",\"locationName\":\"delimiter\",\"shape\":\"Delimiter\"},\"EncodingType\":{\"location\":\"querystring\",\"locationName\":\"encoding-type\",\"shape\":\"EncodingType\"},\"Marker\":{\"location\":\"querystring\",\"locationName\":\"marker\",\"shape\":\"Marker\"},\"MaxKeys\":{\"location\":\"querystring\",\"locationName\":\"max-keys\",\"shape\":\"MaxKeys\"},\"Prefix\":{\"location\":\"querystring\",\"locationName\":\"prefix\",\"shape\":\"Prefix\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListObjectsV2Output", "{\"members\":{\"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\"Contents\":{\"shape\":\"ObjectList\"},\"ContinuationToken\":{\"shape\":\"Token\"},\"Delimiter\":{\"shape\":\"Delimiter\"},\"EncodingType\":{\"shape\":\"EncodingType\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"KeyCount\":{\"shape\":\"KeyCount\"},\"MaxKeys\":{\"shape\":\"MaxKeys\"},\"Name\":{\"shape\":\"BucketName\"},\"NextContinuationToken\":{\"shape\":\"NextToken\"},\"Prefix\":{\"shape\":\"Prefix\"},\"StartAfter\":{\"shape\":\"StartAfter\"}},\"type\":\"structure\"}"},
+    {"ListObjectsV2Request", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContinuationToken\":{\"location\":\"querystring\",\"locationName\":\"continuation-token\",\"shape\":\"Token\"},\"Delimiter\":{\"location\":\"querystring\",\"locationName\":\"delimiter\",\"shape\":\"Delimiter\"},\"EncodingType\":{\"location\":\"querystring\",\"locationName\":\"encoding-type\",\"shape\":\"EncodingType\"},\"FetchOwner\":{\"location\":\"querystring\",\"locationName\":\"fetch-owner\",\"shape\":\"FetchOwner\"},\"MaxKeys\":{\"location\":\"querystring\",\"locationName\":\"max-keys\",\"shape\":\"MaxKeys\"},\"Prefix\":{\"location\":\"querystring\",\"locationName\":\"prefix\",\"shape\":\"Prefix\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"StartAfter\":{\"location\":\"querystring\",\"locationName\":\"start-after\",\"shape\":\"StartAfter\"}},\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"ListPartsOutput", "{\"members\":{\"AbortDate\":{\"location\":\"header\",\"locationName\":\"x-amz-abort-date\",\"shape\":\"AbortDate\"},\"AbortRuleId\":{\"location\":\"header\",\"locationName\":\"x-amz-abort-rule-id\",\"shape\":\"AbortRuleId\"},\"Bucket\":{\"shape\":\"BucketName\"},\"Initiator\":{\"shape\":\"Initiator\"},\"IsTruncated\":{\"shape\":\"IsTruncated\"},\"Key\":{\"shape\":\"ObjectKey\"},\"MaxParts\":{\"shape\":\"MaxParts\"},\"NextPartNumberMarker\":{\"shape\":\"NextPartNumberMarker\"},\"Owner\":{\"shape\":\"Owner\"},\"PartNumberMarker\":{\"shape\":\"PartNumberMarker\"},\"Parts\":{\"locationName\":\"Part\",\"shape\":\"Parts\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"StorageClass\":{\"shape\":\"StorageClass\"},\"UploadId\":{\"shape\":\"MultipartUploadId\"}},\"type\":\"structure\"}"},
+    {"ListPartsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"MaxParts\":{\"location\":\"querystring\",\"locationName\":\"max-parts\",\"shape\":\"MaxParts\"},\"PartNumberMarker\":{\"location\":\"querystring\",\"locationName\":\"part-number-marker\",\"shape\":\"PartNumberMarker\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"UploadId\":{\"location\":\"querystring\",\"locationName\":\"uploadId\",\"shape\":\"MultipartUploadId\"}},\"required\":[\"Bucket\",\"Key\",\"UploadId\"],\"type\":\"structure\"}"},
+    {"Location", "{\"type\":\"string\"}"},
+    {"LocationPrefix", "{\"type\":\"string\"}"},
+    {"LoggingEnabled", "{\"members\":{\"TargetBucket\":{\"shape\":\"TargetBucket\"},\"TargetGrants\":{\"shape\":\"TargetGrants\"},\"TargetPrefix\":{\"shape\":\"TargetPrefix\"}},\"required\":[\"TargetBucket\",\"TargetPrefix\"],\"type\":\"structure\"}"},
+    {"MFA", "{\"type\":\"string\"}"},
+    {"MFADelete", "{\"enum\":[\"Enabled\",\"Disabled\"],\"type\":\"string\"}"},
+    {"MFADeleteStatus", "{\"enum\":[\"Enabled\",\"Disabled\"],\"type\":\"string\"}"},
+    {"Marker", "{\"type\":\"string\"}"},
+    {"MaxAgeSeconds", "{\"type\":\"integer\"}"},
+    {"MaxKeys", "{\"type\":\"integer\"}"},
+    {"MaxParts", "{\"type\":\"integer\"}"},
+    {"MaxUploads", "{\"type\":\"integer\"}"},
+    {"Message", "{\"type\":\"string\"}"},
+    {"Metadata", "{\"key\":{\"shape\":\"MetadataKey\"},\"type\":\"map\",\"value\":{\"shape\":\"MetadataValue\"}}"},
+    {"MetadataDirective", "{\"enum\":[\"COPY\",\"REPLACE\"],\"type\":\"string\"}"},
+    {"MetadataEntry", "{\"members\":{\"Name\":{\"shape\":\"MetadataKey\"},\"Value\":{\"shape\":\"MetadataValue\"}},\"type\":\"structure\"}"},
+    {"MetadataKey", "{\"type\":\"string\"}"},
+    {"MetadataValue", "{\"type\":\"string\"}"},
+    {"MetricsAndOperator", "{\"members\":{\"Prefix\":{\"shape\":\"Prefix\"},\"Tags\":{\"flattened\":true,\"locationName\":\"Tag\",\"shape\":\"TagSet\"}},\"type\":\"structure\"}"},
+    {"MetricsConfiguration", "{\"members\":{\"Filter\":{\"shape\":\"MetricsFilter\"},\"Id\":{\"shape\":\"MetricsId\"}},\"required\":[\"Id\"],\"type\":\"structure\"}"},
+    {"MetricsConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"MetricsConfiguration\"},\"type\":\"list\"}"},
+    {"MetricsFilter", "{\"members\":{\"And\":{\"shape\":\"MetricsAndOperator\"},\"Prefix\":{\"shape\":\"Prefix\"},\"Tag\":{\"shape\":\"Tag\"}},\"type\":\"structure\"}"},
+    {"MetricsId", "{\"type\":\"string\"}"},
+    {"MissingMeta", "{\"type\":\"integer\"}"},
+    {"MultipartUpload", "{\"members\":{\"Initiated\":{\"shape\":\"Initiated\"},\"Initiator\":{\"shape\":\"Initiator\"},\"Key\":{\"shape\":\"ObjectKey\"},\"Owner\":{\"shape\":\"Owner\"},\"StorageClass\":{\"shape\":\"StorageClass\"},\"UploadId\":{\"shape\":\"MultipartUploadId\"}},\"type\":\"structure\"}"},
+    {"MultipartUploadId", "{\"type\":\"string\"}"},
+    {"MultipartUploadList", "{\"flattened\":true,\"member\":{\"shape\":\"MultipartUpload\"},\"type\":\"list\"}"},
+    {"NextKeyMarker", "{\"type\":\"string\"}"},
+    {"NextMarker", "{\"type\":\"string\"}"},
+    {"NextPartNumberMarker", "{\"type\":\"integer\"}"},
+    {"NextToken", "{\"type\":\"string\"}"},
+    {"NextUploadIdMarker", "{\"type\":\"string\"}"},
+    {"NextVersionIdMarker", "{\"type\":\"string\"}"},
+    {"NoSuchBucket", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"NoSuchKey", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"NoSuchUpload", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"NoncurrentVersionExpiration", "{\"members\":{\"NoncurrentDays\":{\"shape\":\"Days\"}},\"type\":\"structure\"}"},
+    {"NoncurrentVersionTransition", "{\"members\":{\"NoncurrentDays\":{\"shape\":\"Days\"},\"StorageClass\":{\"shape\":\"TransitionStorageClass\"}},\"type\":\"structure\"}"},
+    {"NoncurrentVersionTransitionList", "{\"flattened\":true,\"member\":{\"shape\":\"NoncurrentVersionTransition\"},\"type\":\"list\"}"},
+    {"NotificationConfiguration", "{\"members\":{\"LambdaFunctionConfigurations\":{\"locationName\":\"CloudFunctionConfiguration\",\"shape\":\"LambdaFunctionConfigurationList\"},\"QueueConfigurations\":{\"locationName\":\"QueueConfiguration\",\"shape\":\"QueueConfigurationList\"},\"TopicConfigurations\":{\"locationName\":\"TopicConfiguration\",\"shape\":\"TopicConfigurationList\"}},\"type\":\"structure\"}"},
+    {"NotificationConfigurationDeprecated", "{\"members\":{\"CloudFunctionConfiguration\":{\"shape\":\"CloudFunctionConfiguration\"},\"QueueConfiguration\":{\"shape\":\"QueueConfigurationDeprecated\"},\"TopicConfiguration\":{\"shape\":\"TopicConfigurationDeprecated\"}},\"type\":\"structure\"}"},
+    {"NotificationConfigurationFilter", "{\"members\":{\"Key\":{\"locationName\":\"S3Key\",\"shape\":\"S3KeyFilter\"}},\"type\":\"structure\"}"},
+    {"NotificationId", "{\"type\":\"string\"}"},
+    {"Object", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"Key\":{\"shape\":\"ObjectKey\"},\"LastModified\":{\"shape\":\"LastModified\"},\"Owner\":{\"shape\":\"Owner\"},\"Size\":{\"shape\":\"Size\"},\"StorageClass\":{\"shape\":\"ObjectStorageClass\"}},\"type\":\"structure\"}"},
+    {"ObjectAlreadyInActiveTierError", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"ObjectCannedACL", "{\"enum\":[\"private\",\"public-read\",\"public-read-write\",\"authenticated-read\",\"aws-exec-read\",\"bucket-owner-read\",\"bucket-owner-full-control\"],\"type\":\"string\"}"},
+    {"ObjectIdentifier", "{\"members\":{\"Key\":{\"shape\":\"ObjectKey\"},\"VersionId\":{\"shape\":\"ObjectVersionId\"}},\"required\":[\"Key\"],\"type\":\"structure\"}"},
+    {"ObjectIdentifierList", "{\"flattened\":true,\"member\":{\"shape\":\"ObjectIdentifier\"},\"type\":\"list\"}"},
+    {"ObjectKey", "{\"min\":1,\"type\":\"string\"}"},
+    {"ObjectList", "{\"flattened\":true,\"member\":{\"shape\":\"Object\"},\"type\":\"list\"}"},
+    {"ObjectNotInActiveTierError", "{\"exception\":true,\"members\":{},\"type\":\"structure\"}"},
+    {"ObjectStorageClass", "{\"enum\":[\"STANDARD\",\"REDUCED_REDUNDANCY\",\"GLACIER\",\"STANDARD_IA\",\"ONEZONE_IA\"],\"type\":\"string\"}"},
+    {"ObjectVersion", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"IsLatest\":{\"shape\":\"IsLatest\"},\"Key\":{\"shape\":\"ObjectKey\"},\"LastModified\":{\"shape\":\"LastModified\"},\"Owner\":{\"shape\":\"Owner\"},\"Size\":{\"shape\":\"Size\"},\"StorageClass\":{\"shape\":\"ObjectVersionStorageClass\"},\"VersionId\":{\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"ObjectVersionId", "{\"type\":\"string\"}"},
+    {"ObjectVersionList", "{\"flattened\":true,\"member\":{\"shape\":\"ObjectVersion\"},\"type\":\"list\"}"},
+    {"ObjectVersionStorageClass", "{\"enum\":[\"STANDARD\"],\"type\":\"string\"}"},
+    {"OutputLocation", "{\"members\":{\"S3\":{\"shape\":\"S3Location\"}},\"type\":\"structure\"}"},
+    {"OutputSerialization", "{\"members\":{\"CSV\":{\"shape\":\"CSVOutput\"},\"JSON\":{\"shape\":\"JSONOutput\"}},\"type\":\"structure\"}"},
+    {"Owner", "{\"members\":{\"DisplayName\":{\"shape\":\"DisplayName\"},\"ID\":{\"shape\":\"ID\"}},\"type\":\"structure\"}"},
+    {"OwnerOverride", "{\"enum\":[\"Destination\"],\"type\":\"string\"}"},
+    {"Part", "{\"members\":{\"ETag\":{\"shape\":\"ETag\"},\"LastModified\":{\"shape\":\"LastModified\"},\"PartNumber\":{\"shape\":\"PartNumber\"},\"Size\":{\"shape\":\"Size\"}},\"type\":\"structure\"}"},
+    {"PartNumber", "{\"type\":\"integer\"}"},
+    {"PartNumberMarker", "{\"type\":\"integer\"}"},
+    {"Parts", "{\"flattened\":true,\"member\":{\"shape\":\"Part\"},\"type\":\"list\"}"},
+    {"PartsCount", "{\"type\":\"integer\"}"},
+    {"Payer", "{\"enum\":[\"Requester\",\"BucketOwner\"],\"type\":\"string\"}"},
+    {"Permission", "{\"enum\":[\"FULL_CONTROL\",\"WRITE\",\"WRITE_ACP\",\"READ\",\"READ_ACP\"],\"type\":\"string\"}"},
+    {"Policy", "{\"type\":\"string\"}"},
+    {"Prefix", "{\"type\":\"string\"}"},
+    {"Progress", "{\"members\":{\"BytesProcessed\":{\"shape\":\"BytesProcessed\"},\"BytesScanned\":{\"shape\":\"BytesScanned\"}},\"type\":\"structure\"}"},
+    {"ProgressEvent", "{\"event\":true,\"members\":{\"Details\":{\"eventpayload\":true,\"shape\":\"Progress\"}},\"type\":\"structure\"}"},
+    {"Protocol", "{\"enum\":[\"http\",\"https\"],\"type\":\"string\"}"},
+    {"PutBucketAccelerateConfigurationRequest", "{\"members\":{\"AccelerateConfiguration\":{\"locationName\":\"AccelerateConfiguration\",\"shape\":\"AccelerateConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"}},\"payload\":\"AccelerateConfiguration\",\"required\":[\"Bucket\",\"AccelerateConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketAclRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"BucketCannedACL\"},\"AccessControlPolicy\":{\"locationName\":\"AccessControlPolicy\",\"shape\":\"AccessControlPolicy\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWrite\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write\",\"shape\":\"GrantWrite\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"}},\"payload\":\"AccessControlPolicy\",\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"PutBucketAnalyticsConfigurationRequest", "{\"members\":{\"AnalyticsConfiguration\":{\"locationName\":\"AnalyticsConfiguration\",\"shape\":\"AnalyticsConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"AnalyticsId\"}},\"payload\":\"AnalyticsConfiguration\",\"required\":[\"Bucket\",\"Id\",\"AnalyticsConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketCorsRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CORSConfiguration\":{\"locationName\":\"CORSConfiguration\",\"shape\":\"CORSConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"}},\"payload\":\"CORSConfiguration\",\"required\":[\"Bucket\",\"CORSConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketEncryptionRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"ServerSideEncryptionConfiguration\":{\"locationName\":\"ServerSideEncryptionConfiguration\",\"shape\":\"ServerSideEncryptionConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"ServerSideEncryptionConfiguration\",\"required\":[\"Bucket\",\"ServerSideEncryptionConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketInventoryConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"InventoryId\"},\"InventoryConfiguration\":{\"locationName\":\"InventoryConfiguration\",\"shape\":\"InventoryConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"InventoryConfiguration\",\"required\":[\"Bucket\",\"Id\",\"InventoryConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketLifecycleConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"LifecycleConfiguration\":{\"locationName\":\"LifecycleConfiguration\",\"shape\":\"BucketLifecycleConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"LifecycleConfiguration\",\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"PutBucketLifecycleRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"LifecycleConfiguration\":{\"locationName\":\"LifecycleConfiguration\",\"shape\":\"LifecycleConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"LifecycleConfiguration\",\"required\":[\"Bucket\"],\"type\":\"structure\"}"},
+    {"PutBucketLoggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"BucketLoggingStatus\":{\"locationName\":\"BucketLoggingStatus\",\"shape\":\"BucketLoggingStatus\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"}},\"payload\":\"BucketLoggingStatus\",\"required\":[\"Bucket\",\"BucketLoggingStatus\"],\"type\":\"structure\"}"},
+    {"PutBucketMetricsConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Id\":{\"location\":\"querystring\",\"locationName\":\"id\",\"shape\":\"MetricsId\"},\"MetricsConfiguration\":{\"locationName\":\"MetricsConfiguration\",\"shape\":\"MetricsConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"MetricsConfiguration\",\"required\":[\"Bucket\",\"Id\",\"MetricsConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketNotificationConfigurationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"NotificationConfiguration\":{\"locationName\":\"NotificationConfiguration\",\"shape\":\"NotificationConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"NotificationConfiguration\",\"required\":[\"Bucket\",\"NotificationConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketNotificationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"NotificationConfiguration\":{\"locationName\":\"NotificationConfiguration\",\"shape\":\"NotificationConfigurationDeprecated\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"NotificationConfiguration\",\"required\":[\"Bucket\",\"NotificationConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketPolicyRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ConfirmRemoveSelfBucketAccess\":{\"location\":\"header\",\"locationName\":\"x-amz-confirm-remove-self-bucket-access\",\"shape\":\"ConfirmRemoveSelfBucketAccess\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"Policy\":{\"shape\":\"Policy\"}},\"payload\":\"Policy\",\"required\":[\"Bucket\",\"Policy\"],\"type\":\"structure\"}"},
+    {"PutBucketReplicationRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"ReplicationConfiguration\":{\"locationName\":\"ReplicationConfiguration\",\"shape\":\"ReplicationConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"ReplicationConfiguration\",\"required\":[\"Bucket\",\"ReplicationConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketRequestPaymentRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"RequestPaymentConfiguration\":{\"locationName\":\"RequestPaymentConfiguration\",\"shape\":\"RequestPaymentConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"RequestPaymentConfiguration\",\"required\":[\"Bucket\",\"RequestPaymentConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"Tagging\":{\"locationName\":\"Tagging\",\"shape\":\"Tagging\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"Tagging\",\"required\":[\"Bucket\",\"Tagging\"],\"type\":\"structure\"}"},
+    {"PutBucketVersioningRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"MFA\":{\"location\":\"header\",\"locationName\":\"x-amz-mfa\",\"shape\":\"MFA\"},\"VersioningConfiguration\":{\"locationName\":\"VersioningConfiguration\",\"shape\":\"VersioningConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"VersioningConfiguration\",\"required\":[\"Bucket\",\"VersioningConfiguration\"],\"type\":\"structure\"}"},
+    {"PutBucketWebsiteRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"WebsiteConfiguration\":{\"locationName\":\"WebsiteConfiguration\",\"shape\":\"WebsiteConfiguration\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}}},\"payload\":\"WebsiteConfiguration\",\"required\":[\"Bucket\",\"WebsiteConfiguration\"],\"type\":\"structure\"}"},
+    {"PutObjectAclOutput", "{\"members\":{\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"}},\"type\":\"structure\"}"},
+    {"PutObjectAclRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"ObjectCannedACL\"},\"AccessControlPolicy\":{\"locationName\":\"AccessControlPolicy\",\"shape\":\"AccessControlPolicy\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWrite\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write\",\"shape\":\"GrantWrite\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"payload\":\"AccessControlPolicy\",\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"PutObjectOutput", "{\"members\":{\"ETag\":{\"location\":\"header\",\"locationName\":\"ETag\",\"shape\":\"ETag\"},\"Expiration\":{\"location\":\"header\",\"locationName\":\"x-amz-expiration\",\"shape\":\"Expiration\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"PutObjectRequest", "{\"members\":{\"ACL\":{\"location\":\"header\",\"locationName\":\"x-amz-acl\",\"shape\":\"ObjectCannedACL\"},\"Body\":{\"shape\":\"Body\",\"streaming\":true},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CacheControl\":{\"location\":\"header\",\"locationName\":\"Cache-Control\",\"shape\":\"CacheControl\"},\"ContentDisposition\":{\"location\":\"header\",\"locationName\":\"Content-Disposition\",\"shape\":\"ContentDisposition\"},\"ContentEncoding\":{\"location\":\"header\",\"locationName\":\"Content-Encoding\",\"shape\":\"ContentEncoding\"},\"ContentLanguage\":{\"location\":\"header\",\"locationName\":\"Content-Language\",\"shape\":\"ContentLanguage\"},\"ContentLength\":{\"location\":\"header\",\"locationName\":\"Content-Length\",\"shape\":\"ContentLength\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"ContentType\":{\"location\":\"header\",\"locationName\":\"Content-Type\",\"shape\":\"ContentType\"},\"Expires\":{\"location\":\"header\",\"locationName\":\"Expires\",\"shape\":\"Expires\"},\"GrantFullControl\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-full-control\",\"shape\":\"GrantFullControl\"},\"GrantRead\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read\",\"shape\":\"GrantRead\"},\"GrantReadACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-read-acp\",\"shape\":\"GrantReadACP\"},\"GrantWriteACP\":{\"location\":\"header\",\"locationName\":\"x-amz-grant-write-acp\",\"shape\":\"GrantWriteACP\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"Metadata\":{\"location\":\"headers\",\"locationName\":\"x-amz-meta-\",\"shape\":\"Metadata\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"},\"StorageClass\":{\"location\":\"header\",\"locationName\":\"x-amz-storage-class\",\"shape\":\"StorageClass\"},\"Tagging\":{\"location\":\"header\",\"locationName\":\"x-amz-tagging\",\"shape\":\"TaggingHeader\"},\"WebsiteRedirectLocation\":{\"location\":\"header\",\"locationName\":\"x-amz-website-redirect-location\",\"shape\":\"WebsiteRedirectLocation\"}},\"payload\":\"Body\",\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"PutObjectTaggingOutput", "{\"members\":{\"VersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-version-id\",\"shape\":\"ObjectVersionId\"}},\"type\":\"structure\"}"},
+    {"PutObjectTaggingRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"Tagging\":{\"locationName\":\"Tagging\",\"shape\":\"Tagging\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"payload\":\"Tagging\",\"required\":[\"Bucket\",\"Key\",\"Tagging\"],\"type\":\"structure\"}"},
+    {"QueueArn", "{\"type\":\"string\"}"},
+    {"QueueConfiguration", "{\"members\":{\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Filter\":{\"shape\":\"NotificationConfigurationFilter\"},\"Id\":{\"shape\":\"NotificationId\"},\"QueueArn\":{\"locationName\":\"Queue\",\"shape\":\"QueueArn\"}},\"required\":[\"QueueArn\",\"Events\"],\"type\":\"structure\"}"},
+    {"QueueConfigurationDeprecated", "{\"members\":{\"Event\":{\"deprecated\":true,\"shape\":\"Event\"},\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Id\":{\"shape\":\"NotificationId\"},\"Queue\":{\"shape\":\"QueueArn\"}},\"type\":\"structure\"}"},
+    {"QueueConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"QueueConfiguration\"},\"type\":\"list\"}"},
+    {"Quiet", "{\"type\":\"boolean\"}"},
+    {"QuoteCharacter", "{\"type\":\"string\"}"},
+    {"QuoteEscapeCharacter", "{\"type\":\"string\"}"},
+    {"QuoteFields", "{\"enum\":[\"ALWAYS\",\"ASNEEDED\"],\"type\":\"string\"}"},
+    {"Range", "{\"type\":\"string\"}"},
+    {"RecordDelimiter", "{\"type\":\"string\"}"},
+    {"RecordsEvent", "{\"event\":true,\"members\":{\"Payload\":{\"eventpayload\":true,\"shape\":\"Body\"}},\"type\":\"structure\"}"},
+    {"Redirect", "{\"members\":{\"HostName\":{\"shape\":\"HostName\"},\"HttpRedirectCode\":{\"shape\":\"HttpRedirectCode\"},\"Protocol\":{\"shape\":\"Protocol\"},\"ReplaceKeyPrefixWith\":{\"shape\":\"ReplaceKeyPrefixWith\"},\"ReplaceKeyWith\":{\"shape\":\"ReplaceKeyWith\"}},\"type\":\"structure\"}"},
+    {"RedirectAllRequestsTo", "{\"members\":{\"HostName\":{\"shape\":\"HostName\"},\"Protocol\":{\"shape\":\"Protocol\"}},\"required\":[\"HostName\"],\"type\":\"structure\"}"},
+    {"ReplaceKeyPrefixWith", "{\"type\":\"string\"}"},
+    {"ReplaceKeyWith", "{\"type\":\"string\"}"},
+    {"ReplicaKmsKeyID", "{\"type\":\"string\"}"},
+    {"ReplicationConfiguration", "{\"members\":{\"Role\":{\"shape\":\"Role\"},\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"ReplicationRules\"}},\"required\":[\"Role\",\"Rules\"],\"type\":\"structure\"}"},
+    {"ReplicationRule", "{\"members\":{\"Destination\":{\"shape\":\"Destination\"},\"ID\":{\"shape\":\"ID\"},\"Prefix\":{\"shape\":\"Prefix\"},\"SourceSelectionCriteria\":{\"shape\":\"SourceSelectionCriteria\"},\"Status\":{\"shape\":\"ReplicationRuleStatus\"}},\"required\":[\"Prefix\",\"Status\",\"Destination\"],\"type\":\"structure\"}"},
+    {"ReplicationRuleStatus", "{\"enum\":[\"Enabled\",\"Disabled\"],\"type\":\"string\"}"},
+    {"ReplicationRules", "{\"flattened\":true,\"member\":{\"shape\":\"ReplicationRule\"},\"type\":\"list\"}"},
+    {"ReplicationStatus", "{\"enum\":[\"COMPLETE\",\"PENDING\",\"FAILED\",\"REPLICA\"],\"type\":\"string\"}"},
+    {"RequestCharged", "{\"enum\":[\"requester\"],\"type\":\"string\"}"},
+    {"RequestPayer", "{\"enum\":[\"requester\"],\"type\":\"string\"}"},
+    {"RequestPaymentConfiguration", "{\"members\":{\"Payer\":{\"shape\":\"Payer\"}},\"required\":[\"Payer\"],\"type\":\"structure\"}"},
+    {"RequestProgress", "{\"members\":{\"Enabled\":{\"shape\":\"EnableRequestProgress\"}},\"type\":\"structure\"}"},
+    {"ResponseCacheControl", "{\"type\":\"string\"}"},
+    {"ResponseContentDisposition", "{\"type\":\"string\"}"},
+    {"ResponseContentEncoding", "{\"type\":\"string\"}"},
+    {"ResponseContentLanguage", "{\"type\":\"string\"}"},
+    {"ResponseContentType", "{\"type\":\"string\"}"},
+    {"ResponseExpires", "{\"type\":\"timestamp\"}"},
+    {"Restore", "{\"type\":\"string\"}"},
+    {"RestoreObjectOutput", "{\"members\":{\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"RestoreOutputPath\":{\"location\":\"header\",\"locationName\":\"x-amz-restore-output-path\",\"shape\":\"RestoreOutputPath\"}},\"type\":\"structure\"}"},
+    {"RestoreObjectRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"RestoreRequest\":{\"locationName\":\"RestoreRequest\",\"shape\":\"RestoreRequest\",\"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}},\"VersionId\":{\"location\":\"querystring\",\"locationName\":\"versionId\",\"shape\":\"ObjectVersionId\"}},\"payload\":\"RestoreRequest\",\"required\":[\"Bucket\",\"Key\"],\"type\":\"structure\"}"},
+    {"RestoreOutputPath", "{\"type\":\"string\"}"},
+    {"RestoreRequest", "{\"members\":{\"Days\":{\"shape\":\"Days\"},\"Description\":{\"shape\":\"Description\"},\"GlacierJobParameters\":{\"shape\":\"GlacierJobParameters\"},\"OutputLocation\":{\"shape\":\"OutputLocation\"},\"SelectParameters\":{\"shape\":\"SelectParameters\"},\"Tier\":{\"shape\":\"Tier\"},\"Type\":{\"shape\":\"RestoreRequestType\"}},\"type\":\"structure\"}"},
+    {"RestoreRequestType", "{\"enum\":[\"SELECT\"],\"type\":\"string\"}"},
+    {"Role", "{\"type\":\"string\"}"},
+    {"RoutingRule", "{\"members\":{\"Condition\":{\"shape\":\"Condition\"},\"Redirect\":{\"shape\":\"Redirect\"}},\"required\":[\"Redirect\"],\"type\":\"structure\"}"},
+    {"RoutingRules", "{\"member\":{\"locationName\":\"RoutingRule\",\"shape\":\"RoutingRule\"},\"type\":\"list\"}"},
+    {"Rule", "{\"members\":{\"AbortIncompleteMultipartUpload\":{\"shape\":\"AbortIncompleteMultipartUpload\"},\"Expiration\":{\"shape\":\"LifecycleExpiration\"},\"ID\":{\"shape\":\"ID\"},\"NoncurrentVersionExpiration\":{\"shape\":\"NoncurrentVersionExpiration\"},\"NoncurrentVersionTransition\":{\"shape\":\"NoncurrentVersionTransition\"},\"Prefix\":{\"shape\":\"Prefix\"},\"Status\":{\"shape\":\"ExpirationStatus\"},\"Transition\":{\"shape\":\"Transition\"}},\"required\":[\"Prefix\",\"Status\"],\"type\":\"structure\"}"},
+    {"Rules", "{\"flattened\":true,\"member\":{\"shape\":\"Rule\"},\"type\":\"list\"}"},
+    {"S3KeyFilter", "{\"members\":{\"FilterRules\":{\"locationName\":\"FilterRule\",\"shape\":\"FilterRuleList\"}},\"type\":\"structure\"}"},
+    {"S3Location", "{\"members\":{\"AccessControlList\":{\"shape\":\"Grants\"},\"BucketName\":{\"shape\":\"BucketName\"},\"CannedACL\":{\"shape\":\"ObjectCannedACL\"},\"Encryption\":{\"shape\":\"Encryption\"},\"Prefix\":{\"shape\":\"LocationPrefix\"},\"StorageClass\":{\"shape\":\"StorageClass\"},\"Tagging\":{\"shape\":\"Tagging\"},\"UserMetadata\":{\"shape\":\"UserMetadata\"}},\"required\":[\"BucketName\",\"Prefix\"],\"type\":\"structure\"}"},
+    {"SSECustomerAlgorithm", "{\"type\":\"string\"}"},
+    {"SSECustomerKey", "{\"sensitive\":true,\"type\":\"string\"}"},
+    {"SSECustomerKeyMD5", "{\"type\":\"string\"}"},
+    {"SSEKMS", "{\"locationName\":\"SSE-KMS\",\"members\":{\"KeyId\":{\"shape\":\"SSEKMSKeyId\"}},\"required\":[\"KeyId\"],\"type\":\"structure\"}"},
+    {"SSEKMSKeyId", "{\"sensitive\":true,\"type\":\"string\"}"},
+    {"SSES3", "{\"locationName\":\"SSE-S3\",\"members\":{},\"type\":\"structure\"}"},
+    {"SelectObjectContentEventStream", "{\"eventstream\":true,\"members\":{\"Cont\":{\"shape\":\"ContinuationEvent\"},\"End\":{\"shape\":\"EndEvent\"},\"Progress\":{\"shape\":\"ProgressEvent\"},\"Records\":{\"shape\":\"RecordsEvent\"},\"Stats\":{\"shape\":\"StatsEvent\"}},\"type\":\"structure\"}"},
+    {"SelectObjectContentOutput", "{\"members\":{\"Payload\":{\"shape\":\"SelectObjectContentEventStream\"}},\"payload\":\"Payload\",\"type\":\"structure\"}"},
+    {"SelectObjectContentRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"Expression\":{\"shape\":\"Expression\"},\"ExpressionType\":{\"shape\":\"ExpressionType\"},\"InputSerialization\":{\"shape\":\"InputSerialization\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"OutputSerialization\":{\"shape\":\"OutputSerialization\"},\"RequestProgress\":{\"shape\":\"RequestProgress\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"}},\"required\":[\"Bucket\",\"Key\",\"Expression\",\"ExpressionType\",\"InputSerialization\",\"OutputSerialization\"],\"type\":\"structure\"}"},
+    {"SelectParameters", "{\"members\":{\"Expression\":{\"shape\":\"Expression\"},\"ExpressionType\":{\"shape\":\"ExpressionType\"},\"InputSerialization\":{\"shape\":\"InputSerialization\"},\"OutputSerialization\":{\"shape\":\"OutputSerialization\"}},\"required\":[\"InputSerialization\",\"ExpressionType\",\"Expression\",\"OutputSerialization\"],\"type\":\"structure\"}"},
+    {"ServerSideEncryption", "{\"enum\":[\"AES256\",\"aws:kms\"],\"type\":\"string\"}"},
+    {"ServerSideEncryptionByDefault", "{\"members\":{\"KMSMasterKeyID\":{\"shape\":\"SSEKMSKeyId\"},\"SSEAlgorithm\":{\"shape\":\"ServerSideEncryption\"}},\"required\":[\"SSEAlgorithm\"],\"type\":\"structure\"}"},
+    {"ServerSideEncryptionConfiguration", "{\"members\":{\"Rules\":{\"locationName\":\"Rule\",\"shape\":\"ServerSideEncryptionRules\"}},\"required\":[\"Rules\"],\"type\":\"structure\"}"},
+    {"ServerSideEncryptionRule", "{\"members\":{\"ApplyServerSideEncryptionByDefault\":{\"shape\":\"ServerSideEncryptionByDefault\"}},\"type\":\"structure\"}"},
+    {"ServerSideEncryptionRules", "{\"flattened\":true,\"member\":{\"shape\":\"ServerSideEncryptionRule\"},\"type\":\"list\"}"},
+    {"Size", "{\"type\":\"integer\"}"},
+    {"SourceSelectionCriteria", "{\"members\":{\"SseKmsEncryptedObjects\":{\"shape\":\"SseKmsEncryptedObjects\"}},\"type\":\"structure\"}"},
+    {"SseKmsEncryptedObjects", "{\"members\":{\"Status\":{\"shape\":\"SseKmsEncryptedObjectsStatus\"}},\"required\":[\"Status\"],\"type\":\"structure\"}"},
+    {"SseKmsEncryptedObjectsStatus", "{\"enum\":[\"Enabled\",\"Disabled\"],\"type\":\"string\"}"},
+    {"StartAfter", "{\"type\":\"string\"}"},
+    {"Stats", "{\"members\":{\"BytesProcessed\":{\"shape\":\"BytesProcessed\"},\"BytesScanned\":{\"shape\":\"BytesScanned\"}},\"type\":\"structure\"}"},
+    {"StatsEvent", "{\"event\":true,\"members\":{\"Details\":{\"eventpayload\":true,\"shape\":\"Stats\"}},\"type\":\"structure\"}"},
+    {"StorageClass", "{\"enum\":[\"STANDARD\",\"REDUCED_REDUNDANCY\",\"STANDARD_IA\",\"ONEZONE_IA\"],\"type\":\"string\"}"},
+    {"StorageClassAnalysis", "{\"members\":{\"DataExport\":{\"shape\":\"StorageClassAnalysisDataExport\"}},\"type\":\"structure\"}"},
+    {"StorageClassAnalysisDataExport", "{\"members\":{\"Destination\":{\"shape\":\"AnalyticsExportDestination\"},\"OutputSchemaVersion\":{\"shape\":\"StorageClassAnalysisSchemaVersion\"}},\"required\":[\"OutputSchemaVersion\",\"Destination\"],\"type\":\"structure\"}"},
+    {"StorageClassAnalysisSchemaVersion", "{\"enum\":[\"V_1\"],\"type\":\"string\"}"},
+    {"Suffix", "{\"type\":\"string\"}"},
+    {"Tag", "{\"members\":{\"Key\":{\"shape\":\"ObjectKey\"},\"Value\":{\"shape\":\"Value\"}},\"required\":[\"Key\",\"Value\"],\"type\":\"structure\"}"},
+    {"TagCount", "{\"type\":\"integer\"}"},
+    {"TagSet", "{\"member\":{\"locationName\":\"Tag\",\"shape\":\"Tag\"},\"type\":\"list\"}"},
+    {"Tagging", "{\"members\":{\"TagSet\":{\"shape\":\"TagSet\"}},\"required\":[\"TagSet\"],\"type\":\"structure\"}"},
+    {"TaggingDirective", "{\"enum\":[\"COPY\",\"REPLACE\"],\"type\":\"string\"}"},
+    {"TaggingHeader", "{\"type\":\"string\"}"},
+    {"TargetBucket", "{\"type\":\"string\"}"},
+    {"TargetGrant", "{\"members\":{\"Grantee\":{\"shape\":\"Grantee\"},\"Permission\":{\"shape\":\"BucketLogsPermission\"}},\"type\":\"structure\"}"},
+    {"TargetGrants", "{\"member\":{\"locationName\":\"Grant\",\"shape\":\"TargetGrant\"},\"type\":\"list\"}"},
+    {"TargetPrefix", "{\"type\":\"string\"}"},
+    {"Tier", "{\"enum\":[\"Standard\",\"Bulk\",\"Expedited\"],\"type\":\"string\"}"},
+    {"Token", "{\"type\":\"string\"}"},
+    {"TopicArn", "{\"type\":\"string\"}"},
+    {"TopicConfiguration", "{\"members\":{\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Filter\":{\"shape\":\"NotificationConfigurationFilter\"},\"Id\":{\"shape\":\"NotificationId\"},\"TopicArn\":{\"locationName\":\"Topic\",\"shape\":\"TopicArn\"}},\"required\":[\"TopicArn\",\"Events\"],\"type\":\"structure\"}"},
+    {"TopicConfigurationDeprecated", "{\"members\":{\"Event\":{\"deprecated\":true,\"shape\":\"Event\"},\"Events\":{\"locationName\":\"Event\",\"shape\":\"EventList\"},\"Id\":{\"shape\":\"NotificationId\"},\"Topic\":{\"shape\":\"TopicArn\"}},\"type\":\"structure\"}"},
+    {"TopicConfigurationList", "{\"flattened\":true,\"member\":{\"shape\":\"TopicConfiguration\"},\"type\":\"list\"}"},
+    {"Transition", "{\"members\":{\"Date\":{\"shape\":\"Date\"},\"Days\":{\"shape\":\"Days\"},\"StorageClass\":{\"shape\":\"TransitionStorageClass\"}},\"type\":\"structure\"}"},
+    {"TransitionList", "{\"flattened\":true,\"member\":{\"shape\":\"Transition\"},\"type\":\"list\"}"},
+    {"TransitionStorageClass", "{\"enum\":[\"GLACIER\",\"STANDARD_IA\",\"ONEZONE_IA\"],\"type\":\"string\"}"},
+    {"Type", "{\"enum\":[\"CanonicalUser\",\"AmazonCustomerByEmail\",\"Group\"],\"type\":\"string\"}"},
+    {"URI", "{\"type\":\"string\"}"},
+    {"UploadIdMarker", "{\"type\":\"string\"}"},
+    {"UploadPartCopyOutput", "{\"members\":{\"CopyPartResult\":{\"shape\":\"CopyPartResult\"},\"CopySourceVersionId\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-version-id\",\"shape\":\"CopySourceVersionId\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"}},\"payload\":\"CopyPartResult\",\"type\":\"structure\"}"},
+    {"UploadPartCopyRequest", "{\"members\":{\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"CopySource\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source\",\"shape\":\"CopySource\"},\"CopySourceIfMatch\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-match\",\"shape\":\"CopySourceIfMatch\"},\"CopySourceIfModifiedSince\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-modified-since\",\"shape\":\"CopySourceIfModifiedSince\"},\"CopySourceIfNoneMatch\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-none-match\",\"shape\":\"CopySourceIfNoneMatch\"},\"CopySourceIfUnmodifiedSince\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-if-unmodified-since\",\"shape\":\"CopySourceIfUnmodifiedSince\"},\"CopySourceRange\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-range\",\"shape\":\"CopySourceRange\"},\"CopySourceSSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-algorithm\",\"shape\":\"CopySourceSSECustomerAlgorithm\"},\"CopySourceSSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key\",\"shape\":\"CopySourceSSECustomerKey\"},\"CopySourceSSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key-MD5\",\"shape\":\"CopySourceSSECustomerKeyMD5\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"PartNumber\":{\"location\":\"querystring\",\"locationName\":\"partNumber\",\"shape\":\"PartNumber\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"UploadId\":{\"location\":\"querystring\",\"locationName\":\"uploadId\",\"shape\":\"MultipartUploadId\"}},\"required\":[\"Bucket\",\"CopySource\",\"Key\",\"PartNumber\",\"UploadId\"],\"type\":\"structure\"}"},
+    {"UploadPartOutput", "{\"members\":{\"ETag\":{\"location\":\"header\",\"locationName\":\"ETag\",\"shape\":\"ETag\"},\"RequestCharged\":{\"location\":\"header\",\"locationName\":\"x-amz-request-charged\",\"shape\":\"RequestCharged\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"SSEKMSKeyId\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\",\"shape\":\"SSEKMSKeyId\"},\"ServerSideEncryption\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption\",\"shape\":\"ServerSideEncryption\"}},\"type\":\"structure\"}"},
+    {"UploadPartRequest", "{\"members\":{\"Body\":{\"shape\":\"Body\",\"streaming\":true},\"Bucket\":{\"location\":\"uri\",\"locationName\":\"Bucket\",\"shape\":\"BucketName\"},\"ContentLength\":{\"location\":\"header\",\"locationName\":\"Content-Length\",\"shape\":\"ContentLength\"},\"ContentMD5\":{\"location\":\"header\",\"locationName\":\"Content-MD5\",\"shape\":\"ContentMD5\"},\"Key\":{\"location\":\"uri\",\"locationName\":\"Key\",\"shape\":\"ObjectKey\"},\"PartNumber\":{\"location\":\"querystring\",\"locationName\":\"partNumber\",\"shape\":\"PartNumber\"},\"RequestPayer\":{\"location\":\"header\",\"locationName\":\"x-amz-request-payer\",\"shape\":\"RequestPayer\"},\"SSECustomerAlgorithm\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-algorithm\",\"shape\":\"SSECustomerAlgorithm\"},\"SSECustomerKey\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key\",\"shape\":\"SSECustomerKey\"},\"SSECustomerKeyMD5\":{\"location\":\"header\",\"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\",\"shape\":\"SSECustomerKeyMD5\"},\"UploadId\":{\"location\":\"querystring\",\"locationName\":\"uploadId\",\"shape\":\"MultipartUploadId\"}},\"payload\":\"Body\",\"required\":[\"Bucket\",\"Key\",\"PartNumber\",\"UploadId\"],\"type\":\"structure\"}"},
+    {"UserMetadata", "{\"member\":{\"locationName\":\"MetadataEntry\",\"shape\":\"MetadataEntry\"},\"type\":\"list\"}"},
+    {"Value", "{\"type\":\"string\"}"},
+    {"VersionIdMarker", "{\"type\":\"string\"}"},
+    {"VersioningConfiguration", "{\"members\":{\"MFADelete\":{\"locationName\":\"MfaDelete\",\"shape\":\"MFADelete\"},\"Status\":{\"shape\":\"BucketVersioningStatus\"}},\"type\":\"structure\"}"},
+    {"WebsiteConfiguration", "{\"members\":{\"ErrorDocument\":{\"shape\":\"ErrorDocument\"},\"IndexDocument\":{\"shape\":\"IndexDocument\"},\"RedirectAllRequestsTo\":{\"shape\":\"RedirectAllRequestsTo\"},\"RoutingRules\":{\"shape\":\"RoutingRules\"}},\"type\":\"structure\"}"},
+    {"WebsiteRedirectLocation", "{\"type\":\"string\"}"},
+};
 
 @interface AWSS3Resources ()
 
@@ -43,7102 +594,25 @@
     if (self = [super init]) {
         //init method
         NSError *error = nil;
-        _definitionDictionary = [NSJSONSerialization JSONObjectWithData:[[self definitionString] dataUsingEncoding:NSUTF8StringEncoding]
-                                                                options:kNilOptions
-                                                                  error:&error];
-        if (_definitionDictionary == nil) {
+        NSDictionary *definitionDictionary = [NSJSONSerialization JSONObjectWithData:[NSData dataWithBytesNoCopy:(void *)AWSS3Definition
+                                                                                                           length:sizeof(AWSS3Definition) - 1
+                                                                                                     freeWhenDone:NO]
+                                                                               options:kNilOptions
+                                                                                 error:&error];
+        if (definitionDictionary == nil) {
             if (error) {
                 AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
             }
+        } else {
+            NSMutableDictionary *mutableDefinitionDictionary = [definitionDictionary mutableCopy];
+            mutableDefinitionDictionary[@"operations"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSS3Operations
+                                                                                                      count:sizeof(AWSS3Operations) / sizeof(AWSS3Operations[0])];
+            mutableDefinitionDictionary[@"shapes"] = [[AWSServiceModelDictionary alloc] initWithEntries:AWSS3Shapes
+                                                                                                  count:sizeof(AWSS3Shapes) / sizeof(AWSS3Shapes[0])];
+            _definitionDictionary = [mutableDefinitionDictionary copy];
         }
     }
     return self;
 }
 
-- (NSString *)definitionString {
-    return @"{\
-  \"version\":\"2.0\",\
-  \"metadata\":{\
-    \"apiVersion\":\"2006-03-01\",\
-    \"checksumFormat\":\"md5\",\
-    \"endpointPrefix\":\"s3\",\
-    \"globalEndpoint\":\"s3.amazonaws.com\",\
-    \"protocol\":\"rest-xml\",\
-    \"serviceAbbreviation\":\"Amazon S3\",\
-    \"serviceFullName\":\"Amazon Simple Storage Service\",\
-    \"serviceId\":\"S3\",\
-    \"signatureVersion\":\"s3\",\
-    \"timestampFormat\":\"rfc822\",\
-    \"uid\":\"s3-2006-03-01\"\
-  },\
-  \"operations\":{\
-    \"AbortMultipartUpload\":{\
-      \"name\":\"AbortMultipartUpload\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"AbortMultipartUploadRequest\"},\
-      \"output\":{\"shape\":\"AbortMultipartUploadOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchUpload\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadAbort.html\",\
-      \"documentation\":\"<p>Aborts a multipart upload.</p><p>To verify that all parts have been removed, so you don't get charged for the part storage, you should call the List Parts operation and ensure the parts list is empty.</p>\"\
-    },\
-    \"CompleteMultipartUpload\":{\
-      \"name\":\"CompleteMultipartUpload\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"CompleteMultipartUploadRequest\"},\
-      \"output\":{\"shape\":\"CompleteMultipartUploadOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadComplete.html\",\
-      \"documentation\":\"Completes a multipart upload by assembling previously uploaded parts.\"\
-    },\
-    \"CopyObject\":{\
-      \"name\":\"CopyObject\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"CopyObjectRequest\"},\
-      \"output\":{\"shape\":\"CopyObjectOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"ObjectNotInActiveTierError\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectCOPY.html\",\
-      \"documentation\":\"Creates a copy of an object that is already stored in Amazon S3.\",\
-      \"alias\":\"PutObjectCopy\"\
-    },\
-    \"CreateBucket\":{\
-      \"name\":\"CreateBucket\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}\"\
-      },\
-      \"input\":{\"shape\":\"CreateBucketRequest\"},\
-      \"output\":{\"shape\":\"CreateBucketOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"BucketAlreadyExists\"},\
-        {\"shape\":\"BucketAlreadyOwnedByYou\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUT.html\",\
-      \"documentation\":\"Creates a new bucket.\",\
-      \"alias\":\"PutBucket\"\
-    },\
-    \"CreateMultipartUpload\":{\
-      \"name\":\"CreateMultipartUpload\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?uploads\"\
-      },\
-      \"input\":{\"shape\":\"CreateMultipartUploadRequest\"},\
-      \"output\":{\"shape\":\"CreateMultipartUploadOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadInitiate.html\",\
-      \"documentation\":\"<p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b> After you initiate multipart upload and upload one or more parts, you must either complete or abort multipart upload in order to stop getting charged for storage of the uploaded parts. Only after you either complete or abort multipart upload, Amazon S3 frees up the parts storage and stops charging you for the parts storage.</p>\",\
-      \"alias\":\"InitiateMultipartUpload\"\
-    },\
-    \"DeleteBucket\":{\
-      \"name\":\"DeleteBucket\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETE.html\",\
-      \"documentation\":\"Deletes the bucket. All objects (including all object versions and Delete Markers) in the bucket must be deleted before the bucket itself can be deleted.\"\
-    },\
-    \"DeleteBucketAnalyticsConfiguration\":{\
-      \"name\":\"DeleteBucketAnalyticsConfiguration\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?analytics\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketAnalyticsConfigurationRequest\"},\
-      \"documentation\":\"Deletes an analytics configuration for the bucket (specified by the analytics configuration ID).\"\
-    },\
-    \"DeleteBucketCors\":{\
-      \"name\":\"DeleteBucketCors\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?cors\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketCorsRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETEcors.html\",\
-      \"documentation\":\"Deletes the cors configuration information set for the bucket.\"\
-    },\
-    \"DeleteBucketEncryption\":{\
-      \"name\":\"DeleteBucketEncryption\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?encryption\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketEncryptionRequest\"},\
-      \"documentation\":\"Deletes the server-side encryption configuration from the bucket.\"\
-    },\
-    \"DeleteBucketInventoryConfiguration\":{\
-      \"name\":\"DeleteBucketInventoryConfiguration\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?inventory\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketInventoryConfigurationRequest\"},\
-      \"documentation\":\"Deletes an inventory configuration (identified by the inventory ID) from the bucket.\"\
-    },\
-    \"DeleteBucketLifecycle\":{\
-      \"name\":\"DeleteBucketLifecycle\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?lifecycle\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketLifecycleRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETElifecycle.html\",\
-      \"documentation\":\"Deletes the lifecycle configuration from the bucket.\"\
-    },\
-    \"DeleteBucketMetricsConfiguration\":{\
-      \"name\":\"DeleteBucketMetricsConfiguration\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?metrics\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketMetricsConfigurationRequest\"},\
-      \"documentation\":\"Deletes a metrics configuration (specified by the metrics configuration ID) from the bucket.\"\
-    },\
-    \"DeleteBucketPolicy\":{\
-      \"name\":\"DeleteBucketPolicy\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?policy\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketPolicyRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETEpolicy.html\",\
-      \"documentation\":\"Deletes the policy from the bucket.\"\
-    },\
-    \"DeleteBucketReplication\":{\
-      \"name\":\"DeleteBucketReplication\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?replication\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketReplicationRequest\"},\
-      \"documentation\":\"Deletes the replication configuration from the bucket.\"\
-    },\
-    \"DeleteBucketTagging\":{\
-      \"name\":\"DeleteBucketTagging\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketTaggingRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETEtagging.html\",\
-      \"documentation\":\"Deletes the tags from the bucket.\"\
-    },\
-    \"DeleteBucketWebsite\":{\
-      \"name\":\"DeleteBucketWebsite\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}?website\"\
-      },\
-      \"input\":{\"shape\":\"DeleteBucketWebsiteRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketDELETEwebsite.html\",\
-      \"documentation\":\"This operation removes the website configuration from the bucket.\"\
-    },\
-    \"DeleteObject\":{\
-      \"name\":\"DeleteObject\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"DeleteObjectRequest\"},\
-      \"output\":{\"shape\":\"DeleteObjectOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectDELETE.html\",\
-      \"documentation\":\"Removes the null version (if there is one) of an object and inserts a delete marker, which becomes the latest version of the object. If there isn't a null version, Amazon S3 does not remove any objects.\"\
-    },\
-    \"DeleteObjectTagging\":{\
-      \"name\":\"DeleteObjectTagging\",\
-      \"http\":{\
-        \"method\":\"DELETE\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"DeleteObjectTaggingRequest\"},\
-      \"output\":{\"shape\":\"DeleteObjectTaggingOutput\"},\
-      \"documentation\":\"Removes the tag-set from an existing object.\"\
-    },\
-    \"DeleteObjects\":{\
-      \"name\":\"DeleteObjects\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/{Bucket}?delete\"\
-      },\
-      \"input\":{\"shape\":\"DeleteObjectsRequest\"},\
-      \"output\":{\"shape\":\"DeleteObjectsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/multiobjectdeleteapi.html\",\
-      \"documentation\":\"This operation enables you to delete multiple objects from a bucket using a single HTTP request. You may specify up to 1000 keys.\",\
-      \"alias\":\"DeleteMultipleObjects\"\
-    },\
-    \"GetBucketAccelerateConfiguration\":{\
-      \"name\":\"GetBucketAccelerateConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?accelerate\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketAccelerateConfigurationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketAccelerateConfigurationOutput\"},\
-      \"documentation\":\"Returns the accelerate configuration of a bucket.\"\
-    },\
-    \"GetBucketAcl\":{\
-      \"name\":\"GetBucketAcl\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?acl\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketAclRequest\"},\
-      \"output\":{\"shape\":\"GetBucketAclOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETacl.html\",\
-      \"documentation\":\"Gets the access control policy for the bucket.\"\
-    },\
-    \"GetBucketAnalyticsConfiguration\":{\
-      \"name\":\"GetBucketAnalyticsConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?analytics\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketAnalyticsConfigurationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketAnalyticsConfigurationOutput\"},\
-      \"documentation\":\"Gets an analytics configuration for the bucket (specified by the analytics configuration ID).\"\
-    },\
-    \"GetBucketCors\":{\
-      \"name\":\"GetBucketCors\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?cors\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketCorsRequest\"},\
-      \"output\":{\"shape\":\"GetBucketCorsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETcors.html\",\
-      \"documentation\":\"Returns the cors configuration for the bucket.\"\
-    },\
-    \"GetBucketEncryption\":{\
-      \"name\":\"GetBucketEncryption\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?encryption\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketEncryptionRequest\"},\
-      \"output\":{\"shape\":\"GetBucketEncryptionOutput\"},\
-      \"documentation\":\"Returns the server-side encryption configuration of a bucket.\"\
-    },\
-    \"GetBucketInventoryConfiguration\":{\
-      \"name\":\"GetBucketInventoryConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?inventory\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketInventoryConfigurationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketInventoryConfigurationOutput\"},\
-      \"documentation\":\"Returns an inventory configuration (identified by the inventory ID) from the bucket.\"\
-    },\
-    \"GetBucketLifecycle\":{\
-      \"name\":\"GetBucketLifecycle\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?lifecycle\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketLifecycleRequest\"},\
-      \"output\":{\"shape\":\"GetBucketLifecycleOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETlifecycle.html\",\
-      \"documentation\":\"Deprecated, see the GetBucketLifecycleConfiguration operation.\",\
-      \"deprecated\":true\
-    },\
-    \"GetBucketLifecycleConfiguration\":{\
-      \"name\":\"GetBucketLifecycleConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?lifecycle\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketLifecycleConfigurationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketLifecycleConfigurationOutput\"},\
-      \"documentation\":\"Returns the lifecycle configuration information set on the bucket.\"\
-    },\
-    \"GetBucketLocation\":{\
-      \"name\":\"GetBucketLocation\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?location\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketLocationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketLocationOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETlocation.html\",\
-      \"documentation\":\"Returns the region the bucket resides in.\"\
-    },\
-    \"GetBucketLogging\":{\
-      \"name\":\"GetBucketLogging\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?logging\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketLoggingRequest\"},\
-      \"output\":{\"shape\":\"GetBucketLoggingOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETlogging.html\",\
-      \"documentation\":\"Returns the logging status of a bucket and the permissions users have to view and modify that status. To use GET, you must be the bucket owner.\"\
-    },\
-    \"GetBucketMetricsConfiguration\":{\
-      \"name\":\"GetBucketMetricsConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?metrics\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketMetricsConfigurationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketMetricsConfigurationOutput\"},\
-      \"documentation\":\"Gets a metrics configuration (specified by the metrics configuration ID) from the bucket.\"\
-    },\
-    \"GetBucketNotification\":{\
-      \"name\":\"GetBucketNotification\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?notification\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketNotificationConfigurationRequest\"},\
-      \"output\":{\"shape\":\"NotificationConfigurationDeprecated\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETnotification.html\",\
-      \"documentation\":\"Deprecated, see the GetBucketNotificationConfiguration operation.\",\
-      \"deprecated\":true\
-    },\
-    \"GetBucketNotificationConfiguration\":{\
-      \"name\":\"GetBucketNotificationConfiguration\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?notification\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketNotificationConfigurationRequest\"},\
-      \"output\":{\"shape\":\"NotificationConfiguration\"},\
-      \"documentation\":\"Returns the notification configuration of a bucket.\"\
-    },\
-    \"GetBucketPolicy\":{\
-      \"name\":\"GetBucketPolicy\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?policy\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketPolicyRequest\"},\
-      \"output\":{\"shape\":\"GetBucketPolicyOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETpolicy.html\",\
-      \"documentation\":\"Returns the policy of a specified bucket.\"\
-    },\
-    \"GetBucketReplication\":{\
-      \"name\":\"GetBucketReplication\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?replication\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketReplicationRequest\"},\
-      \"output\":{\"shape\":\"GetBucketReplicationOutput\"},\
-      \"documentation\":\"Returns the replication configuration of a bucket.\"\
-    },\
-    \"GetBucketRequestPayment\":{\
-      \"name\":\"GetBucketRequestPayment\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?requestPayment\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketRequestPaymentRequest\"},\
-      \"output\":{\"shape\":\"GetBucketRequestPaymentOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTrequestPaymentGET.html\",\
-      \"documentation\":\"Returns the request payment configuration of a bucket.\"\
-    },\
-    \"GetBucketTagging\":{\
-      \"name\":\"GetBucketTagging\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketTaggingRequest\"},\
-      \"output\":{\"shape\":\"GetBucketTaggingOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETtagging.html\",\
-      \"documentation\":\"Returns the tag set associated with the bucket.\"\
-    },\
-    \"GetBucketVersioning\":{\
-      \"name\":\"GetBucketVersioning\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?versioning\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketVersioningRequest\"},\
-      \"output\":{\"shape\":\"GetBucketVersioningOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETversioningStatus.html\",\
-      \"documentation\":\"Returns the versioning state of a bucket.\"\
-    },\
-    \"GetBucketWebsite\":{\
-      \"name\":\"GetBucketWebsite\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?website\"\
-      },\
-      \"input\":{\"shape\":\"GetBucketWebsiteRequest\"},\
-      \"output\":{\"shape\":\"GetBucketWebsiteOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETwebsite.html\",\
-      \"documentation\":\"Returns the website configuration for a bucket.\"\
-    },\
-    \"GetObject\":{\
-      \"name\":\"GetObject\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"GetObjectRequest\"},\
-      \"output\":{\"shape\":\"GetObjectOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchKey\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectGET.html\",\
-      \"documentation\":\"Retrieves objects from Amazon S3.\"\
-    },\
-    \"GetObjectAcl\":{\
-      \"name\":\"GetObjectAcl\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?acl\"\
-      },\
-      \"input\":{\"shape\":\"GetObjectAclRequest\"},\
-      \"output\":{\"shape\":\"GetObjectAclOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchKey\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectGETacl.html\",\
-      \"documentation\":\"Returns the access control list (ACL) of an object.\"\
-    },\
-    \"GetObjectTagging\":{\
-      \"name\":\"GetObjectTagging\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"GetObjectTaggingRequest\"},\
-      \"output\":{\"shape\":\"GetObjectTaggingOutput\"},\
-      \"documentation\":\"Returns the tag-set of an object.\"\
-    },\
-    \"GetObjectTorrent\":{\
-      \"name\":\"GetObjectTorrent\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?torrent\"\
-      },\
-      \"input\":{\"shape\":\"GetObjectTorrentRequest\"},\
-      \"output\":{\"shape\":\"GetObjectTorrentOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectGETtorrent.html\",\
-      \"documentation\":\"Return torrent files from a bucket.\"\
-    },\
-    \"HeadBucket\":{\
-      \"name\":\"HeadBucket\",\
-      \"http\":{\
-        \"method\":\"HEAD\",\
-        \"requestUri\":\"/{Bucket}\"\
-      },\
-      \"input\":{\"shape\":\"HeadBucketRequest\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchBucket\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketHEAD.html\",\
-      \"documentation\":\"This operation is useful to determine if a bucket exists and you have permission to access it.\"\
-    },\
-    \"HeadObject\":{\
-      \"name\":\"HeadObject\",\
-      \"http\":{\
-        \"method\":\"HEAD\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"HeadObjectRequest\"},\
-      \"output\":{\"shape\":\"HeadObjectOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchKey\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectHEAD.html\",\
-      \"documentation\":\"The HEAD operation retrieves metadata from an object without returning the object itself. This operation is useful if you're only interested in an object's metadata. To use HEAD, you must have READ access to the object.\"\
-    },\
-    \"ListBucketAnalyticsConfigurations\":{\
-      \"name\":\"ListBucketAnalyticsConfigurations\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?analytics\"\
-      },\
-      \"input\":{\"shape\":\"ListBucketAnalyticsConfigurationsRequest\"},\
-      \"output\":{\"shape\":\"ListBucketAnalyticsConfigurationsOutput\"},\
-      \"documentation\":\"Lists the analytics configurations for the bucket.\"\
-    },\
-    \"ListBucketInventoryConfigurations\":{\
-      \"name\":\"ListBucketInventoryConfigurations\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?inventory\"\
-      },\
-      \"input\":{\"shape\":\"ListBucketInventoryConfigurationsRequest\"},\
-      \"output\":{\"shape\":\"ListBucketInventoryConfigurationsOutput\"},\
-      \"documentation\":\"Returns a list of inventory configurations for the bucket.\"\
-    },\
-    \"ListBucketMetricsConfigurations\":{\
-      \"name\":\"ListBucketMetricsConfigurations\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?metrics\"\
-      },\
-      \"input\":{\"shape\":\"ListBucketMetricsConfigurationsRequest\"},\
-      \"output\":{\"shape\":\"ListBucketMetricsConfigurationsOutput\"},\
-      \"documentation\":\"Lists the metrics configurations for the bucket.\"\
-    },\
-    \"ListBuckets\":{\
-      \"name\":\"ListBuckets\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/\"\
-      },\
-      \"output\":{\"shape\":\"ListBucketsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTServiceGET.html\",\
-      \"documentation\":\"Returns a list of all buckets owned by the authenticated sender of the request.\",\
-      \"alias\":\"GetService\"\
-    },\
-    \"ListMultipartUploads\":{\
-      \"name\":\"ListMultipartUploads\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?uploads\"\
-      },\
-      \"input\":{\"shape\":\"ListMultipartUploadsRequest\"},\
-      \"output\":{\"shape\":\"ListMultipartUploadsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadListMPUpload.html\",\
-      \"documentation\":\"This operation lists in-progress multipart uploads.\"\
-    },\
-    \"ListObjectVersions\":{\
-      \"name\":\"ListObjectVersions\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?versions\"\
-      },\
-      \"input\":{\"shape\":\"ListObjectVersionsRequest\"},\
-      \"output\":{\"shape\":\"ListObjectVersionsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGETVersion.html\",\
-      \"documentation\":\"Returns metadata about all of the versions of objects in a bucket.\",\
-      \"alias\":\"GetBucketObjectVersions\"\
-    },\
-    \"ListObjects\":{\
-      \"name\":\"ListObjects\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}\"\
-      },\
-      \"input\":{\"shape\":\"ListObjectsRequest\"},\
-      \"output\":{\"shape\":\"ListObjectsOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchBucket\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketGET.html\",\
-      \"documentation\":\"Returns some or all (up to 1000) of the objects in a bucket. You can use the request parameters as selection criteria to return a subset of the objects in a bucket.\",\
-      \"alias\":\"GetBucket\"\
-    },\
-    \"ListObjectsV2\":{\
-      \"name\":\"ListObjectsV2\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}?list-type=2\"\
-      },\
-      \"input\":{\"shape\":\"ListObjectsV2Request\"},\
-      \"output\":{\"shape\":\"ListObjectsV2Output\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchBucket\"}\
-      ],\
-      \"documentation\":\"Returns some or all (up to 1000) of the objects in a bucket. You can use the request parameters as selection criteria to return a subset of the objects in a bucket. Note: ListObjectsV2 is the revised List Objects API and we recommend you use this revised API for new application development.\"\
-    },\
-    \"ListParts\":{\
-      \"name\":\"ListParts\",\
-      \"http\":{\
-        \"method\":\"GET\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"ListPartsRequest\"},\
-      \"output\":{\"shape\":\"ListPartsOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadListParts.html\",\
-      \"documentation\":\"Lists the parts that have been uploaded for a specific multipart upload.\"\
-    },\
-    \"PutBucketAccelerateConfiguration\":{\
-      \"name\":\"PutBucketAccelerateConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?accelerate\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketAccelerateConfigurationRequest\"},\
-      \"documentation\":\"Sets the accelerate configuration of an existing bucket.\"\
-    },\
-    \"PutBucketAcl\":{\
-      \"name\":\"PutBucketAcl\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?acl\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketAclRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTacl.html\",\
-      \"documentation\":\"Sets the permissions on a bucket using access control lists (ACL).\"\
-    },\
-    \"PutBucketAnalyticsConfiguration\":{\
-      \"name\":\"PutBucketAnalyticsConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?analytics\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketAnalyticsConfigurationRequest\"},\
-      \"documentation\":\"Sets an analytics configuration for the bucket (specified by the analytics configuration ID).\"\
-    },\
-    \"PutBucketCors\":{\
-      \"name\":\"PutBucketCors\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?cors\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketCorsRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTcors.html\",\
-      \"documentation\":\"Sets the cors configuration for a bucket.\"\
-    },\
-    \"PutBucketEncryption\":{\
-      \"name\":\"PutBucketEncryption\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?encryption\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketEncryptionRequest\"},\
-      \"documentation\":\"Creates a new server-side encryption configuration (or replaces an existing one, if present).\"\
-    },\
-    \"PutBucketInventoryConfiguration\":{\
-      \"name\":\"PutBucketInventoryConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?inventory\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketInventoryConfigurationRequest\"},\
-      \"documentation\":\"Adds an inventory configuration (identified by the inventory ID) from the bucket.\"\
-    },\
-    \"PutBucketLifecycle\":{\
-      \"name\":\"PutBucketLifecycle\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?lifecycle\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketLifecycleRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTlifecycle.html\",\
-      \"documentation\":\"Deprecated, see the PutBucketLifecycleConfiguration operation.\",\
-      \"deprecated\":true\
-    },\
-    \"PutBucketLifecycleConfiguration\":{\
-      \"name\":\"PutBucketLifecycleConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?lifecycle\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketLifecycleConfigurationRequest\"},\
-      \"documentation\":\"Sets lifecycle configuration for your bucket. If a lifecycle configuration exists, it replaces it.\"\
-    },\
-    \"PutBucketLogging\":{\
-      \"name\":\"PutBucketLogging\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?logging\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketLoggingRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTlogging.html\",\
-      \"documentation\":\"Set the logging parameters for a bucket and to specify permissions for who can view and modify the logging parameters. To set the logging status of a bucket, you must be the bucket owner.\"\
-    },\
-    \"PutBucketMetricsConfiguration\":{\
-      \"name\":\"PutBucketMetricsConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?metrics\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketMetricsConfigurationRequest\"},\
-      \"documentation\":\"Sets a metrics configuration (specified by the metrics configuration ID) for the bucket.\"\
-    },\
-    \"PutBucketNotification\":{\
-      \"name\":\"PutBucketNotification\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?notification\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketNotificationRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTnotification.html\",\
-      \"documentation\":\"Deprecated, see the PutBucketNotificationConfiguraiton operation.\",\
-      \"deprecated\":true\
-    },\
-    \"PutBucketNotificationConfiguration\":{\
-      \"name\":\"PutBucketNotificationConfiguration\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?notification\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketNotificationConfigurationRequest\"},\
-      \"documentation\":\"Enables notifications of specified events for a bucket.\"\
-    },\
-    \"PutBucketPolicy\":{\
-      \"name\":\"PutBucketPolicy\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?policy\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketPolicyRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTpolicy.html\",\
-      \"documentation\":\"Replaces a policy on a bucket. If the bucket already has a policy, the one in this request completely replaces it.\"\
-    },\
-    \"PutBucketReplication\":{\
-      \"name\":\"PutBucketReplication\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?replication\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketReplicationRequest\"},\
-      \"documentation\":\"Creates a new replication configuration (or replaces an existing one, if present).\"\
-    },\
-    \"PutBucketRequestPayment\":{\
-      \"name\":\"PutBucketRequestPayment\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?requestPayment\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketRequestPaymentRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTrequestPaymentPUT.html\",\
-      \"documentation\":\"Sets the request payment configuration for a bucket. By default, the bucket owner pays for downloads from the bucket. This configuration parameter enables the bucket owner (only) to specify that the person requesting the download will be charged for the download. Documentation on requester pays buckets can be found at http://docs.aws.amazon.com/AmazonS3/latest/dev/RequesterPaysBuckets.html\"\
-    },\
-    \"PutBucketTagging\":{\
-      \"name\":\"PutBucketTagging\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketTaggingRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTtagging.html\",\
-      \"documentation\":\"Sets the tags for a bucket.\"\
-    },\
-    \"PutBucketVersioning\":{\
-      \"name\":\"PutBucketVersioning\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?versioning\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketVersioningRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTVersioningStatus.html\",\
-      \"documentation\":\"Sets the versioning state of an existing bucket. To set the versioning state, you must be the bucket owner.\"\
-    },\
-    \"PutBucketWebsite\":{\
-      \"name\":\"PutBucketWebsite\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}?website\"\
-      },\
-      \"input\":{\"shape\":\"PutBucketWebsiteRequest\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTBucketPUTwebsite.html\",\
-      \"documentation\":\"Set the website configuration for a bucket.\"\
-    },\
-    \"PutObject\":{\
-      \"name\":\"PutObject\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"PutObjectRequest\"},\
-      \"output\":{\"shape\":\"PutObjectOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectPUT.html\",\
-      \"documentation\":\"Adds an object to a bucket.\"\
-    },\
-    \"PutObjectAcl\":{\
-      \"name\":\"PutObjectAcl\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?acl\"\
-      },\
-      \"input\":{\"shape\":\"PutObjectAclRequest\"},\
-      \"output\":{\"shape\":\"PutObjectAclOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"NoSuchKey\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectPUTacl.html\",\
-      \"documentation\":\"uses the acl subresource to set the access control list (ACL) permissions for an object that already exists in a bucket\"\
-    },\
-    \"PutObjectTagging\":{\
-      \"name\":\"PutObjectTagging\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?tagging\"\
-      },\
-      \"input\":{\"shape\":\"PutObjectTaggingRequest\"},\
-      \"output\":{\"shape\":\"PutObjectTaggingOutput\"},\
-      \"documentation\":\"Sets the supplied tag-set to an object that already exists in a bucket\"\
-    },\
-    \"RestoreObject\":{\
-      \"name\":\"RestoreObject\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?restore\"\
-      },\
-      \"input\":{\"shape\":\"RestoreObjectRequest\"},\
-      \"output\":{\"shape\":\"RestoreObjectOutput\"},\
-      \"errors\":[\
-        {\"shape\":\"ObjectAlreadyInActiveTierError\"}\
-      ],\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/RESTObjectRestore.html\",\
-      \"documentation\":\"Restores an archived copy of an object back into Amazon S3\",\
-      \"alias\":\"PostObjectRestore\"\
-    },\
-    \"SelectObjectContent\":{\
-      \"name\":\"SelectObjectContent\",\
-      \"http\":{\
-        \"method\":\"POST\",\
-        \"requestUri\":\"/{Bucket}/{Key+}?select&select-type=2\"\
-      },\
-      \"input\":{\
-        \"shape\":\"SelectObjectContentRequest\",\
-        \"locationName\":\"SelectObjectContentRequest\",\
-        \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-      },\
-      \"output\":{\"shape\":\"SelectObjectContentOutput\"},\
-      \"documentation\":\"This operation filters the contents of an Amazon S3 object based on a simple Structured Query Language (SQL) statement. In the request, along with the SQL expression, you must also specify a data serialization format (JSON or CSV) of the object. Amazon S3 uses this to parse object data into records, and returns only records that match the specified SQL expression. You must also specify the data serialization format for the response.\"\
-    },\
-    \"UploadPart\":{\
-      \"name\":\"UploadPart\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"UploadPartRequest\"},\
-      \"output\":{\"shape\":\"UploadPartOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadUploadPart.html\",\
-      \"documentation\":\"<p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate multipart upload and upload one or more parts, you must either complete or abort multipart upload in order to stop getting charged for storage of the uploaded parts. Only after you either complete or abort multipart upload, Amazon S3 frees up the parts storage and stops charging you for the parts storage.</p>\"\
-    },\
-    \"UploadPartCopy\":{\
-      \"name\":\"UploadPartCopy\",\
-      \"http\":{\
-        \"method\":\"PUT\",\
-        \"requestUri\":\"/{Bucket}/{Key+}\"\
-      },\
-      \"input\":{\"shape\":\"UploadPartCopyRequest\"},\
-      \"output\":{\"shape\":\"UploadPartCopyOutput\"},\
-      \"documentationUrl\":\"http://docs.amazonwebservices.com/AmazonS3/latest/API/mpUploadUploadPartCopy.html\",\
-      \"documentation\":\"Uploads a part by copying data from an existing object as data source.\"\
-    }\
-  },\
-  \"shapes\":{\
-    \"AbortDate\":{\"type\":\"timestamp\"},\
-    \"AbortIncompleteMultipartUpload\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"DaysAfterInitiation\":{\
-          \"shape\":\"DaysAfterInitiation\",\
-          \"documentation\":\"Indicates the number of days that must pass since initiation for Lifecycle to abort an Incomplete Multipart Upload.\"\
-        }\
-      },\
-      \"documentation\":\"Specifies the days since the initiation of an Incomplete Multipart Upload that Lifecycle will wait before permanently removing all parts of the upload.\"\
-    },\
-    \"AbortMultipartUploadOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"AbortMultipartUploadRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"UploadId\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"uploadId\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"AbortRuleId\":{\"type\":\"string\"},\
-    \"AccelerateConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Status\":{\
-          \"shape\":\"BucketAccelerateStatus\",\
-          \"documentation\":\"The accelerate configuration of the bucket.\"\
-        }\
-      }\
-    },\
-    \"AcceptRanges\":{\"type\":\"string\"},\
-    \"AccessControlPolicy\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Grants\":{\
-          \"shape\":\"Grants\",\
-          \"documentation\":\"A list of grants.\",\
-          \"locationName\":\"AccessControlList\"\
-        },\
-        \"Owner\":{\"shape\":\"Owner\"}\
-      }\
-    },\
-    \"AccessControlTranslation\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Owner\"],\
-      \"members\":{\
-        \"Owner\":{\
-          \"shape\":\"OwnerOverride\",\
-          \"documentation\":\"The override value for the owner of the replica object.\"\
-        }\
-      },\
-      \"documentation\":\"Container for information regarding the access control for replicas.\"\
-    },\
-    \"AccountId\":{\"type\":\"string\"},\
-    \"AllowedHeader\":{\"type\":\"string\"},\
-    \"AllowedHeaders\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"AllowedHeader\"},\
-      \"flattened\":true\
-    },\
-    \"AllowedMethod\":{\"type\":\"string\"},\
-    \"AllowedMethods\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"AllowedMethod\"},\
-      \"flattened\":true\
-    },\
-    \"AllowedOrigin\":{\"type\":\"string\"},\
-    \"AllowedOrigins\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"AllowedOrigin\"},\
-      \"flattened\":true\
-    },\
-    \"AnalyticsAndOperator\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix to use when evaluating an AND predicate.\"\
-        },\
-        \"Tags\":{\
-          \"shape\":\"TagSet\",\
-          \"documentation\":\"The list of tags to use when evaluating an AND predicate.\",\
-          \"flattened\":true,\
-          \"locationName\":\"Tag\"\
-        }\
-      }\
-    },\
-    \"AnalyticsConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Id\",\
-        \"StorageClassAnalysis\"\
-      ],\
-      \"members\":{\
-        \"Id\":{\
-          \"shape\":\"AnalyticsId\",\
-          \"documentation\":\"The identifier used to represent an analytics configuration.\"\
-        },\
-        \"Filter\":{\
-          \"shape\":\"AnalyticsFilter\",\
-          \"documentation\":\"The filter used to describe a set of objects for analyses. A filter must have exactly one prefix, one tag, or one conjunction (AnalyticsAndOperator). If no filter is provided, all objects will be considered in any analysis.\"\
-        },\
-        \"StorageClassAnalysis\":{\
-          \"shape\":\"StorageClassAnalysis\",\
-          \"documentation\":\"If present, it indicates that data related to access patterns will be collected and made available to analyze the tradeoffs between different storage classes.\"\
-        }\
-      }\
-    },\
-    \"AnalyticsConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"AnalyticsConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"AnalyticsExportDestination\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"S3BucketDestination\"],\
-      \"members\":{\
-        \"S3BucketDestination\":{\
-          \"shape\":\"AnalyticsS3BucketDestination\",\
-          \"documentation\":\"A destination signifying output to an S3 bucket.\"\
-        }\
-      }\
-    },\
-    \"AnalyticsFilter\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix to use when evaluating an analytics filter.\"\
-        },\
-        \"Tag\":{\
-          \"shape\":\"Tag\",\
-          \"documentation\":\"The tag to use when evaluating an analytics filter.\"\
-        },\
-        \"And\":{\
-          \"shape\":\"AnalyticsAndOperator\",\
-          \"documentation\":\"A conjunction (logical AND) of predicates, which is used in evaluating an analytics filter. The operator must have at least two predicates.\"\
-        }\
-      }\
-    },\
-    \"AnalyticsId\":{\"type\":\"string\"},\
-    \"AnalyticsS3BucketDestination\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Format\",\
-        \"Bucket\"\
-      ],\
-      \"members\":{\
-        \"Format\":{\
-          \"shape\":\"AnalyticsS3ExportFileFormat\",\
-          \"documentation\":\"The file format used when exporting data to Amazon S3.\"\
-        },\
-        \"BucketAccountId\":{\
-          \"shape\":\"AccountId\",\
-          \"documentation\":\"The account ID that owns the destination bucket. If no account ID is provided, the owner will not be validated prior to exporting data.\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The Amazon resource name (ARN) of the bucket to which data is exported.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix to use when exporting data. The exported data begins with this prefix.\"\
-        }\
-      }\
-    },\
-    \"AnalyticsS3ExportFileFormat\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"CSV\"]\
-    },\
-    \"Body\":{\"type\":\"blob\"},\
-    \"Bucket\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Name\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket.\"\
-        },\
-        \"CreationDate\":{\
-          \"shape\":\"CreationDate\",\
-          \"documentation\":\"Date the bucket was created.\"\
-        }\
-      }\
-    },\
-    \"BucketAccelerateStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Suspended\"\
-      ]\
-    },\
-    \"BucketAlreadyExists\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"The requested bucket name is not available. The bucket namespace is shared by all users of the system. Please select a different name and try again.\",\
-      \"exception\":true\
-    },\
-    \"BucketAlreadyOwnedByYou\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"exception\":true\
-    },\
-    \"BucketCannedACL\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"private\",\
-        \"public-read\",\
-        \"public-read-write\",\
-        \"authenticated-read\"\
-      ]\
-    },\
-    \"BucketLifecycleConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Rules\"],\
-      \"members\":{\
-        \"Rules\":{\
-          \"shape\":\"LifecycleRules\",\
-          \"locationName\":\"Rule\"\
-        }\
-      }\
-    },\
-    \"BucketLocationConstraint\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"\",\
-        \"EU\",\
-        \"eu-west-1\",\
-        \"us-west-1\",\
-        \"us-west-2\",\
-        \"eu-west-2\",\
-        \"eu-west-3\",\
-        \"us-east-2\",\
-        \"ap-south-1\",\
-        \"ap-southeast-1\",\
-        \"ap-southeast-2\",\
-        \"ap-northeast-1\",\
-        \"ap-northeast-2\",\
-        \"sa-east-1\",\
-        \"cn-north-1\",\
-        \"cn-northwest-1\",\
-        \"us-gov-west-1\",\
-        \"eu-central-1\",\
-        \"ca-central-1\"\
-      ]\
-    },\
-    \"BucketLoggingStatus\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"LoggingEnabled\":{\"shape\":\"LoggingEnabled\"}\
-      }\
-    },\
-    \"BucketLogsPermission\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"FULL_CONTROL\",\
-        \"READ\",\
-        \"WRITE\"\
-      ]\
-    },\
-    \"BucketName\":{\"type\":\"string\"},\
-    \"BucketVersioningStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Suspended\"\
-      ]\
-    },\
-    \"Buckets\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"Bucket\",\
-        \"locationName\":\"Bucket\"\
-      }\
-    },\
-    \"BytesProcessed\":{\"type\":\"long\"},\
-    \"BytesScanned\":{\"type\":\"long\"},\
-    \"CORSConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"CORSRules\"],\
-      \"members\":{\
-        \"CORSRules\":{\
-          \"shape\":\"CORSRules\",\
-          \"locationName\":\"CORSRule\"\
-        }\
-      }\
-    },\
-    \"CORSRule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"AllowedMethods\",\
-        \"AllowedOrigins\"\
-      ],\
-      \"members\":{\
-        \"AllowedHeaders\":{\
-          \"shape\":\"AllowedHeaders\",\
-          \"documentation\":\"Specifies which headers are allowed in a pre-flight OPTIONS request.\",\
-          \"locationName\":\"AllowedHeader\"\
-        },\
-        \"AllowedMethods\":{\
-          \"shape\":\"AllowedMethods\",\
-          \"documentation\":\"Identifies HTTP methods that the domain/origin specified in the rule is allowed to execute.\",\
-          \"locationName\":\"AllowedMethod\"\
-        },\
-        \"AllowedOrigins\":{\
-          \"shape\":\"AllowedOrigins\",\
-          \"documentation\":\"One or more origins you want customers to be able to access the bucket from.\",\
-          \"locationName\":\"AllowedOrigin\"\
-        },\
-        \"ExposeHeaders\":{\
-          \"shape\":\"ExposeHeaders\",\
-          \"documentation\":\"One or more headers in the response that you want customers to be able to access from their applications (for example, from a JavaScript XMLHttpRequest object).\",\
-          \"locationName\":\"ExposeHeader\"\
-        },\
-        \"MaxAgeSeconds\":{\
-          \"shape\":\"MaxAgeSeconds\",\
-          \"documentation\":\"The time in seconds that your browser is to cache the preflight response for the specified resource.\"\
-        }\
-      }\
-    },\
-    \"CORSRules\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"CORSRule\"},\
-      \"flattened\":true\
-    },\
-    \"CSVInput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"FileHeaderInfo\":{\
-          \"shape\":\"FileHeaderInfo\",\
-          \"documentation\":\"Describes the first line of input. Valid values: None, Ignore, Use.\"\
-        },\
-        \"Comments\":{\
-          \"shape\":\"Comments\",\
-          \"documentation\":\"Single character used to indicate a row should be ignored when present at the start of a row.\"\
-        },\
-        \"QuoteEscapeCharacter\":{\
-          \"shape\":\"QuoteEscapeCharacter\",\
-          \"documentation\":\"Single character used for escaping the quote character inside an already escaped value.\"\
-        },\
-        \"RecordDelimiter\":{\
-          \"shape\":\"RecordDelimiter\",\
-          \"documentation\":\"Value used to separate individual records.\"\
-        },\
-        \"FieldDelimiter\":{\
-          \"shape\":\"FieldDelimiter\",\
-          \"documentation\":\"Value used to separate individual fields in a record.\"\
-        },\
-        \"QuoteCharacter\":{\
-          \"shape\":\"QuoteCharacter\",\
-          \"documentation\":\"Value used for escaping where the field delimiter is part of the value.\"\
-        }\
-      },\
-      \"documentation\":\"Describes how a CSV-formatted input object is formatted.\"\
-    },\
-    \"CSVOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"QuoteFields\":{\
-          \"shape\":\"QuoteFields\",\
-          \"documentation\":\"Indicates whether or not all output fields should be quoted.\"\
-        },\
-        \"QuoteEscapeCharacter\":{\
-          \"shape\":\"QuoteEscapeCharacter\",\
-          \"documentation\":\"Single character used for escaping the quote character inside an already escaped value.\"\
-        },\
-        \"RecordDelimiter\":{\
-          \"shape\":\"RecordDelimiter\",\
-          \"documentation\":\"Value used to separate individual records.\"\
-        },\
-        \"FieldDelimiter\":{\
-          \"shape\":\"FieldDelimiter\",\
-          \"documentation\":\"Value used to separate individual fields in a record.\"\
-        },\
-        \"QuoteCharacter\":{\
-          \"shape\":\"QuoteCharacter\",\
-          \"documentation\":\"Value used for escaping where the field delimiter is part of the value.\"\
-        }\
-      },\
-      \"documentation\":\"Describes how CSV-formatted results are formatted.\"\
-    },\
-    \"CacheControl\":{\"type\":\"string\"},\
-    \"CloudFunction\":{\"type\":\"string\"},\
-    \"CloudFunctionConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"Event\":{\
-          \"shape\":\"Event\",\
-          \"deprecated\":true\
-        },\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"CloudFunction\":{\"shape\":\"CloudFunction\"},\
-        \"InvocationRole\":{\"shape\":\"CloudFunctionInvocationRole\"}\
-      }\
-    },\
-    \"CloudFunctionInvocationRole\":{\"type\":\"string\"},\
-    \"Code\":{\"type\":\"string\"},\
-    \"Comments\":{\"type\":\"string\"},\
-    \"CommonPrefix\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\"shape\":\"Prefix\"}\
-      }\
-    },\
-    \"CommonPrefixList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"CommonPrefix\"},\
-      \"flattened\":true\
-    },\
-    \"CompleteMultipartUploadOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Location\":{\"shape\":\"Location\"},\
-        \"Bucket\":{\"shape\":\"BucketName\"},\
-        \"Key\":{\"shape\":\"ObjectKey\"},\
-        \"Expiration\":{\
-          \"shape\":\"Expiration\",\
-          \"documentation\":\"If the object expiration is configured, this will contain the expiration date (expiry-date) and rule ID (rule-id). The value of rule-id is URL encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-expiration\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag of the object.\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version of the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"CompleteMultipartUploadRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"UploadId\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"MultipartUpload\":{\
-          \"shape\":\"CompletedMultipartUpload\",\
-          \"locationName\":\"CompleteMultipartUpload\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"uploadId\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      },\
-      \"payload\":\"MultipartUpload\"\
-    },\
-    \"CompletedMultipartUpload\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Parts\":{\
-          \"shape\":\"CompletedPartList\",\
-          \"locationName\":\"Part\"\
-        }\
-      }\
-    },\
-    \"CompletedPart\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag returned when the part was uploaded.\"\
-        },\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number that identifies the part. This is a positive integer between 1 and 10,000.\"\
-        }\
-      }\
-    },\
-    \"CompletedPartList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"CompletedPart\"},\
-      \"flattened\":true\
-    },\
-    \"CompressionType\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"NONE\",\
-        \"GZIP\"\
-      ]\
-    },\
-    \"Condition\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"HttpErrorCodeReturnedEquals\":{\
-          \"shape\":\"HttpErrorCodeReturnedEquals\",\
-          \"documentation\":\"The HTTP error code when the redirect is applied. In the event of an error, if the error code equals this value, then the specified redirect is applied. Required when parent element Condition is specified and sibling KeyPrefixEquals is not specified. If both are specified, then both must be true for the redirect to be applied.\"\
-        },\
-        \"KeyPrefixEquals\":{\
-          \"shape\":\"KeyPrefixEquals\",\
-          \"documentation\":\"The object key name prefix when the redirect is applied. For example, to redirect requests for ExamplePage.html, the key prefix will be ExamplePage.html. To redirect request for all pages with the prefix docs/, the key prefix will be /docs, which identifies all objects in the docs/ folder. Required when the parent element Condition is specified and sibling HttpErrorCodeReturnedEquals is not specified. If both conditions are specified, both must be true for the redirect to be applied.\"\
-        }\
-      }\
-    },\
-    \"ConfirmRemoveSelfBucketAccess\":{\"type\":\"boolean\"},\
-    \"ContentDisposition\":{\"type\":\"string\"},\
-    \"ContentEncoding\":{\"type\":\"string\"},\
-    \"ContentLanguage\":{\"type\":\"string\"},\
-    \"ContentLength\":{\"type\":\"long\"},\
-    \"ContentMD5\":{\"type\":\"string\"},\
-    \"ContentRange\":{\"type\":\"string\"},\
-    \"ContentType\":{\"type\":\"string\"},\
-    \"ContinuationEvent\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"event\":true\
-    },\
-    \"CopyObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"CopyObjectResult\":{\"shape\":\"CopyObjectResult\"},\
-        \"Expiration\":{\
-          \"shape\":\"Expiration\",\
-          \"documentation\":\"If the object expiration is configured, the response includes this header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-expiration\"\
-        },\
-        \"CopySourceVersionId\":{\
-          \"shape\":\"CopySourceVersionId\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-version-id\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version ID of the newly created copy.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      },\
-      \"payload\":\"CopyObjectResult\"\
-    },\
-    \"CopyObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"CopySource\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"ObjectCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CacheControl\":{\
-          \"shape\":\"CacheControl\",\
-          \"documentation\":\"Specifies caching behavior along the request/reply chain.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Cache-Control\"\
-        },\
-        \"ContentDisposition\":{\
-          \"shape\":\"ContentDisposition\",\
-          \"documentation\":\"Specifies presentational information for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Disposition\"\
-        },\
-        \"ContentEncoding\":{\
-          \"shape\":\"ContentEncoding\",\
-          \"documentation\":\"Specifies what content encodings have been applied to the object and thus what decoding mechanisms must be applied to obtain the media-type referenced by the Content-Type header field.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Encoding\"\
-        },\
-        \"ContentLanguage\":{\
-          \"shape\":\"ContentLanguage\",\
-          \"documentation\":\"The language the content is in.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Language\"\
-        },\
-        \"ContentType\":{\
-          \"shape\":\"ContentType\",\
-          \"documentation\":\"A standard MIME type describing the format of the object data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Type\"\
-        },\
-        \"CopySource\":{\
-          \"shape\":\"CopySource\",\
-          \"documentation\":\"The name of the source bucket and key name of the source object, separated by a slash (/). Must be URL-encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source\"\
-        },\
-        \"CopySourceIfMatch\":{\
-          \"shape\":\"CopySourceIfMatch\",\
-          \"documentation\":\"Copies the object if its entity tag (ETag) matches the specified tag.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-match\"\
-        },\
-        \"CopySourceIfModifiedSince\":{\
-          \"shape\":\"CopySourceIfModifiedSince\",\
-          \"documentation\":\"Copies the object if it has been modified since the specified time.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-modified-since\"\
-        },\
-        \"CopySourceIfNoneMatch\":{\
-          \"shape\":\"CopySourceIfNoneMatch\",\
-          \"documentation\":\"Copies the object if its entity tag (ETag) is different than the specified ETag.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-none-match\"\
-        },\
-        \"CopySourceIfUnmodifiedSince\":{\
-          \"shape\":\"CopySourceIfUnmodifiedSince\",\
-          \"documentation\":\"Copies the object if it hasn't been modified since the specified time.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-unmodified-since\"\
-        },\
-        \"Expires\":{\
-          \"shape\":\"Expires\",\
-          \"documentation\":\"The date and time at which the object is no longer cacheable.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Expires\"\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Gives the grantee READ, READ_ACP, and WRITE_ACP permissions on the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to read the object data and its metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the object ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"Metadata\":{\
-          \"shape\":\"Metadata\",\
-          \"documentation\":\"A map of metadata to store with the object in S3.\",\
-          \"location\":\"headers\",\
-          \"locationName\":\"x-amz-meta-\"\
-        },\
-        \"MetadataDirective\":{\
-          \"shape\":\"MetadataDirective\",\
-          \"documentation\":\"Specifies whether the metadata is copied from the source object or replaced with metadata provided in the request.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-metadata-directive\"\
-        },\
-        \"TaggingDirective\":{\
-          \"shape\":\"TaggingDirective\",\
-          \"documentation\":\"Specifies whether the object tag-set are copied from the source object or replaced with tag-set provided in the request.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-tagging-directive\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The type of storage to use for the object. Defaults to 'STANDARD'.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-storage-class\"\
-        },\
-        \"WebsiteRedirectLocation\":{\
-          \"shape\":\"WebsiteRedirectLocation\",\
-          \"documentation\":\"If the bucket is configured as a website, redirects requests for this object to another object in the same bucket or to an external URL. Amazon S3 stores the value of this header in the object metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-website-redirect-location\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"Specifies the AWS KMS key ID to use for object encryption. All GET and PUT requests for an object protected by AWS KMS will fail if not made via SSL or using SigV4. Documentation on configuring any of the officially supported AWS SDKs and CLI can be found at http://docs.aws.amazon.com/AmazonS3/latest/dev/UsingAWSSDK.html#specify-signature-version\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"CopySourceSSECustomerAlgorithm\":{\
-          \"shape\":\"CopySourceSSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use when decrypting the source object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-algorithm\"\
-        },\
-        \"CopySourceSSECustomerKey\":{\
-          \"shape\":\"CopySourceSSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use to decrypt the source object. The encryption key provided in this header must be one that was used when the source object was created.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key\"\
-        },\
-        \"CopySourceSSECustomerKeyMD5\":{\
-          \"shape\":\"CopySourceSSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"TaggingHeader\",\
-          \"documentation\":\"The tag-set for the object destination object this value must be used in conjunction with the TaggingDirective. The tag-set must be encoded as URL Query parameters\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-tagging\"\
-        }\
-      }\
-    },\
-    \"CopyObjectResult\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ETag\":{\"shape\":\"ETag\"},\
-        \"LastModified\":{\"shape\":\"LastModified\"}\
-      }\
-    },\
-    \"CopyPartResult\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag of the object.\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Date and time at which the object was uploaded.\"\
-        }\
-      }\
-    },\
-    \"CopySource\":{\
-      \"type\":\"string\",\
-      \"pattern\":\"\\\\/.+\\\\/.+\"\
-    },\
-    \"CopySourceIfMatch\":{\"type\":\"string\"},\
-    \"CopySourceIfModifiedSince\":{\"type\":\"timestamp\"},\
-    \"CopySourceIfNoneMatch\":{\"type\":\"string\"},\
-    \"CopySourceIfUnmodifiedSince\":{\"type\":\"timestamp\"},\
-    \"CopySourceRange\":{\"type\":\"string\"},\
-    \"CopySourceSSECustomerAlgorithm\":{\"type\":\"string\"},\
-    \"CopySourceSSECustomerKey\":{\
-      \"type\":\"string\",\
-      \"sensitive\":true\
-    },\
-    \"CopySourceSSECustomerKeyMD5\":{\"type\":\"string\"},\
-    \"CopySourceVersionId\":{\"type\":\"string\"},\
-    \"CreateBucketConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"LocationConstraint\":{\
-          \"shape\":\"BucketLocationConstraint\",\
-          \"documentation\":\"Specifies the region where the bucket will be created. If you don't specify a region, the bucket will be created in US Standard.\"\
-        }\
-      }\
-    },\
-    \"CreateBucketOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Location\":{\
-          \"shape\":\"Location\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Location\"\
-        }\
-      }\
-    },\
-    \"CreateBucketRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"BucketCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CreateBucketConfiguration\":{\
-          \"shape\":\"CreateBucketConfiguration\",\
-          \"locationName\":\"CreateBucketConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Allows grantee the read, write, read ACP, and write ACP permissions on the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to list the objects in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the bucket ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWrite\":{\
-          \"shape\":\"GrantWrite\",\
-          \"documentation\":\"Allows grantee to create, overwrite, and delete any object in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        }\
-      },\
-      \"payload\":\"CreateBucketConfiguration\"\
-    },\
-    \"CreateMultipartUploadOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"AbortDate\":{\
-          \"shape\":\"AbortDate\",\
-          \"documentation\":\"Date when multipart upload will become eligible for abort operation by lifecycle.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-abort-date\"\
-        },\
-        \"AbortRuleId\":{\
-          \"shape\":\"AbortRuleId\",\
-          \"documentation\":\"Id of the lifecycle rule that makes a multipart upload eligible for abort operation.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-abort-rule-id\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to which the multipart upload was initiated.\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Object key for which the multipart upload was initiated.\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"ID for the initiated multipart upload.\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"CreateMultipartUploadRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"ObjectCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CacheControl\":{\
-          \"shape\":\"CacheControl\",\
-          \"documentation\":\"Specifies caching behavior along the request/reply chain.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Cache-Control\"\
-        },\
-        \"ContentDisposition\":{\
-          \"shape\":\"ContentDisposition\",\
-          \"documentation\":\"Specifies presentational information for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Disposition\"\
-        },\
-        \"ContentEncoding\":{\
-          \"shape\":\"ContentEncoding\",\
-          \"documentation\":\"Specifies what content encodings have been applied to the object and thus what decoding mechanisms must be applied to obtain the media-type referenced by the Content-Type header field.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Encoding\"\
-        },\
-        \"ContentLanguage\":{\
-          \"shape\":\"ContentLanguage\",\
-          \"documentation\":\"The language the content is in.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Language\"\
-        },\
-        \"ContentType\":{\
-          \"shape\":\"ContentType\",\
-          \"documentation\":\"A standard MIME type describing the format of the object data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Type\"\
-        },\
-        \"Expires\":{\
-          \"shape\":\"Expires\",\
-          \"documentation\":\"The date and time at which the object is no longer cacheable.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Expires\"\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Gives the grantee READ, READ_ACP, and WRITE_ACP permissions on the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to read the object data and its metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the object ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"Metadata\":{\
-          \"shape\":\"Metadata\",\
-          \"documentation\":\"A map of metadata to store with the object in S3.\",\
-          \"location\":\"headers\",\
-          \"locationName\":\"x-amz-meta-\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The type of storage to use for the object. Defaults to 'STANDARD'.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-storage-class\"\
-        },\
-        \"WebsiteRedirectLocation\":{\
-          \"shape\":\"WebsiteRedirectLocation\",\
-          \"documentation\":\"If the bucket is configured as a website, redirects requests for this object to another object in the same bucket or to an external URL. Amazon S3 stores the value of this header in the object metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-website-redirect-location\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"Specifies the AWS KMS key ID to use for object encryption. All GET and PUT requests for an object protected by AWS KMS will fail if not made via SSL or using SigV4. Documentation on configuring any of the officially supported AWS SDKs and CLI can be found at http://docs.aws.amazon.com/AmazonS3/latest/dev/UsingAWSSDK.html#specify-signature-version\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"TaggingHeader\",\
-          \"documentation\":\"The tag-set for the object. The tag-set must be encoded as URL Query parameters\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-tagging\"\
-        }\
-      }\
-    },\
-    \"CreationDate\":{\"type\":\"timestamp\"},\
-    \"Date\":{\
-      \"type\":\"timestamp\",\
-      \"timestampFormat\":\"iso8601\"\
-    },\
-    \"Days\":{\"type\":\"integer\"},\
-    \"DaysAfterInitiation\":{\"type\":\"integer\"},\
-    \"Delete\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Objects\"],\
-      \"members\":{\
-        \"Objects\":{\
-          \"shape\":\"ObjectIdentifierList\",\
-          \"locationName\":\"Object\"\
-        },\
-        \"Quiet\":{\
-          \"shape\":\"Quiet\",\
-          \"documentation\":\"Element to enable quiet mode for the request. When you add this element, you must set its value to true.\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketAnalyticsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket from which an analytics configuration is deleted.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"AnalyticsId\",\
-          \"documentation\":\"The identifier used to represent an analytics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketCorsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketEncryptionRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the server-side encryption configuration to delete.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketInventoryConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the inventory configuration to delete.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"InventoryId\",\
-          \"documentation\":\"The ID used to identify the inventory configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketLifecycleRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketMetricsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the metrics configuration to delete.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"MetricsId\",\
-          \"documentation\":\"The ID used to identify the metrics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketPolicyRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketReplicationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteBucketWebsiteRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"DeleteMarker\":{\"type\":\"boolean\"},\
-    \"DeleteMarkerEntry\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Owner\":{\"shape\":\"Owner\"},\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"The object key.\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version ID of an object.\"\
-        },\
-        \"IsLatest\":{\
-          \"shape\":\"IsLatest\",\
-          \"documentation\":\"Specifies whether the object is (true) or is not (false) the latest version of an object.\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Date and time the object was last modified.\"\
-        }\
-      }\
-    },\
-    \"DeleteMarkerVersionId\":{\"type\":\"string\"},\
-    \"DeleteMarkers\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"DeleteMarkerEntry\"},\
-      \"flattened\":true\
-    },\
-    \"DeleteObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"DeleteMarker\":{\
-          \"shape\":\"DeleteMarker\",\
-          \"documentation\":\"Specifies whether the versioned object that was permanently deleted was (true) or was not (false) a delete marker.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-delete-marker\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Returns the version ID of the delete marker created as a result of the DELETE operation.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"DeleteObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"MFA\":{\
-          \"shape\":\"MFA\",\
-          \"documentation\":\"The concatenation of the authentication device's serial number, a space, and the value that is displayed on your authentication device.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-mfa\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId used to reference a specific version of the object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"DeleteObjectTaggingOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"The versionId of the object the tag-set was removed from.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        }\
-      }\
-    },\
-    \"DeleteObjectTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"The versionId of the object that the tag-set will be removed from.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        }\
-      }\
-    },\
-    \"DeleteObjectsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Deleted\":{\"shape\":\"DeletedObjects\"},\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        },\
-        \"Errors\":{\
-          \"shape\":\"Errors\",\
-          \"locationName\":\"Error\"\
-        }\
-      }\
-    },\
-    \"DeleteObjectsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Delete\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Delete\":{\
-          \"shape\":\"Delete\",\
-          \"locationName\":\"Delete\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"MFA\":{\
-          \"shape\":\"MFA\",\
-          \"documentation\":\"The concatenation of the authentication device's serial number, a space, and the value that is displayed on your authentication device.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-mfa\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      },\
-      \"payload\":\"Delete\"\
-    },\
-    \"DeletedObject\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Key\":{\"shape\":\"ObjectKey\"},\
-        \"VersionId\":{\"shape\":\"ObjectVersionId\"},\
-        \"DeleteMarker\":{\"shape\":\"DeleteMarker\"},\
-        \"DeleteMarkerVersionId\":{\"shape\":\"DeleteMarkerVersionId\"}\
-      }\
-    },\
-    \"DeletedObjects\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"DeletedObject\"},\
-      \"flattened\":true\
-    },\
-    \"Delimiter\":{\"type\":\"string\"},\
-    \"Description\":{\"type\":\"string\"},\
-    \"Destination\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Amazon resource name (ARN) of the bucket where you want Amazon S3 to store replicas of the object identified by the rule.\"\
-        },\
-        \"Account\":{\
-          \"shape\":\"AccountId\",\
-          \"documentation\":\"Account ID of the destination bucket. Currently this is only being verified if Access Control Translation is enabled\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        },\
-        \"AccessControlTranslation\":{\
-          \"shape\":\"AccessControlTranslation\",\
-          \"documentation\":\"Container for information regarding the access control for replicas.\"\
-        },\
-        \"EncryptionConfiguration\":{\
-          \"shape\":\"EncryptionConfiguration\",\
-          \"documentation\":\"Container for information regarding encryption based configuration for replicas.\"\
-        }\
-      },\
-      \"documentation\":\"Container for replication destination information.\"\
-    },\
-    \"DisplayName\":{\"type\":\"string\"},\
-    \"ETag\":{\"type\":\"string\"},\
-    \"EmailAddress\":{\"type\":\"string\"},\
-    \"EnableRequestProgress\":{\"type\":\"boolean\"},\
-    \"EncodingType\":{\
-      \"type\":\"string\",\
-      \"documentation\":\"Requests Amazon S3 to encode the object keys in the response and specifies the encoding method to use. An object key may contain any Unicode character; however, XML 1.0 parser cannot parse some characters, such as characters with an ASCII value from 0 to 10. For characters that are not supported in XML 1.0, you can add this parameter to request that Amazon S3 encode the keys in the response.\",\
-      \"enum\":[\"url\"]\
-    },\
-    \"Encryption\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"EncryptionType\"],\
-      \"members\":{\
-        \"EncryptionType\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The server-side encryption algorithm used when storing job results in Amazon S3 (e.g., AES256, aws:kms).\"\
-        },\
-        \"KMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If the encryption type is aws:kms, this optional value specifies the AWS KMS key ID to use for encryption of job results.\"\
-        },\
-        \"KMSContext\":{\
-          \"shape\":\"KMSContext\",\
-          \"documentation\":\"If the encryption type is aws:kms, this optional value can be used to specify the encryption context for the restore results.\"\
-        }\
-      },\
-      \"documentation\":\"Describes the server-side encryption that will be applied to the restore results.\"\
-    },\
-    \"EncryptionConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ReplicaKmsKeyID\":{\
-          \"shape\":\"ReplicaKmsKeyID\",\
-          \"documentation\":\"The id of the KMS key used to encrypt the replica object.\"\
-        }\
-      },\
-      \"documentation\":\"Container for information regarding encryption based configuration for replicas.\"\
-    },\
-    \"EndEvent\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"event\":true\
-    },\
-    \"Error\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Key\":{\"shape\":\"ObjectKey\"},\
-        \"VersionId\":{\"shape\":\"ObjectVersionId\"},\
-        \"Code\":{\"shape\":\"Code\"},\
-        \"Message\":{\"shape\":\"Message\"}\
-      }\
-    },\
-    \"ErrorDocument\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Key\"],\
-      \"members\":{\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"The object key name to use when a 4XX class error occurs.\"\
-        }\
-      }\
-    },\
-    \"Errors\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Error\"},\
-      \"flattened\":true\
-    },\
-    \"Event\":{\
-      \"type\":\"string\",\
-      \"documentation\":\"Bucket event for which to send notifications.\",\
-      \"enum\":[\
-        \"s3:ReducedRedundancyLostObject\",\
-        \"s3:ObjectCreated:*\",\
-        \"s3:ObjectCreated:Put\",\
-        \"s3:ObjectCreated:Post\",\
-        \"s3:ObjectCreated:Copy\",\
-        \"s3:ObjectCreated:CompleteMultipartUpload\",\
-        \"s3:ObjectRemoved:*\",\
-        \"s3:ObjectRemoved:Delete\",\
-        \"s3:ObjectRemoved:DeleteMarkerCreated\"\
-      ]\
-    },\
-    \"EventList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Event\"},\
-      \"flattened\":true\
-    },\
-    \"Expiration\":{\"type\":\"string\"},\
-    \"ExpirationStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Disabled\"\
-      ]\
-    },\
-    \"ExpiredObjectDeleteMarker\":{\"type\":\"boolean\"},\
-    \"Expires\":{\"type\":\"timestamp\"},\
-    \"ExposeHeader\":{\"type\":\"string\"},\
-    \"ExposeHeaders\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"ExposeHeader\"},\
-      \"flattened\":true\
-    },\
-    \"Expression\":{\"type\":\"string\"},\
-    \"ExpressionType\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"SQL\"]\
-    },\
-    \"FetchOwner\":{\"type\":\"boolean\"},\
-    \"FieldDelimiter\":{\"type\":\"string\"},\
-    \"FileHeaderInfo\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"USE\",\
-        \"IGNORE\",\
-        \"NONE\"\
-      ]\
-    },\
-    \"FilterRule\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Name\":{\
-          \"shape\":\"FilterRuleName\",\
-          \"documentation\":\"Object key name prefix or suffix identifying one or more objects to which the filtering rule applies. Maximum prefix length can be up to 1,024 characters. Overlapping prefixes and suffixes are not supported. For more information, go to <a href=\\\"http://docs.aws.amazon.com/AmazonS3/latest/dev/NotificationHowTo.html\\\">Configuring Event Notifications</a> in the Amazon Simple Storage Service Developer Guide.\"\
-        },\
-        \"Value\":{\"shape\":\"FilterRuleValue\"}\
-      },\
-      \"documentation\":\"Container for key value pair that defines the criteria for the filter rule.\"\
-    },\
-    \"FilterRuleList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"FilterRule\"},\
-      \"documentation\":\"A list of containers for key value pair that defines the criteria for the filter rule.\",\
-      \"flattened\":true\
-    },\
-    \"FilterRuleName\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"prefix\",\
-        \"suffix\"\
-      ]\
-    },\
-    \"FilterRuleValue\":{\"type\":\"string\"},\
-    \"GetBucketAccelerateConfigurationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Status\":{\
-          \"shape\":\"BucketAccelerateStatus\",\
-          \"documentation\":\"The accelerate configuration of the bucket.\"\
-        }\
-      }\
-    },\
-    \"GetBucketAccelerateConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket for which the accelerate configuration is retrieved.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketAclOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Owner\":{\"shape\":\"Owner\"},\
-        \"Grants\":{\
-          \"shape\":\"Grants\",\
-          \"documentation\":\"A list of grants.\",\
-          \"locationName\":\"AccessControlList\"\
-        }\
-      }\
-    },\
-    \"GetBucketAclRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketAnalyticsConfigurationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"AnalyticsConfiguration\":{\
-          \"shape\":\"AnalyticsConfiguration\",\
-          \"documentation\":\"The configuration and any analyses for the analytics filter.\"\
-        }\
-      },\
-      \"payload\":\"AnalyticsConfiguration\"\
-    },\
-    \"GetBucketAnalyticsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket from which an analytics configuration is retrieved.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"AnalyticsId\",\
-          \"documentation\":\"The identifier used to represent an analytics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"GetBucketCorsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"CORSRules\":{\
-          \"shape\":\"CORSRules\",\
-          \"locationName\":\"CORSRule\"\
-        }\
-      }\
-    },\
-    \"GetBucketCorsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketEncryptionOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ServerSideEncryptionConfiguration\":{\"shape\":\"ServerSideEncryptionConfiguration\"}\
-      },\
-      \"payload\":\"ServerSideEncryptionConfiguration\"\
-    },\
-    \"GetBucketEncryptionRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket from which the server-side encryption configuration is retrieved.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketInventoryConfigurationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"InventoryConfiguration\":{\
-          \"shape\":\"InventoryConfiguration\",\
-          \"documentation\":\"Specifies the inventory configuration.\"\
-        }\
-      },\
-      \"payload\":\"InventoryConfiguration\"\
-    },\
-    \"GetBucketInventoryConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the inventory configuration to retrieve.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"InventoryId\",\
-          \"documentation\":\"The ID used to identify the inventory configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"GetBucketLifecycleConfigurationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Rules\":{\
-          \"shape\":\"LifecycleRules\",\
-          \"locationName\":\"Rule\"\
-        }\
-      }\
-    },\
-    \"GetBucketLifecycleConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketLifecycleOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Rules\":{\
-          \"shape\":\"Rules\",\
-          \"locationName\":\"Rule\"\
-        }\
-      }\
-    },\
-    \"GetBucketLifecycleRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketLocationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"LocationConstraint\":{\"shape\":\"BucketLocationConstraint\"}\
-      }\
-    },\
-    \"GetBucketLocationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketLoggingOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"LoggingEnabled\":{\"shape\":\"LoggingEnabled\"}\
-      }\
-    },\
-    \"GetBucketLoggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketMetricsConfigurationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"MetricsConfiguration\":{\
-          \"shape\":\"MetricsConfiguration\",\
-          \"documentation\":\"Specifies the metrics configuration.\"\
-        }\
-      },\
-      \"payload\":\"MetricsConfiguration\"\
-    },\
-    \"GetBucketMetricsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the metrics configuration to retrieve.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"MetricsId\",\
-          \"documentation\":\"The ID used to identify the metrics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        }\
-      }\
-    },\
-    \"GetBucketNotificationConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to get the notification configuration for.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketPolicyOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Policy\":{\
-          \"shape\":\"Policy\",\
-          \"documentation\":\"The bucket policy as a JSON document.\"\
-        }\
-      },\
-      \"payload\":\"Policy\"\
-    },\
-    \"GetBucketPolicyRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketReplicationOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ReplicationConfiguration\":{\"shape\":\"ReplicationConfiguration\"}\
-      },\
-      \"payload\":\"ReplicationConfiguration\"\
-    },\
-    \"GetBucketReplicationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketRequestPaymentOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Payer\":{\
-          \"shape\":\"Payer\",\
-          \"documentation\":\"Specifies who pays for the download and request fees.\"\
-        }\
-      }\
-    },\
-    \"GetBucketRequestPaymentRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketTaggingOutput\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"TagSet\"],\
-      \"members\":{\
-        \"TagSet\":{\"shape\":\"TagSet\"}\
-      }\
-    },\
-    \"GetBucketTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketVersioningOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Status\":{\
-          \"shape\":\"BucketVersioningStatus\",\
-          \"documentation\":\"The versioning state of the bucket.\"\
-        },\
-        \"MFADelete\":{\
-          \"shape\":\"MFADeleteStatus\",\
-          \"documentation\":\"Specifies whether MFA delete is enabled in the bucket versioning configuration. This element is only returned if the bucket has been configured with MFA delete. If the bucket has never been so configured, this element is not returned.\",\
-          \"locationName\":\"MfaDelete\"\
-        }\
-      }\
-    },\
-    \"GetBucketVersioningRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetBucketWebsiteOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"RedirectAllRequestsTo\":{\"shape\":\"RedirectAllRequestsTo\"},\
-        \"IndexDocument\":{\"shape\":\"IndexDocument\"},\
-        \"ErrorDocument\":{\"shape\":\"ErrorDocument\"},\
-        \"RoutingRules\":{\"shape\":\"RoutingRules\"}\
-      }\
-    },\
-    \"GetBucketWebsiteRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"GetObjectAclOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Owner\":{\"shape\":\"Owner\"},\
-        \"Grants\":{\
-          \"shape\":\"Grants\",\
-          \"documentation\":\"A list of grants.\",\
-          \"locationName\":\"AccessControlList\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"GetObjectAclRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId used to reference a specific version of the object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"GetObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Body\":{\
-          \"shape\":\"Body\",\
-          \"documentation\":\"Object data.\",\
-          \"streaming\":true\
-        },\
-        \"DeleteMarker\":{\
-          \"shape\":\"DeleteMarker\",\
-          \"documentation\":\"Specifies whether the object retrieved was (true) or was not (false) a Delete Marker. If false, this response header does not appear in the response.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-delete-marker\"\
-        },\
-        \"AcceptRanges\":{\
-          \"shape\":\"AcceptRanges\",\
-          \"location\":\"header\",\
-          \"locationName\":\"accept-ranges\"\
-        },\
-        \"Expiration\":{\
-          \"shape\":\"Expiration\",\
-          \"documentation\":\"If the object expiration is configured (see PUT Bucket lifecycle), the response includes this header. It includes the expiry-date and rule-id key value pairs providing object expiration information. The value of the rule-id is URL encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-expiration\"\
-        },\
-        \"Restore\":{\
-          \"shape\":\"Restore\",\
-          \"documentation\":\"Provides information about object restoration operation and expiration time of the restored object copy.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-restore\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Last modified date of the object\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Last-Modified\"\
-        },\
-        \"ContentLength\":{\
-          \"shape\":\"ContentLength\",\
-          \"documentation\":\"Size of the body in bytes.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Length\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"An ETag is an opaque identifier assigned by a web server to a specific version of a resource found at a URL\",\
-          \"location\":\"header\",\
-          \"locationName\":\"ETag\"\
-        },\
-        \"MissingMeta\":{\
-          \"shape\":\"MissingMeta\",\
-          \"documentation\":\"This is set to the number of metadata entries not returned in x-amz-meta headers. This can happen if you create metadata using an API like SOAP that supports more flexible metadata than the REST API. For example, using SOAP, you can create metadata whose values are not legal HTTP headers.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-missing-meta\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version of the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"CacheControl\":{\
-          \"shape\":\"CacheControl\",\
-          \"documentation\":\"Specifies caching behavior along the request/reply chain.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Cache-Control\"\
-        },\
-        \"ContentDisposition\":{\
-          \"shape\":\"ContentDisposition\",\
-          \"documentation\":\"Specifies presentational information for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Disposition\"\
-        },\
-        \"ContentEncoding\":{\
-          \"shape\":\"ContentEncoding\",\
-          \"documentation\":\"Specifies what content encodings have been applied to the object and thus what decoding mechanisms must be applied to obtain the media-type referenced by the Content-Type header field.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Encoding\"\
-        },\
-        \"ContentLanguage\":{\
-          \"shape\":\"ContentLanguage\",\
-          \"documentation\":\"The language the content is in.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Language\"\
-        },\
-        \"ContentRange\":{\
-          \"shape\":\"ContentRange\",\
-          \"documentation\":\"The portion of the object returned in the response.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Range\"\
-        },\
-        \"ContentType\":{\
-          \"shape\":\"ContentType\",\
-          \"documentation\":\"A standard MIME type describing the format of the object data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Type\"\
-        },\
-        \"Expires\":{\
-          \"shape\":\"Expires\",\
-          \"documentation\":\"The date and time at which the object is no longer cacheable.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Expires\"\
-        },\
-        \"WebsiteRedirectLocation\":{\
-          \"shape\":\"WebsiteRedirectLocation\",\
-          \"documentation\":\"If the bucket is configured as a website, redirects requests for this object to another object in the same bucket or to an external URL. Amazon S3 stores the value of this header in the object metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-website-redirect-location\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"Metadata\":{\
-          \"shape\":\"Metadata\",\
-          \"documentation\":\"A map of metadata to store with the object in S3.\",\
-          \"location\":\"headers\",\
-          \"locationName\":\"x-amz-meta-\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-storage-class\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        },\
-        \"ReplicationStatus\":{\
-          \"shape\":\"ReplicationStatus\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-replication-status\"\
-        },\
-        \"PartsCount\":{\
-          \"shape\":\"PartsCount\",\
-          \"documentation\":\"The count of parts this object has.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-mp-parts-count\"\
-        },\
-        \"TagCount\":{\
-          \"shape\":\"TagCount\",\
-          \"documentation\":\"The number of tags, if any, on the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-tagging-count\"\
-        }\
-      },\
-      \"payload\":\"Body\"\
-    },\
-    \"GetObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"IfMatch\":{\
-          \"shape\":\"IfMatch\",\
-          \"documentation\":\"Return the object only if its entity tag (ETag) is the same as the one specified, otherwise return a 412 (precondition failed).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Match\"\
-        },\
-        \"IfModifiedSince\":{\
-          \"shape\":\"IfModifiedSince\",\
-          \"documentation\":\"Return the object only if it has been modified since the specified time, otherwise return a 304 (not modified).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Modified-Since\"\
-        },\
-        \"IfNoneMatch\":{\
-          \"shape\":\"IfNoneMatch\",\
-          \"documentation\":\"Return the object only if its entity tag (ETag) is different from the one specified, otherwise return a 304 (not modified).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-None-Match\"\
-        },\
-        \"IfUnmodifiedSince\":{\
-          \"shape\":\"IfUnmodifiedSince\",\
-          \"documentation\":\"Return the object only if it has not been modified since the specified time, otherwise return a 412 (precondition failed).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Unmodified-Since\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"Range\":{\
-          \"shape\":\"Range\",\
-          \"documentation\":\"Downloads the specified range bytes of an object. For more information about the HTTP Range header, go to http://www.w3.org/Protocols/rfc2616/rfc2616-sec14.html#sec14.35.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Range\"\
-        },\
-        \"ResponseCacheControl\":{\
-          \"shape\":\"ResponseCacheControl\",\
-          \"documentation\":\"Sets the Cache-Control header of the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-cache-control\"\
-        },\
-        \"ResponseContentDisposition\":{\
-          \"shape\":\"ResponseContentDisposition\",\
-          \"documentation\":\"Sets the Content-Disposition header of the response\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-content-disposition\"\
-        },\
-        \"ResponseContentEncoding\":{\
-          \"shape\":\"ResponseContentEncoding\",\
-          \"documentation\":\"Sets the Content-Encoding header of the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-content-encoding\"\
-        },\
-        \"ResponseContentLanguage\":{\
-          \"shape\":\"ResponseContentLanguage\",\
-          \"documentation\":\"Sets the Content-Language header of the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-content-language\"\
-        },\
-        \"ResponseContentType\":{\
-          \"shape\":\"ResponseContentType\",\
-          \"documentation\":\"Sets the Content-Type header of the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-content-type\"\
-        },\
-        \"ResponseExpires\":{\
-          \"shape\":\"ResponseExpires\",\
-          \"documentation\":\"Sets the Expires header of the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"response-expires\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId used to reference a specific version of the object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number of the object being read. This is a positive integer between 1 and 10,000. Effectively performs a 'ranged' GET request for the part specified. Useful for downloading just a part of an object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"partNumber\"\
-        }\
-      }\
-    },\
-    \"GetObjectTaggingOutput\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"TagSet\"],\
-      \"members\":{\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"TagSet\":{\"shape\":\"TagSet\"}\
-      }\
-    },\
-    \"GetObjectTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        }\
-      }\
-    },\
-    \"GetObjectTorrentOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Body\":{\
-          \"shape\":\"Body\",\
-          \"streaming\":true\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      },\
-      \"payload\":\"Body\"\
-    },\
-    \"GetObjectTorrentRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"GlacierJobParameters\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Tier\"],\
-      \"members\":{\
-        \"Tier\":{\
-          \"shape\":\"Tier\",\
-          \"documentation\":\"Glacier retrieval tier at which the restore will be processed.\"\
-        }\
-      }\
-    },\
-    \"Grant\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Grantee\":{\"shape\":\"Grantee\"},\
-        \"Permission\":{\
-          \"shape\":\"Permission\",\
-          \"documentation\":\"Specifies the permission given to the grantee.\"\
-        }\
-      }\
-    },\
-    \"GrantFullControl\":{\"type\":\"string\"},\
-    \"GrantRead\":{\"type\":\"string\"},\
-    \"GrantReadACP\":{\"type\":\"string\"},\
-    \"GrantWrite\":{\"type\":\"string\"},\
-    \"GrantWriteACP\":{\"type\":\"string\"},\
-    \"Grantee\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Type\"],\
-      \"members\":{\
-        \"DisplayName\":{\
-          \"shape\":\"DisplayName\",\
-          \"documentation\":\"Screen name of the grantee.\"\
-        },\
-        \"EmailAddress\":{\
-          \"shape\":\"EmailAddress\",\
-          \"documentation\":\"Email address of the grantee.\"\
-        },\
-        \"ID\":{\
-          \"shape\":\"ID\",\
-          \"documentation\":\"The canonical user ID of the grantee.\"\
-        },\
-        \"Type\":{\
-          \"shape\":\"Type\",\
-          \"documentation\":\"Type of grantee\",\
-          \"locationName\":\"xsi:type\",\
-          \"xmlAttribute\":true\
-        },\
-        \"URI\":{\
-          \"shape\":\"URI\",\
-          \"documentation\":\"URI of the grantee group.\"\
-        }\
-      },\
-      \"xmlNamespace\":{\
-        \"prefix\":\"xsi\",\
-        \"uri\":\"http://www.w3.org/2001/XMLSchema-instance\"\
-      }\
-    },\
-    \"Grants\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"Grant\",\
-        \"locationName\":\"Grant\"\
-      }\
-    },\
-    \"HeadBucketRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        }\
-      }\
-    },\
-    \"HeadObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"DeleteMarker\":{\
-          \"shape\":\"DeleteMarker\",\
-          \"documentation\":\"Specifies whether the object retrieved was (true) or was not (false) a Delete Marker. If false, this response header does not appear in the response.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-delete-marker\"\
-        },\
-        \"AcceptRanges\":{\
-          \"shape\":\"AcceptRanges\",\
-          \"location\":\"header\",\
-          \"locationName\":\"accept-ranges\"\
-        },\
-        \"Expiration\":{\
-          \"shape\":\"Expiration\",\
-          \"documentation\":\"If the object expiration is configured (see PUT Bucket lifecycle), the response includes this header. It includes the expiry-date and rule-id key value pairs providing object expiration information. The value of the rule-id is URL encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-expiration\"\
-        },\
-        \"Restore\":{\
-          \"shape\":\"Restore\",\
-          \"documentation\":\"Provides information about object restoration operation and expiration time of the restored object copy.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-restore\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Last modified date of the object\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Last-Modified\"\
-        },\
-        \"ContentLength\":{\
-          \"shape\":\"ContentLength\",\
-          \"documentation\":\"Size of the body in bytes.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Length\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"An ETag is an opaque identifier assigned by a web server to a specific version of a resource found at a URL\",\
-          \"location\":\"header\",\
-          \"locationName\":\"ETag\"\
-        },\
-        \"MissingMeta\":{\
-          \"shape\":\"MissingMeta\",\
-          \"documentation\":\"This is set to the number of metadata entries not returned in x-amz-meta headers. This can happen if you create metadata using an API like SOAP that supports more flexible metadata than the REST API. For example, using SOAP, you can create metadata whose values are not legal HTTP headers.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-missing-meta\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version of the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"CacheControl\":{\
-          \"shape\":\"CacheControl\",\
-          \"documentation\":\"Specifies caching behavior along the request/reply chain.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Cache-Control\"\
-        },\
-        \"ContentDisposition\":{\
-          \"shape\":\"ContentDisposition\",\
-          \"documentation\":\"Specifies presentational information for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Disposition\"\
-        },\
-        \"ContentEncoding\":{\
-          \"shape\":\"ContentEncoding\",\
-          \"documentation\":\"Specifies what content encodings have been applied to the object and thus what decoding mechanisms must be applied to obtain the media-type referenced by the Content-Type header field.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Encoding\"\
-        },\
-        \"ContentLanguage\":{\
-          \"shape\":\"ContentLanguage\",\
-          \"documentation\":\"The language the content is in.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Language\"\
-        },\
-        \"ContentType\":{\
-          \"shape\":\"ContentType\",\
-          \"documentation\":\"A standard MIME type describing the format of the object data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Type\"\
-        },\
-        \"Expires\":{\
-          \"shape\":\"Expires\",\
-          \"documentation\":\"The date and time at which the object is no longer cacheable.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Expires\"\
-        },\
-        \"WebsiteRedirectLocation\":{\
-          \"shape\":\"WebsiteRedirectLocation\",\
-          \"documentation\":\"If the bucket is configured as a website, redirects requests for this object to another object in the same bucket or to an external URL. Amazon S3 stores the value of this header in the object metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-website-redirect-location\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"Metadata\":{\
-          \"shape\":\"Metadata\",\
-          \"documentation\":\"A map of metadata to store with the object in S3.\",\
-          \"location\":\"headers\",\
-          \"locationName\":\"x-amz-meta-\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-storage-class\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        },\
-        \"ReplicationStatus\":{\
-          \"shape\":\"ReplicationStatus\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-replication-status\"\
-        },\
-        \"PartsCount\":{\
-          \"shape\":\"PartsCount\",\
-          \"documentation\":\"The count of parts this object has.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-mp-parts-count\"\
-        }\
-      }\
-    },\
-    \"HeadObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"IfMatch\":{\
-          \"shape\":\"IfMatch\",\
-          \"documentation\":\"Return the object only if its entity tag (ETag) is the same as the one specified, otherwise return a 412 (precondition failed).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Match\"\
-        },\
-        \"IfModifiedSince\":{\
-          \"shape\":\"IfModifiedSince\",\
-          \"documentation\":\"Return the object only if it has been modified since the specified time, otherwise return a 304 (not modified).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Modified-Since\"\
-        },\
-        \"IfNoneMatch\":{\
-          \"shape\":\"IfNoneMatch\",\
-          \"documentation\":\"Return the object only if its entity tag (ETag) is different from the one specified, otherwise return a 304 (not modified).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-None-Match\"\
-        },\
-        \"IfUnmodifiedSince\":{\
-          \"shape\":\"IfUnmodifiedSince\",\
-          \"documentation\":\"Return the object only if it has not been modified since the specified time, otherwise return a 412 (precondition failed).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"If-Unmodified-Since\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"Range\":{\
-          \"shape\":\"Range\",\
-          \"documentation\":\"Downloads the specified range bytes of an object. For more information about the HTTP Range header, go to http://www.w3.org/Protocols/rfc2616/rfc2616-sec14.html#sec14.35.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Range\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId used to reference a specific version of the object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number of the object being read. This is a positive integer between 1 and 10,000. Effectively performs a 'ranged' HEAD request for the part specified. Useful querying about the size of the part and the number of parts in this object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"partNumber\"\
-        }\
-      }\
-    },\
-    \"HostName\":{\"type\":\"string\"},\
-    \"HttpErrorCodeReturnedEquals\":{\"type\":\"string\"},\
-    \"HttpRedirectCode\":{\"type\":\"string\"},\
-    \"ID\":{\"type\":\"string\"},\
-    \"IfMatch\":{\"type\":\"string\"},\
-    \"IfModifiedSince\":{\"type\":\"timestamp\"},\
-    \"IfNoneMatch\":{\"type\":\"string\"},\
-    \"IfUnmodifiedSince\":{\"type\":\"timestamp\"},\
-    \"IndexDocument\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Suffix\"],\
-      \"members\":{\
-        \"Suffix\":{\
-          \"shape\":\"Suffix\",\
-          \"documentation\":\"A suffix that is appended to a request that is for a directory on the website endpoint (e.g. if the suffix is index.html and you make a request to samplebucket/images/ the data that is returned will be for the object with the key name images/index.html) The suffix must not be empty and must not include a slash character.\"\
-        }\
-      }\
-    },\
-    \"Initiated\":{\"type\":\"timestamp\"},\
-    \"Initiator\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ID\":{\
-          \"shape\":\"ID\",\
-          \"documentation\":\"If the principal is an AWS account, it provides the Canonical User ID. If the principal is an IAM User, it provides a user ARN value.\"\
-        },\
-        \"DisplayName\":{\
-          \"shape\":\"DisplayName\",\
-          \"documentation\":\"Name of the Principal.\"\
-        }\
-      }\
-    },\
-    \"InputSerialization\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"CSV\":{\
-          \"shape\":\"CSVInput\",\
-          \"documentation\":\"Describes the serialization of a CSV-encoded object.\"\
-        },\
-        \"CompressionType\":{\
-          \"shape\":\"CompressionType\",\
-          \"documentation\":\"Specifies object's compression format. Valid values: NONE, GZIP. Default Value: NONE.\"\
-        },\
-        \"JSON\":{\
-          \"shape\":\"JSONInput\",\
-          \"documentation\":\"Specifies JSON as object's input serialization format.\"\
-        }\
-      },\
-      \"documentation\":\"Describes the serialization format of the object.\"\
-    },\
-    \"InventoryConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Destination\",\
-        \"IsEnabled\",\
-        \"Id\",\
-        \"IncludedObjectVersions\",\
-        \"Schedule\"\
-      ],\
-      \"members\":{\
-        \"Destination\":{\
-          \"shape\":\"InventoryDestination\",\
-          \"documentation\":\"Contains information about where to publish the inventory results.\"\
-        },\
-        \"IsEnabled\":{\
-          \"shape\":\"IsEnabled\",\
-          \"documentation\":\"Specifies whether the inventory is enabled or disabled.\"\
-        },\
-        \"Filter\":{\
-          \"shape\":\"InventoryFilter\",\
-          \"documentation\":\"Specifies an inventory filter. The inventory only includes objects that meet the filter's criteria.\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"InventoryId\",\
-          \"documentation\":\"The ID used to identify the inventory configuration.\"\
-        },\
-        \"IncludedObjectVersions\":{\
-          \"shape\":\"InventoryIncludedObjectVersions\",\
-          \"documentation\":\"Specifies which object version(s) to included in the inventory results.\"\
-        },\
-        \"OptionalFields\":{\
-          \"shape\":\"InventoryOptionalFields\",\
-          \"documentation\":\"Contains the optional fields that are included in the inventory results.\"\
-        },\
-        \"Schedule\":{\
-          \"shape\":\"InventorySchedule\",\
-          \"documentation\":\"Specifies the schedule for generating inventory results.\"\
-        }\
-      }\
-    },\
-    \"InventoryConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"InventoryConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"InventoryDestination\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"S3BucketDestination\"],\
-      \"members\":{\
-        \"S3BucketDestination\":{\
-          \"shape\":\"InventoryS3BucketDestination\",\
-          \"documentation\":\"Contains the bucket name, file format, bucket owner (optional), and prefix (optional) where inventory results are published.\"\
-        }\
-      }\
-    },\
-    \"InventoryEncryption\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"SSES3\":{\
-          \"shape\":\"SSES3\",\
-          \"documentation\":\"Specifies the use of SSE-S3 to encrypt delievered Inventory reports.\",\
-          \"locationName\":\"SSE-S3\"\
-        },\
-        \"SSEKMS\":{\
-          \"shape\":\"SSEKMS\",\
-          \"documentation\":\"Specifies the use of SSE-KMS to encrypt delievered Inventory reports.\",\
-          \"locationName\":\"SSE-KMS\"\
-        }\
-      },\
-      \"documentation\":\"Contains the type of server-side encryption used to encrypt the inventory results.\"\
-    },\
-    \"InventoryFilter\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Prefix\"],\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix that an object must have to be included in the inventory results.\"\
-        }\
-      }\
-    },\
-    \"InventoryFormat\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"CSV\",\
-        \"ORC\"\
-      ]\
-    },\
-    \"InventoryFrequency\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Daily\",\
-        \"Weekly\"\
-      ]\
-    },\
-    \"InventoryId\":{\"type\":\"string\"},\
-    \"InventoryIncludedObjectVersions\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"All\",\
-        \"Current\"\
-      ]\
-    },\
-    \"InventoryOptionalField\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Size\",\
-        \"LastModifiedDate\",\
-        \"StorageClass\",\
-        \"ETag\",\
-        \"IsMultipartUploaded\",\
-        \"ReplicationStatus\",\
-        \"EncryptionStatus\"\
-      ]\
-    },\
-    \"InventoryOptionalFields\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"InventoryOptionalField\",\
-        \"locationName\":\"Field\"\
-      }\
-    },\
-    \"InventoryS3BucketDestination\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Format\"\
-      ],\
-      \"members\":{\
-        \"AccountId\":{\
-          \"shape\":\"AccountId\",\
-          \"documentation\":\"The ID of the account that owns the destination bucket.\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The Amazon resource name (ARN) of the bucket where inventory results will be published.\"\
-        },\
-        \"Format\":{\
-          \"shape\":\"InventoryFormat\",\
-          \"documentation\":\"Specifies the output format of the inventory results.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix that is prepended to all inventory results.\"\
-        },\
-        \"Encryption\":{\
-          \"shape\":\"InventoryEncryption\",\
-          \"documentation\":\"Contains the type of server-side encryption used to encrypt the inventory results.\"\
-        }\
-      }\
-    },\
-    \"InventorySchedule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Frequency\"],\
-      \"members\":{\
-        \"Frequency\":{\
-          \"shape\":\"InventoryFrequency\",\
-          \"documentation\":\"Specifies how frequently inventory results are produced.\"\
-        }\
-      }\
-    },\
-    \"IsEnabled\":{\"type\":\"boolean\"},\
-    \"IsLatest\":{\"type\":\"boolean\"},\
-    \"IsTruncated\":{\"type\":\"boolean\"},\
-    \"JSONInput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Type\":{\
-          \"shape\":\"JSONType\",\
-          \"documentation\":\"The type of JSON. Valid values: Document, Lines.\"\
-        }\
-      }\
-    },\
-    \"JSONOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"RecordDelimiter\":{\
-          \"shape\":\"RecordDelimiter\",\
-          \"documentation\":\"The value used to separate individual records in the output.\"\
-        }\
-      }\
-    },\
-    \"JSONType\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"DOCUMENT\",\
-        \"LINES\"\
-      ]\
-    },\
-    \"KMSContext\":{\"type\":\"string\"},\
-    \"KeyCount\":{\"type\":\"integer\"},\
-    \"KeyMarker\":{\"type\":\"string\"},\
-    \"KeyPrefixEquals\":{\"type\":\"string\"},\
-    \"LambdaFunctionArn\":{\"type\":\"string\"},\
-    \"LambdaFunctionConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"LambdaFunctionArn\",\
-        \"Events\"\
-      ],\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"LambdaFunctionArn\":{\
-          \"shape\":\"LambdaFunctionArn\",\
-          \"documentation\":\"Lambda cloud function ARN that Amazon S3 can invoke when it detects events of the specified type.\",\
-          \"locationName\":\"CloudFunction\"\
-        },\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"Filter\":{\"shape\":\"NotificationConfigurationFilter\"}\
-      },\
-      \"documentation\":\"Container for specifying the AWS Lambda notification configuration.\"\
-    },\
-    \"LambdaFunctionConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"LambdaFunctionConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"LastModified\":{\"type\":\"timestamp\"},\
-    \"LifecycleConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Rules\"],\
-      \"members\":{\
-        \"Rules\":{\
-          \"shape\":\"Rules\",\
-          \"locationName\":\"Rule\"\
-        }\
-      }\
-    },\
-    \"LifecycleExpiration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Date\":{\
-          \"shape\":\"Date\",\
-          \"documentation\":\"Indicates at what date the object is to be moved or deleted. Should be in GMT ISO 8601 Format.\"\
-        },\
-        \"Days\":{\
-          \"shape\":\"Days\",\
-          \"documentation\":\"Indicates the lifetime, in days, of the objects that are subject to the rule. The value must be a non-zero positive integer.\"\
-        },\
-        \"ExpiredObjectDeleteMarker\":{\
-          \"shape\":\"ExpiredObjectDeleteMarker\",\
-          \"documentation\":\"Indicates whether Amazon S3 will remove a delete marker with no noncurrent versions. If set to true, the delete marker will be expired; if set to false the policy takes no action. This cannot be specified with Days or Date in a Lifecycle Expiration Policy.\"\
-        }\
-      }\
-    },\
-    \"LifecycleRule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Status\"],\
-      \"members\":{\
-        \"Expiration\":{\"shape\":\"LifecycleExpiration\"},\
-        \"ID\":{\
-          \"shape\":\"ID\",\
-          \"documentation\":\"Unique identifier for the rule. The value cannot be longer than 255 characters.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Prefix identifying one or more objects to which the rule applies. This is deprecated; use Filter instead.\",\
-          \"deprecated\":true\
-        },\
-        \"Filter\":{\"shape\":\"LifecycleRuleFilter\"},\
-        \"Status\":{\
-          \"shape\":\"ExpirationStatus\",\
-          \"documentation\":\"If 'Enabled', the rule is currently being applied. If 'Disabled', the rule is not currently being applied.\"\
-        },\
-        \"Transitions\":{\
-          \"shape\":\"TransitionList\",\
-          \"locationName\":\"Transition\"\
-        },\
-        \"NoncurrentVersionTransitions\":{\
-          \"shape\":\"NoncurrentVersionTransitionList\",\
-          \"locationName\":\"NoncurrentVersionTransition\"\
-        },\
-        \"NoncurrentVersionExpiration\":{\"shape\":\"NoncurrentVersionExpiration\"},\
-        \"AbortIncompleteMultipartUpload\":{\"shape\":\"AbortIncompleteMultipartUpload\"}\
-      }\
-    },\
-    \"LifecycleRuleAndOperator\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\"shape\":\"Prefix\"},\
-        \"Tags\":{\
-          \"shape\":\"TagSet\",\
-          \"documentation\":\"All of these tags must exist in the object's tag set in order for the rule to apply.\",\
-          \"flattened\":true,\
-          \"locationName\":\"Tag\"\
-        }\
-      },\
-      \"documentation\":\"This is used in a Lifecycle Rule Filter to apply a logical AND to two or more predicates. The Lifecycle Rule will apply to any object matching all of the predicates configured inside the And operator.\"\
-    },\
-    \"LifecycleRuleFilter\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Prefix identifying one or more objects to which the rule applies.\"\
-        },\
-        \"Tag\":{\
-          \"shape\":\"Tag\",\
-          \"documentation\":\"This tag must exist in the object's tag set in order for the rule to apply.\"\
-        },\
-        \"And\":{\"shape\":\"LifecycleRuleAndOperator\"}\
-      },\
-      \"documentation\":\"The Filter is used to identify objects that a Lifecycle Rule applies to. A Filter must have exactly one of Prefix, Tag, or And specified.\"\
-    },\
-    \"LifecycleRules\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"LifecycleRule\"},\
-      \"flattened\":true\
-    },\
-    \"ListBucketAnalyticsConfigurationsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"Indicates whether the returned list of analytics configurations is complete. A value of true indicates that the list is not complete and the NextContinuationToken will be provided for a subsequent request.\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"The ContinuationToken that represents where this request began.\"\
-        },\
-        \"NextContinuationToken\":{\
-          \"shape\":\"NextToken\",\
-          \"documentation\":\"NextContinuationToken is sent when isTruncated is true, which indicates that there are more analytics configurations to list. The next request must include this NextContinuationToken. The token is obfuscated and is not a usable value.\"\
-        },\
-        \"AnalyticsConfigurationList\":{\
-          \"shape\":\"AnalyticsConfigurationList\",\
-          \"documentation\":\"The list of analytics configurations for a bucket.\",\
-          \"locationName\":\"AnalyticsConfiguration\"\
-        }\
-      }\
-    },\
-    \"ListBucketAnalyticsConfigurationsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket from which analytics configurations are retrieved.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"The ContinuationToken that represents a placeholder from where this request should begin.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"continuation-token\"\
-        }\
-      }\
-    },\
-    \"ListBucketInventoryConfigurationsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"If sent in the request, the marker that is used as a starting point for this inventory configuration list response.\"\
-        },\
-        \"InventoryConfigurationList\":{\
-          \"shape\":\"InventoryConfigurationList\",\
-          \"documentation\":\"The list of inventory configurations for a bucket.\",\
-          \"locationName\":\"InventoryConfiguration\"\
-        },\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"Indicates whether the returned list of inventory configurations is truncated in this response. A value of true indicates that the list is truncated.\"\
-        },\
-        \"NextContinuationToken\":{\
-          \"shape\":\"NextToken\",\
-          \"documentation\":\"The marker used to continue this inventory configuration listing. Use the NextContinuationToken from this response to continue the listing in a subsequent request. The continuation token is an opaque value that Amazon S3 understands.\"\
-        }\
-      }\
-    },\
-    \"ListBucketInventoryConfigurationsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the inventory configurations to retrieve.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"The marker used to continue an inventory configuration listing that has been truncated. Use the NextContinuationToken from a previously truncated list response to continue the listing. The continuation token is an opaque value that Amazon S3 understands.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"continuation-token\"\
-        }\
-      }\
-    },\
-    \"ListBucketMetricsConfigurationsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"Indicates whether the returned list of metrics configurations is complete. A value of true indicates that the list is not complete and the NextContinuationToken will be provided for a subsequent request.\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"The marker that is used as a starting point for this metrics configuration list response. This value is present if it was sent in the request.\"\
-        },\
-        \"NextContinuationToken\":{\
-          \"shape\":\"NextToken\",\
-          \"documentation\":\"The marker used to continue a metrics configuration listing that has been truncated. Use the NextContinuationToken from a previously truncated list response to continue the listing. The continuation token is an opaque value that Amazon S3 understands.\"\
-        },\
-        \"MetricsConfigurationList\":{\
-          \"shape\":\"MetricsConfigurationList\",\
-          \"documentation\":\"The list of metrics configurations for a bucket.\",\
-          \"locationName\":\"MetricsConfiguration\"\
-        }\
-      }\
-    },\
-    \"ListBucketMetricsConfigurationsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket containing the metrics configurations to retrieve.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"The marker that is used to continue a metrics configuration listing that has been truncated. Use the NextContinuationToken from a previously truncated list response to continue the listing. The continuation token is an opaque value that Amazon S3 understands.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"continuation-token\"\
-        }\
-      }\
-    },\
-    \"ListBucketsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Buckets\":{\"shape\":\"Buckets\"},\
-        \"Owner\":{\"shape\":\"Owner\"}\
-      }\
-    },\
-    \"ListMultipartUploadsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to which the multipart upload was initiated.\"\
-        },\
-        \"KeyMarker\":{\
-          \"shape\":\"KeyMarker\",\
-          \"documentation\":\"The key at or after which the listing began.\"\
-        },\
-        \"UploadIdMarker\":{\
-          \"shape\":\"UploadIdMarker\",\
-          \"documentation\":\"Upload ID after which listing began.\"\
-        },\
-        \"NextKeyMarker\":{\
-          \"shape\":\"NextKeyMarker\",\
-          \"documentation\":\"When a list is truncated, this element specifies the value that should be used for the key-marker request parameter in a subsequent request.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"When a prefix is provided in the request, this field contains the specified prefix. The result contains only keys starting with the specified prefix.\"\
-        },\
-        \"Delimiter\":{\"shape\":\"Delimiter\"},\
-        \"NextUploadIdMarker\":{\
-          \"shape\":\"NextUploadIdMarker\",\
-          \"documentation\":\"When a list is truncated, this element specifies the value that should be used for the upload-id-marker request parameter in a subsequent request.\"\
-        },\
-        \"MaxUploads\":{\
-          \"shape\":\"MaxUploads\",\
-          \"documentation\":\"Maximum number of multipart uploads that could have been included in the response.\"\
-        },\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"Indicates whether the returned list of multipart uploads is truncated. A value of true indicates that the list was truncated. The list can be truncated if the number of multipart uploads exceeds the limit allowed or specified by max uploads.\"\
-        },\
-        \"Uploads\":{\
-          \"shape\":\"MultipartUploadList\",\
-          \"locationName\":\"Upload\"\
-        },\
-        \"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"documentation\":\"Encoding type used by Amazon S3 to encode object keys in the response.\"\
-        }\
-      }\
-    },\
-    \"ListMultipartUploadsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Delimiter\":{\
-          \"shape\":\"Delimiter\",\
-          \"documentation\":\"Character you use to group keys.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"delimiter\"\
-        },\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"encoding-type\"\
-        },\
-        \"KeyMarker\":{\
-          \"shape\":\"KeyMarker\",\
-          \"documentation\":\"Together with upload-id-marker, this parameter specifies the multipart upload after which listing should begin.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"key-marker\"\
-        },\
-        \"MaxUploads\":{\
-          \"shape\":\"MaxUploads\",\
-          \"documentation\":\"Sets the maximum number of multipart uploads, from 1 to 1,000, to return in the response body. 1,000 is the maximum number of uploads that can be returned in a response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"max-uploads\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Lists in-progress uploads only for those keys that begin with the specified prefix.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"prefix\"\
-        },\
-        \"UploadIdMarker\":{\
-          \"shape\":\"UploadIdMarker\",\
-          \"documentation\":\"Together with key-marker, specifies the multipart upload after which listing should begin. If key-marker is not specified, the upload-id-marker parameter is ignored.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"upload-id-marker\"\
-        }\
-      }\
-    },\
-    \"ListObjectVersionsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"A flag that indicates whether or not Amazon S3 returned all of the results that satisfied the search criteria. If your results were truncated, you can make a follow-up paginated request using the NextKeyMarker and NextVersionIdMarker response parameters as a starting place in another request to return the rest of the results.\"\
-        },\
-        \"KeyMarker\":{\
-          \"shape\":\"KeyMarker\",\
-          \"documentation\":\"Marks the last Key returned in a truncated response.\"\
-        },\
-        \"VersionIdMarker\":{\"shape\":\"VersionIdMarker\"},\
-        \"NextKeyMarker\":{\
-          \"shape\":\"NextKeyMarker\",\
-          \"documentation\":\"Use this value for the key marker request parameter in a subsequent request.\"\
-        },\
-        \"NextVersionIdMarker\":{\
-          \"shape\":\"NextVersionIdMarker\",\
-          \"documentation\":\"Use this value for the next version id marker parameter in a subsequent request.\"\
-        },\
-        \"Versions\":{\
-          \"shape\":\"ObjectVersionList\",\
-          \"locationName\":\"Version\"\
-        },\
-        \"DeleteMarkers\":{\
-          \"shape\":\"DeleteMarkers\",\
-          \"locationName\":\"DeleteMarker\"\
-        },\
-        \"Name\":{\"shape\":\"BucketName\"},\
-        \"Prefix\":{\"shape\":\"Prefix\"},\
-        \"Delimiter\":{\"shape\":\"Delimiter\"},\
-        \"MaxKeys\":{\"shape\":\"MaxKeys\"},\
-        \"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"documentation\":\"Encoding type used by Amazon S3 to encode object keys in the response.\"\
-        }\
-      }\
-    },\
-    \"ListObjectVersionsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Delimiter\":{\
-          \"shape\":\"Delimiter\",\
-          \"documentation\":\"A delimiter is a character you use to group keys.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"delimiter\"\
-        },\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"encoding-type\"\
-        },\
-        \"KeyMarker\":{\
-          \"shape\":\"KeyMarker\",\
-          \"documentation\":\"Specifies the key to start with when listing objects in a bucket.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"key-marker\"\
-        },\
-        \"MaxKeys\":{\
-          \"shape\":\"MaxKeys\",\
-          \"documentation\":\"Sets the maximum number of keys returned in the response. The response might contain fewer keys but will never contain more.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"max-keys\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Limits the response to keys that begin with the specified prefix.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"prefix\"\
-        },\
-        \"VersionIdMarker\":{\
-          \"shape\":\"VersionIdMarker\",\
-          \"documentation\":\"Specifies the object version you want to start listing from.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"version-id-marker\"\
-        }\
-      }\
-    },\
-    \"ListObjectsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"A flag that indicates whether or not Amazon S3 returned all of the results that satisfied the search criteria.\"\
-        },\
-        \"Marker\":{\"shape\":\"Marker\"},\
-        \"NextMarker\":{\
-          \"shape\":\"NextMarker\",\
-          \"documentation\":\"When response is truncated (the IsTruncated element value in the response is true), you can use the key name in this field as marker in the subsequent request to get next set of objects. Amazon S3 lists objects in alphabetical order Note: This element is returned only if you have delimiter request parameter specified. If response does not include the NextMaker and it is truncated, you can use the value of the last Key in the response as the marker in the subsequent request to get the next set of object keys.\"\
-        },\
-        \"Contents\":{\"shape\":\"ObjectList\"},\
-        \"Name\":{\"shape\":\"BucketName\"},\
-        \"Prefix\":{\"shape\":\"Prefix\"},\
-        \"Delimiter\":{\"shape\":\"Delimiter\"},\
-        \"MaxKeys\":{\"shape\":\"MaxKeys\"},\
-        \"CommonPrefixes\":{\"shape\":\"CommonPrefixList\"},\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"documentation\":\"Encoding type used by Amazon S3 to encode object keys in the response.\"\
-        }\
-      }\
-    },\
-    \"ListObjectsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Delimiter\":{\
-          \"shape\":\"Delimiter\",\
-          \"documentation\":\"A delimiter is a character you use to group keys.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"delimiter\"\
-        },\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"encoding-type\"\
-        },\
-        \"Marker\":{\
-          \"shape\":\"Marker\",\
-          \"documentation\":\"Specifies the key to start with when listing objects in a bucket.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"marker\"\
-        },\
-        \"MaxKeys\":{\
-          \"shape\":\"MaxKeys\",\
-          \"documentation\":\"Sets the maximum number of keys returned in the response. The response might contain fewer keys but will never contain more.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"max-keys\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Limits the response to keys that begin with the specified prefix.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"prefix\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"documentation\":\"Confirms that the requester knows that she or he will be charged for the list objects request. Bucket owners need not specify this parameter in their requests.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"ListObjectsV2Output\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"A flag that indicates whether or not Amazon S3 returned all of the results that satisfied the search criteria.\"\
-        },\
-        \"Contents\":{\
-          \"shape\":\"ObjectList\",\
-          \"documentation\":\"Metadata about each object returned.\"\
-        },\
-        \"Name\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to list.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Limits the response to keys that begin with the specified prefix.\"\
-        },\
-        \"Delimiter\":{\
-          \"shape\":\"Delimiter\",\
-          \"documentation\":\"A delimiter is a character you use to group keys.\"\
-        },\
-        \"MaxKeys\":{\
-          \"shape\":\"MaxKeys\",\
-          \"documentation\":\"Sets the maximum number of keys returned in the response. The response might contain fewer keys but will never contain more.\"\
-        },\
-        \"CommonPrefixes\":{\
-          \"shape\":\"CommonPrefixList\",\
-          \"documentation\":\"CommonPrefixes contains all (if there are any) keys between Prefix and the next occurrence of the string specified by delimiter\"\
-        },\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"documentation\":\"Encoding type used by Amazon S3 to encode object keys in the response.\"\
-        },\
-        \"KeyCount\":{\
-          \"shape\":\"KeyCount\",\
-          \"documentation\":\"KeyCount is the number of keys returned with this request. KeyCount will always be less than equals to MaxKeys field. Say you ask for 50 keys, your result will include less than equals 50 keys\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"ContinuationToken indicates Amazon S3 that the list is being continued on this bucket with a token. ContinuationToken is obfuscated and is not a real key\"\
-        },\
-        \"NextContinuationToken\":{\
-          \"shape\":\"NextToken\",\
-          \"documentation\":\"NextContinuationToken is sent when isTruncated is true which means there are more keys in the bucket that can be listed. The next list requests to Amazon S3 can be continued with this NextContinuationToken. NextContinuationToken is obfuscated and is not a real key\"\
-        },\
-        \"StartAfter\":{\
-          \"shape\":\"StartAfter\",\
-          \"documentation\":\"StartAfter is where you want Amazon S3 to start listing from. Amazon S3 starts listing after this specified key. StartAfter can be any key in the bucket\"\
-        }\
-      }\
-    },\
-    \"ListObjectsV2Request\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to list.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Delimiter\":{\
-          \"shape\":\"Delimiter\",\
-          \"documentation\":\"A delimiter is a character you use to group keys.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"delimiter\"\
-        },\
-        \"EncodingType\":{\
-          \"shape\":\"EncodingType\",\
-          \"documentation\":\"Encoding type used by Amazon S3 to encode object keys in the response.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"encoding-type\"\
-        },\
-        \"MaxKeys\":{\
-          \"shape\":\"MaxKeys\",\
-          \"documentation\":\"Sets the maximum number of keys returned in the response. The response might contain fewer keys but will never contain more.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"max-keys\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Limits the response to keys that begin with the specified prefix.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"prefix\"\
-        },\
-        \"ContinuationToken\":{\
-          \"shape\":\"Token\",\
-          \"documentation\":\"ContinuationToken indicates Amazon S3 that the list is being continued on this bucket with a token. ContinuationToken is obfuscated and is not a real key\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"continuation-token\"\
-        },\
-        \"FetchOwner\":{\
-          \"shape\":\"FetchOwner\",\
-          \"documentation\":\"The owner field is not present in listV2 by default, if you want to return owner field with each key in the result then set the fetch owner field to true\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"fetch-owner\"\
-        },\
-        \"StartAfter\":{\
-          \"shape\":\"StartAfter\",\
-          \"documentation\":\"StartAfter is where you want Amazon S3 to start listing from. Amazon S3 starts listing after this specified key. StartAfter can be any key in the bucket\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"start-after\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"documentation\":\"Confirms that the requester knows that she or he will be charged for the list objects request in V2 style. Bucket owners need not specify this parameter in their requests.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"ListPartsOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"AbortDate\":{\
-          \"shape\":\"AbortDate\",\
-          \"documentation\":\"Date when multipart upload will become eligible for abort operation by lifecycle.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-abort-date\"\
-        },\
-        \"AbortRuleId\":{\
-          \"shape\":\"AbortRuleId\",\
-          \"documentation\":\"Id of the lifecycle rule that makes a multipart upload eligible for abort operation.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-abort-rule-id\"\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to which the multipart upload was initiated.\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Object key for which the multipart upload was initiated.\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"Upload ID identifying the multipart upload whose parts are being listed.\"\
-        },\
-        \"PartNumberMarker\":{\
-          \"shape\":\"PartNumberMarker\",\
-          \"documentation\":\"Part number after which listing begins.\"\
-        },\
-        \"NextPartNumberMarker\":{\
-          \"shape\":\"NextPartNumberMarker\",\
-          \"documentation\":\"When a list is truncated, this element specifies the last part in the list, as well as the value to use for the part-number-marker request parameter in a subsequent request.\"\
-        },\
-        \"MaxParts\":{\
-          \"shape\":\"MaxParts\",\
-          \"documentation\":\"Maximum number of parts that were allowed in the response.\"\
-        },\
-        \"IsTruncated\":{\
-          \"shape\":\"IsTruncated\",\
-          \"documentation\":\"Indicates whether the returned list of parts is truncated.\"\
-        },\
-        \"Parts\":{\
-          \"shape\":\"Parts\",\
-          \"locationName\":\"Part\"\
-        },\
-        \"Initiator\":{\
-          \"shape\":\"Initiator\",\
-          \"documentation\":\"Identifies who initiated the multipart upload.\"\
-        },\
-        \"Owner\":{\"shape\":\"Owner\"},\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"ListPartsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"UploadId\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"MaxParts\":{\
-          \"shape\":\"MaxParts\",\
-          \"documentation\":\"Sets the maximum number of parts to return.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"max-parts\"\
-        },\
-        \"PartNumberMarker\":{\
-          \"shape\":\"PartNumberMarker\",\
-          \"documentation\":\"Specifies the part after which listing should begin. Only parts with higher part numbers will be listed.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"part-number-marker\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"Upload ID identifying the multipart upload whose parts are being listed.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"uploadId\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"Location\":{\"type\":\"string\"},\
-    \"LocationPrefix\":{\"type\":\"string\"},\
-    \"LoggingEnabled\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"TargetBucket\",\
-        \"TargetPrefix\"\
-      ],\
-      \"members\":{\
-        \"TargetBucket\":{\
-          \"shape\":\"TargetBucket\",\
-          \"documentation\":\"Specifies the bucket where you want Amazon S3 to store server access logs. You can have your logs delivered to any bucket that you own, including the same bucket that is being logged. You can also configure multiple buckets to deliver their logs to the same target bucket. In this case you should choose a different TargetPrefix for each source bucket so that the delivered log files can be distinguished by key.\"\
-        },\
-        \"TargetGrants\":{\"shape\":\"TargetGrants\"},\
-        \"TargetPrefix\":{\
-          \"shape\":\"TargetPrefix\",\
-          \"documentation\":\"This element lets you specify a prefix for the keys that the log files will be stored under.\"\
-        }\
-      },\
-      \"documentation\":\"Container for logging information. Presence of this element indicates that logging is enabled. Parameters TargetBucket and TargetPrefix are required in this case.\"\
-    },\
-    \"MFA\":{\"type\":\"string\"},\
-    \"MFADelete\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Disabled\"\
-      ]\
-    },\
-    \"MFADeleteStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Disabled\"\
-      ]\
-    },\
-    \"Marker\":{\"type\":\"string\"},\
-    \"MaxAgeSeconds\":{\"type\":\"integer\"},\
-    \"MaxKeys\":{\"type\":\"integer\"},\
-    \"MaxParts\":{\"type\":\"integer\"},\
-    \"MaxUploads\":{\"type\":\"integer\"},\
-    \"Message\":{\"type\":\"string\"},\
-    \"Metadata\":{\
-      \"type\":\"map\",\
-      \"key\":{\"shape\":\"MetadataKey\"},\
-      \"value\":{\"shape\":\"MetadataValue\"}\
-    },\
-    \"MetadataDirective\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"COPY\",\
-        \"REPLACE\"\
-      ]\
-    },\
-    \"MetadataEntry\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Name\":{\"shape\":\"MetadataKey\"},\
-        \"Value\":{\"shape\":\"MetadataValue\"}\
-      },\
-      \"documentation\":\"A metadata key-value pair to store with an object.\"\
-    },\
-    \"MetadataKey\":{\"type\":\"string\"},\
-    \"MetadataValue\":{\"type\":\"string\"},\
-    \"MetricsAndOperator\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix used when evaluating an AND predicate.\"\
-        },\
-        \"Tags\":{\
-          \"shape\":\"TagSet\",\
-          \"documentation\":\"The list of tags used when evaluating an AND predicate.\",\
-          \"flattened\":true,\
-          \"locationName\":\"Tag\"\
-        }\
-      }\
-    },\
-    \"MetricsConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Id\"],\
-      \"members\":{\
-        \"Id\":{\
-          \"shape\":\"MetricsId\",\
-          \"documentation\":\"The ID used to identify the metrics configuration.\"\
-        },\
-        \"Filter\":{\
-          \"shape\":\"MetricsFilter\",\
-          \"documentation\":\"Specifies a metrics configuration filter. The metrics configuration will only include objects that meet the filter's criteria. A filter must be a prefix, a tag, or a conjunction (MetricsAndOperator).\"\
-        }\
-      }\
-    },\
-    \"MetricsConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"MetricsConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"MetricsFilter\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"The prefix used when evaluating a metrics filter.\"\
-        },\
-        \"Tag\":{\
-          \"shape\":\"Tag\",\
-          \"documentation\":\"The tag used when evaluating a metrics filter.\"\
-        },\
-        \"And\":{\
-          \"shape\":\"MetricsAndOperator\",\
-          \"documentation\":\"A conjunction (logical AND) of predicates, which is used in evaluating a metrics filter. The operator must have at least two predicates, and an object must match all of the predicates in order for the filter to apply.\"\
-        }\
-      }\
-    },\
-    \"MetricsId\":{\"type\":\"string\"},\
-    \"MissingMeta\":{\"type\":\"integer\"},\
-    \"MultipartUpload\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"Upload ID that identifies the multipart upload.\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Key of the object for which the multipart upload was initiated.\"\
-        },\
-        \"Initiated\":{\
-          \"shape\":\"Initiated\",\
-          \"documentation\":\"Date and time at which the multipart upload was initiated.\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        },\
-        \"Owner\":{\"shape\":\"Owner\"},\
-        \"Initiator\":{\
-          \"shape\":\"Initiator\",\
-          \"documentation\":\"Identifies who initiated the multipart upload.\"\
-        }\
-      }\
-    },\
-    \"MultipartUploadId\":{\"type\":\"string\"},\
-    \"MultipartUploadList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"MultipartUpload\"},\
-      \"flattened\":true\
-    },\
-    \"NextKeyMarker\":{\"type\":\"string\"},\
-    \"NextMarker\":{\"type\":\"string\"},\
-    \"NextPartNumberMarker\":{\"type\":\"integer\"},\
-    \"NextToken\":{\"type\":\"string\"},\
-    \"NextUploadIdMarker\":{\"type\":\"string\"},\
-    \"NextVersionIdMarker\":{\"type\":\"string\"},\
-    \"NoSuchBucket\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"The specified bucket does not exist.\",\
-      \"exception\":true\
-    },\
-    \"NoSuchKey\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"The specified key does not exist.\",\
-      \"exception\":true\
-    },\
-    \"NoSuchUpload\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"The specified multipart upload does not exist.\",\
-      \"exception\":true\
-    },\
-    \"NoncurrentVersionExpiration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"NoncurrentDays\":{\
-          \"shape\":\"Days\",\
-          \"documentation\":\"Specifies the number of days an object is noncurrent before Amazon S3 can perform the associated action. For information about the noncurrent days calculations, see <a href=\\\"http://docs.aws.amazon.com/AmazonS3/latest/dev/s3-access-control.html\\\">How Amazon S3 Calculates When an Object Became Noncurrent</a> in the Amazon Simple Storage Service Developer Guide.\"\
-        }\
-      },\
-      \"documentation\":\"Specifies when noncurrent object versions expire. Upon expiration, Amazon S3 permanently deletes the noncurrent object versions. You set this lifecycle configuration action on a bucket that has versioning enabled (or suspended) to request that Amazon S3 delete noncurrent object versions at a specific period in the object's lifetime.\"\
-    },\
-    \"NoncurrentVersionTransition\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"NoncurrentDays\":{\
-          \"shape\":\"Days\",\
-          \"documentation\":\"Specifies the number of days an object is noncurrent before Amazon S3 can perform the associated action. For information about the noncurrent days calculations, see <a href=\\\"http://docs.aws.amazon.com/AmazonS3/latest/dev/s3-access-control.html\\\">How Amazon S3 Calculates When an Object Became Noncurrent</a> in the Amazon Simple Storage Service Developer Guide.\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"TransitionStorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        }\
-      },\
-      \"documentation\":\"Container for the transition rule that describes when noncurrent objects transition to the STANDARD_IA, ONEZONE_IA or GLACIER storage class. If your bucket is versioning-enabled (or versioning is suspended), you can set this action to request that Amazon S3 transition noncurrent object versions to the STANDARD_IA, ONEZONE_IA or GLACIER storage class at a specific period in the object's lifetime.\"\
-    },\
-    \"NoncurrentVersionTransitionList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"NoncurrentVersionTransition\"},\
-      \"flattened\":true\
-    },\
-    \"NotificationConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"TopicConfigurations\":{\
-          \"shape\":\"TopicConfigurationList\",\
-          \"locationName\":\"TopicConfiguration\"\
-        },\
-        \"QueueConfigurations\":{\
-          \"shape\":\"QueueConfigurationList\",\
-          \"locationName\":\"QueueConfiguration\"\
-        },\
-        \"LambdaFunctionConfigurations\":{\
-          \"shape\":\"LambdaFunctionConfigurationList\",\
-          \"locationName\":\"CloudFunctionConfiguration\"\
-        }\
-      },\
-      \"documentation\":\"Container for specifying the notification configuration of the bucket. If this element is empty, notifications are turned off on the bucket.\"\
-    },\
-    \"NotificationConfigurationDeprecated\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"TopicConfiguration\":{\"shape\":\"TopicConfigurationDeprecated\"},\
-        \"QueueConfiguration\":{\"shape\":\"QueueConfigurationDeprecated\"},\
-        \"CloudFunctionConfiguration\":{\"shape\":\"CloudFunctionConfiguration\"}\
-      }\
-    },\
-    \"NotificationConfigurationFilter\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Key\":{\
-          \"shape\":\"S3KeyFilter\",\
-          \"locationName\":\"S3Key\"\
-        }\
-      },\
-      \"documentation\":\"Container for object key name filtering rules. For information about key name filtering, go to <a href=\\\"http://docs.aws.amazon.com/AmazonS3/latest/dev/NotificationHowTo.html\\\">Configuring Event Notifications</a> in the Amazon Simple Storage Service Developer Guide.\"\
-    },\
-    \"NotificationId\":{\
-      \"type\":\"string\",\
-      \"documentation\":\"Optional unique identifier for configurations in a notification configuration. If you don't provide one, Amazon S3 will assign an ID.\"\
-    },\
-    \"Object\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Key\":{\"shape\":\"ObjectKey\"},\
-        \"LastModified\":{\"shape\":\"LastModified\"},\
-        \"ETag\":{\"shape\":\"ETag\"},\
-        \"Size\":{\"shape\":\"Size\"},\
-        \"StorageClass\":{\
-          \"shape\":\"ObjectStorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        },\
-        \"Owner\":{\"shape\":\"Owner\"}\
-      }\
-    },\
-    \"ObjectAlreadyInActiveTierError\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"This operation is not allowed against this storage tier\",\
-      \"exception\":true\
-    },\
-    \"ObjectCannedACL\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"private\",\
-        \"public-read\",\
-        \"public-read-write\",\
-        \"authenticated-read\",\
-        \"aws-exec-read\",\
-        \"bucket-owner-read\",\
-        \"bucket-owner-full-control\"\
-      ]\
-    },\
-    \"ObjectIdentifier\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Key\"],\
-      \"members\":{\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Key name of the object to delete.\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId for the specific version of the object to delete.\"\
-        }\
-      }\
-    },\
-    \"ObjectIdentifierList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"ObjectIdentifier\"},\
-      \"flattened\":true\
-    },\
-    \"ObjectKey\":{\
-      \"type\":\"string\",\
-      \"min\":1\
-    },\
-    \"ObjectList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Object\"},\
-      \"flattened\":true\
-    },\
-    \"ObjectNotInActiveTierError\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"The source object of the COPY operation is not in the active tier and is only stored in Amazon Glacier.\",\
-      \"exception\":true\
-    },\
-    \"ObjectStorageClass\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"STANDARD\",\
-        \"REDUCED_REDUNDANCY\",\
-        \"GLACIER\",\
-        \"STANDARD_IA\",\
-        \"ONEZONE_IA\"\
-      ]\
-    },\
-    \"ObjectVersion\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ETag\":{\"shape\":\"ETag\"},\
-        \"Size\":{\
-          \"shape\":\"Size\",\
-          \"documentation\":\"Size in bytes of the object.\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"ObjectVersionStorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"The object key.\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version ID of an object.\"\
-        },\
-        \"IsLatest\":{\
-          \"shape\":\"IsLatest\",\
-          \"documentation\":\"Specifies whether the object is (true) or is not (false) the latest version of an object.\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Date and time the object was last modified.\"\
-        },\
-        \"Owner\":{\"shape\":\"Owner\"}\
-      }\
-    },\
-    \"ObjectVersionId\":{\"type\":\"string\"},\
-    \"ObjectVersionList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"ObjectVersion\"},\
-      \"flattened\":true\
-    },\
-    \"ObjectVersionStorageClass\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"STANDARD\"]\
-    },\
-    \"OutputLocation\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"S3\":{\
-          \"shape\":\"S3Location\",\
-          \"documentation\":\"Describes an S3 location that will receive the results of the restore request.\"\
-        }\
-      },\
-      \"documentation\":\"Describes the location where the restore job's output is stored.\"\
-    },\
-    \"OutputSerialization\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"CSV\":{\
-          \"shape\":\"CSVOutput\",\
-          \"documentation\":\"Describes the serialization of CSV-encoded Select results.\"\
-        },\
-        \"JSON\":{\
-          \"shape\":\"JSONOutput\",\
-          \"documentation\":\"Specifies JSON as request's output serialization format.\"\
-        }\
-      },\
-      \"documentation\":\"Describes how results of the Select job are serialized.\"\
-    },\
-    \"Owner\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"DisplayName\":{\"shape\":\"DisplayName\"},\
-        \"ID\":{\"shape\":\"ID\"}\
-      }\
-    },\
-    \"OwnerOverride\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"Destination\"]\
-    },\
-    \"Part\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number identifying the part. This is a positive integer between 1 and 10,000.\"\
-        },\
-        \"LastModified\":{\
-          \"shape\":\"LastModified\",\
-          \"documentation\":\"Date and time at which the part was uploaded.\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag returned when the part was uploaded.\"\
-        },\
-        \"Size\":{\
-          \"shape\":\"Size\",\
-          \"documentation\":\"Size of the uploaded part data.\"\
-        }\
-      }\
-    },\
-    \"PartNumber\":{\"type\":\"integer\"},\
-    \"PartNumberMarker\":{\"type\":\"integer\"},\
-    \"Parts\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Part\"},\
-      \"flattened\":true\
-    },\
-    \"PartsCount\":{\"type\":\"integer\"},\
-    \"Payer\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Requester\",\
-        \"BucketOwner\"\
-      ]\
-    },\
-    \"Permission\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"FULL_CONTROL\",\
-        \"WRITE\",\
-        \"WRITE_ACP\",\
-        \"READ\",\
-        \"READ_ACP\"\
-      ]\
-    },\
-    \"Policy\":{\"type\":\"string\"},\
-    \"Prefix\":{\"type\":\"string\"},\
-    \"Progress\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"BytesScanned\":{\
-          \"shape\":\"BytesScanned\",\
-          \"documentation\":\"Current number of object bytes scanned.\"\
-        },\
-        \"BytesProcessed\":{\
-          \"shape\":\"BytesProcessed\",\
-          \"documentation\":\"Current number of uncompressed object bytes processed.\"\
-        }\
-      }\
-    },\
-    \"ProgressEvent\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Details\":{\
-          \"shape\":\"Progress\",\
-          \"documentation\":\"The Progress event details.\",\
-          \"eventpayload\":true\
-        }\
-      },\
-      \"event\":true\
-    },\
-    \"Protocol\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"http\",\
-        \"https\"\
-      ]\
-    },\
-    \"PutBucketAccelerateConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"AccelerateConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket for which the accelerate configuration is set.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"AccelerateConfiguration\":{\
-          \"shape\":\"AccelerateConfiguration\",\
-          \"documentation\":\"Specifies the Accelerate Configuration you want to set for the bucket.\",\
-          \"locationName\":\"AccelerateConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"AccelerateConfiguration\"\
-    },\
-    \"PutBucketAclRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"BucketCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"AccessControlPolicy\":{\
-          \"shape\":\"AccessControlPolicy\",\
-          \"locationName\":\"AccessControlPolicy\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Allows grantee the read, write, read ACP, and write ACP permissions on the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to list the objects in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the bucket ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWrite\":{\
-          \"shape\":\"GrantWrite\",\
-          \"documentation\":\"Allows grantee to create, overwrite, and delete any object in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        }\
-      },\
-      \"payload\":\"AccessControlPolicy\"\
-    },\
-    \"PutBucketAnalyticsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\",\
-        \"AnalyticsConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket to which an analytics configuration is stored.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"AnalyticsId\",\
-          \"documentation\":\"The identifier used to represent an analytics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        },\
-        \"AnalyticsConfiguration\":{\
-          \"shape\":\"AnalyticsConfiguration\",\
-          \"documentation\":\"The configuration and any analyses for the analytics filter.\",\
-          \"locationName\":\"AnalyticsConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"AnalyticsConfiguration\"\
-    },\
-    \"PutBucketCorsRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"CORSConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CORSConfiguration\":{\
-          \"shape\":\"CORSConfiguration\",\
-          \"locationName\":\"CORSConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        }\
-      },\
-      \"payload\":\"CORSConfiguration\"\
-    },\
-    \"PutBucketEncryptionRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"ServerSideEncryptionConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket for which the server-side encryption configuration is set.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"documentation\":\"The base64-encoded 128-bit MD5 digest of the server-side encryption configuration.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"ServerSideEncryptionConfiguration\":{\
-          \"shape\":\"ServerSideEncryptionConfiguration\",\
-          \"locationName\":\"ServerSideEncryptionConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"ServerSideEncryptionConfiguration\"\
-    },\
-    \"PutBucketInventoryConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\",\
-        \"InventoryConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket where the inventory configuration will be stored.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"InventoryId\",\
-          \"documentation\":\"The ID used to identify the inventory configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        },\
-        \"InventoryConfiguration\":{\
-          \"shape\":\"InventoryConfiguration\",\
-          \"documentation\":\"Specifies the inventory configuration.\",\
-          \"locationName\":\"InventoryConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"InventoryConfiguration\"\
-    },\
-    \"PutBucketLifecycleConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"LifecycleConfiguration\":{\
-          \"shape\":\"BucketLifecycleConfiguration\",\
-          \"locationName\":\"LifecycleConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"LifecycleConfiguration\"\
-    },\
-    \"PutBucketLifecycleRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Bucket\"],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"LifecycleConfiguration\":{\
-          \"shape\":\"LifecycleConfiguration\",\
-          \"locationName\":\"LifecycleConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"LifecycleConfiguration\"\
-    },\
-    \"PutBucketLoggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"BucketLoggingStatus\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"BucketLoggingStatus\":{\
-          \"shape\":\"BucketLoggingStatus\",\
-          \"locationName\":\"BucketLoggingStatus\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        }\
-      },\
-      \"payload\":\"BucketLoggingStatus\"\
-    },\
-    \"PutBucketMetricsConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Id\",\
-        \"MetricsConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket for which the metrics configuration is set.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Id\":{\
-          \"shape\":\"MetricsId\",\
-          \"documentation\":\"The ID used to identify the metrics configuration.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"id\"\
-        },\
-        \"MetricsConfiguration\":{\
-          \"shape\":\"MetricsConfiguration\",\
-          \"documentation\":\"Specifies the metrics configuration.\",\
-          \"locationName\":\"MetricsConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"MetricsConfiguration\"\
-    },\
-    \"PutBucketNotificationConfigurationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"NotificationConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"NotificationConfiguration\":{\
-          \"shape\":\"NotificationConfiguration\",\
-          \"locationName\":\"NotificationConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"NotificationConfiguration\"\
-    },\
-    \"PutBucketNotificationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"NotificationConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"NotificationConfiguration\":{\
-          \"shape\":\"NotificationConfigurationDeprecated\",\
-          \"locationName\":\"NotificationConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"NotificationConfiguration\"\
-    },\
-    \"PutBucketPolicyRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Policy\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"ConfirmRemoveSelfBucketAccess\":{\
-          \"shape\":\"ConfirmRemoveSelfBucketAccess\",\
-          \"documentation\":\"Set this parameter to true to confirm that you want to remove your permissions to change this bucket policy in the future.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-confirm-remove-self-bucket-access\"\
-        },\
-        \"Policy\":{\
-          \"shape\":\"Policy\",\
-          \"documentation\":\"The bucket policy as a JSON document.\"\
-        }\
-      },\
-      \"payload\":\"Policy\"\
-    },\
-    \"PutBucketReplicationRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"ReplicationConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"ReplicationConfiguration\":{\
-          \"shape\":\"ReplicationConfiguration\",\
-          \"locationName\":\"ReplicationConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"ReplicationConfiguration\"\
-    },\
-    \"PutBucketRequestPaymentRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"RequestPaymentConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"RequestPaymentConfiguration\":{\
-          \"shape\":\"RequestPaymentConfiguration\",\
-          \"locationName\":\"RequestPaymentConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"RequestPaymentConfiguration\"\
-    },\
-    \"PutBucketTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Tagging\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"Tagging\",\
-          \"locationName\":\"Tagging\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"Tagging\"\
-    },\
-    \"PutBucketVersioningRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"VersioningConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"MFA\":{\
-          \"shape\":\"MFA\",\
-          \"documentation\":\"The concatenation of the authentication device's serial number, a space, and the value that is displayed on your authentication device.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-mfa\"\
-        },\
-        \"VersioningConfiguration\":{\
-          \"shape\":\"VersioningConfiguration\",\
-          \"locationName\":\"VersioningConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"VersioningConfiguration\"\
-    },\
-    \"PutBucketWebsiteRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"WebsiteConfiguration\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"WebsiteConfiguration\":{\
-          \"shape\":\"WebsiteConfiguration\",\
-          \"locationName\":\"WebsiteConfiguration\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"WebsiteConfiguration\"\
-    },\
-    \"PutObjectAclOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"PutObjectAclRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"ObjectCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"AccessControlPolicy\":{\
-          \"shape\":\"AccessControlPolicy\",\
-          \"locationName\":\"AccessControlPolicy\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Allows grantee the read, write, read ACP, and write ACP permissions on the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to list the objects in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the bucket ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWrite\":{\
-          \"shape\":\"GrantWrite\",\
-          \"documentation\":\"Allows grantee to create, overwrite, and delete any object in the bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"VersionId used to reference a specific version of the object.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        }\
-      },\
-      \"payload\":\"AccessControlPolicy\"\
-    },\
-    \"PutObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Expiration\":{\
-          \"shape\":\"Expiration\",\
-          \"documentation\":\"If the object expiration is configured, this will contain the expiration date (expiry-date) and rule ID (rule-id). The value of rule-id is URL encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-expiration\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag for the uploaded object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"ETag\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"documentation\":\"Version of the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"PutObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"ACL\":{\
-          \"shape\":\"ObjectCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-acl\"\
-        },\
-        \"Body\":{\
-          \"shape\":\"Body\",\
-          \"documentation\":\"Object data.\",\
-          \"streaming\":true\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to which the PUT operation was initiated.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CacheControl\":{\
-          \"shape\":\"CacheControl\",\
-          \"documentation\":\"Specifies caching behavior along the request/reply chain.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Cache-Control\"\
-        },\
-        \"ContentDisposition\":{\
-          \"shape\":\"ContentDisposition\",\
-          \"documentation\":\"Specifies presentational information for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Disposition\"\
-        },\
-        \"ContentEncoding\":{\
-          \"shape\":\"ContentEncoding\",\
-          \"documentation\":\"Specifies what content encodings have been applied to the object and thus what decoding mechanisms must be applied to obtain the media-type referenced by the Content-Type header field.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Encoding\"\
-        },\
-        \"ContentLanguage\":{\
-          \"shape\":\"ContentLanguage\",\
-          \"documentation\":\"The language the content is in.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Language\"\
-        },\
-        \"ContentLength\":{\
-          \"shape\":\"ContentLength\",\
-          \"documentation\":\"Size of the body in bytes. This parameter is useful when the size of the body cannot be determined automatically.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Length\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"documentation\":\"The base64-encoded 128-bit MD5 digest of the part data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"ContentType\":{\
-          \"shape\":\"ContentType\",\
-          \"documentation\":\"A standard MIME type describing the format of the object data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Type\"\
-        },\
-        \"Expires\":{\
-          \"shape\":\"Expires\",\
-          \"documentation\":\"The date and time at which the object is no longer cacheable.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Expires\"\
-        },\
-        \"GrantFullControl\":{\
-          \"shape\":\"GrantFullControl\",\
-          \"documentation\":\"Gives the grantee READ, READ_ACP, and WRITE_ACP permissions on the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-full-control\"\
-        },\
-        \"GrantRead\":{\
-          \"shape\":\"GrantRead\",\
-          \"documentation\":\"Allows grantee to read the object data and its metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read\"\
-        },\
-        \"GrantReadACP\":{\
-          \"shape\":\"GrantReadACP\",\
-          \"documentation\":\"Allows grantee to read the object ACL.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-read-acp\"\
-        },\
-        \"GrantWriteACP\":{\
-          \"shape\":\"GrantWriteACP\",\
-          \"documentation\":\"Allows grantee to write the ACL for the applicable object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-grant-write-acp\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Object key for which the PUT operation was initiated.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"Metadata\":{\
-          \"shape\":\"Metadata\",\
-          \"documentation\":\"A map of metadata to store with the object in S3.\",\
-          \"location\":\"headers\",\
-          \"locationName\":\"x-amz-meta-\"\
-        },\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The type of storage to use for the object. Defaults to 'STANDARD'.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-storage-class\"\
-        },\
-        \"WebsiteRedirectLocation\":{\
-          \"shape\":\"WebsiteRedirectLocation\",\
-          \"documentation\":\"If the bucket is configured as a website, redirects requests for this object to another object in the same bucket or to an external URL. Amazon S3 stores the value of this header in the object metadata.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-website-redirect-location\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"Specifies the AWS KMS key ID to use for object encryption. All GET and PUT requests for an object protected by AWS KMS will fail if not made via SSL or using SigV4. Documentation on configuring any of the officially supported AWS SDKs and CLI can be found at http://docs.aws.amazon.com/AmazonS3/latest/dev/UsingAWSSDK.html#specify-signature-version\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"TaggingHeader\",\
-          \"documentation\":\"The tag-set for the object. The tag-set must be encoded as URL Query parameters\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-tagging\"\
-        }\
-      },\
-      \"payload\":\"Body\"\
-    },\
-    \"PutObjectTaggingOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-version-id\"\
-        }\
-      }\
-    },\
-    \"PutObjectTaggingRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"Tagging\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"Tagging\",\
-          \"locationName\":\"Tagging\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        }\
-      },\
-      \"payload\":\"Tagging\"\
-    },\
-    \"QueueArn\":{\"type\":\"string\"},\
-    \"QueueConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"QueueArn\",\
-        \"Events\"\
-      ],\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"QueueArn\":{\
-          \"shape\":\"QueueArn\",\
-          \"documentation\":\"Amazon SQS queue ARN to which Amazon S3 will publish a message when it detects events of specified type.\",\
-          \"locationName\":\"Queue\"\
-        },\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"Filter\":{\"shape\":\"NotificationConfigurationFilter\"}\
-      },\
-      \"documentation\":\"Container for specifying an configuration when you want Amazon S3 to publish events to an Amazon Simple Queue Service (Amazon SQS) queue.\"\
-    },\
-    \"QueueConfigurationDeprecated\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"Event\":{\
-          \"shape\":\"Event\",\
-          \"deprecated\":true\
-        },\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"Queue\":{\"shape\":\"QueueArn\"}\
-      }\
-    },\
-    \"QueueConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"QueueConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"Quiet\":{\"type\":\"boolean\"},\
-    \"QuoteCharacter\":{\"type\":\"string\"},\
-    \"QuoteEscapeCharacter\":{\"type\":\"string\"},\
-    \"QuoteFields\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"ALWAYS\",\
-        \"ASNEEDED\"\
-      ]\
-    },\
-    \"Range\":{\"type\":\"string\"},\
-    \"RecordDelimiter\":{\"type\":\"string\"},\
-    \"RecordsEvent\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Payload\":{\
-          \"shape\":\"Body\",\
-          \"documentation\":\"The byte array of partial, one or more result records.\",\
-          \"eventpayload\":true\
-        }\
-      },\
-      \"event\":true\
-    },\
-    \"Redirect\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"HostName\":{\
-          \"shape\":\"HostName\",\
-          \"documentation\":\"The host name to use in the redirect request.\"\
-        },\
-        \"HttpRedirectCode\":{\
-          \"shape\":\"HttpRedirectCode\",\
-          \"documentation\":\"The HTTP redirect code to use on the response. Not required if one of the siblings is present.\"\
-        },\
-        \"Protocol\":{\
-          \"shape\":\"Protocol\",\
-          \"documentation\":\"Protocol to use (http, https) when redirecting requests. The default is the protocol that is used in the original request.\"\
-        },\
-        \"ReplaceKeyPrefixWith\":{\
-          \"shape\":\"ReplaceKeyPrefixWith\",\
-          \"documentation\":\"The object key prefix to use in the redirect request. For example, to redirect requests for all pages with prefix docs/ (objects in the docs/ folder) to documents/, you can set a condition block with KeyPrefixEquals set to docs/ and in the Redirect set ReplaceKeyPrefixWith to /documents. Not required if one of the siblings is present. Can be present only if ReplaceKeyWith is not provided.\"\
-        },\
-        \"ReplaceKeyWith\":{\
-          \"shape\":\"ReplaceKeyWith\",\
-          \"documentation\":\"The specific object key to use in the redirect request. For example, redirect request to error.html. Not required if one of the sibling is present. Can be present only if ReplaceKeyPrefixWith is not provided.\"\
-        }\
-      }\
-    },\
-    \"RedirectAllRequestsTo\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"HostName\"],\
-      \"members\":{\
-        \"HostName\":{\
-          \"shape\":\"HostName\",\
-          \"documentation\":\"Name of the host where requests will be redirected.\"\
-        },\
-        \"Protocol\":{\
-          \"shape\":\"Protocol\",\
-          \"documentation\":\"Protocol to use (http, https) when redirecting requests. The default is the protocol that is used in the original request.\"\
-        }\
-      }\
-    },\
-    \"ReplaceKeyPrefixWith\":{\"type\":\"string\"},\
-    \"ReplaceKeyWith\":{\"type\":\"string\"},\
-    \"ReplicaKmsKeyID\":{\"type\":\"string\"},\
-    \"ReplicationConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Role\",\
-        \"Rules\"\
-      ],\
-      \"members\":{\
-        \"Role\":{\
-          \"shape\":\"Role\",\
-          \"documentation\":\"Amazon Resource Name (ARN) of an IAM role for Amazon S3 to assume when replicating the objects.\"\
-        },\
-        \"Rules\":{\
-          \"shape\":\"ReplicationRules\",\
-          \"documentation\":\"Container for information about a particular replication rule. Replication configuration must have at least one rule and can contain up to 1,000 rules.\",\
-          \"locationName\":\"Rule\"\
-        }\
-      },\
-      \"documentation\":\"Container for replication rules. You can add as many as 1,000 rules. Total replication configuration size can be up to 2 MB.\"\
-    },\
-    \"ReplicationRule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Prefix\",\
-        \"Status\",\
-        \"Destination\"\
-      ],\
-      \"members\":{\
-        \"ID\":{\
-          \"shape\":\"ID\",\
-          \"documentation\":\"Unique identifier for the rule. The value cannot be longer than 255 characters.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Object keyname prefix identifying one or more objects to which the rule applies. Maximum prefix length can be up to 1,024 characters. Overlapping prefixes are not supported.\"\
-        },\
-        \"Status\":{\
-          \"shape\":\"ReplicationRuleStatus\",\
-          \"documentation\":\"The rule is ignored if status is not Enabled.\"\
-        },\
-        \"SourceSelectionCriteria\":{\
-          \"shape\":\"SourceSelectionCriteria\",\
-          \"documentation\":\"Container for filters that define which source objects should be replicated.\"\
-        },\
-        \"Destination\":{\
-          \"shape\":\"Destination\",\
-          \"documentation\":\"Container for replication destination information.\"\
-        }\
-      },\
-      \"documentation\":\"Container for information about a particular replication rule.\"\
-    },\
-    \"ReplicationRuleStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Disabled\"\
-      ]\
-    },\
-    \"ReplicationRules\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"ReplicationRule\"},\
-      \"flattened\":true\
-    },\
-    \"ReplicationStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"COMPLETE\",\
-        \"PENDING\",\
-        \"FAILED\",\
-        \"REPLICA\"\
-      ]\
-    },\
-    \"RequestCharged\":{\
-      \"type\":\"string\",\
-      \"documentation\":\"If present, indicates that the requester was successfully charged for the request.\",\
-      \"enum\":[\"requester\"]\
-    },\
-    \"RequestPayer\":{\
-      \"type\":\"string\",\
-      \"documentation\":\"Confirms that the requester knows that she or he will be charged for the request. Bucket owners need not specify this parameter in their requests. Documentation on downloading objects from requester pays buckets can be found at http://docs.aws.amazon.com/AmazonS3/latest/dev/ObjectsinRequesterPaysBuckets.html\",\
-      \"enum\":[\"requester\"]\
-    },\
-    \"RequestPaymentConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Payer\"],\
-      \"members\":{\
-        \"Payer\":{\
-          \"shape\":\"Payer\",\
-          \"documentation\":\"Specifies who pays for the download and request fees.\"\
-        }\
-      }\
-    },\
-    \"RequestProgress\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Enabled\":{\
-          \"shape\":\"EnableRequestProgress\",\
-          \"documentation\":\"Specifies whether periodic QueryProgress frames should be sent. Valid values: TRUE, FALSE. Default value: FALSE.\"\
-        }\
-      }\
-    },\
-    \"ResponseCacheControl\":{\"type\":\"string\"},\
-    \"ResponseContentDisposition\":{\"type\":\"string\"},\
-    \"ResponseContentEncoding\":{\"type\":\"string\"},\
-    \"ResponseContentLanguage\":{\"type\":\"string\"},\
-    \"ResponseContentType\":{\"type\":\"string\"},\
-    \"ResponseExpires\":{\"type\":\"timestamp\"},\
-    \"Restore\":{\"type\":\"string\"},\
-    \"RestoreObjectOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        },\
-        \"RestoreOutputPath\":{\
-          \"shape\":\"RestoreOutputPath\",\
-          \"documentation\":\"Indicates the path in the provided S3 output location where Select results will be restored to.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-restore-output-path\"\
-        }\
-      }\
-    },\
-    \"RestoreObjectRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"VersionId\":{\
-          \"shape\":\"ObjectVersionId\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"versionId\"\
-        },\
-        \"RestoreRequest\":{\
-          \"shape\":\"RestoreRequest\",\
-          \"locationName\":\"RestoreRequest\",\
-          \"xmlNamespace\":{\"uri\":\"http://s3.amazonaws.com/doc/2006-03-01/\"}\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      },\
-      \"payload\":\"RestoreRequest\"\
-    },\
-    \"RestoreOutputPath\":{\"type\":\"string\"},\
-    \"RestoreRequest\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Days\":{\
-          \"shape\":\"Days\",\
-          \"documentation\":\"Lifetime of the active copy in days. Do not use with restores that specify OutputLocation.\"\
-        },\
-        \"GlacierJobParameters\":{\
-          \"shape\":\"GlacierJobParameters\",\
-          \"documentation\":\"Glacier related parameters pertaining to this job. Do not use with restores that specify OutputLocation.\"\
-        },\
-        \"Type\":{\
-          \"shape\":\"RestoreRequestType\",\
-          \"documentation\":\"Type of restore request.\"\
-        },\
-        \"Tier\":{\
-          \"shape\":\"Tier\",\
-          \"documentation\":\"Glacier retrieval tier at which the restore will be processed.\"\
-        },\
-        \"Description\":{\
-          \"shape\":\"Description\",\
-          \"documentation\":\"The optional description for the job.\"\
-        },\
-        \"SelectParameters\":{\
-          \"shape\":\"SelectParameters\",\
-          \"documentation\":\"Describes the parameters for Select job types.\"\
-        },\
-        \"OutputLocation\":{\
-          \"shape\":\"OutputLocation\",\
-          \"documentation\":\"Describes the location where the restore job's output is stored.\"\
-        }\
-      },\
-      \"documentation\":\"Container for restore job parameters.\"\
-    },\
-    \"RestoreRequestType\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"SELECT\"]\
-    },\
-    \"Role\":{\"type\":\"string\"},\
-    \"RoutingRule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Redirect\"],\
-      \"members\":{\
-        \"Condition\":{\
-          \"shape\":\"Condition\",\
-          \"documentation\":\"A container for describing a condition that must be met for the specified redirect to apply. For example, 1. If request is for pages in the /docs folder, redirect to the /documents folder. 2. If request results in HTTP error 4xx, redirect request to another host where you might process the error.\"\
-        },\
-        \"Redirect\":{\
-          \"shape\":\"Redirect\",\
-          \"documentation\":\"Container for redirect information. You can redirect requests to another host, to another page, or with another protocol. In the event of an error, you can can specify a different error code to return.\"\
-        }\
-      }\
-    },\
-    \"RoutingRules\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"RoutingRule\",\
-        \"locationName\":\"RoutingRule\"\
-      }\
-    },\
-    \"Rule\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Prefix\",\
-        \"Status\"\
-      ],\
-      \"members\":{\
-        \"Expiration\":{\"shape\":\"LifecycleExpiration\"},\
-        \"ID\":{\
-          \"shape\":\"ID\",\
-          \"documentation\":\"Unique identifier for the rule. The value cannot be longer than 255 characters.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"Prefix\",\
-          \"documentation\":\"Prefix identifying one or more objects to which the rule applies.\"\
-        },\
-        \"Status\":{\
-          \"shape\":\"ExpirationStatus\",\
-          \"documentation\":\"If 'Enabled', the rule is currently being applied. If 'Disabled', the rule is not currently being applied.\"\
-        },\
-        \"Transition\":{\"shape\":\"Transition\"},\
-        \"NoncurrentVersionTransition\":{\"shape\":\"NoncurrentVersionTransition\"},\
-        \"NoncurrentVersionExpiration\":{\"shape\":\"NoncurrentVersionExpiration\"},\
-        \"AbortIncompleteMultipartUpload\":{\"shape\":\"AbortIncompleteMultipartUpload\"}\
-      }\
-    },\
-    \"Rules\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Rule\"},\
-      \"flattened\":true\
-    },\
-    \"S3KeyFilter\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"FilterRules\":{\
-          \"shape\":\"FilterRuleList\",\
-          \"locationName\":\"FilterRule\"\
-        }\
-      },\
-      \"documentation\":\"Container for object key name prefix and suffix filtering rules.\"\
-    },\
-    \"S3Location\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"BucketName\",\
-        \"Prefix\"\
-      ],\
-      \"members\":{\
-        \"BucketName\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The name of the bucket where the restore results will be placed.\"\
-        },\
-        \"Prefix\":{\
-          \"shape\":\"LocationPrefix\",\
-          \"documentation\":\"The prefix that is prepended to the restore results for this request.\"\
-        },\
-        \"Encryption\":{\"shape\":\"Encryption\"},\
-        \"CannedACL\":{\
-          \"shape\":\"ObjectCannedACL\",\
-          \"documentation\":\"The canned ACL to apply to the restore results.\"\
-        },\
-        \"AccessControlList\":{\
-          \"shape\":\"Grants\",\
-          \"documentation\":\"A list of grants that control access to the staged results.\"\
-        },\
-        \"Tagging\":{\
-          \"shape\":\"Tagging\",\
-          \"documentation\":\"The tag-set that is applied to the restore results.\"\
-        },\
-        \"UserMetadata\":{\
-          \"shape\":\"UserMetadata\",\
-          \"documentation\":\"A list of metadata to store with the restore results in S3.\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"StorageClass\",\
-          \"documentation\":\"The class of storage used to store the restore results.\"\
-        }\
-      },\
-      \"documentation\":\"Describes an S3 location that will receive the results of the restore request.\"\
-    },\
-    \"SSECustomerAlgorithm\":{\"type\":\"string\"},\
-    \"SSECustomerKey\":{\
-      \"type\":\"string\",\
-      \"sensitive\":true\
-    },\
-    \"SSECustomerKeyMD5\":{\"type\":\"string\"},\
-    \"SSEKMS\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"KeyId\"],\
-      \"members\":{\
-        \"KeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"Specifies the ID of the AWS Key Management Service (KMS) master encryption key to use for encrypting Inventory reports.\"\
-        }\
-      },\
-      \"documentation\":\"Specifies the use of SSE-KMS to encrypt delievered Inventory reports.\",\
-      \"locationName\":\"SSE-KMS\"\
-    },\
-    \"SSEKMSKeyId\":{\
-      \"type\":\"string\",\
-      \"sensitive\":true\
-    },\
-    \"SSES3\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-      },\
-      \"documentation\":\"Specifies the use of SSE-S3 to encrypt delievered Inventory reports.\",\
-      \"locationName\":\"SSE-S3\"\
-    },\
-    \"SelectObjectContentEventStream\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Records\":{\
-          \"shape\":\"RecordsEvent\",\
-          \"documentation\":\"The Records Event.\"\
-        },\
-        \"Stats\":{\
-          \"shape\":\"StatsEvent\",\
-          \"documentation\":\"The Stats Event.\"\
-        },\
-        \"Progress\":{\
-          \"shape\":\"ProgressEvent\",\
-          \"documentation\":\"The Progress Event.\"\
-        },\
-        \"Cont\":{\
-          \"shape\":\"ContinuationEvent\",\
-          \"documentation\":\"The Continuation Event.\"\
-        },\
-        \"End\":{\
-          \"shape\":\"EndEvent\",\
-          \"documentation\":\"The End Event.\"\
-        }\
-      },\
-      \"eventstream\":true\
-    },\
-    \"SelectObjectContentOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Payload\":{\"shape\":\"SelectObjectContentEventStream\"}\
-      },\
-      \"payload\":\"Payload\"\
-    },\
-    \"SelectObjectContentRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"Expression\",\
-        \"ExpressionType\",\
-        \"InputSerialization\",\
-        \"OutputSerialization\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"The S3 Bucket.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"The Object Key.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"The SSE Algorithm used to encrypt the object. For more information, go to <a href=\\\"https://docs.aws.amazon.com/AmazonS3/latest/dev/ServerSideEncryptionCustomerKeys.html\\\"> Server-Side Encryption (Using Customer-Provided Encryption Keys</a>.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"The SSE Customer Key. For more information, go to <a href=\\\"https://docs.aws.amazon.com/AmazonS3/latest/dev/ServerSideEncryptionCustomerKeys.html\\\"> Server-Side Encryption (Using Customer-Provided Encryption Keys</a>.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"The SSE Customer Key MD5. For more information, go to <a href=\\\"https://docs.aws.amazon.com/AmazonS3/latest/dev/ServerSideEncryptionCustomerKeys.html\\\"> Server-Side Encryption (Using Customer-Provided Encryption Keys</a>.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"Expression\":{\
-          \"shape\":\"Expression\",\
-          \"documentation\":\"The expression that is used to query the object.\"\
-        },\
-        \"ExpressionType\":{\
-          \"shape\":\"ExpressionType\",\
-          \"documentation\":\"The type of the provided expression (e.g., SQL).\"\
-        },\
-        \"RequestProgress\":{\
-          \"shape\":\"RequestProgress\",\
-          \"documentation\":\"Specifies if periodic request progress information should be enabled.\"\
-        },\
-        \"InputSerialization\":{\
-          \"shape\":\"InputSerialization\",\
-          \"documentation\":\"Describes the format of the data in the object that is being queried.\"\
-        },\
-        \"OutputSerialization\":{\
-          \"shape\":\"OutputSerialization\",\
-          \"documentation\":\"Describes the format of the data that you want Amazon S3 to return in response.\"\
-        }\
-      },\
-      \"documentation\":\"Request to filter the contents of an Amazon S3 object based on a simple Structured Query Language (SQL) statement. In the request, along with the SQL expression, you must also specify a data serialization format (JSON or CSV) of the object. Amazon S3 uses this to parse object data into records, and returns only records that match the specified SQL expression. You must also specify the data serialization format for the response. For more information, go to <a href=\\\"https://docs.aws.amazon.com/AmazonS3/latest/API/RESTObjectSELECTContent.html\\\">S3Select API Documentation</a>.\"\
-    },\
-    \"SelectParameters\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"InputSerialization\",\
-        \"ExpressionType\",\
-        \"Expression\",\
-        \"OutputSerialization\"\
-      ],\
-      \"members\":{\
-        \"InputSerialization\":{\
-          \"shape\":\"InputSerialization\",\
-          \"documentation\":\"Describes the serialization format of the object.\"\
-        },\
-        \"ExpressionType\":{\
-          \"shape\":\"ExpressionType\",\
-          \"documentation\":\"The type of the provided expression (e.g., SQL).\"\
-        },\
-        \"Expression\":{\
-          \"shape\":\"Expression\",\
-          \"documentation\":\"The expression that is used to query the object.\"\
-        },\
-        \"OutputSerialization\":{\
-          \"shape\":\"OutputSerialization\",\
-          \"documentation\":\"Describes how the results of the Select job are serialized.\"\
-        }\
-      },\
-      \"documentation\":\"Describes the parameters for Select job types.\"\
-    },\
-    \"ServerSideEncryption\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"AES256\",\
-        \"aws:kms\"\
-      ]\
-    },\
-    \"ServerSideEncryptionByDefault\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"SSEAlgorithm\"],\
-      \"members\":{\
-        \"SSEAlgorithm\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"Server-side encryption algorithm to use for the default encryption.\"\
-        },\
-        \"KMSMasterKeyID\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"KMS master key ID to use for the default encryption. This parameter is allowed if SSEAlgorithm is aws:kms.\"\
-        }\
-      },\
-      \"documentation\":\"Describes the default server-side encryption to apply to new objects in the bucket. If Put Object request does not specify any server-side encryption, this default encryption will be applied.\"\
-    },\
-    \"ServerSideEncryptionConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Rules\"],\
-      \"members\":{\
-        \"Rules\":{\
-          \"shape\":\"ServerSideEncryptionRules\",\
-          \"documentation\":\"Container for information about a particular server-side encryption configuration rule.\",\
-          \"locationName\":\"Rule\"\
-        }\
-      },\
-      \"documentation\":\"Container for server-side encryption configuration rules. Currently S3 supports one rule only.\"\
-    },\
-    \"ServerSideEncryptionRule\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ApplyServerSideEncryptionByDefault\":{\
-          \"shape\":\"ServerSideEncryptionByDefault\",\
-          \"documentation\":\"Describes the default server-side encryption to apply to new objects in the bucket. If Put Object request does not specify any server-side encryption, this default encryption will be applied.\"\
-        }\
-      },\
-      \"documentation\":\"Container for information about a particular server-side encryption configuration rule.\"\
-    },\
-    \"ServerSideEncryptionRules\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"ServerSideEncryptionRule\"},\
-      \"flattened\":true\
-    },\
-    \"Size\":{\"type\":\"integer\"},\
-    \"SourceSelectionCriteria\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"SseKmsEncryptedObjects\":{\
-          \"shape\":\"SseKmsEncryptedObjects\",\
-          \"documentation\":\"Container for filter information of selection of KMS Encrypted S3 objects.\"\
-        }\
-      },\
-      \"documentation\":\"Container for filters that define which source objects should be replicated.\"\
-    },\
-    \"SseKmsEncryptedObjects\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"Status\"],\
-      \"members\":{\
-        \"Status\":{\
-          \"shape\":\"SseKmsEncryptedObjectsStatus\",\
-          \"documentation\":\"The replication for KMS encrypted S3 objects is disabled if status is not Enabled.\"\
-        }\
-      },\
-      \"documentation\":\"Container for filter information of selection of KMS Encrypted S3 objects.\"\
-    },\
-    \"SseKmsEncryptedObjectsStatus\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Enabled\",\
-        \"Disabled\"\
-      ]\
-    },\
-    \"StartAfter\":{\"type\":\"string\"},\
-    \"Stats\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"BytesScanned\":{\
-          \"shape\":\"BytesScanned\",\
-          \"documentation\":\"Total number of object bytes scanned.\"\
-        },\
-        \"BytesProcessed\":{\
-          \"shape\":\"BytesProcessed\",\
-          \"documentation\":\"Total number of uncompressed object bytes processed.\"\
-        }\
-      }\
-    },\
-    \"StatsEvent\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Details\":{\
-          \"shape\":\"Stats\",\
-          \"documentation\":\"The Stats event details.\",\
-          \"eventpayload\":true\
-        }\
-      },\
-      \"event\":true\
-    },\
-    \"StorageClass\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"STANDARD\",\
-        \"REDUCED_REDUNDANCY\",\
-        \"STANDARD_IA\",\
-        \"ONEZONE_IA\"\
-      ]\
-    },\
-    \"StorageClassAnalysis\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"DataExport\":{\
-          \"shape\":\"StorageClassAnalysisDataExport\",\
-          \"documentation\":\"A container used to describe how data related to the storage class analysis should be exported.\"\
-        }\
-      }\
-    },\
-    \"StorageClassAnalysisDataExport\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"OutputSchemaVersion\",\
-        \"Destination\"\
-      ],\
-      \"members\":{\
-        \"OutputSchemaVersion\":{\
-          \"shape\":\"StorageClassAnalysisSchemaVersion\",\
-          \"documentation\":\"The version of the output schema to use when exporting data. Must be V_1.\"\
-        },\
-        \"Destination\":{\
-          \"shape\":\"AnalyticsExportDestination\",\
-          \"documentation\":\"The place to store the data for an analysis.\"\
-        }\
-      }\
-    },\
-    \"StorageClassAnalysisSchemaVersion\":{\
-      \"type\":\"string\",\
-      \"enum\":[\"V_1\"]\
-    },\
-    \"Suffix\":{\"type\":\"string\"},\
-    \"Tag\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Key\",\
-        \"Value\"\
-      ],\
-      \"members\":{\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Name of the tag.\"\
-        },\
-        \"Value\":{\
-          \"shape\":\"Value\",\
-          \"documentation\":\"Value of the tag.\"\
-        }\
-      }\
-    },\
-    \"TagCount\":{\"type\":\"integer\"},\
-    \"TagSet\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"Tag\",\
-        \"locationName\":\"Tag\"\
-      }\
-    },\
-    \"Tagging\":{\
-      \"type\":\"structure\",\
-      \"required\":[\"TagSet\"],\
-      \"members\":{\
-        \"TagSet\":{\"shape\":\"TagSet\"}\
-      }\
-    },\
-    \"TaggingDirective\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"COPY\",\
-        \"REPLACE\"\
-      ]\
-    },\
-    \"TaggingHeader\":{\"type\":\"string\"},\
-    \"TargetBucket\":{\"type\":\"string\"},\
-    \"TargetGrant\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Grantee\":{\"shape\":\"Grantee\"},\
-        \"Permission\":{\
-          \"shape\":\"BucketLogsPermission\",\
-          \"documentation\":\"Logging permissions assigned to the Grantee for the bucket.\"\
-        }\
-      }\
-    },\
-    \"TargetGrants\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"TargetGrant\",\
-        \"locationName\":\"Grant\"\
-      }\
-    },\
-    \"TargetPrefix\":{\"type\":\"string\"},\
-    \"Tier\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"Standard\",\
-        \"Bulk\",\
-        \"Expedited\"\
-      ]\
-    },\
-    \"Token\":{\"type\":\"string\"},\
-    \"TopicArn\":{\"type\":\"string\"},\
-    \"TopicConfiguration\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"TopicArn\",\
-        \"Events\"\
-      ],\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"TopicArn\":{\
-          \"shape\":\"TopicArn\",\
-          \"documentation\":\"Amazon SNS topic ARN to which Amazon S3 will publish a message when it detects events of specified type.\",\
-          \"locationName\":\"Topic\"\
-        },\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"Filter\":{\"shape\":\"NotificationConfigurationFilter\"}\
-      },\
-      \"documentation\":\"Container for specifying the configuration when you want Amazon S3 to publish events to an Amazon Simple Notification Service (Amazon SNS) topic.\"\
-    },\
-    \"TopicConfigurationDeprecated\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Id\":{\"shape\":\"NotificationId\"},\
-        \"Events\":{\
-          \"shape\":\"EventList\",\
-          \"locationName\":\"Event\"\
-        },\
-        \"Event\":{\
-          \"shape\":\"Event\",\
-          \"documentation\":\"Bucket event for which to send notifications.\",\
-          \"deprecated\":true\
-        },\
-        \"Topic\":{\
-          \"shape\":\"TopicArn\",\
-          \"documentation\":\"Amazon SNS topic to which Amazon S3 will publish a message to report the specified events for the bucket.\"\
-        }\
-      }\
-    },\
-    \"TopicConfigurationList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"TopicConfiguration\"},\
-      \"flattened\":true\
-    },\
-    \"Transition\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"Date\":{\
-          \"shape\":\"Date\",\
-          \"documentation\":\"Indicates at what date the object is to be moved or deleted. Should be in GMT ISO 8601 Format.\"\
-        },\
-        \"Days\":{\
-          \"shape\":\"Days\",\
-          \"documentation\":\"Indicates the lifetime, in days, of the objects that are subject to the rule. The value must be a non-zero positive integer.\"\
-        },\
-        \"StorageClass\":{\
-          \"shape\":\"TransitionStorageClass\",\
-          \"documentation\":\"The class of storage used to store the object.\"\
-        }\
-      }\
-    },\
-    \"TransitionList\":{\
-      \"type\":\"list\",\
-      \"member\":{\"shape\":\"Transition\"},\
-      \"flattened\":true\
-    },\
-    \"TransitionStorageClass\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"GLACIER\",\
-        \"STANDARD_IA\",\
-        \"ONEZONE_IA\"\
-      ]\
-    },\
-    \"Type\":{\
-      \"type\":\"string\",\
-      \"enum\":[\
-        \"CanonicalUser\",\
-        \"AmazonCustomerByEmail\",\
-        \"Group\"\
-      ]\
-    },\
-    \"URI\":{\"type\":\"string\"},\
-    \"UploadIdMarker\":{\"type\":\"string\"},\
-    \"UploadPartCopyOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"CopySourceVersionId\":{\
-          \"shape\":\"CopySourceVersionId\",\
-          \"documentation\":\"The version of the source object that was copied, if you have enabled versioning on the source bucket.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-version-id\"\
-        },\
-        \"CopyPartResult\":{\"shape\":\"CopyPartResult\"},\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      },\
-      \"payload\":\"CopyPartResult\"\
-    },\
-    \"UploadPartCopyRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"CopySource\",\
-        \"Key\",\
-        \"PartNumber\",\
-        \"UploadId\"\
-      ],\
-      \"members\":{\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"CopySource\":{\
-          \"shape\":\"CopySource\",\
-          \"documentation\":\"The name of the source bucket and key name of the source object, separated by a slash (/). Must be URL-encoded.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source\"\
-        },\
-        \"CopySourceIfMatch\":{\
-          \"shape\":\"CopySourceIfMatch\",\
-          \"documentation\":\"Copies the object if its entity tag (ETag) matches the specified tag.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-match\"\
-        },\
-        \"CopySourceIfModifiedSince\":{\
-          \"shape\":\"CopySourceIfModifiedSince\",\
-          \"documentation\":\"Copies the object if it has been modified since the specified time.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-modified-since\"\
-        },\
-        \"CopySourceIfNoneMatch\":{\
-          \"shape\":\"CopySourceIfNoneMatch\",\
-          \"documentation\":\"Copies the object if its entity tag (ETag) is different than the specified ETag.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-none-match\"\
-        },\
-        \"CopySourceIfUnmodifiedSince\":{\
-          \"shape\":\"CopySourceIfUnmodifiedSince\",\
-          \"documentation\":\"Copies the object if it hasn't been modified since the specified time.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-if-unmodified-since\"\
-        },\
-        \"CopySourceRange\":{\
-          \"shape\":\"CopySourceRange\",\
-          \"documentation\":\"The range of bytes to copy from the source object. The range value must use the form bytes=first-last, where the first and last are the zero-based byte offsets to copy. For example, bytes=0-9 indicates that you want to copy the first ten bytes of the source. You can copy a range only if the source object is greater than 5 GB.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-range\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number of part being copied. This is a positive integer between 1 and 10,000.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"partNumber\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"Upload ID identifying the multipart upload whose part is being copied.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"uploadId\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header. This must be the same encryption key specified in the initiate multipart upload request.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"CopySourceSSECustomerAlgorithm\":{\
-          \"shape\":\"CopySourceSSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use when decrypting the source object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-algorithm\"\
-        },\
-        \"CopySourceSSECustomerKey\":{\
-          \"shape\":\"CopySourceSSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use to decrypt the source object. The encryption key provided in this header must be one that was used when the source object was created.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key\"\
-        },\
-        \"CopySourceSSECustomerKeyMD5\":{\
-          \"shape\":\"CopySourceSSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-copy-source-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      }\
-    },\
-    \"UploadPartOutput\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ServerSideEncryption\":{\
-          \"shape\":\"ServerSideEncryption\",\
-          \"documentation\":\"The Server-side encryption algorithm used when storing this object in S3 (e.g., AES256, aws:kms).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption\"\
-        },\
-        \"ETag\":{\
-          \"shape\":\"ETag\",\
-          \"documentation\":\"Entity tag for the uploaded object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"ETag\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header confirming the encryption algorithm used.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"If server-side encryption with a customer-provided encryption key was requested, the response will include this header to provide round trip message integrity verification of the customer-provided encryption key.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"SSEKMSKeyId\":{\
-          \"shape\":\"SSEKMSKeyId\",\
-          \"documentation\":\"If present, specifies the ID of the AWS Key Management Service (KMS) master encryption key that was used for the object.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-aws-kms-key-id\"\
-        },\
-        \"RequestCharged\":{\
-          \"shape\":\"RequestCharged\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-charged\"\
-        }\
-      }\
-    },\
-    \"UploadPartRequest\":{\
-      \"type\":\"structure\",\
-      \"required\":[\
-        \"Bucket\",\
-        \"Key\",\
-        \"PartNumber\",\
-        \"UploadId\"\
-      ],\
-      \"members\":{\
-        \"Body\":{\
-          \"shape\":\"Body\",\
-          \"documentation\":\"Object data.\",\
-          \"streaming\":true\
-        },\
-        \"Bucket\":{\
-          \"shape\":\"BucketName\",\
-          \"documentation\":\"Name of the bucket to which the multipart upload was initiated.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Bucket\"\
-        },\
-        \"ContentLength\":{\
-          \"shape\":\"ContentLength\",\
-          \"documentation\":\"Size of the body in bytes. This parameter is useful when the size of the body cannot be determined automatically.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-Length\"\
-        },\
-        \"ContentMD5\":{\
-          \"shape\":\"ContentMD5\",\
-          \"documentation\":\"The base64-encoded 128-bit MD5 digest of the part data.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"Content-MD5\"\
-        },\
-        \"Key\":{\
-          \"shape\":\"ObjectKey\",\
-          \"documentation\":\"Object key for which the multipart upload was initiated.\",\
-          \"location\":\"uri\",\
-          \"locationName\":\"Key\"\
-        },\
-        \"PartNumber\":{\
-          \"shape\":\"PartNumber\",\
-          \"documentation\":\"Part number of part being uploaded. This is a positive integer between 1 and 10,000.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"partNumber\"\
-        },\
-        \"UploadId\":{\
-          \"shape\":\"MultipartUploadId\",\
-          \"documentation\":\"Upload ID identifying the multipart upload whose part is being uploaded.\",\
-          \"location\":\"querystring\",\
-          \"locationName\":\"uploadId\"\
-        },\
-        \"SSECustomerAlgorithm\":{\
-          \"shape\":\"SSECustomerAlgorithm\",\
-          \"documentation\":\"Specifies the algorithm to use to when encrypting the object (e.g., AES256).\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-algorithm\"\
-        },\
-        \"SSECustomerKey\":{\
-          \"shape\":\"SSECustomerKey\",\
-          \"documentation\":\"Specifies the customer-provided encryption key for Amazon S3 to use in encrypting data. This value is used to store the object and then it is discarded; Amazon does not store the encryption key. The key must be appropriate for use with the algorithm specified in the x-amz-server-sideâ-encryptionâ-customer-algorithm header. This must be the same encryption key specified in the initiate multipart upload request.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key\"\
-        },\
-        \"SSECustomerKeyMD5\":{\
-          \"shape\":\"SSECustomerKeyMD5\",\
-          \"documentation\":\"Specifies the 128-bit MD5 digest of the encryption key according to RFC 1321. Amazon S3 uses this header for a message integrity check to ensure the encryption key was transmitted without error.\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-server-side-encryption-customer-key-MD5\"\
-        },\
-        \"RequestPayer\":{\
-          \"shape\":\"RequestPayer\",\
-          \"location\":\"header\",\
-          \"locationName\":\"x-amz-request-payer\"\
-        }\
-      },\
-      \"payload\":\"Body\"\
-    },\
-    \"UserMetadata\":{\
-      \"type\":\"list\",\
-      \"member\":{\
-        \"shape\":\"MetadataEntry\",\
-        \"locationName\":\"MetadataEntry\"\
-      }\
-    },\
-    \"Value\":{\"type\":\"string\"},\
-    \"VersionIdMarker\":{\"type\":\"string\"},\
-    \"VersioningConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"MFADelete\":{\
-          \"shape\":\"MFADelete\",\
-          \"documentation\":\"Specifies whether MFA delete is enabled in the bucket versioning configuration. This element is only returned if the bucket has been configured with MFA delete. If the bucket has never been so configured, this element is not returned.\",\
-          \"locationName\":\"MfaDelete\"\
-        },\
-        \"Status\":{\
-          \"shape\":\"BucketVersioningStatus\",\
-          \"documentation\":\"The versioning state of the bucket.\"\
-        }\
-      }\
-    },\
-    \"WebsiteConfiguration\":{\
-      \"type\":\"structure\",\
-      \"members\":{\
-        \"ErrorDocument\":{\"shape\":\"ErrorDocument\"},\
-        \"IndexDocument\":{\"shape\":\"IndexDocument\"},\
-        \"RedirectAllRequestsTo\":{\"shape\":\"RedirectAllRequestsTo\"},\
-        \"RoutingRules\":{\"shape\":\"RoutingRules\"}\
-      }\
-    },\
-    \"WebsiteRedirectLocation\":{\"type\":\"string\"}\
-  }\
-}";
-}
-
 @end
@@ -158,6 +158,9 @@ static AWSSynchronizedMutableDictionary *_serviceClients = nil;
                                                                          
         AWSSignatureV4Signer *signer = [[AWSSignatureV4Signer alloc] initWithCredentialsProvider:_configuration.credentialsProvider
                                                                                         endpoint:_configuration.endpoint];
+        signer.allowsUnsignedPayload = _configuration.allowsUnsignedPayload;
+        signer.signedChunkSize = _configuration.signedChunkSize;
+        signer.usesChecksumTrailer = _configuration.usesChecksumTrailer;
         AWSNetworkingRequestInterceptor *baseInterceptor = [[AWSNetworkingRequestInterceptor alloc] initWithUserAgent:_configuration.userAgent];
         _configuration.requestInterceptors = @[baseInterceptor, signer];
 
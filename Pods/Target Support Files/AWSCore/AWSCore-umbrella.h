@@ -14,6 +14,10 @@
 #import "AWSCredentialsProvider.h"
 #import "AWSIdentityProvider.h"
 #import "AWSSignature.h"
+#import "aws_crc32c.h"
+#import "aws_sha256.h"
+#import "aws_sigv4.h"
+#import "aws_uri.h"
 #import "AWSBolts.h"
 #import "AWSCancellationToken.h"
 #import "AWSCancellationTokenRegistration.h"
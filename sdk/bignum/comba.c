@@ -0,0 +1,147 @@
+/* Comba column kernels: the CPU-specific kernels against the portable ones.
+ *
+ * check  every operand length the comba paths accept, full and truncated
+ *        products, compared column by column
+ * bench  multiply and square at 1024 to 4096 bits, with the speedup over
+ *        the portable kernel where a cpu-specific one is selected
+ */
+#include "harness.h"
+
+/* the limits aws_s_mp_mul_digs and aws_s_mp_sqr put on the comba paths */
+#define COMBA_MAXFAST (1 << ((CHAR_BIT * sizeof(aws_mp_word)) - (2 * AWS_DIGIT_BIT)))
+#define COMBA_MAXLEN  ((AWS_MP_WARRAY - 1) / 2)
+
+static aws_mp_digit A[AWS_MP_WARRAY], B[AWS_MP_WARRAY], W0[AWS_MP_WARRAY], W1[AWS_MP_WARRAY];
+
+static void check_mul(aws_mp_comba_mul_kernel fast, aws_mp_comba_mul_kernel generic, int na, int nb, int pa)
+{
+   harness_fill(A, na);
+   harness_fill(B, nb);
+   fast(W0, A, na, B, nb, pa);
+   generic(W1, A, na, B, nb, pa);
+   HARNESS_EXPECT(memcmp(W0, W1, (size_t)pa * sizeof(aws_mp_digit)) == 0,
+                  "mul na=%d nb=%d pa=%d", na, nb, pa);
+}
+
+static void check_sqr(aws_mp_comba_sqr_kernel fast, aws_mp_comba_sqr_kernel generic, int na)
+{
+   harness_fill(A, na);
+   fast(W0, A, na);
+   generic(W1, A, na);
+   HARNESS_EXPECT(memcmp(W0, W1, (size_t)(2 * na) * sizeof(aws_mp_digit)) == 0, "sqr na=%d", na);
+}
+
+static int check(void)
+{
+   aws_mp_comba_mul_kernel mul = aws_mp_comba_mul_kernel_get(0), mul_c = aws_mp_comba_mul_kernel_get(1);
+   aws_mp_comba_sqr_kernel sqr = aws_mp_comba_sqr_kernel_get(0), sqr_c = aws_mp_comba_sqr_kernel_get(1);
+   int na, nb, rep;
+
+   printf("comba: mul kernel %s, sqr kernel %s, %d-bit digits\n",
+          mul == mul_c ? "portable" : "cpu-specific", sqr == sqr_c ? "portable" : "cpu-specific", AWS_DIGIT_BIT);
+
+   for (na = 1; na <= COMBA_MAXLEN; na += (na < 40) ? 1 : 7) {
+      for (nb = 1; na + nb < AWS_MP_WARRAY && nb <= COMBA_MAXLEN; nb += (nb < 40) ? 1 : 11) {
+         if (na > COMBA_MAXFAST && nb > COMBA_MAXFAST) {
+            continue;
+         }
+         for (rep = 0; rep < 3; rep++) {
+            /* full product, then the truncated ones Barrett and Montgomery ask for */
+            check_mul(mul, mul_c, na, nb, na + nb);
+            check_mul(mul, mul_c, na, nb, 1 + (int)(harness_rand64() % (unsigned)(na + nb)));
+         }
+      }
+      for (rep = 0; rep < 8 && 2 * na + 1 < AWS_MP_WARRAY; rep++) {
+         check_sqr(sqr, sqr_c, na);
+      }
+   }
+   return harness_done("comba");
+}
+
+/* best of five runs, in seconds per call */
+static double time_mul(aws_mp_comba_mul_kernel k, int n)
+{
+   double best = 0, t;
+   int    reps = 50000000 / (n * n) + 1, run, ix;
+
+   for (run = 0; run < 5; run++) {
+      t = harness_now();
+      for (ix = 0; ix < reps; ix++) {
+         k(W0, A, n, B, n, 2 * n);
+      }
+      t = (harness_now() - t) / reps;
+      best = (run == 0 || t < best) ? t : best;
+   }
+   return best;
+}
+
+/* best of five runs, in seconds per call */
+static double time_sqr(aws_mp_comba_sqr_kernel k, int n)
+{
+   double best = 0, t;
+   int    reps = 50000000 / (n * n) + 1, run, ix;
+
+   for (run = 0; run < 5; run++) {
+      t = harness_now();
+      for (ix = 0; ix < reps; ix++) {
+         k(W0, A, n);
+      }
+      t = (harness_now() - t) / reps;
+      best = (run == 0 || t < best) ? t : best;
+   }
+   return best;
+}
+
+static int bench(void)
+{
+   static const int bits[] = { 1024, 2048, 3072, 4096 };
+   aws_mp_comba_mul_kernel mul = aws_mp_comba_mul_kernel_get(0), mul_c = aws_mp_comba_mul_kernel_get(1);
+   aws_mp_comba_sqr_kernel sqr = aws_mp_comba_sqr_kernel_get(0), sqr_c = aws_mp_comba_sqr_kernel_get(1);
+   size_t ix;
+
+   /* a speedup is only printed for a kernel that differs from the portable one */
+   if (mul == mul_c && sqr == sqr_c) {
+      printf("comba: no cpu-specific kernel on this build, portable timings only\n");
+   } else if (sqr == sqr_c) {
+      printf("comba: squaring uses the portable kernel on this build\n");
+   } else if (mul == mul_c) {
+      printf("comba: multiply uses the portable kernel on this build\n");
+   }
+   printf("%6s %12s %7s %12s %7s\n", "bits", "mul ns", "speedup", "sqr ns", "speedup");
+   for (ix = 0; ix < sizeof(bits) / sizeof(bits[0]); ix++) {
+      int    n = (bits[ix] + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT;
+      double m, s;
+
+      if (2 * n + 1 >= AWS_MP_WARRAY) {
+         break;
+      }
+      harness_fill(A, n);
+      harness_fill(B, n);
+      m = time_mul(mul, n);
+      s = time_sqr(sqr, n);
+      printf("%6d %12.0f", bits[ix], m * 1e9);
+      if (mul != mul_c) {
+         printf(" %6.2fx", time_mul(mul_c, n) / m);
+      } else {
+         printf(" %7s", "-");
+      }
+      printf(" %12.0f", s * 1e9);
+      if (sqr != sqr_c) {
+         printf(" %6.2fx\n", time_sqr(sqr_c, n) / s);
+      } else {
+         printf(" %7s\n", "-");
+      }
+   }
+   return 0;
+}
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && strcmp(argv[1], "check") == 0) {
+      return check();
+   }
+   if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+      return bench();
+   }
+   return harness_usage(argv[0]);
+}
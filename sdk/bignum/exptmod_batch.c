@@ -0,0 +1,195 @@
+/* Batched modular exponentiation against aws_mp_exptmod.
+ *
+ * check  moduli from 3 to 4200 bits (across the IFMA size limit), batches
+ *        that are not a multiple of the lane count, zero, one and full-width
+ *        exponents, bases of 0, 1 and N-1, and output aliased to the input.
+ *        Negative exponents and bases outside [0, N) are mixed into batches
+ *        to exercise the fallback.
+ * bench  exponentiations per second at 2048 and 3072 bits, batch against
+ *        aws_mp_exptmod_ctx one at a time
+ */
+#include "harness.h"
+
+#define BATCH_MAX 24
+
+static int odd_modulus(aws_mp_int *N, int bits)
+{
+   int err;
+
+   if ((err = harness_rand_bits(N, bits)) != AWS_MP_OKAY) {
+      return err;
+   }
+   N->dp[0] |= 1;
+   return AWS_MP_OKAY;
+}
+
+/* a random value below N */
+static int below(aws_mp_int *a, aws_mp_int *N)
+{
+   int err, bits = aws_mp_count_bits(N);
+
+   if ((err = harness_rand_bits(a, bits)) != AWS_MP_OKAY) {
+      return err;
+   }
+   return aws_mp_mod(a, N, a);
+}
+
+static void check_batch(aws_mp_int *N, aws_mp_mont_ctx *ctx, aws_mp_int *G, aws_mp_int *X, aws_mp_int *Y, int count, const char *what)
+{
+   aws_mp_int want, A[BATCH_MAX];
+   int        i, err;
+
+   HARNESS_OK(aws_mp_init(&want));
+
+   /* separate outputs */
+   err = aws_mp_exptmod_batch(G, X, count, ctx, Y);
+   HARNESS_EXPECT(err == AWS_MP_OKAY, "%s: batch failed with %d, %d bits count %d", what, err, aws_mp_count_bits(N), count);
+   for (i = 0; i < count && err == AWS_MP_OKAY; i++) {
+      HARNESS_OK(aws_mp_exptmod(&G[i], &X[i], N, &want));
+      HARNESS_EXPECT(aws_mp_cmp(&want, &Y[i]) == AWS_MP_EQ, "%s: %d bits, entry %d of %d, exponent %d bits",
+                     what, aws_mp_count_bits(N), i, count, aws_mp_count_bits(&X[i]));
+   }
+
+   /* outputs written over the bases */
+   for (i = 0; i < count; i++) {
+      HARNESS_OK(aws_mp_init_copy(&A[i], &G[i]));
+   }
+   err = aws_mp_exptmod_batch(A, X, count, ctx, A);
+   HARNESS_EXPECT(err == AWS_MP_OKAY, "%s: aliased batch failed with %d", what, err);
+   for (i = 0; i < count; i++) {
+      HARNESS_EXPECT(err != AWS_MP_OKAY || aws_mp_cmp(&A[i], &Y[i]) == AWS_MP_EQ, "%s: aliased entry %d of %d, %d bits",
+                     what, i, count, aws_mp_count_bits(N));
+      aws_mp_clear(&A[i]);
+   }
+
+   aws_mp_clear(&want);
+}
+
+static int check(void)
+{
+   static const int counts[] = { 1, 3, 8, 9, 17, BATCH_MAX };
+   aws_mp_int      N, G[BATCH_MAX], X[BATCH_MAX], Y[BATCH_MAX];
+   aws_mp_mont_ctx ctx;
+   int             bits, c, i, step;
+
+   printf("exptmod_batch: %d lane(s), %d-bit digits\n", aws_mp_exptmod_batch_lanes(), AWS_DIGIT_BIT);
+
+   HARNESS_OK(aws_mp_init(&N));
+   for (i = 0; i < BATCH_MAX; i++) {
+      HARNESS_OK(aws_mp_init_multi(&G[i], &X[i], &Y[i], NULL));
+   }
+
+   for (bits = 2; bits <= 4200; bits += step) {
+      /* every size around limb and digit boundaries, sparser in between */
+      step = (bits < 300) ? 1 : (bits < 3900) ? 251 : 13;
+      HARNESS_OK(odd_modulus(&N, bits));
+      if (aws_mp_cmp_d(&N, 1) == AWS_MP_EQ) {
+         continue;
+      }
+      HARNESS_OK(aws_mp_mont_ctx_init(&ctx, &N));
+
+      for (c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); c++) {
+         int count = counts[c];
+
+         /* large moduli are slow in the reference, one partial batch each is enough */
+         if (bits >= 1024 && count != 9) {
+            continue;
+         }
+
+         for (i = 0; i < count; i++) {
+            HARNESS_OK(below(&G[i], &N));
+            HARNESS_OK(harness_rand_bits(&X[i], 1 + (int)(harness_rand64() % (unsigned)(bits + 64))));
+         }
+         /* the edges: 0 and 1 as base and exponent, N-1 as base */
+         aws_mp_zero(&X[0]);
+         if (count > 2) {
+            aws_mp_zero(&G[1]);
+            aws_mp_set(&X[2], 1);
+         }
+         if (count > 8) {
+            aws_mp_set(&G[7], 1);
+            HARNESS_OK(aws_mp_sub_d(&N, 1, &G[8]));
+         }
+         check_batch(&N, &ctx, G, X, Y, count, "in range");
+      }
+
+      /* entries the kernel must hand back to aws_mp_exptmod_ctx, mixed with normal ones */
+      if (bits > 8 && bits % 3 == 0) {
+         for (i = 0; i < 9; i++) {
+            HARNESS_OK(below(&G[i], &N));
+            HARNESS_OK(harness_rand_bits(&X[i], bits));
+         }
+         HARNESS_OK(aws_mp_add(&N, &G[3], &G[3]));
+         aws_mp_set(&G[5], 2);
+         HARNESS_OK(aws_mp_neg(&X[5], &X[5]));
+         check_batch(&N, &ctx, G, X, Y, 9, "fallback");
+      }
+
+      aws_mp_mont_ctx_clear(&ctx);
+   }
+
+   for (i = 0; i < BATCH_MAX; i++) {
+      aws_mp_clear_multi(&G[i], &X[i], &Y[i], NULL);
+   }
+   aws_mp_clear(&N);
+   return harness_done("exptmod_batch");
+}
+
+static int bench(void)
+{
+   static const int sizes[][2] = { { 2048, 256 }, { 2048, 2048 }, { 3072, 256 }, { 3072, 3072 } };
+   enum { COUNT = 64 };
+   aws_mp_int      N, G[COUNT], X[COUNT], Y[COUNT];
+   aws_mp_mont_ctx ctx;
+   int             s, i, run;
+
+   printf("exptmod_batch: %d lane(s), exponentiations per second, batches of %d\n", aws_mp_exptmod_batch_lanes(), COUNT);
+   printf("%8s %8s %12s %12s %8s\n", "modulus", "exponent", "one by one", "batch", "speedup");
+   HARNESS_OK(aws_mp_init(&N));
+   for (i = 0; i < COUNT; i++) {
+      HARNESS_OK(aws_mp_init_multi(&G[i], &X[i], &Y[i], NULL));
+   }
+
+   for (s = 0; s < (int)(sizeof(sizes) / sizeof(sizes[0])); s++) {
+      double one = 0, batch = 0, t;
+
+      HARNESS_OK(odd_modulus(&N, sizes[s][0]));
+      HARNESS_OK(aws_mp_mont_ctx_init(&ctx, &N));
+      for (i = 0; i < COUNT; i++) {
+         HARNESS_OK(below(&G[i], &N));
+         HARNESS_OK(harness_rand_bits(&X[i], sizes[s][1]));
+      }
+      for (run = 0; run < 3; run++) {
+         t = harness_now();
+         for (i = 0; i < COUNT; i++) {
+            HARNESS_OK(aws_mp_exptmod_ctx(&G[i], &X[i], &ctx, &Y[i]));
+         }
+         t = COUNT / (harness_now() - t);
+         one = (t > one) ? t : one;
+
+         t = harness_now();
+         HARNESS_OK(aws_mp_exptmod_batch(G, X, COUNT, &ctx, Y));
+         t = COUNT / (harness_now() - t);
+         batch = (t > batch) ? t : batch;
+      }
+      printf("%8d %8d %12.0f %12.0f %7.2fx\n", sizes[s][0], sizes[s][1], one, batch, batch / one);
+      aws_mp_mont_ctx_clear(&ctx);
+   }
+
+   for (i = 0; i < COUNT; i++) {
+      aws_mp_clear_multi(&G[i], &X[i], &Y[i], NULL);
+   }
+   aws_mp_clear(&N);
+   return harness_failures != 0;
+}
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && strcmp(argv[1], "check") == 0) {
+      return check();
+   }
+   if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+      return bench();
+   }
+   return harness_usage(argv[0]);
+}
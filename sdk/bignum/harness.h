@@ -0,0 +1,106 @@
+/* Shared helpers for the bignum checks and benchmarks in this directory.
+ *
+ * Each program runs its differential checks when started with "check" and
+ * its timings when started with "bench"; see the Makefile.
+ */
+#ifndef AWS_BIGNUM_HARNESS_H
+#define AWS_BIGNUM_HARNESS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "aws_tommath.h"
+
+static int harness_failures;
+
+#define HARNESS_EXPECT(cond, ...)                     \
+   do {                                               \
+      if (!(cond)) {                                  \
+         fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__); \
+         fprintf(stderr, __VA_ARGS__);                \
+         fputc('\n', stderr);                         \
+         if (++harness_failures >= 10) {              \
+            exit(1);                                  \
+         }                                            \
+      }                                               \
+   } while (0)
+
+#define HARNESS_OK(expr) HARNESS_EXPECT((expr) == AWS_MP_OKAY, "%s", #expr)
+
+/* monotonic wall time in seconds */
+static inline double harness_now(void)
+{
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* xorshift64*, so runs are reproducible across libcs */
+static unsigned long long harness_state = 0x9e3779b97f4a7c15ULL;
+
+static inline unsigned long long harness_rand64(void)
+{
+   harness_state ^= harness_state >> 12;
+   harness_state ^= harness_state << 25;
+   harness_state ^= harness_state >> 27;
+   return harness_state * 0x2545f4914f6cdd1dULL;
+}
+
+/* random digits, with runs of all-ones and zero digits to exercise carries */
+static inline void harness_fill(aws_mp_digit *dp, int n)
+{
+   int mode = (int)(harness_rand64() % 4), ix;
+
+   for (ix = 0; ix < n; ix++) {
+      switch (mode) {
+      case 0:  dp[ix] = AWS_MP_MASK; break;
+      case 1:  dp[ix] = (harness_rand64() & 1) ? AWS_MP_MASK : 0; break;
+      default: dp[ix] = (aws_mp_digit)harness_rand64() & AWS_MP_MASK; break;
+      }
+   }
+}
+
+/* a random positive integer of exactly "bits" bits */
+static inline int harness_rand_bits(aws_mp_int *a, int bits)
+{
+   int err, ix, digits = (bits + AWS_DIGIT_BIT - 1) / AWS_DIGIT_BIT;
+
+   if ((err = aws_mp_grow(a, digits)) != AWS_MP_OKAY) {
+      return err;
+   }
+   for (ix = 0; ix < digits; ix++) {
+      a->dp[ix] = (aws_mp_digit)harness_rand64() & AWS_MP_MASK;
+   }
+   for (; ix < a->used; ix++) {
+      a->dp[ix] = 0;
+   }
+   a->used = digits;
+   a->sign = AWS_MP_ZPOS;
+   if ((bits % AWS_DIGIT_BIT) != 0) {
+      a->dp[digits - 1] &= ((aws_mp_digit)1 << (bits % AWS_DIGIT_BIT)) - 1;
+   }
+   a->dp[digits - 1] |= (aws_mp_digit)1 << ((bits - 1) % AWS_DIGIT_BIT);
+   aws_mp_clamp(a);
+   return AWS_MP_OKAY;
+}
+
+static inline int harness_usage(const char *argv0)
+{
+   fprintf(stderr, "usage: %s check|bench\n", argv0);
+   return 2;
+}
+
+static inline int harness_done(const char *name)
+{
+   if (harness_failures != 0) {
+      fprintf(stderr, "%s: %d failure(s)\n", name, harness_failures);
+      return 1;
+   }
+   printf("%s: ok\n", name);
+   return 0;
+}
+
+#endif
@@ -0,0 +1,276 @@
+/* Bignum micro-benchmarks and the Karatsuba/Toom-3 cutoff tuner.
+ *
+ * bench [OP...]  time add, mul, sqr, div, exptmod and radix (all by default)
+ * tune [FILE]    measure the multiplication cutoffs of this machine and write
+ *                them as a header for AWS_MP_CUTOFFS_HEADER (stdout by default)
+ *
+ * The tuner changes the library's cutoffs while it searches, which is why it
+ * lives in its own process rather than in the library.
+ */
+#include <limits.h>
+
+#include "harness.h"
+
+/* largest operand in digits tried when tuning Karatsuba, Toom-3 goes to 4x */
+#ifndef MPBENCH_TUNE_MAX
+   #define MPBENCH_TUNE_MAX   256
+#endif
+
+/* digits^2 worth of products timed per size when tuning */
+#ifndef MPBENCH_TUNE_WORK
+   #define MPBENCH_TUNE_WORK  4000000
+#endif
+
+static const int bench_bits[] = { 256, 1024, 2048, 3072, 4096, 8192 };
+
+#define BENCH_SIZES ((int)(sizeof(bench_bits) / sizeof(bench_bits[0])))
+
+/* operands for one size, set up outside the timing */
+typedef struct {
+   aws_mp_int a, b;   /* two random values just under the modulus */
+   aws_mp_int m;      /* an odd modulus and divisor */
+   aws_mp_int ab;     /* a*b, the dividend */
+   aws_mp_int c;      /* result */
+   char      *hex, *dec, *out;
+   int        len;    /* size of each string buffer */
+} bench_args;
+
+typedef int (*bench_op)(bench_args *x);
+
+static int op_add(bench_args *x)       { return aws_mp_add(&x->a, &x->b, &x->c); }
+static int op_mul(bench_args *x)       { return aws_mp_mul(&x->a, &x->b, &x->c); }
+static int op_sqr(bench_args *x)       { return aws_mp_sqr(&x->a, &x->c); }
+static int op_div(bench_args *x)       { return aws_mp_div(&x->ab, &x->m, &x->c, NULL); }
+static int op_exptmod(bench_args *x)   { return aws_mp_exptmod(&x->a, &x->b, &x->m, &x->c); }
+static int op_toradix16(bench_args *x) { return aws_mp_toradix_n(&x->a, x->out, 16, x->len); }
+static int op_toradix10(bench_args *x) { return aws_mp_toradix_n(&x->a, x->out, 10, x->len); }
+static int op_read16(bench_args *x)    { return aws_mp_read_radix(&x->c, x->hex, 16); }
+static int op_read10(bench_args *x)    { return aws_mp_read_radix(&x->c, x->dec, 10); }
+
+static const struct {
+   const char *group, *name;
+   bench_op    op;
+   int         max_bits;
+} bench_ops[] = {
+   { "add",     "add",         op_add,      8192 },
+   { "mul",     "mul",         op_mul,      8192 },
+   { "sqr",     "sqr",         op_sqr,      8192 },
+   { "div",     "div 2n/n",    op_div,      8192 },
+   { "exptmod", "exptmod",     op_exptmod,  4096 },
+   { "radix",   "toradix 16",  op_toradix16, 8192 },
+   { "radix",   "toradix 10",  op_toradix10, 8192 },
+   { "radix",   "read 16",     op_read16,   8192 },
+   { "radix",   "read 10",     op_read10,   8192 },
+};
+
+/* seconds per call, best of three runs of about 50 ms */
+static double bench_time(bench_op op, bench_args *x)
+{
+   double best = 0, t;
+   long   reps = 1, ix;
+   int    run;
+
+   /* find a repeat count worth timing */
+   for (;;) {
+      t = harness_now();
+      for (ix = 0; ix < reps; ix++) {
+         HARNESS_OK(op(x));
+      }
+      t = harness_now() - t;
+      if (t > 0.05 || reps >= (1L << 24)) {
+         break;
+      }
+      reps *= (t < 0.005) ? 10 : 2;
+   }
+
+   for (run = 0; run < 3; run++) {
+      t = harness_now();
+      for (ix = 0; ix < reps; ix++) {
+         HARNESS_OK(op(x));
+      }
+      t = (harness_now() - t) / (double)reps;
+      best = (run == 0 || t < best) ? t : best;
+   }
+   return best;
+}
+
+static int bench_selected(int argc, char **argv, const char *group)
+{
+   int ix;
+
+   if (argc == 0) {
+      return 1;
+   }
+   for (ix = 0; ix < argc; ix++) {
+      if (strcmp(argv[ix], group) == 0) {
+         return 1;
+      }
+   }
+   return 0;
+}
+
+static int bench(int argc, char **argv)
+{
+   aws_mp_cutoffs cut;
+   bench_args     x;
+   int            ix, op, size;
+
+   aws_mp_cutoffs_get(&cut);
+   printf("mpbench: %d-bit digits, cutoffs karatsuba %d/%d toom %d/%d, times in microseconds\n",
+          AWS_DIGIT_BIT, cut.karatsuba_mul, cut.karatsuba_sqr, cut.toom_mul, cut.toom_sqr);
+   printf("%-12s", "op");
+   for (ix = 0; ix < BENCH_SIZES; ix++) {
+      printf(" %10d", bench_bits[ix]);
+   }
+   printf("\n");
+
+   x.len = bench_bits[BENCH_SIZES - 1] + 16;
+   x.hex = malloc((size_t)x.len);
+   x.dec = malloc((size_t)x.len);
+   x.out = malloc((size_t)x.len);
+   if (x.hex == NULL || x.dec == NULL || x.out == NULL ||
+       aws_mp_init_multi(&x.a, &x.b, &x.m, &x.ab, &x.c, NULL) != AWS_MP_OKAY) {
+      return 1;
+   }
+
+   for (op = 0; op < (int)(sizeof(bench_ops) / sizeof(bench_ops[0])); op++) {
+      if (!bench_selected(argc, argv, bench_ops[op].group)) {
+         continue;
+      }
+      printf("%-12s", bench_ops[op].name);
+      for (size = 0; size < BENCH_SIZES; size++) {
+         int bits = bench_bits[size];
+
+         if (bits > bench_ops[op].max_bits) {
+            printf(" %10s", "-");
+            continue;
+         }
+         HARNESS_OK(harness_rand_bits(&x.m, bits));
+         x.m.dp[0] |= 1;
+         HARNESS_OK(harness_rand_bits(&x.a, bits - 1));
+         HARNESS_OK(harness_rand_bits(&x.b, bits - 1));
+         HARNESS_OK(aws_mp_mul(&x.a, &x.b, &x.ab));
+         HARNESS_OK(aws_mp_toradix_n(&x.a, x.hex, 16, x.len));
+         HARNESS_OK(aws_mp_toradix_n(&x.a, x.dec, 10, x.len));
+         printf(" %10.2f", bench_time(bench_ops[op].op, &x) * 1e6);
+         fflush(stdout);
+      }
+      printf("\n");
+   }
+
+   aws_mp_clear_multi(&x.a, &x.b, &x.m, &x.ab, &x.c, NULL);
+   free(x.hex);
+   free(x.dec);
+   free(x.out);
+   return harness_failures != 0;
+}
+
+/* best of three wall times for a batch of products of "a" and "b" */
+static double tune_time(aws_mp_int *a, aws_mp_int *b, aws_mp_int *c, int sqr)
+{
+   double best = 0, t;
+   int    reps, x, y;
+
+   /* aim for about the same amount of work at every size */
+   reps = 1 + (MPBENCH_TUNE_WORK / (a->used * a->used));
+
+   for (x = 0; x < 3; x++) {
+      t = harness_now();
+      for (y = 0; y < reps; y++) {
+         HARNESS_OK((sqr != 0) ? aws_mp_sqr(a, c) : aws_mp_mul(a, b, c));
+      }
+      t = harness_now() - t;
+      best = (x == 0 || t < best) ? t : best;
+   }
+   return best;
+}
+
+/* find the smallest size in [lo, hi] from which setting *cutoff, a member
+ * of "cut", to that size beats leaving it off, for three steps in a row.
+ * *found is left untouched if there is no such size.
+ */
+static void tune_search(aws_mp_cutoffs *cut, int *cutoff, int sqr, int lo, int hi, int step, int *found)
+{
+   aws_mp_int a, b, c;
+   double     t0, t1;
+   int        n, wins = 0;
+
+   HARNESS_OK(aws_mp_init_multi(&a, &b, &c, NULL));
+   for (n = lo; n <= hi; n += step) {
+      HARNESS_OK(aws_mp_rand(&a, n));
+      HARNESS_OK(aws_mp_rand(&b, n));
+
+      *cutoff = INT_MAX;
+      aws_mp_cutoffs_set(cut);
+      t0 = tune_time(&a, &b, &c, sqr);
+      *cutoff = n;
+      aws_mp_cutoffs_set(cut);
+      t1 = tune_time(&a, &b, &c, sqr);
+
+      wins = (t1 < t0) ? wins + 1 : 0;
+      if (wins == 3) {
+         *found = n - 2 * step;
+         break;
+      }
+   }
+   aws_mp_clear_multi(&a, &b, &c, NULL);
+}
+
+/* Karatsuba is tuned against comba/baseline products first, then Toom-3
+ * against the tuned Karatsuba.  A cutoff with no crossover in the searched
+ * range keeps the library's default.
+ */
+static int tune(const char *path)
+{
+   aws_mp_cutoffs defaults, cut, result;
+   FILE          *out = stdout;
+
+   aws_mp_cutoffs_get(&defaults);
+   result = defaults;
+
+   cut = defaults;
+   cut.toom_mul = cut.toom_sqr = INT_MAX;
+   tune_search(&cut, &cut.karatsuba_mul, 0, 8, MPBENCH_TUNE_MAX, 8, &result.karatsuba_mul);
+   cut = defaults;
+   cut.toom_mul = cut.toom_sqr = cut.karatsuba_mul = INT_MAX;
+   tune_search(&cut, &cut.karatsuba_sqr, 1, 8, MPBENCH_TUNE_MAX, 8, &result.karatsuba_sqr);
+
+   cut = result;
+   tune_search(&cut, &cut.toom_mul, 0, result.karatsuba_mul, 4 * MPBENCH_TUNE_MAX, 16, &result.toom_mul);
+   cut = result;
+   tune_search(&cut, &cut.toom_sqr, 1, result.karatsuba_sqr, 4 * MPBENCH_TUNE_MAX, 16, &result.toom_sqr);
+
+   aws_mp_cutoffs_set(&defaults);
+   if (harness_failures != 0) {
+      return 1;
+   }
+
+   if (path != NULL && (out = fopen(path, "w")) == NULL) {
+      perror(path);
+      return 1;
+   }
+   fprintf(out, "/* generated by sdk/bignum \"mpbench tune\", %d-bit digits */\n"
+                "#define AWS_MP_KARATSUBA_MUL_CUTOFF %d\n"
+                "#define AWS_MP_KARATSUBA_SQR_CUTOFF %d\n"
+                "#define AWS_MP_TOOM_MUL_CUTOFF      %d\n"
+                "#define AWS_MP_TOOM_SQR_CUTOFF      %d\n",
+           AWS_DIGIT_BIT, result.karatsuba_mul, result.karatsuba_sqr, result.toom_mul, result.toom_sqr);
+   if (out != stdout && fclose(out) != 0) {
+      perror(path);
+      return 1;
+   }
+   return 0;
+}
+
+int main(int argc, char **argv)
+{
+   if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+      return bench(argc - 2, argv + 2);
+   }
+   if ((argc == 2 || argc == 3) && strcmp(argv[1], "tune") == 0) {
+      return tune(argc == 3 ? argv[2] : NULL);
+   }
+   fprintf(stderr, "usage: %s bench [add|mul|sqr|div|exptmod|radix ...]\n"
+                   "       %s tune [FILE]\n", argv[0], argv[0]);
+   return 2;
+}
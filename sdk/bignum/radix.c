@@ -0,0 +1,278 @@
+/* Radix conversion: the power-of-two and decimal fast paths against the
+ * one-digit-at-a-time algorithms they replaced, which are reproduced here.
+ *
+ * check  every radix from 2 to 64, both signs, sizes up to 40000 bits
+ *        (deep enough for the recursive decimal split), truncated output,
+ *        trailing garbage and lower-case input
+ * bench  hex and decimal, both directions, fast path vs reference
+ */
+#include <ctype.h>
+
+#include "harness.h"
+
+extern const char *aws_mp_s_rmap;
+
+/* the original aws_mp_toradix_n: one aws_mp_div_d per character */
+static int ref_toradix_n(aws_mp_int *a, char *str, int radix, int maxlen)
+{
+   aws_mp_int   t;
+   aws_mp_digit d;
+   char        *s;
+   int          err, digs = 0, ix;
+
+   if (maxlen < 2 || radix < 2 || radix > 64) {
+      return AWS_MP_VAL;
+   }
+   if (aws_mp_iszero(a) == AWS_MP_YES) {
+      strcpy(str, "0");
+      return AWS_MP_OKAY;
+   }
+   if ((err = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+      return err;
+   }
+   if (t.sign == AWS_MP_NEG) {
+      *str++ = '-';
+      t.sign = AWS_MP_ZPOS;
+      --maxlen;
+   }
+   s = str;
+   while (aws_mp_iszero(&t) == AWS_MP_NO) {
+      if (--maxlen < 1) {
+         break;
+      }
+      if ((err = aws_mp_div_d(&t, (aws_mp_digit)radix, &t, &d)) != AWS_MP_OKAY) {
+         aws_mp_clear(&t);
+         return err;
+      }
+      s[digs++] = aws_mp_s_rmap[d];
+   }
+   for (ix = 0; ix < digs / 2; ix++) {
+      char c = s[ix];
+      s[ix] = s[digs - 1 - ix];
+      s[digs - 1 - ix] = c;
+   }
+   s[digs] = '\0';
+   aws_mp_clear(&t);
+   return AWS_MP_OKAY;
+}
+
+/* the original aws_mp_read_radix: a linear search of the map and one
+ * aws_mp_mul_d/aws_mp_add_d per character
+ */
+static int ref_read_radix(aws_mp_int *a, const char *str, int radix)
+{
+   int err, neg, y;
+
+   aws_mp_zero(a);
+   if (radix < 2 || radix > 64) {
+      return AWS_MP_VAL;
+   }
+   neg = (*str == '-') ? AWS_MP_NEG : AWS_MP_ZPOS;
+   if (*str == '-') {
+      ++str;
+   }
+   for (; *str != '\0'; ++str) {
+      char ch = (char)((radix < 36) ? toupper((unsigned char)*str) : *str);
+
+      for (y = 0; y < 64; y++) {
+         if (ch == aws_mp_s_rmap[y]) {
+            break;
+         }
+      }
+      if (y >= radix) {
+         break;
+      }
+      if ((err = aws_mp_mul_d(a, (aws_mp_digit)radix, a)) != AWS_MP_OKAY ||
+          (err = aws_mp_add_d(a, (aws_mp_digit)y, a)) != AWS_MP_OKAY) {
+         return err;
+      }
+   }
+   if (aws_mp_iszero(a) == AWS_MP_NO) {
+      a->sign = neg;
+   }
+   return AWS_MP_OKAY;
+}
+
+/* the original aws_mp_radix_size, including its size of 1 for zero in binary */
+static int ref_radix_size(aws_mp_int *a, int radix, int *size)
+{
+   aws_mp_int   t;
+   aws_mp_digit d;
+   int          err, digs;
+
+   if (radix == 2) {
+      *size = aws_mp_count_bits(a) + (a->sign == AWS_MP_NEG ? 1 : 0) + 1;
+      return AWS_MP_OKAY;
+   }
+   if (aws_mp_iszero(a) == AWS_MP_YES) {
+      *size = 2;
+      return AWS_MP_OKAY;
+   }
+   digs = (a->sign == AWS_MP_NEG) ? 1 : 0;
+   if ((err = aws_mp_init_copy(&t, a)) != AWS_MP_OKAY) {
+      return err;
+   }
+   t.sign = AWS_MP_ZPOS;
+   while (aws_mp_iszero(&t) == AWS_MP_NO) {
+      if ((err = aws_mp_div_d(&t, (aws_mp_digit)radix, &t, &d)) != AWS_MP_OKAY) {
+         aws_mp_clear(&t);
+         return err;
+      }
+      ++digs;
+   }
+   aws_mp_clear(&t);
+   *size = digs + 1;
+   return AWS_MP_OKAY;
+}
+
+static void check_one(aws_mp_int *a, int radix, char *s0, char *s1, int len)
+{
+   aws_mp_int b, c;
+   int        size, want = 0, ix, maxlen;
+   static const int cuts[] = { 2, 3, 7 };
+
+   HARNESS_OK(aws_mp_init_multi(&b, &c, NULL));
+
+   HARNESS_OK(ref_toradix_n(a, s0, radix, len));
+   HARNESS_OK(aws_mp_toradix(a, s1, radix));
+   HARNESS_EXPECT(strcmp(s0, s1) == 0, "toradix radix %d bits %d", radix, aws_mp_count_bits(a));
+
+   HARNESS_OK(aws_mp_radix_size(a, radix, &size));
+   HARNESS_OK(ref_radix_size(a, radix, &want));
+   HARNESS_EXPECT(size == want, "radix_size radix %d bits %d: %d, want %d", radix, aws_mp_count_bits(a), size, want);
+
+   /* round trip, then again with a character that is not a digit appended */
+   HARNESS_OK(aws_mp_read_radix(&b, s0, radix));
+   HARNESS_EXPECT(aws_mp_cmp(a, &b) == AWS_MP_EQ, "read_radix radix %d bits %d", radix, aws_mp_count_bits(a));
+   strcat(s0, (radix <= 36) ? "!1" : "=1");
+   HARNESS_OK(aws_mp_read_radix(&b, s0, radix));
+   HARNESS_EXPECT(aws_mp_cmp(a, &b) == AWS_MP_EQ, "read_radix trailing radix %d", radix);
+
+   /* radices below 36 read either case, the others stop at the first unknown letter */
+   if (radix > 10) {
+      for (ix = 0; s1[ix] != '\0'; ix++) {
+         s0[ix] = (char)tolower((unsigned char)s1[ix]);
+      }
+      s0[ix] = '\0';
+      HARNESS_OK(aws_mp_read_radix(&b, s0, radix));
+      HARNESS_OK(ref_read_radix(&c, s0, radix));
+      HARNESS_EXPECT(aws_mp_cmp(&c, &b) == AWS_MP_EQ, "read_radix lower case radix %d", radix);
+      HARNESS_EXPECT(radix >= 36 || aws_mp_cmp(a, &b) == AWS_MP_EQ, "read_radix lower case radix %d", radix);
+   }
+
+   /* truncated output keeps its old behaviour, the last maxlen-1 digits, and
+    * the fast path takes over from exactly the full size
+    */
+   for (ix = 0; ix < 6; ix++) {
+      maxlen = (ix < 3) ? cuts[ix] : size - 4 + ix;
+      if (maxlen < 2) {
+         continue;
+      }
+      HARNESS_OK(ref_toradix_n(a, s0, radix, maxlen));
+      HARNESS_OK(aws_mp_toradix_n(a, s1, radix, maxlen));
+      HARNESS_EXPECT(strcmp(s0, s1) == 0, "toradix_n radix %d maxlen %d of %d", radix, maxlen, size);
+   }
+
+   aws_mp_clear_multi(&b, &c, NULL);
+}
+
+static int check(void)
+{
+   static const int sizes[] = { 1, 2, 7, 27, 28, 29, 59, 60, 61, 64, 119, 120, 121, 255, 256, 257,
+                                1023, 1024, 1331, 1333, 2048, 3072, 4095, 4096, 5000, 8192, 13290, 20000, 40000 };
+   aws_mp_int a;
+   char      *s0, *s1;
+   int        len = 40000 + 16, radix, ix, sign;
+
+   s0 = malloc((size_t)len);
+   s1 = malloc((size_t)len);
+   HARNESS_EXPECT(s0 != NULL && s1 != NULL, "out of memory");
+   HARNESS_OK(aws_mp_init(&a));
+
+   for (radix = 2; radix <= 64; radix++) {
+      aws_mp_zero(&a);
+      check_one(&a, radix, s0, s1, len);
+      for (ix = 0; ix < (int)(sizeof(sizes) / sizeof(sizes[0])); ix++) {
+         /* the slow reference makes the largest sizes expensive, keep them to the fast radices */
+         if (sizes[ix] > 8192 && radix != 10 && radix != 16 && radix != 64 && radix != 2) {
+            continue;
+         }
+         for (sign = 0; sign < 2; sign++) {
+            HARNESS_OK(harness_rand_bits(&a, sizes[ix]));
+            a.sign = sign ? AWS_MP_NEG : AWS_MP_ZPOS;
+            check_one(&a, radix, s0, s1, len);
+         }
+      }
+   }
+
+   /* powers of the radix and one less are where a decimal size estimate is off by one */
+   for (ix = 1; ix < 1300; ix += 37) {
+      HARNESS_OK(aws_mp_set_int(&a, 10));
+      HARNESS_OK(aws_mp_expt_d(&a, (aws_mp_digit)ix, &a));
+      check_one(&a, 10, s0, s1, len);
+      HARNESS_OK(aws_mp_sub_d(&a, 1, &a));
+      check_one(&a, 10, s0, s1, len);
+   }
+
+   aws_mp_clear(&a);
+   free(s0);
+   free(s1);
+   return harness_done("radix");
+}
+
+/* microseconds per call, best of three */
+#define BENCH_TIME(result, call)                                   \
+   do {                                                            \
+      double _t;                                                   \
+      int    _run, _ix, _reps = 2000000 / bits + 1;                \
+      for (_run = 0; _run < 3; _run++) {                           \
+         _t = harness_now();                                       \
+         for (_ix = 0; _ix < _reps; _ix++) {                       \
+            HARNESS_OK(call);                                      \
+         }                                                         \
+         _t = (harness_now() - _t) / _reps * 1e6;                  \
+         result = (_run == 0 || _t < result) ? _t : result;        \
+      }                                                            \
+   } while (0)
+
+static int bench(void)
+{
+   static const int sizes[] = { 256, 1024, 2048, 3072, 4096, 8192, 16384 };
+   static const int radices[] = { 16, 10 };
+   aws_mp_int a, b;
+   char      *s;
+   int        len = 16384 + 16, ix, r;
+
+   s = malloc((size_t)len);
+   HARNESS_OK(aws_mp_init_multi(&a, &b, NULL));
+   printf("%5s %6s %12s %12s %7s %12s %12s %7s\n", "radix", "bits", "toradix us", "reference us", "speedup",
+          "read us", "reference us", "speedup");
+   for (r = 0; r < 2; r++) {
+      for (ix = 0; ix < (int)(sizeof(sizes) / sizeof(sizes[0])); ix++) {
+         int    bits = sizes[ix], radix = radices[r];
+         double to = 0, to_ref = 0, rd = 0, rd_ref = 0;
+
+         HARNESS_OK(harness_rand_bits(&a, bits));
+         BENCH_TIME(to, aws_mp_toradix(&a, s, radix));
+         BENCH_TIME(to_ref, ref_toradix_n(&a, s, radix, len));
+         BENCH_TIME(rd, aws_mp_read_radix(&b, s, radix));
+         BENCH_TIME(rd_ref, ref_read_radix(&b, s, radix));
+         printf("%5d %6d %12.2f %12.2f %6.1fx %12.2f %12.2f %6.1fx\n", radix, bits,
+                to, to_ref, to_ref / to, rd, rd_ref, rd_ref / rd);
+      }
+   }
+   aws_mp_clear_multi(&a, &b, NULL);
+   free(s);
+   return harness_failures != 0;
+}
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && strcmp(argv[1], "check") == 0) {
+      return check();
+   }
+   if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+      return bench();
+   }
+   return harness_usage(argv[0]);
+}
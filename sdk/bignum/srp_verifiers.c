@@ -0,0 +1,231 @@
+/* SRP verifiers v = g^x mod N over the default Cognito group, in parallel.
+ *
+ * This is the arithmetic AWSCognitoIdentityProviderSrpHelper's
+ * helpersWithPoolName:userNames:passwords: spreads over the cores: one
+ * Montgomery context and one 256-bit comb table for g = 2, set up once and
+ * shared read-only by every thread, each thread filling its own slice of
+ * the results in order.  x is a random 256-bit value standing in for the
+ * salted password hash, so the timings are the exponentiations alone.
+ *
+ * check  verifiers from 1 to 8 threads, over counts that do not divide
+ *        evenly, against aws_mp_exptmod one at a time
+ * bench  verifiers per second and per second per thread, from one thread
+ *        up to the number of online CPUs, comb table against
+ *        aws_mp_exptmod_ctx with the same shared context
+ */
+#include <pthread.h>
+#include <unistd.h>
+
+#include "harness.h"
+
+static const char N_HEX[] =
+   "FFFFFFFFFFFFFFFFC90FDAA22168C234C4C6628B80DC1CD129024E088A67CC74020BBEA63B139B22514A08798E3404DDEF9519B3CD"
+   "3A431B302B0A6DF25F14374FE1356D6D51C245E485B576625E7EC6F44C42E9A637ED6B0BFF5CB6F406B7EDEE386BFB5A899FA5AE9F"
+   "24117C4B1FE649286651ECE45B3DC2007CB8A163BF0598DA48361C55D39A69163FA8FD24CF5F83655D23DCA3AD961C62F356208552"
+   "BB9ED529077096966D670C354E4ABC9804F1746C08CA18217C32905E462E36CE3BE39E772C180E86039B2783A2EC07A28FB5C55DF0"
+   "6F4C52C9DE2BCBF6955817183995497CEA956AE515D2261898FA051015728E5A8AAAC42DAD33170D04507A33A85521ABDF1CBA64EC"
+   "FB850458DBEF0A8AEA71575D060C7DB3970F85A6E1E4C7ABF5AE8CDB0933D71E8C94E04A25619DCEE3D2261AD2EE6BF12FFA06D98A"
+   "0864D87602733EC86A64521F2B18177B200CBBE117577A615D6C770988C0BAD946E208E24FA074E5AB3143DB5BFCE0FD108E4B82D1"
+   "20A93AD2CAFFFFFFFFFFFFFFFF";
+
+/* the helper's comb: x is a SHA-256 output, at most 256 bits */
+#define COMB_BITS   256
+#define COMB_TEETH  8
+#define MAX_THREADS 64
+
+/* the shared group, read-only once set up */
+static aws_mp_int      N, g;
+static aws_mp_mont_ctx ctx;
+static aws_mp_comb     comb;
+
+struct slice {
+   pthread_t   thread;
+   aws_mp_int *X, *V;
+   int         start, end, use_comb, err;
+};
+
+static void *verifiers(void *arg)
+{
+   struct slice *s = arg;
+   int           i;
+
+   for (i = s->start; i < s->end && s->err == AWS_MP_OKAY; i++) {
+      s->err = s->use_comb ? aws_mp_exptmod_comb(&s->X[i], &comb, &s->V[i])
+                           : aws_mp_exptmod_ctx(&g, &s->X[i], &ctx, &s->V[i]);
+   }
+   return NULL;
+}
+
+/* V[i] = g^X[i] mod N for i < count on "threads" threads, each taking a contiguous slice */
+static int verifiers_parallel(aws_mp_int *X, aws_mp_int *V, int count, int threads, int use_comb)
+{
+   struct slice s[MAX_THREADS];
+   int          t, started, err = AWS_MP_OKAY;
+
+   for (t = 0; t < threads; t++) {
+      s[t].X = X;
+      s[t].V = V;
+      s[t].start = (int)((long)count * t / threads);
+      s[t].end = (int)((long)count * (t + 1) / threads);
+      s[t].use_comb = use_comb;
+      s[t].err = AWS_MP_OKAY;
+   }
+   /* the calling thread takes the first slice */
+   for (started = 1; started < threads; started++) {
+      if (pthread_create(&s[started].thread, NULL, verifiers, &s[started]) != 0) {
+         break;
+      }
+   }
+   verifiers(&s[0]);
+   for (t = started; t < threads; t++) {
+      verifiers(&s[t]);
+   }
+   for (t = 1; t < started; t++) {
+      pthread_join(s[t].thread, NULL);
+   }
+   for (t = 0; t < threads; t++) {
+      if (s[t].err != AWS_MP_OKAY) {
+         err = s[t].err;
+      }
+   }
+   return err;
+}
+
+static int group_init(void)
+{
+   int err;
+
+   if ((err = aws_mp_init_multi(&N, &g, NULL)) != AWS_MP_OKAY) {
+      return err;
+   }
+   if ((err = aws_mp_read_radix(&N, N_HEX, 16)) != AWS_MP_OKAY) {
+      return err;
+   }
+   aws_mp_set(&g, 2);
+   if ((err = aws_mp_mont_ctx_init(&ctx, &N)) != AWS_MP_OKAY) {
+      return err;
+   }
+   return aws_mp_comb_init(&comb, &g, COMB_BITS, COMB_TEETH, &ctx);
+}
+
+static void group_clear(void)
+{
+   aws_mp_comb_clear(&comb);
+   aws_mp_mont_ctx_clear(&ctx);
+   aws_mp_clear_multi(&N, &g, NULL);
+}
+
+static int check(void)
+{
+   static const int counts[] = { 1, 2, 7, 64, 257 };
+   enum { COUNT = 257 };
+   aws_mp_int X[COUNT], V[COUNT], want;
+   int        c, i, threads, use_comb;
+
+   HARNESS_OK(group_init());
+   HARNESS_OK(aws_mp_init(&want));
+   for (i = 0; i < COUNT; i++) {
+      HARNESS_OK(aws_mp_init_multi(&X[i], &V[i], NULL));
+   }
+
+   for (c = 0; c < (int)(sizeof(counts) / sizeof(counts[0])); c++) {
+      int count = counts[c];
+
+      for (i = 0; i < count; i++) {
+         HARNESS_OK(harness_rand_bits(&X[i], 1 + (int)(harness_rand64() % COMB_BITS)));
+      }
+      /* a zero and a full-width exponent */
+      aws_mp_zero(&X[0]);
+      if (count > 1) {
+         HARNESS_OK(harness_rand_bits(&X[1], COMB_BITS));
+      }
+
+      for (threads = 1; threads <= 8; threads++) {
+         for (use_comb = 0; use_comb < 2; use_comb++) {
+            for (i = 0; i < count; i++) {
+               aws_mp_zero(&V[i]);
+            }
+            HARNESS_OK(verifiers_parallel(X, V, count, threads, use_comb));
+            for (i = 0; i < count; i++) {
+               HARNESS_OK(aws_mp_exptmod(&g, &X[i], &N, &want));
+               HARNESS_EXPECT(aws_mp_cmp(&want, &V[i]) == AWS_MP_EQ, "%s: entry %d of %d on %d thread(s)",
+                              use_comb ? "comb" : "exptmod_ctx", i, count, threads);
+            }
+         }
+      }
+   }
+
+   for (i = 0; i < COUNT; i++) {
+      aws_mp_clear_multi(&X[i], &V[i], NULL);
+   }
+   aws_mp_clear(&want);
+   group_clear();
+   return harness_done("srp_verifiers");
+}
+
+/* best of three, in verifiers per second */
+static double rate(aws_mp_int *X, aws_mp_int *V, int count, int threads, int use_comb)
+{
+   double best = 0, t;
+   int    run;
+
+   for (run = 0; run < 3; run++) {
+      t = harness_now();
+      HARNESS_OK(verifiers_parallel(X, V, count, threads, use_comb));
+      t = count / (harness_now() - t);
+      best = (t > best) ? t : best;
+   }
+   return best;
+}
+
+static int bench(void)
+{
+   enum { PER_THREAD = 256 };
+   long        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+   int         max_threads = (cpus < 1) ? 1 : (cpus > MAX_THREADS) ? MAX_THREADS : (int)cpus;
+   int         count = PER_THREAD * max_threads, threads, i;
+   aws_mp_int *X, *V;
+
+   X = calloc((size_t)count, sizeof(*X));
+   V = calloc((size_t)count, sizeof(*V));
+   if (X == NULL || V == NULL) {
+      free(X);
+      free(V);
+      return 1;
+   }
+   HARNESS_OK(group_init());
+   for (i = 0; i < count; i++) {
+      HARNESS_OK(aws_mp_init_multi(&X[i], &V[i], NULL));
+      HARNESS_OK(harness_rand_bits(&X[i], COMB_BITS));
+   }
+
+   printf("srp_verifiers: %d-bit N, g = 2, %d-bit x, %d per thread, %ld online cpu(s)\n",
+          aws_mp_count_bits(&N), COMB_BITS, PER_THREAD, cpus);
+   printf("%7s %12s %12s %12s %12s %8s\n", "threads", "ctx /s", "ctx /s/core", "comb /s", "comb /s/core", "speedup");
+   for (threads = 1; threads <= max_threads; threads = (threads * 2 > max_threads && threads < max_threads) ? max_threads : threads * 2) {
+      int    n = PER_THREAD * threads;
+      double one = rate(X, V, n, threads, 0), combed = rate(X, V, n, threads, 1);
+
+      printf("%7d %12.0f %12.0f %12.0f %12.0f %7.2fx\n", threads,
+             one, one / threads, combed, combed / threads, combed / one);
+   }
+
+   for (i = 0; i < count; i++) {
+      aws_mp_clear_multi(&X[i], &V[i], NULL);
+   }
+   free(X);
+   free(V);
+   group_clear();
+   return harness_failures != 0;
+}
+
+int main(int argc, char **argv)
+{
+   if (argc == 2 && strcmp(argv[1], "check") == 0) {
+      return check();
+   }
+   if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+      return bench();
+   }
+   return harness_usage(argv[0]);
+}
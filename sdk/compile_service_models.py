@@ -0,0 +1,226 @@
+#!/usr/bin/env python3
+"""
+Compiles AWS service models into the *Resources.m files the SDK clients read their
+definitions from.
+
+The model is stored without documentation and split into one compact JSON string per
+operation and per shape, in name-sorted static tables. At runtime the tables are wrapped
+in AWSServiceModelDictionary, which parses an entry the first time it is looked up, so a
+client no longer parses the whole model (hundreds of KB for S3) before its first call.
+
+Usage:
+    compile_service_models.py MODEL OUTPUT [MODEL OUTPUT ...]
+
+MODEL is a service model JSON file, or a *Resources.m from before this format that still
+embeds the model as its definitionString. OUTPUT is the *Resources.m to write; the class
+is named after the file. An existing OUTPUT keeps its license header.
+"""
+
+import json
+import os
+import sys
+
+DEFINITION_STRING_START = '- (NSString *)definitionString {\n    return @"'
+DEFINITION_STRING_END = '";\n}'
+
+# Keys that only carry documentation. A member that happens to be called "documentation"
+# is a dictionary, not a string, and is kept.
+DOCUMENTATION_KEYS = ('documentation', 'documentationUrl')
+
+LICENSE_HEADER = """//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+"""
+
+
+def unescape_objc_string(body):
+    """Undoes the escaping of an Objective-C string literal split with line continuations."""
+    out = []
+    i = 0
+    while i < len(body):
+        c = body[i]
+        if c == '\\':
+            nxt = body[i + 1]
+            if nxt == '\n':
+                pass
+            elif nxt in '"\\':
+                out.append(nxt)
+            else:
+                raise ValueError('unsupported escape \\%s' % nxt)
+            i += 2
+        else:
+            out.append(c)
+            i += 1
+    return ''.join(out)
+
+
+def load_model(path):
+    with open(path, encoding='utf-8') as f:
+        source = f.read()
+    if not path.endswith('.m'):
+        return json.loads(source)
+    start = source.find(DEFINITION_STRING_START)
+    if start < 0:
+        raise ValueError('%s has no definitionString to compile' % path)
+    start += len(DEFINITION_STRING_START)
+    end = source.index(DEFINITION_STRING_END, start)
+    return json.loads(unescape_objc_string(source[start:end]))
+
+
+def strip_documentation(node):
+    if isinstance(node, dict):
+        return {key: strip_documentation(value) for key, value in node.items()
+                if not (key in DOCUMENTATION_KEYS and isinstance(value, str))}
+    if isinstance(node, list):
+        return [strip_documentation(value) for value in node]
+    return node
+
+
+def c_string(text):
+    """A C string literal of text; compact ASCII JSON in, so only a few characters need escaping."""
+    escaped = text.replace('\\', '\\\\').replace('"', '\\"').replace('?', '\\?')
+    return '"%s"' % escaped
+
+
+def compact_json(value):
+    return json.dumps(value, separators=(',', ':'), ensure_ascii=True, sort_keys=True)
+
+
+def entry_table(name, entries):
+    lines = ['static const AWSServiceModelEntry %s[] = {' % name]
+    # Sorted by UTF-8 bytes: AWSServiceModelDictionary looks names up with strcmp.
+    for key in sorted(entries, key=lambda k: k.encode('utf-8')):
+        lines.append('    {%s, %s},' % (c_string(key), c_string(compact_json(entries[key]))))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def license_header(output_path):
+    if not os.path.exists(output_path):
+        return LICENSE_HEADER
+    header = []
+    with open(output_path, encoding='utf-8') as f:
+        for line in f:
+            if not line.startswith('//'):
+                break
+            header.append(line)
+    return ''.join(header) or LICENSE_HEADER
+
+
+def render(model, output_path):
+    class_name = os.path.splitext(os.path.basename(output_path))[0]
+    prefix = class_name[:-len('Resources')] if class_name.endswith('Resources') else class_name
+    model = strip_documentation(model)
+    operations = model.pop('operations')
+    shapes = model.pop('shapes')
+    if not operations or not shapes:
+        raise ValueError('%s: a model needs operations and shapes' % output_path)
+
+    # Files inside AWSCore import its headers directly; the other pods go through the framework.
+    in_core = '%sAWSCore%sAWSCore%s' % (os.sep, os.sep, os.sep) in os.path.abspath(output_path)
+    core_import = '"%s"' if in_core else '<AWSCore/%s>'
+
+    definition = '%sDefinition' % prefix
+    operations_table = '%sOperations' % prefix
+    shapes_table = '%sShapes' % prefix
+
+    return """{license}
+#import "{class_name}.h"
+#import {lumberjack}
+#import {serialization}
+
+// Generated by sdk/compile_service_models.py from the {service} model. Do not edit.
+
+// Everything in the model but its operations and shapes.
+static const char {definition}[] = {definition_json};
+
+{operations_table_source}
+
+{shapes_table_source}
+
+@interface {class_name} ()
+
+@property (nonatomic, strong) NSDictionary *definitionDictionary;
+
+@end
+
+@implementation {class_name}
+
++ (instancetype)sharedInstance {{
+    static {class_name} *_sharedResources = nil;
+    static dispatch_once_t once_token;
+
+    dispatch_once(&once_token, ^{{
+        _sharedResources = [{class_name} new];
+    }});
+
+    return _sharedResources;
+}}
+
+- (NSDictionary *)JSONObject {{
+    return self.definitionDictionary;
+}}
+
+- (instancetype)init {{
+    if (self = [super init]) {{
+        //init method
+        NSError *error = nil;
+        NSDictionary *definitionDictionary = [NSJSONSerialization JSONObjectWithData:[NSData dataWithBytesNoCopy:(void *){definition}
+                                                                                                           length:sizeof({definition}) - 1
+                                                                                                     freeWhenDone:NO]
+                                                                               options:kNilOptions
+                                                                                 error:&error];
+        if (definitionDictionary == nil) {{
+            if (error) {{
+                AWSDDLogError(@"Failed to parse JSON service definition: %@",error);
+            }}
+        }} else {{
+            NSMutableDictionary *mutableDefinitionDictionary = [definitionDictionary mutableCopy];
+            mutableDefinitionDictionary[@"operations"] = [[AWSServiceModelDictionary alloc] initWithEntries:{operations_table}
+                                                                                                      count:sizeof({operations_table}) / sizeof({operations_table}[0])];
+            mutableDefinitionDictionary[@"shapes"] = [[AWSServiceModelDictionary alloc] initWithEntries:{shapes_table}
+                                                                                                  count:sizeof({shapes_table}) / sizeof({shapes_table}[0])];
+            _definitionDictionary = [mutableDefinitionDictionary copy];
+        }}
+    }}
+    return self;
+}}
+
+@end
+""".format(license=license_header(output_path),
+           class_name=class_name,
+           lumberjack=core_import % 'AWSCocoaLumberjack.h',
+           serialization=core_import % 'AWSSerialization.h',
+           service=model.get('metadata', {}).get('serviceFullName', prefix),
+           definition=definition,
+           definition_json=c_string(compact_json(model)),
+           operations_table=operations_table,
+           operations_table_source=entry_table(operations_table, operations),
+           shapes_table=shapes_table,
+           shapes_table_source=entry_table(shapes_table, shapes))
+
+
+def main(argv):
+    if len(argv) < 3 or len(argv) % 2 == 0:
+        sys.stderr.write(__doc__)
+        return 2
+    for model_path, output_path in zip(argv[1::2], argv[2::2]):
+        source = render(load_model(model_path), output_path)
+        with open(output_path, 'w', encoding='utf-8') as f:
+            f.write(source)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
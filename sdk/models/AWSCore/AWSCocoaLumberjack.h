@@ -0,0 +1,5 @@
+//
+// The *Resources.m files outside AWSCore import the logger as <AWSCore/AWSCocoaLumberjack.h>.
+//
+
+#import "../AWSCocoaLumberjack.h"
@@ -0,0 +1,5 @@
+//
+// The *Resources.m files outside AWSCore import the serializers as <AWSCore/AWSSerialization.h>.
+//
+
+#import "../../../Pods/AWSCore/AWSCore/Serialization/AWSSerialization.h"
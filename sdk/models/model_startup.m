@@ -0,0 +1,262 @@
+//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Service models in static tables (AWSServiceModelDictionary) against the JSON
+// definitionString the *Resources.m files parsed in sharedInstance before.
+//
+// check  for S3, Cognito Identity Provider and STS, the tables hold the old
+//        model without its documentation: same version, metadata, operations
+//        and shapes
+// bench  time and resident memory (phys_footprint) of a fresh process's first
+//        call, which loads the model and resolves one operation and every
+//        shape it reaches, and of resolving the whole model; the median of
+//        five child processes per row
+
+#import <Foundation/Foundation.h>
+#import <mach/mach.h>
+#import <mach/mach_time.h>
+
+#import "AWSCognitoIdentityProviderLegacyResources.h"
+#import "AWSCognitoIdentityProviderResources.h"
+#import "AWSS3LegacyResources.h"
+#import "AWSS3Resources.h"
+#import "AWSSTSLegacyResources.h"
+#import "AWSSTSResources.h"
+
+@protocol AWSServiceResources <NSObject>
+
++ (instancetype)sharedInstance;
+- (NSDictionary *)JSONObject;
+
+@end
+
+typedef struct {
+    const char *name;
+    const char *firstOperation;
+} AWSService;
+
+static const AWSService Services[] = {
+    {"AWSS3", "PutObject"},
+    {"AWSCognitoIdentityProvider", "InitiateAuth"},
+    {"AWSSTS", "AssumeRoleWithWebIdentity"},
+};
+
+static const int ServiceCount = sizeof(Services) / sizeof(Services[0]);
+
+static Class<AWSServiceResources> ResourcesClass(const AWSService *service, BOOL legacy) {
+    return NSClassFromString([NSString stringWithFormat:@"%s%@Resources", service->name, legacy ? @"Legacy" : @""]);
+}
+
+// The old model as the generator stores it: documentation strings dropped, same as compile_service_models.py.
+static id StripDocumentation(id node) {
+    if ([node isKindOfClass:[NSDictionary class]]) {
+        NSMutableDictionary *stripped = [NSMutableDictionary dictionaryWithCapacity:[node count]];
+        [node enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+            if (([key isEqual:@"documentation"] || [key isEqual:@"documentationUrl"]) && [value isKindOfClass:[NSString class]]) {
+                return;
+            }
+            stripped[key] = StripDocumentation(value);
+        }];
+        return stripped;
+    }
+    if ([node isKindOfClass:[NSArray class]]) {
+        NSMutableArray *stripped = [NSMutableArray arrayWithCapacity:[node count]];
+        for (id value in node) {
+            [stripped addObject:StripDocumentation(value)];
+        }
+        return stripped;
+    }
+    return node;
+}
+
+static int Check(void) {
+    int failures = 0;
+    for (int i = 0; i < ServiceCount; i++) {
+        @autoreleasepool {
+            const AWSService *service = &Services[i];
+            NSDictionary *expected = StripDocumentation([[ResourcesClass(service, YES) sharedInstance] JSONObject]);
+            NSDictionary *actual = [[ResourcesClass(service, NO) sharedInstance] JSONObject];
+            if (!expected || !actual) {
+                fprintf(stderr, "FAIL %s: model did not load\n", service->name);
+                failures++;
+                continue;
+            }
+
+            NSMutableSet *keys = [NSMutableSet setWithArray:expected.allKeys];
+            [keys addObjectsFromArray:actual.allKeys];
+            for (NSString *key in keys) {
+                NSDictionary *want = expected[key];
+                NSDictionary *got = actual[key];
+                if (![want isEqual:got]) {
+                    fprintf(stderr, "FAIL %s: %s differs\n", service->name, key.UTF8String);
+                    failures++;
+                }
+            }
+            // Entry by entry too, so a table that enumerates differently from its lookups is caught.
+            for (NSString *table in @[@"operations", @"shapes"]) {
+                NSDictionary *want = expected[table];
+                NSDictionary *got = actual[table];
+                NSUInteger found = 0;
+                for (NSString *name in got) {
+                    found++;
+                    if (![want[name] isEqual:got[name]]) {
+                        fprintf(stderr, "FAIL %s: %s %s differs\n", service->name, table.UTF8String, name.UTF8String);
+                        failures++;
+                    }
+                }
+                if (found != want.count || got.count != want.count) {
+                    fprintf(stderr, "FAIL %s: %lu %s enumerated, count %lu, want %lu\n", service->name, (unsigned long)found,
+                            table.UTF8String, (unsigned long)got.count, (unsigned long)want.count);
+                    failures++;
+                }
+            }
+        }
+    }
+
+    if (failures) {
+        fprintf(stderr, "model_startup: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("model_startup: ok\n");
+    return 0;
+}
+
+static void Resolve(NSDictionary *shapes, NSString *name, NSMutableSet *resolved) {
+    if (!name || [resolved containsObject:name]) {
+        return;
+    }
+    [resolved addObject:name];
+    NSDictionary *shape = shapes[name];
+    for (NSDictionary *member in [shape[@"members"] allValues]) {
+        Resolve(shapes, member[@"shape"], resolved);
+    }
+    Resolve(shapes, shape[@"member"][@"shape"], resolved);
+    Resolve(shapes, shape[@"key"][@"shape"], resolved);
+    Resolve(shapes, shape[@"value"][@"shape"], resolved);
+}
+
+static uint64_t Footprint(void) {
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, (task_info_t)&info, &count) != KERN_SUCCESS) {
+        return 0;
+    }
+    return info.phys_footprint;
+}
+
+// Child process: one measurement in a fresh process, printed as "microseconds KiB".
+static int Measure(const char *path, const char *scope, const char *serviceName) {
+    const AWSService *service = NULL;
+    for (int i = 0; i < ServiceCount; i++) {
+        if (strcmp(Services[i].name, serviceName) == 0) {
+            service = &Services[i];
+        }
+    }
+    if (!service || (strcmp(path, "json") != 0 && strcmp(path, "tables") != 0)) {
+        return 2;
+    }
+    Class<AWSServiceResources> resourcesClass = ResourcesClass(service, strcmp(path, "json") == 0);
+    BOOL all = strcmp(scope, "all") == 0;
+    NSMutableSet *resolved = [NSMutableSet set];
+    mach_timebase_info_data_t timebase;
+    mach_timebase_info(&timebase);
+
+    uint64_t footprint = Footprint();
+    uint64_t start = mach_absolute_time();
+    NSDictionary *model = [[resourcesClass sharedInstance] JSONObject];
+    NSDictionary *operations = model[@"operations"];
+    NSDictionary *shapes = model[@"shapes"];
+    for (NSString *name in all ? operations.allKeys : @[@(service->firstOperation)]) {
+        NSDictionary *operation = operations[name];
+        Resolve(shapes, operation[@"input"][@"shape"], resolved);
+        Resolve(shapes, operation[@"output"][@"shape"], resolved);
+    }
+    if (all) {
+        for (NSString *name in shapes) {
+            Resolve(shapes, name, resolved);
+        }
+    }
+    uint64_t elapsed = mach_absolute_time() - start;
+    int64_t grown = (int64_t)(Footprint() - footprint);
+
+    if (resolved.count == 0) {
+        return 1;
+    }
+    printf("%.1f %.1f\n", elapsed * timebase.numer / timebase.denom / 1e3, grown / 1024.0);
+    return 0;
+}
+
+static int CompareDoubles(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Medians of five child processes.
+static BOOL Run(const char *path, const char *scope, const char *service, double *microseconds, double *kib) {
+    enum { Runs = 5 };
+    double times[Runs], sizes[Runs];
+    NSString *executable = [NSProcessInfo processInfo].arguments[0];
+    for (int run = 0; run < Runs; run++) {
+        NSString *command = [NSString stringWithFormat:@"'%@' measure %s %s %s", executable, path, scope, service];
+        FILE *child = popen(command.UTF8String, "r");
+        if (!child) {
+            return NO;
+        }
+        int fields = fscanf(child, "%lf %lf", &times[run], &sizes[run]);
+        if (pclose(child) != 0 || fields != 2) {
+            return NO;
+        }
+    }
+    qsort(times, Runs, sizeof(double), CompareDoubles);
+    qsort(sizes, Runs, sizeof(double), CompareDoubles);
+    *microseconds = times[Runs / 2];
+    *kib = sizes[Runs / 2];
+    return YES;
+}
+
+static int Bench(void) {
+    printf("model_startup: fresh process, median of 5\n");
+    printf("%-28s %-6s %10s %10s %8s %10s %10s\n", "service", "scope", "JSON ms", "tables ms", "speedup", "JSON KiB", "tables KiB");
+    for (int i = 0; i < ServiceCount; i++) {
+        for (int all = 0; all < 2; all++) {
+            const char *scope = all ? "all" : "first";
+            double jsonTime, jsonSize, tablesTime, tablesSize;
+            if (!Run("json", scope, Services[i].name, &jsonTime, &jsonSize)
+                || !Run("tables", scope, Services[i].name, &tablesTime, &tablesSize)) {
+                fprintf(stderr, "model_startup: measuring %s failed\n", Services[i].name);
+                return 1;
+            }
+            printf("%-28s %-6s %10.2f %10.2f %7.2fx %10.0f %10.0f\n", Services[i].name, scope,
+                   jsonTime / 1e3, tablesTime / 1e3, jsonTime / tablesTime, jsonSize, tablesSize);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        if (argc == 2 && strcmp(argv[1], "check") == 0) {
+            return Check();
+        }
+        if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+            return Bench();
+        }
+        if (argc == 5 && strcmp(argv[1], "measure") == 0) {
+            return Measure(argv[2], argv[3], argv[4]);
+        }
+        fprintf(stderr, "usage: %s check|bench\n", argv[0]);
+        return 2;
+    }
+}
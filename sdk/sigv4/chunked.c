@@ -0,0 +1,353 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// aws-chunked upload signing (STREAMING-AWS4-HMAC-SHA256-PAYLOAD), as done by
+// AWSS3ChunkedEncodingInputStream.
+//
+// check  the chunk signature chain of the S3 documentation example, and random
+//        chains against a reference HMAC over the chunk string-to-sign
+// bench  throughput into a local sink: chunks are read from memory, framed and
+//        signed the way the stream does it, then copied out. Serial, with a
+//        producer thread filling one of two buffers while the other is drained,
+//        and with both buffers filled and their payloads hashed side by side
+//        (aws_sigv4_chunk_signatures), as the producer does when both are free.
+
+#include <pthread.h>
+
+#include "harness.h"
+
+// "<6 hex digits>;chunk-signature=<64 hex>\r\n" and "\r\n" around the payload
+#define CHUNK_HEADER_LENGTH  (6 + 17 + AWS_SIGV4_SIGNATURE_LENGTH + 2)
+#define CHUNK_TRAILER_LENGTH 2
+
+static const char *const AmzDate = "20130524T000000Z";
+static const char *const Scope = "20130524/us-east-1/s3/aws4_request";
+
+static void chunk_key(aws_hmac_sha256_ctx *chunkKey, const char *secret) {
+    uint8_t derived[AWS_SHA256_DIGEST_LENGTH];
+    aws_hmac_sha256_ctx key;
+
+    aws_sigv4_derive_key(secret, strlen(secret), "20130524", 8, "us-east-1", 9, "s3", 2, derived);
+    aws_hmac_sha256_init(&key, derived, sizeof(derived));
+    aws_sigv4_chunk_key(chunkKey, &key, AmzDate, strlen(AmzDate), Scope, strlen(Scope));
+}
+
+// HMAC over "AWS4-HMAC-SHA256-PAYLOAD\n date\n scope\n previous\n hash("")\n hash(payload)"
+static void ref_chunk_signature(const uint8_t derived[AWS_SHA256_DIGEST_LENGTH], const char previous[64],
+                                const void *payload, size_t length, char signature[64]) {
+    char stringToSign[512];
+    uint8_t hash[AWS_SHA256_DIGEST_LENGTH], digest[AWS_SHA256_DIGEST_LENGTH];
+    size_t n = (size_t)snprintf(stringToSign, sizeof(stringToSign), "AWS4-HMAC-SHA256-PAYLOAD\n%s\n%s\n%.64s\n%s\n",
+                                AmzDate, Scope, previous,
+                                "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855");
+
+    aws_sha256(payload, length, hash);
+    aws_sigv4_hex_encode(hash, sizeof(hash), stringToSign + n);
+    harness_ref_hmac(derived, AWS_SHA256_DIGEST_LENGTH, stringToSign, n + 64, digest);
+    aws_sigv4_hex_encode(digest, sizeof(digest), signature);
+}
+
+static int check(void) {
+    static const char *const expected[] = {
+        "ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648",
+        "0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497",
+        "b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9",
+    };
+    static const size_t lengths[] = { 65536, 1024, 0 };
+    aws_hmac_sha256_ctx chunkKey;
+    char signature[AWS_SIGV4_SIGNATURE_LENGTH], want[AWS_SIGV4_SIGNATURE_LENGTH];
+    uint8_t *payload = malloc(1 << 20);
+
+    HARNESS_EXPECT(payload != NULL, "out of memory");
+
+    // The S3 documentation example: 65 KiB of 'a' in a 64 KiB and a 1 KiB chunk
+    chunk_key(&chunkKey, "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY");
+    memset(payload, 'a', 65536);
+    memcpy(signature, "4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9", sizeof(signature));
+    for (int i = 0; i < 3; i++) {
+        aws_sigv4_chunk_signature(&chunkKey, signature, payload, lengths[i], signature);
+        HARNESS_BYTES(signature, sizeof(signature), expected[i], "S3 example chunk signature");
+    }
+
+    // Random chains against the reference, including chunk sizes around the SHA-256 block
+    uint8_t derived[AWS_SHA256_DIGEST_LENGTH];
+    const char *secret = "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY";
+    aws_sigv4_derive_key(secret, strlen(secret), "20130524", 8, "us-east-1", 9, "s3", 2, derived);
+    for (int chain = 0; chain < 50; chain++) {
+        uint8_t seed[AWS_SIGV4_SIGNATURE_LENGTH / 2];
+        harness_fill(seed, sizeof(seed));
+        aws_sigv4_hex_encode(seed, sizeof(seed), signature);
+        memcpy(want, signature, sizeof(want));
+        for (int i = 0; i < 8; i++) {
+            size_t length = (chain < 25) ? harness_rand64() % 200 : harness_rand64() % (1 << 20);
+            harness_fill(payload, length);
+            aws_sigv4_chunk_signature(&chunkKey, signature, payload, length, signature);
+            ref_chunk_signature(derived, want, payload, length, want);
+            HARNESS_EXPECT(memcmp(signature, want, sizeof(want)) == 0, "chain %d chunk %d, %zu bytes", chain, i, length);
+        }
+    }
+
+    // Batches against one chunk at a time, the chain continuing across batches
+    const void *payloads[20];
+    size_t payloadLengths[20];
+    char signatures[20][AWS_SIGV4_SIGNATURE_LENGTH];
+    for (int batch = 0; batch < 200; batch++) {
+        size_t count = 1 + harness_rand64() % 20;
+        size_t offset = 0;
+        for (size_t i = 0; i < count; i++) {
+            payloadLengths[i] = (batch < 150) ? harness_rand64() % 300 : harness_rand64() % (48 << 10);
+            payloads[i] = payload + offset;
+            harness_fill(payload + offset, payloadLengths[i]);
+            offset += payloadLengths[i];
+        }
+        // chained from the previous batch's last signature, passed in place
+        memcpy(signatures[count - 1], want, sizeof(want));
+        aws_sigv4_chunk_signatures(&chunkKey, signatures[count - 1], payloads, payloadLengths, count, signatures);
+        for (size_t i = 0; i < count; i++) {
+            aws_sigv4_chunk_signature(&chunkKey, want, payloads[i], payloadLengths[i], want);
+            HARNESS_EXPECT(memcmp(signatures[i], want, sizeof(want)) == 0,
+                           "batch %d chunk %zu of %zu, %zu bytes", batch, i, count, payloadLengths[i]);
+        }
+    }
+
+    free(payload);
+    return harness_done("chunked");
+}
+
+// One upload: a source in memory, read chunk by chunk, and a sink the framed
+// chunks are copied into, as NSURLSession would drain the stream.
+typedef struct {
+    const uint8_t *source;
+    size_t sourceLength;
+    size_t sourceOffset;
+    size_t chunkSize;
+    aws_hmac_sha256_ctx chunkKey;
+    char signature[AWS_SIGV4_SIGNATURE_LENGTH];
+
+    uint8_t *chunks[2];
+    size_t chunkLengths[2];
+    int chunkIsLast[2];
+    int filled[2];
+
+    pthread_mutex_t lock;
+    pthread_cond_t changed;
+} upload;
+
+// Reads the next chunk's payload into buffer index and returns its length.
+static size_t read_chunk(upload *u, int index) {
+    size_t length = u->sourceLength - u->sourceOffset;
+
+    length = (length < u->chunkSize) ? length : u->chunkSize;
+    memcpy(u->chunks[index] + CHUNK_HEADER_LENGTH, u->source + u->sourceOffset, length);
+    u->sourceOffset += length;
+    return length;
+}
+
+// Frames a signed payload of length bytes in buffer index.
+static int frame_chunk(upload *u, int index, size_t length, const char signature[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    static const char hexDigits[] = "0123456789abcdef";
+    uint8_t *chunk = u->chunks[index];
+
+    for (int i = 5; i >= 0; i--) {
+        chunk[i] = hexDigits[(length >> (4 * (5 - i))) & 0xf];
+    }
+    memcpy(chunk + 6, ";chunk-signature=", 17);
+    memcpy(chunk + 23, signature, AWS_SIGV4_SIGNATURE_LENGTH);
+    memcpy(chunk + 23 + AWS_SIGV4_SIGNATURE_LENGTH, "\r\n", 2);
+    memcpy(chunk + CHUNK_HEADER_LENGTH + length, "\r\n", 2);
+
+    u->chunkLengths[index] = CHUNK_HEADER_LENGTH + length + CHUNK_TRAILER_LENGTH;
+    u->chunkIsLast[index] = (length == 0);
+    return u->chunkIsLast[index];
+}
+
+// Reads and frames the next chunk into buffer index, as fillChunk: does.
+static int fill_chunk(upload *u, int index) {
+    size_t length = read_chunk(u, index);
+
+    aws_sigv4_chunk_signature(&u->chunkKey, u->signature, u->chunks[index] + CHUNK_HEADER_LENGTH, length, u->signature);
+    return frame_chunk(u, index, length, u->signature);
+}
+
+// Reads the next two chunks (one if the first is the last) and signs them
+// together, as fillChunks: does. Returns how many were filled.
+static int fill_chunks(upload *u) {
+    const void *payloads[2] = { u->chunks[0] + CHUNK_HEADER_LENGTH, u->chunks[1] + CHUNK_HEADER_LENGTH };
+    size_t lengths[2];
+    char signatures[2][AWS_SIGV4_SIGNATURE_LENGTH];
+    int count = 1;
+
+    lengths[0] = read_chunk(u, 0);
+    if (lengths[0] > 0) {
+        lengths[1] = read_chunk(u, 1);
+        count = 2;
+    }
+    aws_sigv4_chunk_signatures(&u->chunkKey, u->signature, payloads, lengths, (size_t)count, signatures);
+    memcpy(u->signature, signatures[count - 1], sizeof(u->signature));
+    for (int i = 0; i < count; i++) {
+        frame_chunk(u, i, lengths[i], signatures[i]);
+    }
+    return count;
+}
+
+static size_t upload_serial(upload *u, uint8_t *sink) {
+    size_t sent = 0;
+    int last;
+
+    do {
+        last = fill_chunk(u, 0);
+        memcpy(sink + sent, u->chunks[0], u->chunkLengths[0]);
+        sent += u->chunkLengths[0];
+    } while (!last);
+    return sent;
+}
+
+static size_t upload_paired(upload *u, uint8_t *sink) {
+    size_t sent = 0;
+    int last = 0;
+
+    while (!last) {
+        int count = fill_chunks(u);
+        for (int i = 0; i < count; i++) {
+            memcpy(sink + sent, u->chunks[i], u->chunkLengths[i]);
+            sent += u->chunkLengths[i];
+            last = u->chunkIsLast[i];
+        }
+    }
+    return sent;
+}
+
+static void *producer(void *arg) {
+    upload *u = arg;
+
+    for (int index = 0, last = 0; !last; index ^= 1) {
+        pthread_mutex_lock(&u->lock);
+        while (u->filled[index]) {
+            pthread_cond_wait(&u->changed, &u->lock);
+        }
+        pthread_mutex_unlock(&u->lock);
+
+        last = fill_chunk(u, index);
+
+        pthread_mutex_lock(&u->lock);
+        u->filled[index] = 1;
+        pthread_cond_broadcast(&u->changed);
+        pthread_mutex_unlock(&u->lock);
+    }
+    return NULL;
+}
+
+static size_t upload_pipelined(upload *u, uint8_t *sink) {
+    pthread_t thread;
+    size_t sent = 0;
+    int last = 0;
+
+    u->filled[0] = u->filled[1] = 0;
+    HARNESS_OK(pthread_create(&thread, NULL, producer, u));
+    for (int index = 0; !last; index ^= 1) {
+        pthread_mutex_lock(&u->lock);
+        while (!u->filled[index]) {
+            pthread_cond_wait(&u->changed, &u->lock);
+        }
+        pthread_mutex_unlock(&u->lock);
+
+        memcpy(sink + sent, u->chunks[index], u->chunkLengths[index]);
+        sent += u->chunkLengths[index];
+        last = u->chunkIsLast[index];
+
+        pthread_mutex_lock(&u->lock);
+        u->filled[index] = 0;
+        pthread_cond_broadcast(&u->changed);
+        pthread_mutex_unlock(&u->lock);
+    }
+    pthread_join(thread, NULL);
+    return sent;
+}
+
+static int bench(void) {
+    static const size_t chunkSizes[] = { 64 << 10, 256 << 10, 1 << 20, 8 << 20 };
+    enum { Upload = 64 << 20 };
+    aws_hmac_sha256_ctx chunkKey;
+    uint8_t *source = malloc(Upload);
+    uint8_t *sink = malloc(Upload + Upload / 4);
+    upload u;
+
+    HARNESS_EXPECT(source != NULL && sink != NULL, "out of memory");
+    harness_fill(source, Upload);
+    chunk_key(&chunkKey, "wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY");
+    pthread_mutex_init(&u.lock, NULL);
+    pthread_cond_init(&u.changed, NULL);
+
+    printf("chunked: %d MiB upload into a local sink, MB/s, %zu SHA-256 lanes\n", Upload >> 20, aws_sha256_multi_lanes());
+    printf("%10s %10s %10s %10s\n", "chunk", "serial", "pipelined", "paired");
+    for (size_t c = 0; c < sizeof(chunkSizes) / sizeof(chunkSizes[0]); c++) {
+        double serial = 0, pipelined = 0, paired = 0, t;
+        char serialSignature[AWS_SIGV4_SIGNATURE_LENGTH];
+
+        u.chunkSize = chunkSizes[c];
+        u.chunks[0] = malloc(CHUNK_HEADER_LENGTH + u.chunkSize + CHUNK_TRAILER_LENGTH);
+        u.chunks[1] = malloc(CHUNK_HEADER_LENGTH + u.chunkSize + CHUNK_TRAILER_LENGTH);
+        HARNESS_EXPECT(u.chunks[0] != NULL && u.chunks[1] != NULL, "out of memory");
+        for (int run = 0; run < 3; run++) {
+            u.source = source;
+            u.sourceLength = Upload;
+            u.sourceOffset = 0;
+            u.chunkKey = chunkKey;
+            memset(u.signature, '0', sizeof(u.signature));
+            t = harness_now();
+            upload_serial(&u, sink);
+            t = Upload / (harness_now() - t) / 1e6;
+            serial = (t > serial) ? t : serial;
+            memcpy(serialSignature, u.signature, sizeof(serialSignature));
+
+            u.sourceOffset = 0;
+            memset(u.signature, '0', sizeof(u.signature));
+            t = harness_now();
+            upload_pipelined(&u, sink);
+            t = Upload / (harness_now() - t) / 1e6;
+            pipelined = (t > pipelined) ? t : pipelined;
+            HARNESS_EXPECT(memcmp(serialSignature, u.signature, sizeof(serialSignature)) == 0,
+                           "pipelined upload signs differently from serial");
+
+            u.sourceOffset = 0;
+            memset(u.signature, '0', sizeof(u.signature));
+            t = harness_now();
+            upload_paired(&u, sink);
+            t = Upload / (harness_now() - t) / 1e6;
+            paired = (t > paired) ? t : paired;
+            HARNESS_EXPECT(memcmp(serialSignature, u.signature, sizeof(serialSignature)) == 0,
+                           "paired upload signs differently from serial");
+        }
+        printf("%9zuK %10.0f %10.0f %10.0f\n", chunkSizes[c] >> 10, serial, pipelined, paired);
+        free(u.chunks[0]);
+        free(u.chunks[1]);
+    }
+
+    pthread_mutex_destroy(&u.lock);
+    pthread_cond_destroy(&u.changed);
+    free(source);
+    free(sink);
+    return harness_failures != 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
@@ -0,0 +1,171 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+// CRC-32C as sent in the x-amz-checksum-crc32c trailer (aws_crc32c.c).
+//
+// The Makefile links aws_crc32c.c twice: as built (SSE4.2 or ARMv8 where the
+// CPU has them) and, renamed to aws_crc32c_portable, with AWS_CRC32C_NO_ASM
+// so only the slicing-by-8 tables are compiled in.
+//
+// check  the CRC-32C check value and the RFC 3720 iSCSI vectors, then both
+//        builds against a bitwise reference for every length up to 300 at
+//        every alignment up to 16, random longer buffers, and streams fed in
+//        random pieces
+// bench  MB/s of both builds and the bitwise reference, aligned and not
+
+#include "harness.h"
+#include "aws_crc32c.h"
+
+// aws_crc32c.c built with AWS_CRC32C_NO_ASM
+uint32_t aws_crc32c_portable(uint32_t crc, const void *data, size_t length);
+
+// One bit at a time, reflected polynomial 0x82f63b78
+static uint32_t ref_crc32c(uint32_t crc, const void *data, size_t length) {
+    const uint8_t *bytes = data;
+
+    crc = ~crc;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc >> 1) ^ (0x82f63b78 & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+static int check(void) {
+    enum { MaxLength = 1 << 20 };
+    uint8_t vector[32];
+    uint8_t out[AWS_CRC32C_LENGTH];
+    uint8_t *bytes = malloc(MaxLength + 16);
+
+    HARNESS_EXPECT(bytes != NULL, "out of memory");
+
+    HARNESS_EXPECT(ref_crc32c(0, "123456789", 9) == 0xe3069283, "reference check value");
+    HARNESS_EXPECT(aws_crc32c(0, "123456789", 9) == 0xe3069283, "check value: %08x", aws_crc32c(0, "123456789", 9));
+    HARNESS_EXPECT(aws_crc32c_portable(0, "123456789", 9) == 0xe3069283,
+                   "check value, slicing-by-8: %08x", aws_crc32c_portable(0, "123456789", 9));
+    HARNESS_EXPECT(aws_crc32c(0, NULL, 0) == 0, "empty input");
+    aws_crc32c_bytes(0xe3069283, out);
+    HARNESS_EXPECT(out[0] == 0xe3 && out[1] == 0x06 && out[2] == 0x92 && out[3] == 0x83, "network byte order");
+
+    // RFC 3720 B.4
+    memset(vector, 0, sizeof(vector));
+    HARNESS_EXPECT(aws_crc32c(0, vector, 32) == 0x8a9136aa, "32 zero bytes");
+    HARNESS_EXPECT(aws_crc32c_portable(0, vector, 32) == 0x8a9136aa, "32 zero bytes, slicing-by-8");
+    memset(vector, 0xff, sizeof(vector));
+    HARNESS_EXPECT(aws_crc32c(0, vector, 32) == 0x62a8ab43, "32 0xff bytes");
+    HARNESS_EXPECT(aws_crc32c_portable(0, vector, 32) == 0x62a8ab43, "32 0xff bytes, slicing-by-8");
+    for (int i = 0; i < 32; i++) {
+        vector[i] = (uint8_t)i;
+    }
+    HARNESS_EXPECT(aws_crc32c(0, vector, 32) == 0x46dd794e, "32 ascending bytes");
+    HARNESS_EXPECT(aws_crc32c_portable(0, vector, 32) == 0x46dd794e, "32 ascending bytes, slicing-by-8");
+    for (int i = 0; i < 32; i++) {
+        vector[i] = (uint8_t)(31 - i);
+    }
+    HARNESS_EXPECT(aws_crc32c(0, vector, 32) == 0x113fdb5c, "32 descending bytes");
+    HARNESS_EXPECT(aws_crc32c_portable(0, vector, 32) == 0x113fdb5c, "32 descending bytes, slicing-by-8");
+
+    // Every short length at every alignment, so each head, word loop and tail case runs
+    harness_fill(bytes, 300 + 16);
+    for (size_t offset = 0; offset < 16; offset++) {
+        for (size_t length = 0; length <= 300; length++) {
+            uint32_t seed = (uint32_t)harness_rand64();
+            uint32_t want = ref_crc32c(seed, bytes + offset, length);
+            HARNESS_EXPECT(aws_crc32c(seed, bytes + offset, length) == want,
+                           "%zu bytes at offset %zu", length, offset);
+            HARNESS_EXPECT(aws_crc32c_portable(seed, bytes + offset, length) == want,
+                           "%zu bytes at offset %zu, slicing-by-8", length, offset);
+        }
+    }
+
+    // Longer buffers, and the same buffers fed in random pieces
+    for (int round = 0; round < 100; round++) {
+        size_t offset = harness_rand64() % 16;
+        size_t length = harness_rand64() % MaxLength;
+        harness_fill(bytes + offset, length);
+        uint32_t want = ref_crc32c(0, bytes + offset, length);
+        HARNESS_EXPECT(aws_crc32c(0, bytes + offset, length) == want, "%zu bytes at offset %zu", length, offset);
+        HARNESS_EXPECT(aws_crc32c_portable(0, bytes + offset, length) == want,
+                       "%zu bytes at offset %zu, slicing-by-8", length, offset);
+
+        uint32_t crc = 0, portable = 0;
+        for (size_t done = 0; done < length;) {
+            size_t piece = 1 + harness_rand64() % 70000;
+            piece = (piece < length - done) ? piece : length - done;
+            crc = aws_crc32c(crc, bytes + offset + done, piece);
+            portable = aws_crc32c_portable(portable, bytes + offset + done, piece);
+            done += piece;
+        }
+        HARNESS_EXPECT(crc == want, "%zu bytes streamed", length);
+        HARNESS_EXPECT(portable == want, "%zu bytes streamed, slicing-by-8", length);
+    }
+
+    free(bytes);
+    return harness_done("crc32c");
+}
+
+typedef uint32_t (*crc_fn)(uint32_t crc, const void *data, size_t length);
+
+static double throughput(crc_fn fn, const uint8_t *bytes, size_t length, size_t total) {
+    double best = 0;
+    volatile uint32_t sink = 0;
+
+    for (int run = 0; run < 3; run++) {
+        uint32_t crc = 0;
+        double t = harness_now();
+        for (size_t done = 0; done < total; done += length) {
+            crc = fn(crc, bytes, length);
+        }
+        t = total / (harness_now() - t) / 1e6;
+        best = (t > best) ? t : best;
+        sink ^= crc;
+    }
+    (void)sink;
+    return best;
+}
+
+static int bench(void) {
+    static const size_t sizes[] = { 16, 64, 1024, 64 << 10, 1 << 20 };
+    enum { Total = 256 << 20 };
+    uint8_t *bytes = malloc((1 << 20) + 16);
+
+    HARNESS_EXPECT(bytes != NULL, "out of memory");
+    harness_fill(bytes, (1 << 20) + 16);
+
+    printf("crc32c: MB/s, as built vs slicing-by-8 vs one bit at a time\n");
+    printf("%10s %6s %10s %10s %10s %8s\n", "buffer", "offset", "as built", "sliced", "bitwise", "speedup");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        for (size_t offset = 0; offset < 8; offset += 3) {
+            double built = throughput(aws_crc32c, bytes + offset, sizes[s], Total);
+            double sliced = throughput(aws_crc32c_portable, bytes + offset, sizes[s], Total);
+            double bitwise = throughput(ref_crc32c, bytes + offset, sizes[s], Total / 64);
+            printf("%10zu %6zu %10.0f %10.0f %10.0f %7.2fx\n", sizes[s], offset, built, sliced, bitwise, built / sliced);
+        }
+    }
+
+    free(bytes);
+    return harness_failures != 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
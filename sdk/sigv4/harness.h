@@ -0,0 +1,122 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Shared helpers for the SigV4 checks and benchmarks in this directory.
+//
+// Each program runs its checks when started with "check" and its timings
+// when started with "bench"; see the Makefile.
+
+#ifndef AWS_SIGV4_HARNESS_H
+#define AWS_SIGV4_HARNESS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "aws_sigv4.h"
+
+static int harness_failures;
+
+#define HARNESS_EXPECT(cond, ...)                                       \
+    do {                                                                \
+        if (!(cond)) {                                                  \
+            fprintf(stderr, "FAIL %s:%d: ", __FILE__, __LINE__);        \
+            fprintf(stderr, __VA_ARGS__);                               \
+            fputc('\n', stderr);                                        \
+            if (++harness_failures >= 10) {                             \
+                exit(1);                                                \
+            }                                                           \
+        }                                                               \
+    } while (0)
+
+#define HARNESS_OK(expr) HARNESS_EXPECT((expr) == 0, "%s", #expr)
+
+// Compares length bytes against a NUL-terminated expected string
+#define HARNESS_BYTES(bytes, length, want, what)                        \
+    HARNESS_EXPECT((length) == strlen(want) && memcmp((bytes), (want), (length)) == 0, \
+                   "%s:\n  got  \"%.*s\"\n  want \"%s\"", (what), (int)(length), (const char *)(bytes), (want))
+
+// Monotonic wall time in seconds
+static inline double harness_now(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// xorshift64*, so runs are reproducible across libcs
+static unsigned long long harness_state = 0x9e3779b97f4a7c15ULL;
+
+static inline unsigned long long harness_rand64(void) {
+    harness_state ^= harness_state >> 12;
+    harness_state ^= harness_state << 25;
+    harness_state ^= harness_state >> 27;
+    return harness_state * 0x2545f4914f6cdd1dULL;
+}
+
+static inline void harness_fill(void *bytes, size_t length) {
+    uint8_t *p = bytes;
+    for (size_t i = 0; i < length; i++) {
+        p[i] = (uint8_t)harness_rand64();
+    }
+}
+
+// HMAC-SHA256 computed from the RFC 2104 definition on top of aws_sha256,
+// independent of the keyed-context code in aws_sha256.c
+static inline void harness_ref_hmac(const void *key, size_t keyLength,
+                                    const void *data, size_t length,
+                                    uint8_t digest[AWS_SHA256_DIGEST_LENGTH]) {
+    uint8_t block[AWS_SHA256_BLOCK_LENGTH] = {0};
+    uint8_t pad[AWS_SHA256_BLOCK_LENGTH];
+    uint8_t inner[AWS_SHA256_DIGEST_LENGTH];
+    aws_sha256_ctx ctx;
+
+    if (keyLength > AWS_SHA256_BLOCK_LENGTH) {
+        aws_sha256(key, keyLength, block);
+    } else {
+        memcpy(block, key, keyLength);
+    }
+    for (int i = 0; i < AWS_SHA256_BLOCK_LENGTH; i++) {
+        pad[i] = block[i] ^ 0x36;
+    }
+    aws_sha256_init(&ctx);
+    aws_sha256_update(&ctx, pad, sizeof(pad));
+    aws_sha256_update(&ctx, data, length);
+    aws_sha256_final(&ctx, inner);
+    for (int i = 0; i < AWS_SHA256_BLOCK_LENGTH; i++) {
+        pad[i] = block[i] ^ 0x5c;
+    }
+    aws_sha256_init(&ctx);
+    aws_sha256_update(&ctx, pad, sizeof(pad));
+    aws_sha256_update(&ctx, inner, sizeof(inner));
+    aws_sha256_final(&ctx, digest);
+}
+
+static inline int harness_usage(const char *argv0) {
+    fprintf(stderr, "usage: %s check|bench\n", argv0);
+    return 2;
+}
+
+static inline int harness_done(const char *name) {
+    if (harness_failures != 0) {
+        fprintf(stderr, "%s: %d failure(s)\n", name, harness_failures);
+        return 1;
+    }
+    printf("%s: ok\n", name);
+    return 0;
+}
+
+#endif
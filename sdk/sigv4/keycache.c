@@ -0,0 +1,174 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Signing cost with and without the signing context cache in AWSSignature.m.
+//
+// A cache miss there derives the key, builds the scope and keys an HMAC
+// context; a hit copies the keyed context. Both are reproduced here on the C
+// core the cache calls into.
+//
+// check  a copied keyed context signs exactly like a fresh derivation, for
+//        short, block-sized and long secrets, and the derived key matches a
+//        reference HMAC chain
+// bench  nanoseconds per signed request, uncached vs cached
+
+#include "harness.h"
+
+static const char *const Date = "20150830";
+static const char *const AmzDate = "20150830T123600Z";
+static const char *const Region = "us-east-1";
+static const char *const Service = "service";
+static const char *const EmptyHash = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+// What the cache keeps per (credentials, date, region, service)
+typedef struct {
+    char scope[128];
+    size_t scopeLength;
+    aws_hmac_sha256_ctx key;
+} signing_context;
+
+static void context_init(signing_context *context, const char *secret, size_t secretLength) {
+    uint8_t derived[AWS_SHA256_DIGEST_LENGTH];
+    aws_sigv4_buf buf;
+
+    aws_sigv4_derive_key(secret, secretLength, Date, strlen(Date), Region, strlen(Region),
+                         Service, strlen(Service), derived);
+    aws_hmac_sha256_init(&context->key, derived, sizeof(derived));
+    aws_sigv4_buf_init(&buf, context->scope, sizeof(context->scope));
+    HARNESS_OK(aws_sigv4_append_scope(&buf, Date, strlen(Date), Region, strlen(Region), Service, strlen(Service)));
+    context->scopeLength = buf.length;
+    aws_sigv4_buf_free(&buf);
+}
+
+static int sign(const signing_context *context, const aws_sigv4_header *headers, size_t headerCount,
+                char signature[AWS_SIGV4_SIGNATURE_LENGTH]) {
+    uint8_t storage[2048];
+    aws_sigv4_buf buf;
+    size_t signedHeadersOffset, signedHeadersLength;
+
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    int result = aws_sigv4_sign_request(&buf, &context->key, NULL,
+                                        AmzDate, strlen(AmzDate),
+                                        context->scope, context->scopeLength,
+                                        "GET", 3, "/", 1, "", 0,
+                                        headers, headerCount,
+                                        EmptyHash, strlen(EmptyHash),
+                                        signature, &signedHeadersOffset, &signedHeadersLength);
+    aws_sigv4_buf_free(&buf);
+    return result;
+}
+
+static const aws_sigv4_header Headers[] = {
+    { "Host", 4, "example.amazonaws.com", 21 },
+    { "X-Amz-Date", 10, "20150830T123600Z", 16 },
+    { "Content-Type", 12, "application/x-amz-json-1.0", 26 },
+    { "User-Agent", 10, "aws-sdk-iOS/2.6.0 iOS/11.0 en_US", 32 },
+    { "X-Amz-Target", 12, "DynamoDB_20120810.GetItem", 25 },
+    { "X-Amz-Security-Token", 20, "AQoDYXdzEJr1K6xMDENG", 20 },
+    { "Accept-Encoding", 15, "gzip", 4 },
+    { "Content-Length", 14, "42", 2 },
+};
+
+static int check(void) {
+    static const size_t secretLengths[] = { 1, 40, 59, 60, 61, 64, 100, 300 };
+    char secret[300];
+    char cached[AWS_SIGV4_SIGNATURE_LENGTH], uncached[AWS_SIGV4_SIGNATURE_LENGTH];
+    signing_context context, fresh;
+
+    // aws-sig-v4-test-suite get-vanilla
+    memcpy(secret, "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY", 40);
+    context_init(&context, secret, 40);
+    HARNESS_OK(sign(&context, Headers, 2, cached));
+    HARNESS_BYTES(cached, sizeof(cached), "5fa00fa31553b73ebf1942676e86291e8372ff2a2260956d9b8aae1d763fbf31",
+                  "get-vanilla signature");
+
+    for (size_t s = 0; s < sizeof(secretLengths) / sizeof(secretLengths[0]); s++) {
+        size_t secretLength = secretLengths[s];
+        uint8_t derived[AWS_SHA256_DIGEST_LENGTH], want[AWS_SHA256_DIGEST_LENGTH];
+        char prefixed[4 + sizeof(secret)];
+
+        for (size_t i = 0; i < secretLength; i++) {
+            secret[i] = (char)(' ' + harness_rand64() % 95);
+        }
+
+        // "AWS4" + secret through the reference HMAC, four times
+        memcpy(prefixed, "AWS4", 4);
+        memcpy(prefixed + 4, secret, secretLength);
+        harness_ref_hmac(prefixed, 4 + secretLength, Date, strlen(Date), want);
+        harness_ref_hmac(want, sizeof(want), Region, strlen(Region), want);
+        harness_ref_hmac(want, sizeof(want), Service, strlen(Service), want);
+        harness_ref_hmac(want, sizeof(want), "aws4_request", 12, want);
+        aws_sigv4_derive_key(secret, secretLength, Date, strlen(Date), Region, strlen(Region),
+                             Service, strlen(Service), derived);
+        HARNESS_EXPECT(memcmp(derived, want, sizeof(want)) == 0, "derived key, %zu byte secret", secretLength);
+
+        // one cached context reused for many requests, against a fresh derivation each time
+        context_init(&context, secret, secretLength);
+        for (size_t headerCount = 1; headerCount <= sizeof(Headers) / sizeof(Headers[0]); headerCount++) {
+            HARNESS_OK(sign(&context, Headers, headerCount, cached));
+            context_init(&fresh, secret, secretLength);
+            HARNESS_OK(sign(&fresh, Headers, headerCount, uncached));
+            HARNESS_EXPECT(memcmp(cached, uncached, sizeof(cached)) == 0,
+                           "%zu byte secret, %zu headers: cached %.64s, uncached %.64s",
+                           secretLength, headerCount, cached, uncached);
+        }
+    }
+    return harness_done("keycache");
+}
+
+static int bench(void) {
+    static const size_t headerCounts[] = { 2, 4, 8 };
+    static const char secret[] = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+    enum { Requests = 200000 };
+    char signature[AWS_SIGV4_SIGNATURE_LENGTH];
+    signing_context context;
+
+    printf("keycache: nanoseconds per signed request\n");
+    printf("%8s %10s %10s %8s\n", "headers", "uncached", "cached", "speedup");
+    for (size_t h = 0; h < sizeof(headerCounts) / sizeof(headerCounts[0]); h++) {
+        size_t headerCount = headerCounts[h];
+        double uncached = 0, cached = 0, t;
+
+        for (int run = 0; run < 3; run++) {
+            t = harness_now();
+            for (int i = 0; i < Requests; i++) {
+                context_init(&context, secret, sizeof(secret) - 1);
+                HARNESS_OK(sign(&context, Headers, headerCount, signature));
+            }
+            t = (harness_now() - t) / Requests * 1e9;
+            uncached = (run == 0 || t < uncached) ? t : uncached;
+
+            context_init(&context, secret, sizeof(secret) - 1);
+            t = harness_now();
+            for (int i = 0; i < Requests; i++) {
+                HARNESS_OK(sign(&context, Headers, headerCount, signature));
+            }
+            t = (harness_now() - t) / Requests * 1e9;
+            cached = (run == 0 || t < cached) ? t : cached;
+        }
+        printf("%8zu %10.0f %10.0f %7.2fx\n", headerCount, uncached, cached, uncached / cached);
+    }
+    return harness_failures != 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
@@ -0,0 +1,240 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+// SHA-256 and HMAC-SHA256 known answers for every compression path in
+// aws_sha256.c. The Makefile builds this file three times: sha256 with the
+// default dispatch (SHA-NI or ARMv8 where the CPU has them), sha256-avx2
+// with SHA-NI left out so the eight-lane AVX2 multi-buffer path runs, and
+// sha256-portable with AWS_SHA256_NO_ASM.
+//
+// check  FIPS 180-2 and NIST example vectors, RFC 4231 HMAC test cases,
+//        streaming updates split at random points, and aws_sha256_multi /
+//        aws_hmac_sha256_multi against one message at a time
+// bench  MB/s for one message at a time and side by side
+
+#include "harness.h"
+
+#if defined(AWS_SHA256_NO_ASM)
+#define SHA256_NAME "sha256-portable"
+#elif defined(AWS_SHA256_NO_SHANI)
+#define SHA256_NAME "sha256-avx2"
+#else
+#define SHA256_NAME "sha256"
+#endif
+
+static void hex(const uint8_t digest[AWS_SHA256_DIGEST_LENGTH], char out[2 * AWS_SHA256_DIGEST_LENGTH + 1]) {
+    static const char digits[] = "0123456789abcdef";
+
+    for (int i = 0; i < AWS_SHA256_DIGEST_LENGTH; i++) {
+        out[2 * i] = digits[digest[i] >> 4];
+        out[2 * i + 1] = digits[digest[i] & 0xf];
+    }
+    out[2 * AWS_SHA256_DIGEST_LENGTH] = '\0';
+}
+
+static void expect_digest(const uint8_t digest[AWS_SHA256_DIGEST_LENGTH], const char *want, const char *what) {
+    char got[2 * AWS_SHA256_DIGEST_LENGTH + 1];
+
+    hex(digest, got);
+    HARNESS_BYTES(got, strlen(got), want, what);
+}
+
+static int check(void) {
+    static const struct {
+        const char *message;
+        const char *digest;
+    } vectors[] = {
+        { "", "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855" },
+        { "abc", "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad" },
+        { "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+          "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1" },
+        { "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+          "cf5b16a778af8380036ce59e7b0492370b249b11e8f07a51afac45037afee9d1" },
+    };
+    static const struct {
+        uint8_t keyByte;                        // key is keyLength copies of keyByte, or 0x01.. when 0
+        size_t keyLength;
+        const char *key;                        // used instead when set
+        uint8_t dataByte;
+        size_t dataLength;
+        const char *data;                       // used instead when set
+        const char *digest;
+    } hmacs[] = {
+        { 0x0b, 20, NULL, 0, 0, "Hi There",
+          "b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7" },
+        { 0, 0, "Jefe", 0, 0, "what do ya want for nothing?",
+          "5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843" },
+        { 0xaa, 20, NULL, 0xdd, 50, NULL,
+          "773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe" },
+        { 0, 25, NULL, 0xcd, 50, NULL,
+          "82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b" },
+        { 0xaa, 131, NULL, 0, 0, "Test Using Larger Than Block-Size Key - Hash Key First",
+          "60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54" },
+        { 0xaa, 131, NULL, 0, 0,
+          "This is a test using a larger than block-size key and a larger than block-size data. "
+          "The key needs to be hashed before being used by the HMAC algorithm.",
+          "9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2" },
+    };
+    enum { Messages = 40, MaxLength = 1 << 16 };
+    uint8_t digest[AWS_SHA256_DIGEST_LENGTH], want[AWS_SHA256_DIGEST_LENGTH];
+    uint8_t digests[Messages][AWS_SHA256_DIGEST_LENGTH];
+    const void *data[Messages];
+    size_t lengths[Messages];
+    uint8_t *bytes = malloc((size_t)Messages * MaxLength);
+    aws_sha256_ctx ctx;
+
+    HARNESS_EXPECT(bytes != NULL, "out of memory");
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        aws_sha256(vectors[i].message, strlen(vectors[i].message), digest);
+        expect_digest(digest, vectors[i].digest, vectors[i].message);
+    }
+
+    // a million 'a', fed in uneven pieces
+    memset(bytes, 'a', 1000000);
+    aws_sha256_init(&ctx);
+    for (size_t offset = 0, piece = 1; offset < 1000000; offset += piece, piece = piece * 3 % 1021 + 1) {
+        aws_sha256_update(&ctx, bytes + offset, (offset + piece <= 1000000) ? piece : 1000000 - offset);
+    }
+    aws_sha256_final(&ctx, digest);
+    expect_digest(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", "a million 'a'");
+    aws_sha256(bytes, 1000000, digest);
+    expect_digest(digest, "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0", "a million 'a', one call");
+
+    for (size_t i = 0; i < sizeof(hmacs) / sizeof(hmacs[0]); i++) {
+        uint8_t key[131], message[50];
+        const void *k = hmacs[i].key, *d = hmacs[i].data;
+        size_t keyLength = hmacs[i].key ? strlen(hmacs[i].key) : hmacs[i].keyLength;
+        size_t dataLength = hmacs[i].data ? strlen(hmacs[i].data) : hmacs[i].dataLength;
+
+        if (!hmacs[i].key) {
+            for (size_t j = 0; j < keyLength; j++) {
+                key[j] = hmacs[i].keyByte ? hmacs[i].keyByte : (uint8_t)(j + 1);
+            }
+            k = key;
+        }
+        if (!hmacs[i].data) {
+            memset(message, hmacs[i].dataByte, dataLength);
+            d = message;
+        }
+        aws_hmac_sha256(k, keyLength, d, dataLength, digest);
+        expect_digest(digest, hmacs[i].digest, "RFC 4231 test case");
+        aws_hmac_sha256_multi(k, keyLength, &d, &dataLength, 1, digests);
+        expect_digest(digests[0], hmacs[i].digest, "RFC 4231 test case, multi-buffer");
+    }
+
+    // Streaming in random pieces against one call, lengths around block boundaries
+    for (int round = 0; round < 500; round++) {
+        size_t length = (round < 400) ? harness_rand64() % 300 : harness_rand64() % MaxLength;
+        harness_fill(bytes, length);
+        aws_sha256(bytes, length, want);
+        aws_sha256_init(&ctx);
+        for (size_t offset = 0; offset < length;) {
+            size_t piece = 1 + harness_rand64() % 130;
+            piece = (piece < length - offset) ? piece : length - offset;
+            aws_sha256_update(&ctx, bytes + offset, piece);
+            offset += piece;
+        }
+        aws_sha256_final(&ctx, digest);
+        HARNESS_EXPECT(memcmp(digest, want, sizeof(want)) == 0, "streaming, %zu bytes", length);
+    }
+
+    // Side by side against one at a time: mixed lengths so lanes finish at
+    // different blocks, messages at odd addresses, and every count up to Messages
+    for (int round = 0; round < 300; round++) {
+        size_t count = 1 + harness_rand64() % Messages;
+        uint8_t key[100];
+        size_t keyLength = harness_rand64() % sizeof(key);
+
+        for (size_t i = 0; i < count; i++) {
+            size_t offset = (size_t)i * MaxLength + harness_rand64() % 8;
+            lengths[i] = (round < 200) ? harness_rand64() % 200 : harness_rand64() % (MaxLength - 8);
+            data[i] = bytes + offset;
+            harness_fill(bytes + offset, lengths[i]);
+        }
+        aws_sha256_multi(data, lengths, count, digests);
+        for (size_t i = 0; i < count; i++) {
+            aws_sha256(data[i], lengths[i], want);
+            HARNESS_EXPECT(memcmp(digests[i], want, sizeof(want)) == 0,
+                           "multi-buffer message %zu of %zu, %zu bytes", i, count, lengths[i]);
+        }
+
+        harness_fill(key, keyLength);
+        aws_hmac_sha256_multi(key, keyLength, data, lengths, count, digests);
+        for (size_t i = 0; i < count; i++) {
+            harness_ref_hmac(key, keyLength, data[i], lengths[i], want);
+            HARNESS_EXPECT(memcmp(digests[i], want, sizeof(want)) == 0,
+                           "multi-buffer HMAC message %zu of %zu, %zu bytes, %zu-byte key",
+                           i, count, lengths[i], keyLength);
+        }
+    }
+
+    free(bytes);
+    return harness_done(SHA256_NAME);
+}
+
+static int bench(void) {
+    static const size_t sizes[] = { 64, 256, 1024, 4096, 16 << 10, 1 << 20 };
+    enum { Messages = 16, Total = 64 << 20 };
+    uint8_t digests[Messages][AWS_SHA256_DIGEST_LENGTH];
+    const void *data[Messages];
+    size_t lengths[Messages];
+    uint8_t *bytes = malloc((size_t)Messages << 20);
+
+    HARNESS_EXPECT(bytes != NULL, "out of memory");
+    harness_fill(bytes, (size_t)Messages << 20);
+
+    printf(SHA256_NAME ": MB/s, %zu lanes side by side\n", aws_sha256_multi_lanes());
+    printf("%10s %12s %12s %8s\n", "message", "one by one", "side by side", "speedup");
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        size_t rounds = Total / (sizes[s] * Messages);
+        double single = 0, multi = 0, t;
+
+        for (int i = 0; i < Messages; i++) {
+            data[i] = bytes + ((size_t)i << 20);
+            lengths[i] = sizes[s];
+        }
+        for (int run = 0; run < 3; run++) {
+            t = harness_now();
+            for (size_t r = 0; r < rounds; r++) {
+                for (int i = 0; i < Messages; i++) {
+                    aws_sha256(data[i], lengths[i], digests[i]);
+                }
+            }
+            t = Total / (harness_now() - t) / 1e6;
+            single = (t > single) ? t : single;
+
+            t = harness_now();
+            for (size_t r = 0; r < rounds; r++) {
+                aws_sha256_multi(data, lengths, Messages, digests);
+            }
+            t = Total / (harness_now() - t) / 1e6;
+            multi = (t > multi) ? t : multi;
+        }
+        printf("%10zu %12.0f %12.0f %7.2fx\n", sizes[s], single, multi, multi / single);
+    }
+
+    free(bytes);
+    return harness_failures != 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
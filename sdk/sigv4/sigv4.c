@@ -0,0 +1,408 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Request signing in the C SigV4 core.
+//
+// check  aws-sig-v4-test-suite requests: canonical request, string to sign,
+//        signature and Authorization header, with headers in the given and
+//        in reverse order and with and without a header template. Presigned
+//        URLs and chunk signatures are covered by presign and chunked.
+// bench  signed requests per second with 2, 8 and 32 headers, and derived
+//        keys per second
+
+#include "harness.h"
+
+#define VECTOR_HEADERS 4
+
+static const char *const AccessKey = "AKIDEXAMPLE";
+static const char *const SecretKey = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+static const char *const AmzDate = "20150830T123600Z";
+static const char *const Scope = "20150830/us-east-1/service/aws4_request";
+
+typedef struct {
+    const char *name;
+    const char *method, *path, *query;
+    const char *headers[VECTOR_HEADERS][2];
+    const char *body;
+    const char *canonicalRequest;
+    const char *stringToSign;
+    const char *signature;
+} sigv4_vector;
+
+// Expected values are those of the test suite, regenerated with Python's hmac
+// and hashlib from the suite's requests.
+static const sigv4_vector Vectors[] = {
+    {
+        "get-vanilla",
+        "GET", "/", "",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "bb579772317eb040ac9ed261061d46c1f17a8133879d6129b6e1c25292927e63",
+        "5fa00fa31553b73ebf1942676e86291e8372ff2a2260956d9b8aae1d763fbf31",
+    },
+    {
+        "get-vanilla-query-order-key-case",
+        "GET", "/", "Param2=value2&Param1=value1",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "Param1=value1&Param2=value2\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "816cd5b414d056048ba4f7c5386d6e0533120fb1fcfa93762cf0fc39e2cf19e0",
+        "b97d918cfa904a5beff61c982a1b6f458b799221646efd99d3219ec94cdf2500",
+    },
+    {
+        "get-vanilla-query-order-value",
+        "GET", "/", "Param1=value2&Param1=Value1",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "Param1=Value1&Param1=value2\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "704b4cef673542d84cdff252633f065e8daeba5f168b77116f8b1bcaf3d38f89",
+        "eedbc4e291e521cf13422ffca22be7d2eb8146eecf653089df300a15b2382bd1",
+    },
+    {
+        "get-vanilla-empty-query-key",
+        "GET", "/", "Param1=value1",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "Param1=value1\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "1e24db194ed7d0eec2de28d7369675a243488e08526e8c1c73571282f7c517ab",
+        "a67d582fa61cc504c4bae71f336f98b97f1ea3c7a6bfe1b6e45aec72011b9aeb",
+    },
+    {
+        "get-vanilla-query-unreserved",
+        "GET", "/", "-._~0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz=-._~0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "-._~0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz=-._~0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "c30d4703d9f799439be92736156d47ccfb2d879ddf56f5befa6d1d6aab979177",
+        "9c3e54bfcdf0b19771a7f523ee5669cdf59bc7cc0884027167c21bb143a40197",
+    },
+    {
+        "get-vanilla-utf8-query",
+        "GET", "/", "%E1%88%B4=bar",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "%E1%88%B4=bar\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "eb30c5bed55734080471a834cc727ae56beb50e5f39d1bff6d0d38cb192a7073",
+        "2cdec8eed098649ff3a119c94853b13c643bcf08f8b0a1d91e12c9027818dd04",
+    },
+    {
+        "get-header-value-trim",
+        "GET", "/", "",
+        { { "Host", "example.amazonaws.com" }, { "My-Header1", " value1" }, { "My-Header2", " \"a   b   c\"" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "GET\n"
+        "/\n"
+        "\n"
+        "host:example.amazonaws.com\n"
+        "my-header1:value1\n"
+        "my-header2:\"a b c\"\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;my-header1;my-header2;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "a726db9b0df21c14f559d0a978e563112acb1b9e05476f0a6a1c7d68f28605c7",
+        "acc3ed3afb60bb290fc8d2dd0098b9911fcaa05412b367055dee359757a9c736",
+    },
+    {
+        "post-header-value-case",
+        "POST", "/", "",
+        { { "Host", "example.amazonaws.com" }, { "My-Header1", "VALUE1" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "POST\n"
+        "/\n"
+        "\n"
+        "host:example.amazonaws.com\n"
+        "my-header1:VALUE1\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;my-header1;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "d51ced243e649e3de6ef63afbbdcbca03131a21a7103a1583706a64618606a93",
+        "cdbc9802e29d2942e5e10b5bccfdd67c5f22c7c4e8ae67b53629efa58b974b7d",
+    },
+    {
+        "post-vanilla",
+        "POST", "/", "",
+        { { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "",
+        "POST\n"
+        "/\n"
+        "\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "host;x-amz-date\n"
+        "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "553f88c9e4d10fc9e109e2aeb65f030801b70c2f6468faca261d401ae622fc87",
+        "5da7c1a2acd57cee7505fc6676e4e544621c30862966e37dddb68e92efbe5d6b",
+    },
+    {
+        "post-x-www-form-urlencoded",
+        "POST", "/", "",
+        { { "Content-Type", "application/x-www-form-urlencoded" }, { "Host", "example.amazonaws.com" }, { "X-Amz-Date", "20150830T123600Z" } },
+        "Param1=value1",
+        "POST\n"
+        "/\n"
+        "\n"
+        "content-type:application/x-www-form-urlencoded\n"
+        "host:example.amazonaws.com\n"
+        "x-amz-date:20150830T123600Z\n"
+        "\n"
+        "content-type;host;x-amz-date\n"
+        "9095672bbd1f56dfc5b65f3e153adc8731a4a654192329106275f4c7b24d0b6e",
+        "AWS4-HMAC-SHA256\n"
+        "20150830T123600Z\n"
+        "20150830/us-east-1/service/aws4_request\n"
+        "42a5e5bb34198acb3e84da4f085bb7927f2bc277ca766e6d19c73c2154021281",
+        "ff11897932ad3f4e8b18135d722051e5ac45fc38421b1da7b9d196a0fe09473a",
+    },
+};
+
+static void signing_key(aws_hmac_sha256_ctx *key) {
+    uint8_t derived[AWS_SHA256_DIGEST_LENGTH];
+
+    aws_sigv4_derive_key(SecretKey, strlen(SecretKey), "20150830", 8, "us-east-1", 9, "service", 7, derived);
+    aws_hmac_sha256_init(key, derived, sizeof(derived));
+}
+
+static size_t vector_headers(const sigv4_vector *v, aws_sigv4_header *headers, int reverse) {
+    size_t count = 0;
+
+    while (count < VECTOR_HEADERS && v->headers[count][0] != NULL) {
+        count++;
+    }
+    for (size_t i = 0; i < count; i++) {
+        const char *const *header = v->headers[reverse ? count - 1 - i : i];
+        headers[i].name = header[0];
+        headers[i].nameLength = strlen(header[0]);
+        headers[i].value = header[1];
+        headers[i].valueLength = strlen(header[1]);
+    }
+    return count;
+}
+
+static void check_vector(const sigv4_vector *v, const aws_hmac_sha256_ctx *key, int reverse, int templated) {
+    aws_sigv4_header headers[VECTOR_HEADERS];
+    aws_sigv4_header_template tmpl;
+    aws_sigv4_buf buf;
+    uint8_t storage[256], hash[AWS_SHA256_DIGEST_LENGTH];
+    char payloadHash[2 * AWS_SHA256_DIGEST_LENGTH], signature[AWS_SIGV4_SIGNATURE_LENGTH];
+    size_t signedOffset, signedLength;
+    size_t count = vector_headers(v, headers, reverse);
+
+    aws_sha256(v->body, strlen(v->body), hash);
+    aws_sigv4_hex_encode(hash, sizeof(hash), payloadHash);
+
+    // A small storage array, so the longer requests also exercise growing onto the heap
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    HARNESS_OK(aws_sigv4_canonical_request(&buf, v->method, strlen(v->method), v->path, strlen(v->path),
+                                           v->query, strlen(v->query), headers, count,
+                                           payloadHash, sizeof(payloadHash), &signedOffset, &signedLength));
+    HARNESS_BYTES(buf.data, buf.length, v->canonicalRequest, v->name);
+
+    aws_sha256(buf.data, buf.length, hash);
+    aws_sigv4_buf_reset(&buf);
+    HARNESS_OK(aws_sigv4_string_to_sign(&buf, AmzDate, strlen(AmzDate), Scope, strlen(Scope), hash));
+    HARNESS_BYTES(buf.data, buf.length, v->stringToSign, v->name);
+
+    if (templated) {
+        HARNESS_OK(aws_sigv4_header_template_init(&tmpl, headers, count));
+    }
+    aws_sigv4_buf_reset(&buf);
+    HARNESS_OK(aws_sigv4_sign_request(&buf, key, templated ? &tmpl : NULL, AmzDate, strlen(AmzDate), Scope, strlen(Scope),
+                                      v->method, strlen(v->method), v->path, strlen(v->path),
+                                      v->query, strlen(v->query), headers, count,
+                                      payloadHash, sizeof(payloadHash), signature, &signedOffset, &signedLength));
+    HARNESS_BYTES(signature, sizeof(signature), v->signature, v->name);
+    if (templated) {
+        aws_sigv4_header_template_free(&tmpl);
+    }
+
+    // Authorization: the signed headers list is the line before the payload hash
+    const char *signedHeadersEnd = strrchr(v->canonicalRequest, '\n');
+    const char *signedHeaders = signedHeadersEnd;
+    while (signedHeaders[-1] != '\n') {
+        signedHeaders--;
+    }
+    char want[512];
+    snprintf(want, sizeof(want), "AWS4-HMAC-SHA256 Credential=%s/%s, SignedHeaders=%.*s, Signature=%s",
+             AccessKey, Scope, (int)(signedHeadersEnd - signedHeaders), signedHeaders, v->signature);
+    char signedHeadersCopy[256];
+    memcpy(signedHeadersCopy, buf.data + signedOffset, signedLength);
+    aws_sigv4_buf_reset(&buf);
+    HARNESS_OK(aws_sigv4_append_authorization(&buf, AccessKey, strlen(AccessKey), Scope, strlen(Scope),
+                                              signedHeadersCopy, signedLength, signature));
+    HARNESS_BYTES(buf.data, buf.length, want, v->name);
+
+    aws_sigv4_buf_free(&buf);
+}
+
+static int check(void) {
+    aws_hmac_sha256_ctx key;
+
+    signing_key(&key);
+    for (size_t i = 0; i < sizeof(Vectors) / sizeof(Vectors[0]); i++) {
+        for (int variant = 0; variant < 4; variant++) {
+            check_vector(&Vectors[i], &key, variant & 1, variant >> 1);
+        }
+    }
+    return harness_done("sigv4");
+}
+
+// count headers in reverse canonical order, the worst case for the sort
+static void bench_headers(aws_sigv4_header *headers, char (*names)[32], size_t count) {
+    static const char *const common[] = { "X-Amz-Target", "X-Amz-Security-Token", "X-Amz-Date", "User-Agent",
+                                          "Host", "Content-Type", "Content-Length", "Accept-Encoding" };
+    for (size_t i = 0; i < count; i++) {
+        if (count <= 8) {
+            snprintf(names[i], 32, "%s", common[8 - count + i]);
+        } else {
+            snprintf(names[i], 32, "X-Amz-Meta-Field-%02d", (int)(count - i));
+        }
+        headers[i].name = names[i];
+        headers[i].nameLength = strlen(names[i]);
+        headers[i].value = "  some   header value ";
+        headers[i].valueLength = 22;
+    }
+}
+
+static int bench(void) {
+    static const size_t headerCounts[] = { 2, 8, 32 };
+    enum { Requests = 200000, Keys = 200000 };
+    aws_sigv4_header headers[32];
+    char names[32][32], signature[AWS_SIGV4_SIGNATURE_LENGTH];
+    uint8_t storage[4096], derived[AWS_SHA256_DIGEST_LENGTH];
+    aws_hmac_sha256_ctx key;
+    aws_sigv4_buf buf;
+    size_t signedOffset, signedLength;
+    double best, t;
+    const char *payloadHash = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+
+    signing_key(&key);
+    aws_sigv4_buf_init(&buf, storage, sizeof(storage));
+    printf("sigv4: signed requests per second\n");
+    printf("%8s %12s\n", "headers", "requests/s");
+    for (size_t h = 0; h < sizeof(headerCounts) / sizeof(headerCounts[0]); h++) {
+        bench_headers(headers, names, headerCounts[h]);
+        best = 0;
+        for (int run = 0; run < 3; run++) {
+            t = harness_now();
+            for (int i = 0; i < Requests; i++) {
+                aws_sigv4_buf_reset(&buf);
+                HARNESS_OK(aws_sigv4_sign_request(&buf, &key, NULL, AmzDate, strlen(AmzDate), Scope, strlen(Scope),
+                                                  "GET", 3, "/", 1, "Param2=value2&Param1=value1", 27,
+                                                  headers, headerCounts[h], payloadHash, 64,
+                                                  signature, &signedOffset, &signedLength));
+            }
+            t = Requests / (harness_now() - t);
+            best = (t > best) ? t : best;
+        }
+        printf("%8zu %12.0f\n", headerCounts[h], best);
+    }
+
+    best = 0;
+    for (int run = 0; run < 3; run++) {
+        t = harness_now();
+        for (int i = 0; i < Keys; i++) {
+            aws_sigv4_derive_key(SecretKey, strlen(SecretKey), "20150830", 8, "us-east-1", 9, "service", 7, derived);
+        }
+        t = Keys / (harness_now() - t);
+        best = (t > best) ? t : best;
+    }
+    printf("derive_key: %.0f keys/s\n", best);
+
+    aws_sigv4_buf_free(&buf);
+    return harness_failures != 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
@@ -0,0 +1,259 @@
+//
+// Copyright 2010-2017 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Percent-encoding in aws_uri.c against a byte-at-a-time reference.
+//
+// check  fixed vectors; every byte value; random paths and queries of 0-300
+//        bytes at every alignment, mostly unreserved so the 16-byte scan meets
+//        escapes at every position, for encode, aws_uri_unescaped_length and
+//        the round trip through aws_uri_decode; decoding of random and
+//        malformed escapes, in place and not
+// bench  MB/s of input for the reference and aws_uri_encode over keys with
+//        no escapes, a few escapes and mostly UTF-8
+
+#include "harness.h"
+#include "aws_uri.h"
+
+#define URI_MAX 300
+
+static const char *const ModeNames[2] = {"query", "path"};
+
+static int ref_unreserved(uint8_t c, aws_uri_encode_mode mode) {
+    return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9')
+        || c == '-' || c == '.' || c == '_' || c == '~' || (c == '/' && mode == AWS_URI_ENCODE_PATH);
+}
+
+static size_t ref_encode(char *out, const uint8_t *data, size_t length, aws_uri_encode_mode mode) {
+    char *start = out;
+    for (size_t i = 0; i < length; i++) {
+        if (ref_unreserved(data[i], mode)) {
+            *out++ = (char)data[i];
+        } else {
+            *out++ = '%';
+            *out++ = "0123456789ABCDEF"[data[i] >> 4];
+            *out++ = "0123456789ABCDEF"[data[i] & 15];
+        }
+    }
+    return (size_t)(out - start);
+}
+
+static size_t ref_unescaped_length(const uint8_t *data, size_t length, aws_uri_encode_mode mode) {
+    size_t i = 0;
+    while (i < length && ref_unreserved(data[i], mode)) {
+        i++;
+    }
+    return i;
+}
+
+static int ref_hex(uint8_t c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+static int ref_decode(uint8_t *out, size_t *outLength, const uint8_t *data, size_t length) {
+    size_t n = 0;
+    for (size_t i = 0; i < length; i++) {
+        if (data[i] != '%') {
+            out[n++] = data[i];
+            continue;
+        }
+        if (i + 2 >= length) {
+            return -1;
+        }
+        int hi = ref_hex(data[i + 1]), lo = ref_hex(data[i + 2]);
+        if (hi < 0 || lo < 0) {
+            return -1;
+        }
+        out[n++] = (uint8_t)(hi << 4 | lo);
+        i += 2;
+    }
+    *outLength = n;
+    return 0;
+}
+
+// Random bytes, mostly unreserved, with an escape at a random position now and then
+static void random_input(uint8_t *data, size_t length) {
+    static const char Unreserved[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-._~/";
+    unsigned kind = (unsigned)(harness_rand64() % 4);
+    for (size_t i = 0; i < length; i++) {
+        uint64_t r = harness_rand64();
+        if (kind == 0 || (kind != 3 && r % 64 != 0) || (kind == 3 && r % 4 != 0)) {
+            data[i] = (uint8_t)Unreserved[(r >> 8) % (sizeof(Unreserved) - 1)];
+        } else {
+            data[i] = (uint8_t)(r >> 16);
+        }
+    }
+}
+
+static void check_encode(const uint8_t *data, size_t length, aws_uri_encode_mode mode) {
+    static char want[3 * URI_MAX + 1], got[3 * URI_MAX + 16];
+    static uint8_t decoded[3 * URI_MAX];
+    size_t wantLength = ref_encode(want, data, length, mode);
+
+    memset(got, 0xa5, sizeof(got));
+    size_t gotLength = aws_uri_encode(got, data, length, mode);
+    HARNESS_EXPECT(gotLength == wantLength && memcmp(got, want, wantLength) == 0,
+                   "%s encode of %zu bytes:\n  got  \"%.*s\"\n  want \"%s\"",
+                   ModeNames[mode], length, (int)gotLength, got, want);
+    HARNESS_EXPECT((uint8_t)got[gotLength] == 0xa5, "%s encode of %zu bytes wrote past its result", ModeNames[mode], length);
+    HARNESS_EXPECT(aws_uri_unescaped_length(data, length, mode) == ref_unescaped_length(data, length, mode),
+                   "%s unescaped length of %zu bytes: %zu, want %zu", ModeNames[mode], length,
+                   aws_uri_unescaped_length(data, length, mode), ref_unescaped_length(data, length, mode));
+
+    size_t decodedLength = 0;
+    HARNESS_EXPECT(aws_uri_decode(decoded, &decodedLength, got, gotLength) == 0
+                   && decodedLength == length && memcmp(decoded, data, length) == 0,
+                   "%s round trip of %zu bytes", ModeNames[mode], length);
+}
+
+static void check_decode(const uint8_t *data, size_t length) {
+    static uint8_t want[URI_MAX], got[URI_MAX], inPlace[URI_MAX];
+    size_t wantLength = 0, gotLength = 0, inPlaceLength = 0;
+    int wantResult = ref_decode(want, &wantLength, data, length);
+    int gotResult = aws_uri_decode(got, &gotLength, data, length);
+
+    memcpy(inPlace, data, length);
+    int inPlaceResult = aws_uri_decode(inPlace, &inPlaceLength, inPlace, length);
+    HARNESS_EXPECT(gotResult == wantResult && inPlaceResult == wantResult,
+                   "decode of \"%.*s\" returned %d (in place %d), want %d",
+                   (int)length, (const char *)data, gotResult, inPlaceResult, wantResult);
+    if (wantResult == 0) {
+        HARNESS_EXPECT(gotLength == wantLength && memcmp(got, want, wantLength) == 0,
+                       "decode of \"%.*s\"", (int)length, (const char *)data);
+        HARNESS_EXPECT(inPlaceLength == wantLength && memcmp(inPlace, want, wantLength) == 0,
+                       "in-place decode of \"%.*s\"", (int)length, (const char *)data);
+    }
+}
+
+static int check(void) {
+    static const struct {
+        const char *input;
+        size_t length;
+        const char *query, *path;
+    } Vectors[] = {
+        {"", 0, "", ""},
+        {"photos/2006/February/sample.jpg", 31, "photos%2F2006%2FFebruary%2Fsample.jpg", "photos/2006/February/sample.jpg"},
+        {"a b+c=d&e", 9, "a%20b%2Bc%3Dd%26e", "a%20b%2Bc%3Dd%26e"},
+        {"-._~*'()!", 9, "-._~%2A%27%28%29%21", "-._~%2A%27%28%29%21"},
+        {"caf\xc3\xa9/\xe2\x82\xac", 9, "caf%C3%A9%2F%E2%82%AC", "caf%C3%A9/%E2%82%AC"},
+        {"key\0tail", 8, "key%00tail", "key%00tail"},
+        {"%2F already", 11, "%252F%20already", "%252F%20already"},
+    };
+    static uint8_t buffer[URI_MAX + 16];
+    char out[3 * URI_MAX];
+
+    for (size_t i = 0; i < sizeof(Vectors) / sizeof(Vectors[0]); i++) {
+        size_t length = aws_uri_encode(out, Vectors[i].input, Vectors[i].length, AWS_URI_ENCODE_QUERY);
+        HARNESS_BYTES(out, length, Vectors[i].query, "query vector");
+        length = aws_uri_encode(out, Vectors[i].input, Vectors[i].length, AWS_URI_ENCODE_PATH);
+        HARNESS_BYTES(out, length, Vectors[i].path, "path vector");
+    }
+
+    for (int mode = 0; mode < 2; mode++) {
+        for (int c = 0; c < 256; c++) {
+            // The byte alone, and at each position of two 16-byte blocks of unreserved bytes
+            buffer[0] = (uint8_t)c;
+            check_encode(buffer, 1, (aws_uri_encode_mode)mode);
+            for (size_t at = 0; at < 33; at++) {
+                memset(buffer, 'a', 33);
+                buffer[at] = (uint8_t)c;
+                check_encode(buffer, 33, (aws_uri_encode_mode)mode);
+            }
+        }
+    }
+
+    for (int round = 0; round < 20000; round++) {
+        size_t length = (size_t)(harness_rand64() % (URI_MAX + 1));
+        size_t align = (size_t)(harness_rand64() % 16);
+        random_input(buffer + align, length);
+        check_encode(buffer + align, length, (aws_uri_encode_mode)(round & 1));
+    }
+
+    // Decoding: text with '%' followed by anything, including too little at the end
+    static const char Alphabet[] = "%%%0123456789abcdefABCDEFgG+/ z";
+    for (int round = 0; round < 20000; round++) {
+        size_t length = (size_t)(harness_rand64() % 64);
+        for (size_t i = 0; i < length; i++) {
+            buffer[i] = (uint8_t)Alphabet[harness_rand64() % (sizeof(Alphabet) - 1)];
+        }
+        check_decode(buffer, length);
+    }
+    return harness_done("uri");
+}
+
+// MB/s of input over count strings of length bytes each
+static double encode_rate(size_t (*encode)(char *, const uint8_t *, size_t, aws_uri_encode_mode),
+                          const uint8_t *data, size_t length, size_t count, aws_uri_encode_mode mode) {
+    char *out = malloc(3 * length);
+    double best = 0;
+    size_t sink = 0;
+
+    for (int run = 0; run < 5; run++) {
+        double start = harness_now();
+        for (size_t i = 0; i < count; i++) {
+            sink += encode(out, data, length, mode);
+        }
+        double rate = (double)length * count / (harness_now() - start) / 1e6;
+        best = rate > best ? rate : best;
+    }
+    free(out);
+    return sink ? best : 0;
+}
+
+static size_t lib_encode(char *out, const uint8_t *data, size_t length, aws_uri_encode_mode mode) {
+    return aws_uri_encode(out, data, length, mode);
+}
+
+static int bench(void) {
+    static const struct {
+        const char *name;
+        int escapesPer64;                           // 64: all UTF-8
+    } Inputs[] = {
+        {"no escapes", 0},
+        {"1 escape / 64 bytes", 1},
+        {"UTF-8", 64},
+    };
+    static const size_t Lengths[] = {16, 64, 1024};
+    uint8_t data[1024];
+
+    printf("uri: MB/s of input, path mode\n");
+    printf("%-22s %6s %12s %12s %8s\n", "input", "bytes", "reference", "aws_uri", "speedup");
+    for (size_t i = 0; i < sizeof(Inputs) / sizeof(Inputs[0]); i++) {
+        for (size_t j = 0; j < sizeof(Lengths) / sizeof(Lengths[0]); j++) {
+            size_t length = Lengths[j];
+            for (size_t k = 0; k < length; k++) {
+                int escape = Inputs[i].escapesPer64 == 64 || (Inputs[i].escapesPer64 && k % 64 == 7);
+                data[k] = escape ? (uint8_t)(0x80 | (k & 0x3f)) : (uint8_t)("abcdefghijklmnopqrstuvwxyz0123456789/"[k % 37]);
+            }
+            size_t count = (64u << 20) / length;
+            double reference = encode_rate(ref_encode, data, length, count / 8, AWS_URI_ENCODE_PATH);
+            double library = encode_rate(lib_encode, data, length, count, AWS_URI_ENCODE_PATH);
+            printf("%-22s %6zu %12.0f %12.0f %7.2fx\n", Inputs[i].name, length, reference, library, library / reference);
+        }
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    if (argc == 2 && strcmp(argv[1], "check") == 0) {
+        return check();
+    }
+    if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+        return bench();
+    }
+    return harness_usage(argv[0]);
+}
@@ -0,0 +1,144 @@
+//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Batch salt and verifier generation in AWSCognitoIdentityProviderSrpHelper.
+//
+// check  every helper from helpersWithPoolName:userNames:passwords: has a fresh
+//        salt and v = g^x mod N, recomputed here with the generic aws_mp_exptmod
+// bench  verifiers per second, one helper at a time vs the batch
+
+#import <Foundation/Foundation.h>
+
+#import "AWSCognitoIdentityProviderSrpHelper.h"
+#import "AWSJKBigInteger.h"
+
+static NSString *const PoolName = @"us-east-1_Example";
+
+static NSArray<NSString *> *Strings(NSString *prefix, NSUInteger count) {
+    NSMutableArray<NSString *> *strings = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [strings addObject:[NSString stringWithFormat:@"%@-%lu", prefix, (unsigned long)i]];
+    }
+    return strings;
+}
+
+// v recomputed from the helper's salt without the shared Montgomery context or comb table
+static BOOL VerifierMatches(AWSCognitoIdentityProviderSrpHelper *helper, NSString *userName, NSString *password) {
+    AWSJKBigInteger *x = [AWSCognitoIdentityProviderSrpHelper calculateX:PoolName
+                                                                userName:userName
+                                                                password:password
+                                                                    salt:helper.salt];
+    aws_mp_int v;
+    if (aws_mp_init(&v) != AWS_MP_OKAY) {
+        return NO;
+    }
+    BOOL matches = (aws_mp_exptmod([helper.commonState.g value], [x value], [helper.commonState.N value], &v) == AWS_MP_OKAY
+                    && aws_mp_cmp(&v, [helper.v value]) == AWS_MP_EQ);
+    aws_mp_clear(&v);
+    return matches;
+}
+
+static int Check(void) {
+    int failures = 0;
+    for (NSNumber *size in @[@0, @1, @2, @7, @64, @257]) {
+        NSUInteger count = size.unsignedIntegerValue;
+        NSArray<NSString *> *userNames = Strings(@"user", count);
+        NSArray<NSString *> *passwords = Strings(@"password", count);
+
+        NSArray<AWSCognitoIdentityProviderSrpHelper *> *helpers = [AWSCognitoIdentityProviderSrpHelper helpersWithPoolName:PoolName
+                                                                                                                 userNames:userNames
+                                                                                                                 passwords:passwords];
+        if (helpers.count != count) {
+            fprintf(stderr, "FAIL: %lu helpers for %lu users\n", (unsigned long)helpers.count, (unsigned long)count);
+            failures++;
+            continue;
+        }
+
+        NSMutableSet<NSString *> *salts = [NSMutableSet setWithCapacity:count];
+        for (NSUInteger i = 0; i < count; i++) {
+            AWSCognitoIdentityProviderSrpHelper *helper = helpers[i];
+            if (![helper isKindOfClass:[AWSCognitoIdentityProviderSrpHelper class]] || helper.salt == nil || helper.v == nil) {
+                fprintf(stderr, "FAIL: helper %lu of %lu is incomplete\n", (unsigned long)i, (unsigned long)count);
+                failures++;
+                continue;
+            }
+            [salts addObject:[helper.salt stringValueWithRadix:16]];
+            if (!VerifierMatches(helper, userNames[i], passwords[i])) {
+                fprintf(stderr, "FAIL: verifier %lu of %lu is not g^x mod N for its user\n", (unsigned long)i, (unsigned long)count);
+                failures++;
+            }
+        }
+        if (salts.count != count) {
+            fprintf(stderr, "FAIL: %lu distinct salts for %lu users\n", (unsigned long)salts.count, (unsigned long)count);
+            failures++;
+        }
+    }
+
+    if ([AWSCognitoIdentityProviderSrpHelper helpersWithPoolName:PoolName userNames:@[@"a"] passwords:@[]] != nil) {
+        fprintf(stderr, "FAIL: mismatched arrays were accepted\n");
+        failures++;
+    }
+
+    if (failures != 0) {
+        fprintf(stderr, "srp_batch: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("srp_batch: ok\n");
+    return 0;
+}
+
+static int Bench(void) {
+    NSUInteger cores = [NSProcessInfo processInfo].activeProcessorCount;
+    printf("srp_batch: %lu cores, verifiers per second\n", (unsigned long)cores);
+    printf("%6s %12s %12s %8s\n", "users", "one by one", "batch", "speedup");
+
+    for (NSNumber *size in @[@1, @16, @64, @256]) {
+        NSUInteger count = size.unsignedIntegerValue;
+        NSArray<NSString *> *userNames = Strings(@"user", count);
+        NSArray<NSString *> *passwords = Strings(@"password", count);
+        double serial = 0, batch = 0;
+
+        for (int run = 0; run < 3; run++) {
+            @autoreleasepool {
+                NSDate *start = [NSDate date];
+                for (NSUInteger i = 0; i < count; i++) {
+                    (void)[[AWSCognitoIdentityProviderSrpHelper alloc] initWithPoolName:PoolName userName:userNames[i] password:passwords[i]];
+                }
+                double rate = count / -[start timeIntervalSinceNow];
+                serial = MAX(serial, rate);
+
+                start = [NSDate date];
+                (void)[AWSCognitoIdentityProviderSrpHelper helpersWithPoolName:PoolName userNames:userNames passwords:passwords];
+                rate = count / -[start timeIntervalSinceNow];
+                batch = MAX(batch, rate);
+            }
+        }
+        printf("%6lu %12.0f %12.0f %7.2fx\n", (unsigned long)count, serial, batch, batch / serial);
+    }
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        if (argc == 2 && strcmp(argv[1], "check") == 0) {
+            return Check();
+        }
+        if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+            return Bench();
+        }
+        fprintf(stderr, "usage: %s check|bench\n", argv[0]);
+        return 2;
+    }
+}
@@ -0,0 +1,12 @@
+//
+// Stand-in for AWSCore's logger so the serializers build on their own; found
+// first on the include path. Errors go to stderr.
+//
+
+#import <Foundation/Foundation.h>
+
+#define AWSDDLogError(frmt, ...)   NSLog((frmt), ##__VA_ARGS__)
+#define AWSDDLogWarn(frmt, ...)    NSLog((frmt), ##__VA_ARGS__)
+#define AWSDDLogInfo(frmt, ...)    do {} while (0)
+#define AWSDDLogDebug(frmt, ...)   do {} while (0)
+#define AWSDDLogVerbose(frmt, ...) do {} while (0)
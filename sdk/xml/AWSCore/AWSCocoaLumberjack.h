@@ -0,0 +1,5 @@
+//
+// AWSS3Resources imports the logger as <AWSCore/AWSCocoaLumberjack.h>.
+//
+
+#import "../AWSCocoaLumberjack.h"
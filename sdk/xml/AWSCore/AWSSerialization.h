@@ -0,0 +1,5 @@
+//
+// AWSS3Resources imports the serializers as <AWSCore/AWSSerialization.h>.
+//
+
+#import "../../../Pods/AWSCore/AWSCore/Serialization/AWSSerialization.h"
@@ -0,0 +1,243 @@
+//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// AWSXMLResponseDecoder (AWSXMLParser's opt-in one-pass path) against the
+// AWSXMLDictionary tree walk, on recorded responses.
+//
+// check  both paths decode every response to the same dictionary; the decoder
+//        handles the list and map responses itself and leaves error responses
+//        to the tree; the decoder is off by default
+// bench  parse time per response for each path, and the memory high-water
+//        mark of a child process that parses the response once, less that of
+//        one that only builds it
+
+#import <Foundation/Foundation.h>
+#import <spawn.h>
+#import <sys/resource.h>
+#import <sys/wait.h>
+
+#import "AWSSerialization.h"
+#import "responses.h"
+
+extern char **environ;
+
+// Private to AWSSerialization.m; called directly to tell which path decoded a response.
+@interface AWSXMLResponseDecoder : NSObject
+
+- (instancetype)initWithActionName:(NSString *)actionName
+                        actionRule:(NSDictionary *)actionRule
+                   definitionRules:(NSDictionary *)definitionRules
+             serviceDefinitionRule:(NSDictionary *)serviceDefinitionRule;
+- (NSMutableDictionary *)dictionaryForXMLData:(NSData *)data;
+
+@end
+
+typedef AWSRecordedResponse *(^AWSRecording)(void);
+
+static NSArray<AWSRecording> *Recordings(void) {
+    return @[^{ return [AWSRecordedResponse listObjectsV2WithCount:1000]; },
+             ^{ return [AWSRecordedResponse listObjectsV2WithCount:1]; },
+             ^{ return [AWSRecordedResponse listPartsWithCount:1000]; },
+             ^{ return [AWSRecordedResponse listPartsWithCount:1]; },
+             ^{ return [AWSRecordedResponse assumeRole]; },
+             ^{ return [AWSRecordedResponse assumeRoleWithWebIdentity]; },
+             ^{ return [AWSRecordedResponse getQueueAttributesWithCount:20]; },
+             ^{ return [AWSRecordedResponse getTopicAttributesWithCount:20]; },
+             ^{ return [AWSRecordedResponse noSuchKey]; },
+             ^{ return [AWSRecordedResponse accessDenied]; }];
+}
+
+static BOOL IsError(AWSRecordedResponse *response) {
+    return [response.name hasSuffix:@"NoSuchKey"] || [response.name hasSuffix:@"AccessDenied"];
+}
+
+static AWSXMLParser *Parser(BOOL usesOnePassDecoder) {
+    AWSXMLParser *parser = [AWSXMLParser new];
+    parser.usesOnePassDecoder = usesOnePassDecoder;
+    return parser;
+}
+
+static NSMutableDictionary *Parse(AWSXMLParser *parser, AWSRecordedResponse *response, NSError **error) {
+    NSError *parseError = nil;
+    NSMutableDictionary *result = [parser dictionaryForXMLData:response.data
+                                                    actionName:response.actionName
+                                         serviceDefinitionRule:response.serviceDefinitionRule
+                                                         error:&parseError];
+    if (error) {
+        *error = parseError;
+    }
+    return result;
+}
+
+// What AWSXMLParser tries first when usesOnePassDecoder is set; nil if it falls back to the tree.
+static NSMutableDictionary *Decode(AWSRecordedResponse *response) {
+    NSDictionary *model = response.serviceDefinitionRule;
+    NSDictionary *actionRule = model[@"operations"][response.actionName][@"output"];
+    if (actionRule == (id)[NSNull null]) {
+        actionRule = @{};
+    }
+    AWSXMLResponseDecoder *decoder = [[AWSXMLResponseDecoder alloc] initWithActionName:response.actionName
+                                                                            actionRule:actionRule
+                                                                       definitionRules:model[@"shapes"]
+                                                                 serviceDefinitionRule:model];
+    return [decoder dictionaryForXMLData:response.data];
+}
+
+static int Check(void) {
+    AWSXMLParser *tree = Parser(NO);
+    AWSXMLParser *onePass = Parser(YES);
+    int failures = 0;
+
+    if ([AWSXMLParser sharedInstance].usesOnePassDecoder || [AWSXMLParser new].usesOnePassDecoder) {
+        fprintf(stderr, "FAIL usesOnePassDecoder is on by default\n");
+        failures++;
+    }
+
+    for (AWSRecording recording in Recordings()) {
+        @autoreleasepool {
+            AWSRecordedResponse *response = recording();
+            NSError *treeError = nil;
+            NSError *onePassError = nil;
+            NSDictionary *expected = Parse(tree, response, &treeError);
+            NSDictionary *actual = Parse(onePass, response, &onePassError);
+            NSDictionary *decoded = Decode(response);
+            const char *name = response.name.UTF8String;
+
+            if (!expected || treeError) {
+                fprintf(stderr, "FAIL %s: tree walk failed: %s\n", name, treeError.description.UTF8String);
+                failures++;
+                continue;
+            }
+            if (onePassError || ![actual isEqualToDictionary:expected]) {
+                fprintf(stderr, "FAIL %s: AWSXMLParser differs with usesOnePassDecoder\n  tree: %s\n  one pass: %s\n",
+                        name, expected.description.UTF8String, actual.description.UTF8String);
+                failures++;
+            }
+            if (IsError(response) ? decoded != nil : ![decoded isEqualToDictionary:expected]) {
+                fprintf(stderr, "FAIL %s: decoder %s\n", name,
+                        decoded ? (IsError(response) ? "decoded an error response" : "differs from the tree walk")
+                                : "fell back to the tree");
+                failures++;
+            }
+        }
+    }
+
+    NSDictionary *objects = Parse(tree, [AWSRecordedResponse listObjectsV2WithCount:1000], NULL);
+    NSDictionary *parts = Parse(tree, [AWSRecordedResponse listPartsWithCount:1000], NULL);
+    if ([objects[@"Contents"] count] != 1000 || [parts[@"Parts"] count] != 1000) {
+        fprintf(stderr, "FAIL lists: %lu contents, %lu parts\n",
+                (unsigned long)[objects[@"Contents"] count], (unsigned long)[parts[@"Parts"] count]);
+        failures++;
+    }
+
+    if (failures) {
+        fprintf(stderr, "decoder_check: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("decoder_check: ok\n");
+    return 0;
+}
+
+// Child process for the high-water mark: builds one response and parses it once with the given path.
+static int Peak(const char *path, const char *index) {
+    NSArray<AWSRecording> *recordings = Recordings();
+    NSUInteger i = (NSUInteger)strtoul(index, NULL, 10);
+    if (i >= recordings.count) {
+        return 2;
+    }
+    AWSRecordedResponse *response = recordings[i]();
+    if (strcmp(path, "tree") == 0 || strcmp(path, "decoder") == 0) {
+        @autoreleasepool {
+            (void)Parse(Parser(strcmp(path, "decoder") == 0), response, NULL);
+        }
+    }
+    return 0;
+}
+
+// ru_maxrss of a child running Peak, in KiB; macOS reports it in bytes.
+static double ChildMaxRSS(const char *path, NSUInteger index) {
+    NSString *executable = [NSProcessInfo processInfo].arguments[0];
+    char indexString[32];
+    snprintf(indexString, sizeof(indexString), "%lu", (unsigned long)index);
+    char *argv[] = {(char *)executable.fileSystemRepresentation, "peak", (char *)path, indexString, NULL};
+
+    pid_t pid;
+    if (posix_spawn(&pid, argv[0], NULL, NULL, argv, environ) != 0) {
+        return -1;
+    }
+    int status;
+    struct rusage usage;
+    if (wait4(pid, &status, 0, &usage) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+        return -1;
+    }
+    return usage.ru_maxrss / 1024.0;
+}
+
+static double MicrosecondsPerParse(AWSXMLParser *parser, AWSRecordedResponse *response) {
+    NSUInteger iterations = MAX(1, (NSUInteger)(4 * 1024 * 1024 / response.data.length));
+    double best = 0;
+    for (int run = 0; run < 5; run++) {
+        @autoreleasepool {
+            NSDate *start = [NSDate date];
+            for (NSUInteger i = 0; i < iterations; i++) {
+                @autoreleasepool {
+                    (void)Parse(parser, response, NULL);
+                }
+            }
+            double elapsed = -[start timeIntervalSinceNow] / iterations;
+            best = run == 0 ? elapsed : MIN(best, elapsed);
+        }
+    }
+    return best * 1e6;
+}
+
+static int Bench(void) {
+    AWSXMLParser *tree = Parser(NO);
+    AWSXMLParser *onePass = Parser(YES);
+    NSArray<AWSRecording> *recordings = Recordings();
+
+    printf("decoder_check: parse time and memory high-water mark above building the response\n");
+    printf("%-24s %8s %10s %10s %8s %10s %10s\n", "response", "bytes", "tree us", "1-pass us", "speedup", "tree KiB", "1-pass KiB");
+    for (NSUInteger i = 0; i < recordings.count; i++) {
+        @autoreleasepool {
+            AWSRecordedResponse *response = recordings[i]();
+            double treeTime = MicrosecondsPerParse(tree, response);
+            double onePassTime = MicrosecondsPerParse(onePass, response);
+            double base = ChildMaxRSS("none", i);
+            double treePeak = ChildMaxRSS("tree", i) - base;
+            double onePassPeak = ChildMaxRSS("decoder", i) - base;
+            printf("%-24s %8lu %10.1f %10.1f %7.2fx %10.0f %10.0f%s\n", response.name.UTF8String,
+                   (unsigned long)response.data.length, treeTime, onePassTime, treeTime / onePassTime,
+                   treePeak, onePassPeak, Decode(response) ? "" : "  (falls back to the tree)");
+        }
+    }
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        if (argc == 2 && strcmp(argv[1], "check") == 0) {
+            return Check();
+        }
+        if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+            return Bench();
+        }
+        if (argc == 4 && strcmp(argv[1], "peak") == 0) {
+            return Peak(argv[2], argv[3]);
+        }
+        fprintf(stderr, "usage: %s check|bench\n", argv[0]);
+        return 2;
+    }
+}
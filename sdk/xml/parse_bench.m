@@ -0,0 +1,160 @@
+//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Concurrent XML response parsing in AWSXMLParser.
+//
+// check  every response parsed from many threads at once decodes to the same
+//        dictionary as a parse on one thread
+// bench  responses per second over the recorded corpus from 1 to 2 x cores
+//        threads, each parse behind one lock (the old @synchronized path) vs
+//        parses running concurrently
+
+#import <Foundation/Foundation.h>
+
+#import "AWSSerialization.h"
+#import "responses.h"
+
+static NSArray<AWSRecordedResponse *> *Corpus(void) {
+    return @[[AWSRecordedResponse listObjectsV2WithCount:1000],
+             [AWSRecordedResponse listObjectsV2WithCount:10],
+             [AWSRecordedResponse listPartsWithCount:1000],
+             [AWSRecordedResponse assumeRole]];
+}
+
+static NSMutableDictionary *Parse(AWSRecordedResponse *response, NSError **error) {
+    NSError *parseError = nil;
+    NSMutableDictionary *result = [[AWSXMLParser sharedInstance] dictionaryForXMLData:response.data
+                                                                           actionName:response.actionName
+                                                                serviceDefinitionRule:response.serviceDefinitionRule
+                                                                                error:&parseError];
+    if (error) {
+        *error = parseError;
+    }
+    return result;
+}
+
+static int Check(void) {
+    NSArray<AWSRecordedResponse *> *corpus = Corpus();
+    NSMutableArray<NSDictionary *> *expected = [NSMutableArray arrayWithCapacity:corpus.count];
+    int failures = 0;
+
+    for (AWSRecordedResponse *response in corpus) {
+        NSError *error = nil;
+        NSDictionary *result = Parse(response, &error);
+        if (!result || error) {
+            fprintf(stderr, "FAIL %s: %s\n", response.name.UTF8String, error.description.UTF8String);
+            return 1;
+        }
+        [expected addObject:result];
+    }
+    if ([expected[0][@"Contents"] count] != 1000 || [expected[2][@"Parts"] count] != 1000) {
+        fprintf(stderr, "FAIL lists: %lu contents, %lu parts\n",
+                (unsigned long)[expected[0][@"Contents"] count], (unsigned long)[expected[2][@"Parts"] count]);
+        failures++;
+    }
+
+    __block int32_t mismatches = 0;
+    dispatch_apply(64 * corpus.count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), ^(size_t i) {
+        @autoreleasepool {
+            AWSRecordedResponse *response = corpus[i % corpus.count];
+            NSError *error = nil;
+            NSDictionary *result = Parse(response, &error);
+            if (error || ![result isEqualToDictionary:expected[i % corpus.count]]) {
+                if (__sync_fetch_and_add(&mismatches, 1) == 0) {
+                    fprintf(stderr, "FAIL concurrent %s: %s\n", response.name.UTF8String, error.description.UTF8String);
+                }
+            }
+        }
+    });
+    failures += mismatches;
+
+    if (failures) {
+        fprintf(stderr, "parse_bench: %d failure(s)\n", failures);
+        return 1;
+    }
+    printf("parse_bench: ok\n");
+    return 0;
+}
+
+// Responses per second with threads parsing the corpus round after round.
+static double Rate(NSArray<AWSRecordedResponse *> *corpus, NSUInteger threads, NSUInteger rounds, BOOL serialized) {
+    NSObject *lock = [NSObject new];
+    NSDate *start = [NSDate date];
+    dispatch_group_t group = dispatch_group_create();
+    for (NSUInteger t = 0; t < threads; t++) {
+        dispatch_group_enter(group);
+        [NSThread detachNewThreadWithBlock:^{
+            for (NSUInteger round = 0; round < rounds; round++) {
+                for (AWSRecordedResponse *response in corpus) {
+                    @autoreleasepool {
+                        if (serialized) {
+                            @synchronized (lock) {
+                                (void)Parse(response, NULL);
+                            }
+                        } else {
+                            (void)Parse(response, NULL);
+                        }
+                    }
+                }
+            }
+            dispatch_group_leave(group);
+        }];
+    }
+    dispatch_group_wait(group, DISPATCH_TIME_FOREVER);
+    return threads * rounds * corpus.count / -[start timeIntervalSinceNow];
+}
+
+static int Bench(void) {
+    NSArray<AWSRecordedResponse *> *corpus = Corpus();
+    NSUInteger cores = [NSProcessInfo processInfo].activeProcessorCount;
+    NSUInteger rounds = 20;
+
+    printf("parse_bench: %lu cores\n", (unsigned long)cores);
+    printf("%-20s %10s %10s\n", "response", "bytes", "us/parse");
+    for (AWSRecordedResponse *response in corpus) {
+        double best = 0;
+        for (int run = 0; run < 5; run++) {
+            @autoreleasepool {
+                NSDate *start = [NSDate date];
+                (void)Parse(response, NULL);
+                double elapsed = -[start timeIntervalSinceNow];
+                best = run == 0 ? elapsed : MIN(best, elapsed);
+            }
+        }
+        printf("%-20s %10lu %10.1f\n", response.name.UTF8String, (unsigned long)response.data.length, best * 1e6);
+    }
+
+    printf("\nresponses per second, whole corpus\n");
+    printf("%8s %12s %12s %8s\n", "threads", "one lock", "concurrent", "speedup");
+    for (NSUInteger threads = 1; threads <= 2 * cores; threads *= 2) {
+        double serialized = Rate(corpus, threads, rounds, YES);
+        double concurrent = Rate(corpus, threads, rounds, NO);
+        printf("%8lu %12.0f %12.0f %7.2fx\n", (unsigned long)threads, serialized, concurrent, concurrent / serialized);
+    }
+    return 0;
+}
+
+int main(int argc, const char *argv[]) {
+    @autoreleasepool {
+        if (argc == 2 && strcmp(argv[1], "check") == 0) {
+            return Check();
+        }
+        if (argc == 2 && strcmp(argv[1], "bench") == 0) {
+            return Bench();
+        }
+        fprintf(stderr, "usage: %s check|bench\n", argv[0]);
+        return 2;
+    }
+}
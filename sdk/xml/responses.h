@@ -0,0 +1,39 @@
+//
+// Copyright 2010-2018 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License").
+// You may not use this file except in compliance with the License.
+// A copy of the License is located at
+//
+// http://aws.amazon.com/apache2.0
+//
+// or in the "license" file accompanying this file. This file is distributed
+// on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied. See the License for the specific language governing
+// permissions and limitations under the License.
+//
+
+// Recorded S3, STS, SQS and SNS responses, laid out as the services send them,
+// with the repeated entries generated to the requested count. S3 and STS use
+// their checked-in models; SQS and SNS use excerpts of theirs, for the two map
+// layouts.
+
+#import <Foundation/Foundation.h>
+
+@interface AWSRecordedResponse : NSObject
+
+@property (nonatomic, strong, readonly) NSString *name;
+@property (nonatomic, strong, readonly) NSString *actionName;
+@property (nonatomic, strong, readonly) NSDictionary *serviceDefinitionRule;
+@property (nonatomic, strong, readonly) NSData *data;
+
++ (instancetype)listObjectsV2WithCount:(NSUInteger)count;
++ (instancetype)listPartsWithCount:(NSUInteger)count;
++ (instancetype)assumeRole;
++ (instancetype)assumeRoleWithWebIdentity;
++ (instancetype)getQueueAttributesWithCount:(NSUInteger)count;
++ (instancetype)getTopicAttributesWithCount:(NSUInteger)count;
++ (instancetype)noSuchKey;
++ (instancetype)accessDenied;
+
+@end